@@ -0,0 +1,1161 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "bench.h"
+#include "strutils.h"
+#include "strvec.h"
+#include "strcase.h"
+#include "strchunk.h"
+#include "strcodec.h"
+#include "strconv.h"
+#include "strcsv.h"
+#include "strdiff.h"
+#include "strdist.h"
+#include "strglob.h"
+#include "strindex.h"
+#include "strlines.h"
+#include "strnorm.h"
+#include "strsearch.h"
+#include "strtemplate.h"
+#include "strload.h"
+#include "strwrite.h"
+#include "utf8.h"
+
+// Needle planted into every corpus at regular intervals
+#define NEEDLE "needle"
+#define NEEDLE_EVERY 4096
+
+/* * * * * * * Corpora * * * * * * */
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+static const char *WORDS[] = {
+    "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing",
+    "elit", "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore",
+    "et", "dolore", "magna", "aliqua", "enim", "ad", "minim", "veniam",
+};
+
+static const char *UTF8_WORDS[] = {
+    "привет", "мир", "строка", "日本語", "文字列", "検索", "😀", "🚀",
+    "naïve", "café", "Ελληνικά", "עברית", "한국어", "abc",
+};
+
+static const char *LEVELS[] = { "INFO", "INFO", "INFO", "DEBUG", "WARN", "ERROR" };
+
+#define ARRAY_LEN(a) (sizeof(a) / sizeof(*(a)))
+
+// Appends words separated by spaces and occasional newlines until `size` is exceeded
+static void gen_words(String *s, const char **words, size_t nwords, size_t size) {
+    while (s->len <= size) {
+        str_pushs(str_ref(words[rng() % nwords]), s);
+        str_push(rng() % 12 ? ' ' : '\n', s);
+    }
+}
+
+static void gen_log(String *s, size_t size) {
+    while (s->len <= size) {
+        uint32_t r = rng();
+        str_pushf(s,
+            "2026-10-18T08:%02u:%02u.%03uZ %-5s [worker-%u] request id=%08x "
+            "status=%u latency_ms=%u.%u path=/api/v1/%s\n",
+            r % 60, (r >> 6) % 60, (r >> 12) % 1000,
+            LEVELS[rng() % ARRAY_LEN(LEVELS)], rng() % 32, rng(),
+            rng() % 5 ? 200 : 500, rng() % 200, rng() % 10,
+            WORDS[rng() % ARRAY_LEN(WORDS)]);
+    }
+}
+
+// Generates a corpus of exactly `size` bytes with NEEDLE planted every NEEDLE_EVERY bytes
+static String gen_corpus(const char *kind, size_t size) {
+    String s = str_alloc("");
+
+    if (!strcmp(kind, "ascii"))
+        gen_words(&s, WORDS, ARRAY_LEN(WORDS), size);
+    else if (!strcmp(kind, "utf8"))
+        gen_words(&s, UTF8_WORDS, ARRAY_LEN(UTF8_WORDS), size);
+    else
+        gen_log(&s, size);
+
+    // Cut at a character boundary
+    s.len = size;
+    while (s.len && (s.str[s.len] & 0xC0) == 0x80) s.len--;
+
+    for (size_t i = NEEDLE_EVERY / 2; i + sizeof(NEEDLE) < s.len; i += NEEDLE_EVERY) {
+        while (i && (s.str[i] & 0xC0) == 0x80) i++;
+        memcpy(s.str + i, NEEDLE, sizeof(NEEDLE) - 1);
+
+        // Don't leave orphaned continuation bytes behind the needle
+        for (size_t j = i + sizeof(NEEDLE) - 1; (s.str[j] & 0xC0) == 0x80; j++)
+            s.str[j] = ' ';
+    }
+
+    return s;
+}
+
+/* * * * * * * Benchmarks * * * * * * */
+
+#define CHURN_THREADS 4
+#define CHURN_LIVE    8
+
+// Copies the corpus into strings of 64 B to 2 KiB, keeping a few of them alive
+// at a time, as a worker thread building and dropping short strings would
+static void *alloc_churn(void *arg) {
+    String text = *(String *)arg;
+    String live[CHURN_LIVE];
+    size_t count = 0;
+
+    for (size_t i = 0; i < text.len; count++) {
+        size_t len = 64 + (i * 7) % 2000;
+        if (len > text.len - i) len = text.len - i;
+
+        if (count >= CHURN_LIVE) str_free(&live[count % CHURN_LIVE]);
+        live[count % CHURN_LIVE] = str_nalloc(text.str + i, len);
+        i += len;
+    }
+
+    for (size_t k = 0; k < count && k < CHURN_LIVE; k++) str_free(&live[k]);
+    return NULL;
+}
+
+static void alloc_churn_threads(String text) {
+    pthread_t threads[CHURN_THREADS];
+    for (size_t t = 0; t < CHURN_THREADS; t++)
+        pthread_create(&threads[t], NULL, alloc_churn, &text);
+    for (size_t t = 0; t < CHURN_THREADS; t++)
+        pthread_join(threads[t], NULL);
+}
+
+static void bench_strutils(const char *corpus, String text) {
+    size_t n = text.len;
+    String needle = str_ref(NEEDLE);
+    String tail = str_slice_ref(text, n - 64, 64);
+
+    // Creation
+
+    bench("str_nref", corpus, n, n, , , {
+        String s = str_nref(text.str, text.len);
+        bench_keep(s);
+    });
+
+    char *ctext = cstr(text);
+    ctext[n] = '\0';
+
+    bench("str_ref", corpus, n, n, , , {
+        String s = str_ref(ctext);
+        bench_keep(s);
+    });
+
+    bench("str_nalloc+str_free", corpus, n, n, , , {
+        String s = str_nalloc(text.str, text.len);
+        str_free(&s);
+    });
+
+    bench("str_alloc+str_free", corpus, n, n, , , {
+        String s = str_alloc(ctext);
+        str_free(&s);
+    });
+
+    bench("str_clone+str_free", corpus, n, n, , , {
+        String s = str_clone(text);
+        str_free(&s);
+    });
+
+    String shared = str_clone(text);
+    str_make_shared(&shared);
+
+    bench("str_clone+str_free (shared)", corpus, n, n, , , {
+        String s = str_clone(shared);
+        str_free(&s);
+    });
+
+    str_free(&shared);
+
+    // Concurrent allocations, with and without the per-thread buffer caches
+    for (int cached = 1; cached >= 0; cached--) {
+        str_cache_enable(cached);
+        bench(cached ? "str_nalloc+str_free (4 threads)" : "str_nalloc+str_free (4 threads, no cache)",
+              corpus, n, n * CHURN_THREADS, , , {
+            alloc_churn_threads(text);
+        });
+    }
+    str_cache_enable(true);
+
+    // Input/Output
+
+    FILE *f = tmpfile();
+    fwrite(text.str, 1, text.len, f);
+
+    bench("fread_str", corpus, n, n, , , {
+        String s = fread_str(f);
+        str_free(&s);
+    });
+
+    fclose(f);
+
+    FILE *devnull = fopen("/dev/null", "w");
+
+    bench("str_fdebug", corpus, n, n, , , {
+        str_fdebug(devnull, text);
+    });
+
+    fclose(devnull);
+
+    bench("str_fmt", corpus, n, n, , , {
+        String s = str_fmt("%.*s", (int)text.len, text.str);
+        str_free(&s);
+    });
+
+    bench("str_pushf", corpus, n, 64, String s = str_alloc(""), str_free(&s), {
+        s.len = 0;
+        str_pushf(&s, "%d:%s:%.*s", (int)bench_i, "x", STR_FMT_ARGS(tail));
+    });
+
+    bench("cstr", corpus, n, n, , , {
+        char *c = cstr(text);
+        free(c);
+    });
+
+    // Transformation
+
+    bench("str_slice_ref", corpus, n, 64, , , {
+        String s = str_slice_ref(text, bench_i % (n - 64), 64);
+        bench_keep(s);
+    });
+
+    bench("str_slice", corpus, n, 64, , , {
+        String s = str_slice(text, bench_i % (n - 64), 64);
+        str_free(&s);
+    });
+
+    String padded = str_alloc("  \t ");
+    str_pushs(text, &padded);
+    str_pushs(str_ref(" \n  "), &padded);
+
+    bench("str_strip", corpus, n, 8, , , {
+        String s = str_strip(" \t\n", padded, STR_STRIP_LEFT | STR_STRIP_RIGHT, NULL);
+        bench_keep(s);
+    });
+
+    str_free(&padded);
+
+    bench("str_split", corpus, n, n, , , {
+        String line = {0};
+        size_t k = 0;
+        while (str_split(text, str_ref("\n"), &line)) k++;
+        bench_keep(k);
+    });
+
+    bench("str_escape", corpus, n, n, , , {
+        String s = str_escape(text);
+        str_free(&s);
+    });
+
+    bench("str_unescape", corpus, n, n, , , {
+        String s = str_unescape(text);
+        bench_keep(s);
+    });
+
+    // Mutation
+
+    bench("str_push", corpus, n, 1, String s = str_alloc(""), str_free(&s), {
+        str_push('x', &s);
+    });
+
+    bench("str_pushs", corpus, n, 64, String s = str_alloc(""), str_free(&s), {
+        str_pushs(tail, &s);
+    });
+
+    bench("str_pop", corpus, n, 1, String s = str_alloc(""), str_free(&s), {
+        char c;
+        str_push('x', &s);
+        str_pop(&s, &c);
+        bench_keep(c);
+    });
+
+    bench("str_popn", corpus, n, 64, String s = str_clone(text), str_free(&s), {
+        String out;
+        str_pushs(tail, &s);
+        str_popn(&s, 64, &out);
+        str_free(&out);
+    });
+
+    bench("str_insert", corpus, n, n, String s = str_clone(text), str_free(&s), {
+        str_insert('x', s.len / 2, &s);
+    });
+
+    bench("str_inserts", corpus, n, n, String s = str_clone(text), str_free(&s), {
+        str_inserts(needle, s.len / 2, &s);
+    });
+
+    bench("str_replace_slice", corpus, n, n, String s = str_clone(text), str_free(&s), {
+        str_replace_slice(s.len / 2, 6, needle, &s);
+    });
+
+    bench("str_replace", corpus, n, n, , , {
+        String s = str_clone(text);
+        str_replace(needle, str_ref("NEEDLE"), &s, STR_REPLACE_ALL);
+        str_free(&s);
+    });
+
+    // Inspection
+
+    String copy = str_clone(text);
+
+    bench("str_eq", corpus, n, n, , , {
+        bool eq = str_eq(text, copy);
+        bench_keep(eq);
+    });
+
+    str_free(&copy);
+
+    bench("str_lpos", corpus, n, n, , , {
+        int pos = str_lpos(str_ref("not-found"), text, 0);
+        bench_keep(pos);
+    });
+
+    bench("str_rpos", corpus, n, n, , , {
+        int pos = str_rpos(str_ref("not-found"), text, 0);
+        bench_keep(pos);
+    });
+
+    bench("str_count", corpus, n, n, , , {
+        int c = str_count('\n', text);
+        bench_keep(c);
+    });
+
+    bench("str_counts", corpus, n, n, , , {
+        int c = str_counts(needle, text, 0);
+        bench_keep(c);
+    });
+
+    bench("str_startswith", corpus, n, 64, , , {
+        bool b = str_startswith(str_slice_ref(text, 0, 64), text);
+        bench_keep(b);
+    });
+
+    bench("str_endswith", corpus, n, 64, , , {
+        bool b = str_endswith(tail, text);
+        bench_keep(b);
+    });
+
+    // Views: the words of the corpus as arrays of slices
+
+    size_t nwords = strview_split_all(strview(text), strview_ref(" "), NULL, 0);
+    String *words = malloc(nwords * sizeof *words);
+    StrView *views = malloc(nwords * sizeof *views);
+
+    bench("str_split (String[])", corpus, n, n, , , {
+        String w = {0};
+        for (size_t k = 0; str_split(text, str_ref(" "), &w); k++) words[k] = w;
+    });
+
+    bench("strview_split_all (StrView[])", corpus, n, n, , , {
+        size_t k = strview_split_all(strview(text), strview_ref(" "), views, nwords);
+        bench_keep(k);
+    });
+
+    bench("str_startswith (String[])", corpus, n, n, , , {
+        size_t k = 0;
+        for (size_t i = 0; i < nwords; i++) k += str_startswith(str_ref("ne"), words[i]);
+        bench_keep(k);
+    });
+
+    bench("strview_startswith (StrView[])", corpus, n, n, , , {
+        size_t k = 0;
+        for (size_t i = 0; i < nwords; i++) k += strview_startswith(strview_ref("ne"), views[i]);
+        bench_keep(k);
+    });
+
+    free(views);
+    free(words);
+    free(ctext);
+}
+
+static void bench_strcodec(const char *corpus, String text) {
+    size_t n = text.len;
+    static const char *NAMES[] = { "scalar", "sse", "avx2" };
+    static const StrCodecFlags KERNELS[] = { STR_CODEC_NO_SIMD, STR_CODEC_NO_AVX2, 0 };
+
+    String hex = str_hex_encode(text, 0);
+    String b64 = str_base64_encode(text, 0);
+    char *buf = malloc(hex.len);
+    char name[64];
+
+    for (size_t k = 0; k < ARRAY_LEN(KERNELS); k++) {
+        StrCodecFlags flags = KERNELS[k];
+
+        snprintf(name, sizeof name, "str_hex_encode_to (%s)", NAMES[k]);
+        bench(name, corpus, n, n, , , {
+            size_t len = str_hex_encode_to(buf, text, flags);
+            bench_keep(len);
+        });
+
+        snprintf(name, sizeof name, "str_hex_decode_to (%s)", NAMES[k]);
+        bench(name, corpus, n, hex.len, , , {
+            bool ok = str_hex_decode_to(buf, hex, flags, NULL);
+            bench_keep(ok);
+        });
+
+        snprintf(name, sizeof name, "str_base64_encode_to (%s)", NAMES[k]);
+        bench(name, corpus, n, n, , , {
+            size_t len = str_base64_encode_to(buf, text, flags);
+            bench_keep(len);
+        });
+
+        snprintf(name, sizeof name, "str_base64_decode_to (%s)", NAMES[k]);
+        bench(name, corpus, n, b64.len, , , {
+            bool ok = str_base64_decode_to(buf, b64, flags, NULL);
+            bench_keep(ok);
+        });
+    }
+
+    free(buf);
+    str_free(&hex);
+    str_free(&b64);
+}
+
+static void bench_strconv(const char *corpus, String text) {
+    size_t n = text.len;
+
+    bench("str_push_int", corpus, n, 8, String s = str_alloc(""), str_free(&s), {
+        s.len = 0;
+        str_push_int((int64_t)bench_i * -7919, &s);
+    });
+
+    bench("str_push_double", corpus, n, 8, String s = str_alloc(""), str_free(&s), {
+        s.len = 0;
+        str_push_double((double)bench_i / 7.0, &s);
+    });
+
+    bench("str_parse_int", corpus, n, 20, , , {
+        int64_t v;
+        str_parse_int(str_ref("-1234567890123456789"), &v, NULL);
+        bench_keep(v);
+    });
+
+    bench("str_parse_double", corpus, n, 18, , , {
+        double v;
+        str_parse_double(str_ref("3.1415926535897931"), &v, NULL);
+        bench_keep(v);
+    });
+}
+
+static void bench_strglob(const char *corpus, String text) {
+    size_t n = text.len;
+
+    // Match against every line of the corpus
+    size_t nlines = str_count('\n', text) + 1;
+    String *lines = malloc(nlines * sizeof *lines);
+    String line = {0};
+    nlines = 0;
+    while (str_split(text, str_ref("\n"), &line)) lines[nlines++] = line;
+
+    StrGlob g = strglob_compile(str_ref("*[0-9]*needle*"));
+
+    bench("strglob_compile", corpus, n, 14, , , {
+        StrGlob c = strglob_compile(str_ref("*[0-9]*needle*"));
+        strglob_free(&c);
+    });
+
+    bench("strglob_match_all", corpus, n, n, , , {
+        size_t m = strglob_match_all(&g, lines, nlines, NULL);
+        bench_keep(m);
+    });
+
+    strglob_free(&g);
+    free(lines);
+}
+
+static void bench_strindex(const char *corpus, String text) {
+    size_t n = text.len;
+    String needle = str_ref(NEEDLE);
+
+    bench("strindex_build", corpus, n, n, , , {
+        StrIndex idx = strindex_build(text, 0);
+        bench_keep(idx.sa);
+        strindex_free(&idx);
+    });
+
+    bench("strindex_build (FM)", corpus, n, n, , , {
+        StrIndex idx = strindex_build(text, STR_INDEX_FM | STR_INDEX_DROP_SA);
+        bench_keep(idx.bwt);
+        strindex_free(&idx);
+    });
+
+    StrIndex sa = strindex_build(text, 0);
+    StrIndex fm = strindex_build(text, STR_INDEX_FM | STR_INDEX_DROP_SA);
+
+    // Compare with strindex_build() above
+    FILE *saved[2] = { tmpfile(), tmpfile() };
+    strindex_save(&sa, saved[0]);
+    strindex_save(&fm, saved[1]);
+
+    for (int i = 0; i < 2; i++) {
+        bench(i ? "strindex_load (FM)" : "strindex_load", corpus, n, n, , , {
+            rewind(saved[i]);
+            StrIndex idx;
+            bool ok = strindex_load(text, saved[i], &idx);
+            bench_keep(ok);
+            if (ok) strindex_free(&idx);
+        });
+        fclose(saved[i]);
+    }
+
+    // Compare with str_counts() scanning the whole text
+    bench("strindex_count (SA)", corpus, n, n, , , {
+        size_t c = strindex_count(&sa, needle);
+        bench_keep(c);
+    });
+
+    bench("strindex_count (FM)", corpus, n, n, , , {
+        size_t c = strindex_count(&fm, needle);
+        bench_keep(c);
+    });
+
+    bench("strindex_locate (FM)", corpus, n, n, , , {
+        size_t pos[64];
+        size_t c = strindex_locate(&fm, needle, pos, 64);
+        bench_keep(c);
+    });
+
+    strindex_free(&sa);
+    strindex_free(&fm);
+}
+
+static void bench_strsearch(const char *corpus, String text) {
+    size_t n = text.len;
+    String needle = str_ref(NEEDLE);
+
+    FILE *f = tmpfile();
+    fwrite(text.str, 1, text.len, f);
+    fflush(f);
+
+    // Baseline: load the whole file, then search it
+    bench("fread_str+str_lpos", corpus, n, n, , , {
+        rewind(f);
+        String s = fread_str(f);
+        size_t count = 0;
+        for (int pos = 0; (pos = str_lpos(needle, s, pos)) != -1; pos++) count++;
+        bench_keep(count);
+        str_free(&s);
+    });
+
+    bench("str_search_fd", corpus, n, n, , , {
+        lseek(fileno(f), 0, SEEK_SET);
+        StrSearchResult res = str_search_fd(fileno(f), needle, 1 << 16, 0, NULL, NULL);
+        bench_keep(res.matches);
+    });
+
+    bench("str_search_fd (sync)", corpus, n, n, , , {
+        lseek(fileno(f), 0, SEEK_SET);
+        StrSearchResult res = str_search_fd(fileno(f), needle, 1 << 16, STR_SEARCH_SYNC, NULL, NULL);
+        bench_keep(res.matches);
+    });
+
+    bench("str_search_str", corpus, n, n, , , {
+        StrSearchResult res = str_search_str(text, needle, 0, NULL, NULL);
+        bench_keep(res.matches);
+    });
+
+    fclose(f);
+}
+
+static void bench_strvec(const char *corpus, String text) {
+    size_t n = text.len;
+
+    // Words of the corpus, as separately allocated strings and as a table
+    size_t nwords = 0;
+    for (size_t i = 0; i < n; i++) nwords += text.str[i] == ' ' || text.str[i] == '\n';
+
+    String *words = malloc((nwords + 1) * sizeof *words);
+    StrVec vec = {0};
+    size_t count = 0;
+
+    for (size_t i = 0, start = 0; i <= n; i++) {
+        if (i < n && text.str[i] != ' ' && text.str[i] != '\n') continue;
+        String word = str_slice_ref(text, start, i - start);
+        words[count++] = str_nalloc(word.str, word.len);
+        strvec_push(word, &vec);
+        start = i + 1;
+    }
+
+    String needle = str_ref(NEEDLE);
+
+    bench("String[] push", corpus, n, n, , , {
+        String *copies = malloc(count * sizeof *copies);
+        for (size_t i = 0; i < count; i++) copies[i] = str_nalloc(words[i].str, words[i].len);
+        for (size_t i = 0; i < count; i++) str_free(&copies[i]);
+        free(copies);
+    });
+
+    bench("strvec_push", corpus, n, n, , , {
+        StrVec copy = {0};
+        for (size_t i = 0; i < count; i++) strvec_push(words[i], &copy);
+        strvec_free(&copy);
+    });
+
+    bench("String[] count equal", corpus, n, n, , , {
+        size_t c = 0;
+        for (size_t i = 0; i < count; i++)
+            c += words[i].len == needle.len && !memcmp(words[i].str, needle.str, needle.len);
+        bench_keep(c);
+    });
+
+    bench("strvec_count (equal)", corpus, n, n, , , {
+        size_t c = strvec_count(&vec, needle, STR_VEC_EQUAL);
+        bench_keep(c);
+    });
+
+    bench("String[] count contains", corpus, n, n, , , {
+        size_t c = 0;
+        for (size_t i = 0; i < count; i++)
+            c += memmem(words[i].str, words[i].len, "edl", 3) != NULL;
+        bench_keep(c);
+    });
+
+    bench("strvec_count (contains)", corpus, n, n, , , {
+        size_t c = strvec_count(&vec, str_ref("edl"), STR_VEC_CONTAINS);
+        bench_keep(c);
+    });
+
+    uint64_t *hashes = malloc(count * sizeof *hashes);
+    bench("strvec_hash", corpus, n, n, , , {
+        strvec_hash(&vec, hashes);
+        bench_keep(hashes[0]);
+    });
+    free(hashes);
+
+    for (size_t i = 0; i < count; i++) str_free(&words[i]);
+    free(words);
+    strvec_free(&vec);
+}
+
+static void bench_strlines(const char *corpus, String text) {
+    size_t n = text.len;
+
+    bench("strlines_build", corpus, n, n, , , {
+        StrLineIndex idx = strlines_build(text);
+        bench_keep(idx.count);
+        strlines_free(&idx);
+    });
+
+    StrLineIndex idx = strlines_build(text);
+    size_t nlines = strlines_count(&idx);
+
+    bench("strlines_get", corpus, n, 64, , , {
+        String line = strlines_get(&idx, text, nlines / 2);
+        bench_keep(line.len);
+    });
+
+    bench("strlines_find", corpus, n, 1, , , {
+        size_t line = strlines_find(&idx, n / 2);
+        bench_keep(line);
+    });
+
+    strlines_free(&idx);
+}
+
+static void bench_strload(const char *corpus, String text) {
+    enum { NFILES = 64 };
+    size_t n = text.len;
+
+    // Batch of files with the corpus as contents
+    char dir[] = "/tmp/strbenchXXXXXX";
+    if (!mkdtemp(dir)) return;
+
+    static char paths[NFILES][64];
+    const char *path_ptrs[NFILES];
+
+    for (size_t i = 0; i < NFILES; i++) {
+        snprintf(paths[i], sizeof paths[i], "%s/%zu", dir, i);
+        path_ptrs[i] = paths[i];
+
+        FILE *f = fopen(paths[i], "wb");
+        fwrite(text.str, 1, text.len, f);
+        fclose(f);
+    }
+
+    StrLoadResult res[NFILES];
+    String strs[NFILES];
+
+    // Sequential baseline, keeping all the strings alive like the batch loader
+    bench("fread_str (x64)", corpus, n, NFILES * n, , , {
+        for (size_t i = 0; i < NFILES; i++) {
+            FILE *f = fopen(paths[i], "rb");
+            strs[i] = fread_str(f);
+            fclose(f);
+        }
+        for (size_t i = 0; i < NFILES; i++) str_free(&strs[i]);
+    });
+
+    bench("str_load_files (x64)", corpus, n, NFILES * n, , , {
+        str_load_files(path_ptrs, NFILES, res, 0);
+        for (size_t i = 0; i < NFILES; i++) str_free(&res[i].str);
+    });
+
+    bench("str_load_files/pread (x64)", corpus, n, NFILES * n, , , {
+        str_load_files(path_ptrs, NFILES, res, STR_LOAD_NO_URING);
+        for (size_t i = 0; i < NFILES; i++) str_free(&res[i].str);
+    });
+
+    for (size_t i = 0; i < NFILES; i++) unlink(paths[i]);
+    rmdir(dir);
+}
+
+static void bench_strwrite(const char *corpus, String text) {
+    size_t n = text.len;
+
+    // Write every line of the corpus separately
+    size_t nlines = str_count('\n', text) + 1;
+    String *lines = malloc(nlines * sizeof *lines);
+    String line = {0};
+    nlines = 0;
+    while (str_split(text, str_ref("\n"), &line)) lines[nlines++] = line;
+
+    FILE *devnull = fopen("/dev/null", "w");
+
+    bench("fprintf (lines)", corpus, n, n, , , {
+        for (size_t i = 0; i < nlines; i++)
+            fprintf(devnull, STR_FMT"\n", STR_FMT_ARGS(lines[i]));
+        fflush(devnull);
+    });
+
+    bench("str_write (lines)", corpus, n, n, , , {
+        StrWriter w = str_writer_file(devnull);
+        for (size_t i = 0; i < nlines; i++) {
+            str_write(lines[i], &w);
+            str_write_char('\n', &w);
+        }
+        str_writer_flush(&w);
+    });
+
+    bench("str_write_debug", corpus, n, n, , , {
+        StrWriter w = str_writer_file(devnull);
+        str_write_debug(text, &w);
+        str_writer_flush(&w);
+    });
+
+    // Number of system calls per batch of lines
+    StrWriter w = str_writer_file(devnull);
+    for (size_t i = 0; i < nlines; i++) {
+        str_write(lines[i], &w);
+        str_write_char('\n', &w);
+    }
+    str_writer_flush(&w);
+    printf("   str_write (lines): %zu writes in %zu syscalls\n", nlines * 2, w.syscalls);
+
+    fclose(devnull);
+    free(lines);
+}
+
+static void bench_strnorm(const char *corpus, String text) {
+    size_t n = text.len;
+
+    bench("str_is_normalized (NFC)", corpus, n, n, , , {
+        bool ok = str_is_normalized(text, STR_NFC);
+        bench_keep(ok);
+    });
+
+    bench("str_normalize (NFD)", corpus, n, n, , , {
+        String s = str_normalize(text, STR_NFD);
+        str_free(&s);
+    });
+
+    String nfd = str_normalize(text, STR_NFD);
+
+    bench("str_normalize (NFC)", corpus, n, n, , , {
+        String s = str_normalize(nfd, STR_NFC);
+        str_free(&s);
+    });
+
+    str_free(&nfd);
+}
+
+static void bench_strcase(const char *corpus, String text) {
+    size_t n = text.len;
+    static const char *NAMES[] = { "scalar", "sse", "avx2" };
+    static const StrCaseFlags KERNELS[] = { STR_CASE_NO_SIMD, STR_CASE_NO_AVX2, 0 };
+    static const char *CASES[] = { "lower", "upper", "title" };
+    char name[64];
+
+    for (StrCase to = STR_CASE_LOWER; to <= STR_CASE_TITLE; to++) {
+        for (size_t k = 0; k < ARRAY_LEN(KERNELS); k++) {
+            snprintf(name, sizeof name, "str_to_case (%s, %s)", CASES[to], NAMES[k]);
+            bench(name, corpus, n, n, , , {
+                String s = str_to_case(text, to, KERNELS[k]);
+                str_free(&s);
+            });
+        }
+    }
+
+    bench("str_case (upper, in place)", corpus, n, n, String s = str_clone(text), str_free(&s), {
+        str_case(bench_i % 2 ? STR_CASE_UPPER : STR_CASE_LOWER, 0, &s);
+    });
+}
+
+static void bench_strchunk(const char *corpus, String text) {
+    size_t n = text.len;
+    if (n < 1024) return;
+
+    bench("str_gear_hash", corpus, n, n, , , {
+        uint64_t h = str_gear_hash(text);
+        bench_keep(h);
+    });
+
+    bench("str_chunk_next (avg 4K)", corpus, n, n, , , {
+        StrChunker c = str_chunker(text, 0, 4096, 0);
+        String chunk;
+        size_t count = 0;
+        while (str_chunk_next(&c, &chunk)) count++;
+        bench_keep(count);
+    });
+
+    // Needles of 8 bytes taken from the corpus
+    static const size_t COUNTS[] = { 1, 16, 256 };
+    String needles[256];
+    char name[64];
+
+    for (size_t k = 0; k < ARRAY_LEN(needles); k++)
+        needles[k] = str_slice_ref(text, rng() % (n - 8), 8);
+
+    for (size_t k = 0; k < ARRAY_LEN(COUNTS); k++) {
+        StrMultiSearch search = str_multi_search_new(needles, COUNTS[k]);
+
+        snprintf(name, sizeof name, "str_multi_search (%zu needles)", COUNTS[k]);
+        bench(name, corpus, n, n, , , {
+            size_t m = str_multi_search(&search, text, NULL, NULL);
+            bench_keep(m);
+        });
+
+        str_multi_search_free(&search);
+    }
+
+    // Baseline: one memmem() scan per needle
+    bench("memmem (16 needles)", corpus, n, n, , , {
+        size_t m = 0;
+        for (size_t k = 0; k < 16; k++) {
+            const char *p = text.str;
+            const char *end = text.str + n;
+            while ((p = memmem(p, end - p, needles[k].str, 8))) {
+                m++;
+                p++;
+            }
+        }
+        bench_keep(m);
+    });
+}
+
+// The corpus as CSV: lines are records and words are fields, every 8th field quoted
+// with a delimiter and a doubled quote inside
+static String gen_csv(String text, size_t *rows) {
+    String csv = str_alloc("");
+    size_t fields = 0;
+    *rows = 0;
+
+    for (size_t i = 0; i < text.len;) {
+        size_t end = i;
+        while (end < text.len && text.str[end] != ' ' && text.str[end] != '\n') end++;
+
+        String word = str_nref(text.str + i, end - i);
+        if (++fields % 8) str_pushs(word, &csv);
+        else str_pushf(&csv, "\"" STR_FMT ", \"\"%zu\"\"\"", STR_FMT_ARGS(word), fields);
+
+        bool newline = end == text.len || text.str[end] == '\n';
+        str_push(newline ? '\n' : ',', &csv);
+        *rows += newline;
+        i = end + 1;
+    }
+
+    return csv;
+}
+
+static void bench_strcsv(const char *corpus, String text) {
+    static const char *NAMES[] = { "scalar", "sse", "avx2" };
+    static const StrCsvFlags KERNELS[] = { STR_CSV_NO_SIMD, STR_CSV_NO_AVX2, 0 };
+    size_t rows;
+    String csv = gen_csv(text, &rows);
+    size_t n = csv.len;
+    char name[64];
+
+    for (size_t k = 0; k < ARRAY_LEN(KERNELS); k++) {
+        snprintf(name, sizeof name, "str_csv_next (%s)", NAMES[k]);
+        bench(name, corpus, n, n, , , {
+            StrCsv c = str_csv(csv, ',', KERNELS[k]);
+            size_t fields = 0;
+            while (str_csv_next(&c)) fields += c.count;
+            bench_keep(fields);
+            str_csv_free(&c);
+        });
+    }
+
+    // Character by character state machine, the way the records were parsed before
+    String field = str_alloc("");
+    bench("csv state machine", corpus, n, n, , , {
+        size_t fields = 0;
+        bool quoted = false;
+        field.len = 0;
+        for (size_t i = 0; i < n; i++) {
+            char c = csv.str[i];
+            if (c == '"') {
+                if (quoted && i + 1 < n && csv.str[i + 1] == '"') str_push(csv.str[++i], &field);
+                else quoted = !quoted;
+            } else if (quoted || (c != ',' && c != '\n')) {
+                str_push(c, &field);
+            } else {
+                fields++;
+                field.len = 0;
+            }
+        }
+        bench_keep(fields);
+    });
+    str_free(&field);
+
+    // Rows per second of the best kernel (best of a few runs)
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < BENCH_REPS; r++) {
+        uint64_t t0 = bench_now_ns();
+        StrCsv c = str_csv(csv, ',', 0);
+        while (str_csv_next(&c)) bench_keep(c.count);
+        str_csv_free(&c);
+
+        uint64_t dt = bench_now_ns() - t0;
+        if (dt < best) best = dt;
+    }
+    printf("   str_csv_next: %zu rows, %.1f M rows/s\n", rows, best ? rows * 1e3 / best : 0);
+
+    str_free(&csv);
+}
+
+static void bench_strdiff(const char *corpus, String text) {
+    size_t n = text.len;
+
+    // A copy with a word replaced every 4 KiB
+    String edited = str_clone(text);
+    for (size_t at = 2048; at + 8 <= edited.len; at += 4096)
+        memcpy(edited.str + at, "CHANGED\n", 8);
+
+    bench("str_diff bytes", corpus, n, n, StrDiff d = {0}, str_diff_free(&d), {
+        str_diff_free(&d);
+        d = str_diff(text, edited, 0);
+    });
+
+    bench("str_diff utf8", corpus, n, n, StrDiff d = {0}, str_diff_free(&d), {
+        str_diff_free(&d);
+        d = str_diff(text, edited, STR_DIFF_UTF8);
+    });
+
+    bench("str_diff lines", corpus, n, n, StrDiff d = {0}, str_diff_free(&d), {
+        str_diff_free(&d);
+        d = str_diff(text, edited, STR_DIFF_LINES);
+    });
+
+    // Unrelated halves: the heuristic against the minimal search
+    size_t half = n / 2 < 4096 ? n / 2 : 4096;
+    String a = str_slice_ref(text, 0, half);
+    String b = str_slice_ref(text, n - half, half);
+
+    bench("str_diff unrelated", corpus, n, 2 * half, StrDiff d = {0}, str_diff_free(&d), {
+        str_diff_free(&d);
+        d = str_diff(a, b, 0);
+    });
+
+    bench("str_diff unrelated minimal", corpus, n, 2 * half, StrDiff d = {0}, str_diff_free(&d), {
+        str_diff_free(&d);
+        d = str_diff(a, b, STR_DIFF_MINIMAL);
+    });
+
+    str_free(&edited);
+}
+
+static void bench_strdist(const char *corpus, String text) {
+    size_t n = text.len;
+    String a = str_slice_ref(text, 0, 100);
+    String b = str_slice_ref(text, 100, 100);
+
+    bench("str_edit_distance", corpus, n, 100, , , {
+        size_t d = str_edit_distance(a, b, SIZE_MAX, 0);
+        bench_keep(d);
+    });
+
+    bench("str_edit_distance utf8", corpus, n, 100, , , {
+        size_t d = str_edit_distance(a, b, SIZE_MAX, STR_DIST_UTF8);
+        bench_keep(d);
+    });
+
+    bench("str_fuzzy_find", corpus, n, n, , , {
+        StrFuzzyMatch m;
+        bool found = str_fuzzy_find(str_ref("neeedle"), text, 1, 0, &m);
+        bench_keep(found);
+    });
+}
+
+static void bench_strtemplate(const char *corpus, String text) {
+    size_t n = text.len;
+    String src = str_ref("user={user} id={id} action={action} path={path}");
+    String user = str_slice_ref(text, 0, 8);
+    String id = str_ref("1234567");
+    String action = str_slice_ref(text, 8, 12);
+    String path = str_slice_ref(text, 20, 40);
+
+    StrTemplate tpl;
+    str_template_compile(src, &tpl, NULL);
+    String values[4];
+    values[str_template_slot(&tpl, str_ref("user"))]   = user;
+    values[str_template_slot(&tpl, str_ref("id"))]     = id;
+    values[str_template_slot(&tpl, str_ref("action"))] = action;
+    values[str_template_slot(&tpl, str_ref("path"))]   = path;
+    size_t len = str_template_len(&tpl, values);
+
+    // Baseline: one str_replace() per placeholder
+    bench("str_replace chain", corpus, n, len, , , {
+        String out = str_clone(src);
+        str_replace(str_ref("{user}"), user, &out, 0);
+        str_replace(str_ref("{id}"), id, &out, 0);
+        str_replace(str_ref("{action}"), action, &out, 0);
+        str_replace(str_ref("{path}"), path, &out, 0);
+        bench_keep(out.len);
+        str_free(&out);
+    });
+
+    bench("str_template_render", corpus, n, len, , , {
+        String out = str_template_render(&tpl, values);
+        bench_keep(out.len);
+        str_free(&out);
+    });
+
+    char buf[256];
+    bench("str_template_render_to", corpus, n, len, , , {
+        size_t w = str_template_render_to(buf, &tpl, values);
+        bench_keep(w);
+    });
+
+    bench("str_template_compile", corpus, n, src.len, , , {
+        StrTemplate t;
+        str_template_compile(src, &t, NULL);
+        bench_keep(t.count);
+        str_template_free(&t);
+    });
+
+    str_template_free(&tpl);
+}
+
+static void bench_utf8(const char *corpus, String text) {
+    size_t n = text.len;
+
+    char *ctext = cstr(text);
+    ctext[n] = '\0';
+
+    bench("utf8_decode", corpus, n, n, , , {
+        utf8_Decoder d;
+        utf8_decoder_init(&d);
+        uint32_t sum = 0;
+        for (size_t i = 0; i < n; i++)
+            if (utf8_decode(&d, text.str[i])) sum += d.codepoint;
+        bench_keep(sum);
+    });
+
+    char buf[4 * 64];
+
+    bench("utf8_encode", corpus, n, 64, , , {
+        char *c = buf;
+        for (uint32_t cp = 0; cp < 64; cp++) c = utf8_encode(c, cp * 0x801);
+        bench_keep(buf);
+    });
+
+    bench("utf8_size", corpus, n, 1, , , {
+        uint8_t sz = utf8_size(bench_i & 0x1FFFFF);
+        bench_keep(sz);
+    });
+
+    uint32_t *codepoints = malloc(n * sizeof *codepoints);
+
+    bench("utf8_decode (to array)", corpus, n, n, , , {
+        utf8_Decoder d;
+        utf8_decoder_init(&d);
+        size_t count = 0;
+        for (size_t i = 0; i < n; i++)
+            if (utf8_decode(&d, text.str[i])) codepoints[count++] = d.codepoint;
+        bench_keep(count);
+    });
+
+    bench("utf8_decode_chunk", corpus, n, n, , , {
+        utf8_Decoder d;
+        utf8_decoder_init(&d);
+        utf8_ChunkResult res = utf8_decode_chunk(&d, text.str, n, codepoints, n);
+        bench_keep(res.produced);
+    });
+
+    free(codepoints);
+
+    bench("utf8_skip", corpus, n, n, , , {
+        char *c = ctext;
+        while (*c) c = utf8_skip(c);
+        bench_keep(c);
+    });
+
+    size_t len = utf8_len(ctext);
+
+    bench("utf8_pos", corpus, n, n, , , {
+        char *c = utf8_pos(ctext, len - 1);
+        bench_keep(c);
+    });
+
+    bench("utf8_len", corpus, n, n, , , {
+        size_t l = utf8_len(ctext);
+        bench_keep(l);
+    });
+
+    bench("utf8_nlen", corpus, n, n, , , {
+        size_t l = utf8_nlen(text.str, text.len);
+        bench_keep(l);
+    });
+
+    free(ctext);
+}
+
+int main() {
+    static const char *CORPORA[] = { "ascii", "utf8", "log" };
+    static const size_t SIZES[] = { 1 << 10, 1 << 14, 1 << 18 };
+
+    bench_begin();
+
+    for (size_t c = 0; c < ARRAY_LEN(CORPORA); c++) {
+        for (size_t s = 0; s < ARRAY_LEN(SIZES); s++) {
+            String text = gen_corpus(CORPORA[c], SIZES[s]);
+
+            bench_strutils(CORPORA[c], text);
+            bench_strcodec(CORPORA[c], text);
+            bench_strconv(CORPORA[c], text);
+            bench_strcsv(CORPORA[c], text);
+            bench_strglob(CORPORA[c], text);
+            bench_strindex(CORPORA[c], text);
+            bench_strlines(CORPORA[c], text);
+            bench_strsearch(CORPORA[c], text);
+            bench_strvec(CORPORA[c], text);
+            bench_strload(CORPORA[c], text);
+            bench_strwrite(CORPORA[c], text);
+            bench_strnorm(CORPORA[c], text);
+            bench_strcase(CORPORA[c], text);
+            bench_strchunk(CORPORA[c], text);
+            bench_strdiff(CORPORA[c], text);
+            bench_strdist(CORPORA[c], text);
+            bench_strtemplate(CORPORA[c], text);
+            bench_utf8(CORPORA[c], text);
+
+            str_free(&text);
+        }
+    }
+
+    bench_end();
+}
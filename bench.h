@@ -0,0 +1,106 @@
+#ifndef _BENCH_H
+#define _BENCH_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_LABEL_WIDTH 24
+#define BENCH_WARMUP 1
+#define BENCH_REPS 5
+// Minimum duration of a single repetition (iterations are doubled until reached)
+#define BENCH_MIN_NS 2000000
+
+#define BENCH_OUTPUT "bench_output.txt"
+
+#define COLOR_BENCH "\033[34;1m"
+#define COLOR_NONE "\033[0m"
+
+// Machine-readable output file, opened by bench_begin()
+static FILE *bench_out;
+
+static inline uint64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Forces the compiler to materialize the given lvalue, so that the
+// computation producing it cannot be optimized away
+#define bench_keep(var) __asm__ volatile("" : : "r"(&(var)) : "memory")
+
+static inline int bench_cmp_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Opens the output file and writes the column header
+static inline void bench_begin(void) {
+    bench_out = fopen(BENCH_OUTPUT, "w");
+    if (bench_out) fprintf(bench_out, "name\tcorpus\tsize\tns_op\tmb_s\titers\n");
+}
+
+static inline void bench_end(void) {
+    if (bench_out) fclose(bench_out);
+    bench_out = NULL;
+}
+
+// Prints and records a single result
+//  ns    - median duration of one repetition
+//  iters - number of operations per repetition
+//  bytes - number of bytes processed by one operation
+static inline void bench_report(const char *name, const char *corpus, size_t size,
+                                uint64_t ns, size_t iters, size_t bytes) {
+    double ns_op = (double)ns / iters;
+    double mb_s  = ns_op > 0 ? bytes / ns_op * 1e3 : 0;
+
+    int n = printf("=> "COLOR_BENCH"%s"COLOR_NONE" (%s/%zu)", name, corpus, size);
+    for (n -= sizeof(COLOR_BENCH COLOR_NONE) - 1; n < BENCH_LABEL_WIDTH + 20; n++)
+        putchar(' ');
+    printf(" | %12.1f ns/op | %10.1f MB/s\n", ns_op, mb_s);
+
+    if (bench_out)
+        fprintf(bench_out, "%s\t%s\t%zu\t%.3f\t%.3f\t%zu\n",
+                name, corpus, size, ns_op, mb_s, iters);
+}
+
+// Times a block of code:
+//  name     - label of the benchmark
+//  corpus   - label of the input data
+//  size     - size of the input data (only reported)
+//  bytes    - number of bytes processed by one execution of the block
+//  setup    - statement executed before each repetition (not timed)
+//  teardown - statement executed after each repetition (not timed)
+//  block    - code to time, executed repeatedly
+//
+// The number of iterations is calibrated during warm-up, then the block is
+// run BENCH_REPS times and the median repetition is reported.
+#define bench(name, corpus, size, bytes, setup, teardown, ...) do { \
+    size_t bench_iters = 1; \
+    for (int bench_w = 0; bench_w < BENCH_WARMUP; bench_w++) { \
+        for (;;) { \
+            setup; \
+            uint64_t bench_t0 = bench_now_ns(); \
+            for (size_t bench_i = 0; bench_i < bench_iters; bench_i++) \
+                __VA_ARGS__ \
+            uint64_t bench_dt = bench_now_ns() - bench_t0; \
+            teardown; \
+            if (bench_dt >= BENCH_MIN_NS) break; \
+            bench_iters *= 2; \
+        } \
+    } \
+    uint64_t bench_ns[BENCH_REPS]; \
+    for (int bench_r = 0; bench_r < BENCH_REPS; bench_r++) { \
+        setup; \
+        uint64_t bench_t0 = bench_now_ns(); \
+        for (size_t bench_i = 0; bench_i < bench_iters; bench_i++) \
+            __VA_ARGS__ \
+        bench_ns[bench_r] = bench_now_ns() - bench_t0; \
+        teardown; \
+    } \
+    qsort(bench_ns, BENCH_REPS, sizeof *bench_ns, bench_cmp_u64); \
+    bench_report(name, corpus, size, bench_ns[BENCH_REPS / 2], bench_iters, bytes); \
+} while (0)
+
+#endif // _BENCH_H
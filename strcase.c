@@ -0,0 +1,320 @@
+#include "strcase.h"
+
+#include <string.h>
+
+#include "utf8.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CASE_X86
+#include <immintrin.h>
+
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+/* * * * * * * Tables * * * * * * */
+
+// Simple case mappings of a codepoint, as differences to the codepoint
+typedef struct {
+    int32_t upper;
+    int32_t lower;
+    int32_t title;
+    uint8_t flags;
+} CaseProps;
+
+#define CASED 0x1
+
+#include "strcase_tables.h"
+
+// Invalid UTF-8 bytes are carried through as RAW + byte
+#define RAW 0x110000
+
+static inline const CaseProps *props(uint32_t cp) {
+    if (cp >= CASE_LIMIT) return &CASE_PROPS[0];
+    return &CASE_PROPS[CASE_STAGE2[CASE_STAGE1[cp / CASE_BLOCK]][cp % CASE_BLOCK]];
+}
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Decodes the codepoint at s[*i] and advances `i` past it
+static uint32_t decode(const uint8_t *s, size_t len, size_t *i) {
+    uint8_t c = s[*i];
+    if (c < 0x80) {
+        (*i)++;
+        return c;
+    }
+
+    size_t n;
+    uint32_t cp, min;
+    if      ((c & 0xE0) == 0xC0) { n = 1; cp = c & 0x1F; min = 0x80; }
+    else if ((c & 0xF0) == 0xE0) { n = 2; cp = c & 0x0F; min = 0x800; }
+    else if ((c & 0xF8) == 0xF0) { n = 3; cp = c & 0x07; min = 0x10000; }
+    else goto raw;
+
+    if (len - *i <= n) goto raw;
+
+    for (size_t k = 1; k <= n; k++) {
+        uint8_t b = s[*i + k];
+        if ((b & 0xC0) != 0x80) goto raw;
+        cp = cp << 6 | (b & 0x3F);
+    }
+
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp < 0xE000)) goto raw;
+
+    *i += n + 1;
+    return cp;
+
+raw:
+    (*i)++;
+    return RAW + c;
+}
+
+// State of a conversion
+typedef struct {
+    StrCase      to;
+    StrCaseFlags flags;
+    bool         cased; // the last character converted is cased (STR_CASE_TITLE)
+} Conv;
+
+// Number of bytes of the UTF-8 encoding of a valid codepoint
+static inline size_t encoded_size(uint32_t cp) {
+    return 1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000);
+}
+
+/* * * * * * * ASCII kernels * * * * * * */
+
+// The kernels convert whole blocks of ASCII and return the number of bytes
+// converted, stopping at the first block with a non-ASCII byte.
+// `out` may be `src` itself.
+
+#ifdef __SSE2__
+
+// Mask of the bytes in [lo, lo + 26)
+static inline __m128i letters_sse(__m128i v, char lo) {
+    return _mm_cmplt_epi8(_mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - lo))),
+                          _mm_set1_epi8(-128 + 26));
+}
+
+static size_t ascii_case_sse(Conv *c, char *out, const char *src, size_t n) {
+    const __m128i bit = _mm_set1_epi8(0x20);
+    __m128i carry = _mm_cvtsi32_si128(c->cased ? 0xFF : 0);
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(v)) break;
+
+        __m128i upper = letters_sse(v, 'A');
+        __m128i lower = letters_sse(v, 'a');
+        __m128i flip;
+
+        if (c->to == STR_CASE_LOWER) {
+            flip = upper;
+        } else if (c->to == STR_CASE_UPPER) {
+            flip = lower;
+        } else {
+            // Uppercase after uncased bytes, lowercase after cased ones
+            __m128i alpha = _mm_or_si128(upper, lower);
+            __m128i prev  = _mm_or_si128(_mm_slli_si128(alpha, 1), carry);
+            flip  = _mm_or_si128(_mm_andnot_si128(prev, lower), _mm_and_si128(prev, upper));
+            carry = _mm_srli_si128(alpha, 15);
+        }
+
+        _mm_storeu_si128((__m128i *)(out + i), _mm_xor_si128(v, _mm_and_si128(flip, bit)));
+    }
+
+    if (i && c->to == STR_CASE_TITLE) c->cased = str_isclass(src[i - 1], STR_CLASS_ALPHA);
+    return i;
+}
+
+#endif
+
+#ifdef CASE_X86
+
+TARGET_AVX2
+static inline __m256i letters_avx2(__m256i v, char lo) {
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26),
+                             _mm256_add_epi8(v, _mm256_set1_epi8((char)(0x80 - lo))));
+}
+
+TARGET_AVX2
+static size_t ascii_case_avx2(Conv *c, char *out, const char *src, size_t n) {
+    const __m256i bit = _mm256_set1_epi8(0x20);
+    __m256i carry = _mm256_set_epi64x(0, 0, 0, c->cased ? 0xFF : 0);
+
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+        if (_mm256_movemask_epi8(v)) break;
+
+        __m256i upper = letters_avx2(v, 'A');
+        __m256i lower = letters_avx2(v, 'a');
+        __m256i flip;
+
+        if (c->to == STR_CASE_LOWER) {
+            flip = upper;
+        } else if (c->to == STR_CASE_UPPER) {
+            flip = lower;
+        } else {
+            // Shift the mask by a byte across the lanes: [0, alpha.lo] supplies
+            // the byte entering each lane
+            __m256i alpha = _mm256_or_si256(upper, lower);
+            __m256i low   = _mm256_permute2x128_si256(alpha, alpha, 0x08);
+            __m256i prev  = _mm256_or_si256(_mm256_alignr_epi8(alpha, low, 15), carry);
+            flip  = _mm256_or_si256(_mm256_andnot_si256(prev, lower), _mm256_and_si256(prev, upper));
+            carry = _mm256_set_epi64x(0, 0, 0, (uint8_t)_mm256_extract_epi8(alpha, 31));
+        }
+
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_xor_si256(v, _mm256_and_si256(flip, bit)));
+    }
+
+    if (i && c->to == STR_CASE_TITLE) c->cased = str_isclass(src[i - 1], STR_CLASS_ALPHA);
+    return i;
+}
+
+#endif
+
+static size_t ascii_case(Conv *c, char *out, const char *src, size_t n) {
+    size_t i = 0;
+    if (c->flags & STR_CASE_NO_SIMD) return 0;
+
+#ifdef CASE_X86
+    if (!(c->flags & STR_CASE_NO_AVX2) && __builtin_cpu_supports("avx2"))
+        i = ascii_case_avx2(c, out, src, n);
+#endif
+#ifdef __SSE2__
+    i += ascii_case_sse(c, out + i, src + i, n - i);
+#endif
+
+    return i;
+}
+
+/* * * * * * * Conversion * * * * * * */
+
+// Converts src[0..n) to `out`, which has room for the converted bytes (and may be
+// `src` itself if `fixed`). With `fixed`, stops before the first codepoint whose
+// mapping has a different encoded length. Returns the number of bytes consumed,
+// the number of bytes written to `written`.
+static size_t convert(Conv *c, char *out, const char *src, size_t n, bool fixed, size_t *written) {
+    const uint8_t *s = (const uint8_t *)src;
+    const StrCase to = c->to;
+    const bool ascii_only = c->flags & STR_CASE_ASCII;
+    size_t i = 0, w = 0;
+    size_t run = 32;
+
+    while (i < n) {
+        size_t k = ascii_case(c, out + w, src + i, n - i);
+        i += k;
+        w += k;
+
+        // Convert the rest of the block with a non-ASCII byte one by one
+        // (with the state in locals, which the byte stores cannot alias).
+        // Back off from the kernels while they find no ASCII block.
+        run = k ? 32 : run < 1024 ? run * 2 : run;
+        size_t stop = n - i > run ? i + run : n;
+        bool cased = c->cased;
+
+        while (i < stop) {
+            uint8_t b = s[i];
+
+            if (b < 0x80) {
+                uint8_t classes = STR_CHAR_CLASSES[b];
+                bool up = to == STR_CASE_UPPER || (to == STR_CASE_TITLE && !cased);
+
+                out[w++] = b ^ (classes & (up ? STR_CLASS_LOWER : STR_CLASS_UPPER) ? 0x20 : 0);
+                cased = classes & STR_CLASS_ALPHA;
+                i++;
+                continue;
+            }
+
+            size_t start = i;
+            uint32_t cp = ascii_only ? (uint32_t)RAW + s[i++] : decode(s, n, &i);
+
+            if (cp >= RAW) {
+                out[w++] = (char)(cp - RAW);
+                cased = false;
+                continue;
+            }
+
+            const CaseProps *p = props(cp);
+            int32_t delta = to == STR_CASE_UPPER ? p->upper
+                          : to == STR_CASE_LOWER || cased ? p->lower
+                          : p->title;
+            uint32_t mapped = cp + delta;
+
+            size_t size = encoded_size(mapped);
+            if (fixed && size != i - start) {
+                c->cased = cased;
+                *written = w;
+                return start;
+            }
+
+            cased = p->flags & CASED;
+
+            // Unchanged codepoints are copied, 2-byte sequences (most alphabets) encoded inline
+            if (!delta) {
+                for (size_t k = 0; k < size; k++) out[w + k] = src[start + k];
+            } else if (size == 2) {
+                out[w]     = (char)(0xC0 | mapped >> 6);
+                out[w + 1] = (char)(0x80 | (mapped & 0x3F));
+            } else {
+                utf8_encode(out + w, mapped);
+            }
+            w += size;
+        }
+
+        c->cased = cased;
+    }
+
+    *written = w;
+    return i;
+}
+
+uint32_t str_case_map(uint32_t cp, StrCase to) {
+    const CaseProps *p = props(cp);
+
+    switch (to) {
+        case STR_CASE_LOWER: return cp + p->lower;
+        case STR_CASE_UPPER: return cp + p->upper;
+        case STR_CASE_TITLE: return cp + p->title;
+    }
+
+    return cp;
+}
+
+bool str_case_is_cased(uint32_t cp) {
+    return props(cp)->flags & CASED;
+}
+
+String str_to_case(String str, StrCase to, StrCaseFlags flags) {
+    Conv c = { .to = to, .flags = flags };
+
+    // Mappings grow 2-byte sequences to 3 bytes at most
+    String out = str_alloc("");
+    str_reserve(str.len + str.len / 2, &out);
+
+    convert(&c, out.str, str.str, str.len, false, &out.len);
+    return out;
+}
+
+void str_case(StrCase to, StrCaseFlags flags, String *str) {
+    if (!(str->flags & STR_VALID) || !(str->flags & STR_HEAP))
+        fprintf(stderr, "Invalid string passed to str_case\n");
+
+    Conv c = { .to = to, .flags = flags };
+
+    // Make the buffer writable if it is shared
+    str_reserve(str->len, str);
+
+    size_t written;
+    size_t done = convert(&c, str->str, str->str, str->len, true, &written);
+    if (done == str->len) return;
+
+    // The encoded length changes: convert the rest into a new buffer
+    String rest = str_alloc("");
+    size_t n = str->len - done;
+    str_reserve(n + n / 2, &rest);
+
+    convert(&c, rest.str, str->str + done, n, false, &rest.len);
+    str_replace_slice(done, n, rest, str);
+    str_free(&rest);
+}
@@ -0,0 +1,51 @@
+#ifndef _STRCASE_H
+#define _STRCASE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Target case of the conversions
+typedef enum {
+    STR_CASE_LOWER,
+    STR_CASE_UPPER,
+    // Titlecase of the first cased character of every word and lowercase of the
+    // others, where a word starts after any character that is not cased (like
+    // Python's str.title())
+    STR_CASE_TITLE,
+} StrCase;
+
+// Flags for the case conversions
+typedef enum {
+    // Only convert the ASCII letters, copying all other bytes as is
+    STR_CASE_ASCII    = 0x1,
+    // Only use the scalar code (for testing and benchmarking)
+    STR_CASE_NO_SIMD  = 0x2,
+    // Do not use the AVX2 kernels, only SSE2 (for testing and benchmarking)
+    STR_CASE_NO_AVX2  = 0x4,
+} StrCaseFlags;
+
+// The conversions use the Unicode simple case mappings, which map every codepoint
+// to a single codepoint without regard to the locale or the context (e.g. 'ß' is
+// not uppercased to "SS"). The encoded length may still change, e.g. 'ı' (2 bytes)
+// uppercases to 'I' (1 byte) and 'Ⱥ' (2 bytes) lowercases to 'ⱥ' (3 bytes).
+// Runs of ASCII are converted 16 or 32 bytes at a time with SIMD kernels picked
+// at runtime. Invalid UTF-8 bytes are copied as is.
+
+// Returns the simple case mapping of the codepoint
+uint32_t str_case_map(uint32_t cp, StrCase to);
+
+// Tells whether the codepoint is cased (an uppercase, lowercase or titlecase letter)
+bool str_case_is_cased(uint32_t cp);
+
+// Returns a copy of the UTF-8 string converted to the given case.
+// Requires str_free()
+String str_to_case(String str, StrCase to, StrCaseFlags flags);
+
+// Converts the heap-allocated UTF-8 string to the given case in place.
+// The buffer only gets reallocated if the encoded length changes
+// (or copied if it is shared, see str_make_shared()).
+void str_case(StrCase to, StrCaseFlags flags, String *str);
+
+#endif // _STRCASE_H
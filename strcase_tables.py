@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# Generates strcase_tables.h from the Unicode database shipped with Python
+#
+#   python3 strcase_tables.py > strcase_tables.h
+
+import sys
+import unicodedata
+
+BLOCK = 64
+
+CASED = 0x1
+
+def simple(c, full, fallback=None):
+    # Python only exposes the full mappings. They differ from the simple ones
+    # when they expand to several codepoints, in which case the simple mapping
+    # is the codepoint itself, or `fallback` when that is a single codepoint.
+    if len(full) == 1: return ord(full)
+    if fallback is not None and len(fallback) == 1 and fallback != c: return ord(fallback)
+    return ord(c)
+
+# Properties of every codepoint: (upper delta, lower delta, title delta, flags)
+props = [(0, 0, 0, 0)]
+props_index = {props[0]: 0}
+cp_props = []
+
+for cp in range(0x110000):
+    c = chr(cp)
+    if 0xD800 <= cp < 0xE000:
+        p = props[0]
+    else:
+        lower_full = c.lower()
+        # U+0130 lowers to i + combining dot above, its simple mapping is the i
+        lower = simple(c, lower_full, lower_full[0] if lower_full[1:2] == '̇' else None)
+        # Greek letters with ypogegrammeni uppercase to the titlecase letter
+        upper = simple(c, c.upper(), c.title())
+        title = simple(c, c.title())
+        flags = CASED if c.islower() or c.isupper() or c.istitle() else 0
+        p = (upper - cp, lower - cp, title - cp, flags)
+
+    if p not in props_index:
+        props_index[p] = len(props)
+        props.append(p)
+    cp_props.append(props_index[p])
+
+assert len(props) < 1 << 16
+
+# Codepoints past the last block with properties are neither cased nor have mappings
+LIMIT = max(cp for cp, p in enumerate(cp_props) if p) // BLOCK * BLOCK + BLOCK
+
+# Two-stage table with deduplicated blocks
+blocks = []
+block_index = {}
+stage1 = []
+for b in range(0, LIMIT, BLOCK):
+    block = tuple(cp_props[b:b + BLOCK])
+    if block not in block_index:
+        block_index[block] = len(blocks)
+        blocks.append(block)
+    stage1.append(block_index[block])
+
+def rows(values, per_line, fmt):
+    for i in range(0, len(values), per_line):
+        print('    ' + ' '.join(fmt(v) + ',' for v in values[i:i + per_line]))
+
+print('// Unicode %s simple case mapping tables (generated by strcase_tables.py, do not edit)' %
+      unicodedata.unidata_version)
+print()
+print('#define CASE_LIMIT 0x%X' % LIMIT)
+print('#define CASE_BLOCK %d' % BLOCK)
+print()
+print('// Codepoint block -> index of the block in CASE_STAGE2')
+print('static const uint%d_t CASE_STAGE1[%d] = {' % (8 if len(blocks) < 256 else 16, len(stage1)))
+rows(stage1, 16, str)
+print('};')
+print()
+print('// Codepoint -> index in CASE_PROPS')
+print('static const uint%d_t CASE_STAGE2[%d][CASE_BLOCK] = {' % (8 if len(props) < 256 else 16, len(blocks)))
+for block in blocks:
+    print('    {')
+    rows(block, 16, str)
+    print('    },')
+print('};')
+print()
+print('static const CaseProps CASE_PROPS[%d] = {' % len(props))
+for upper, lower, title, flags in props:
+    print('    { %6d, %6d, %6d, 0x%x },' % (upper, lower, title, flags))
+print('};')
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strcase.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+// Kernel selections compared against the scalar code
+static const StrCaseFlags KERNELS[] = { 0, STR_CASE_NO_AVX2 };
+
+// Pieces of the random strings: runs of ASCII longer than the kernel blocks,
+// codepoints changing length, titlecase digraphs and invalid bytes
+static const char *PIECES[] = {
+    "a", "Z", " ", "-", "hello ", "WORLD", "o'neil", "3rd",
+    "the Quick brown fox jumps over the lazy dog, AGAIN and again",
+    "\xC8\xBA", "\xC4\xB1", "\xC3\xA9", "\xE2\x84\xAA", "\xC7\x85", "\xF0\x90\x90\xA8",
+    "\xFF", "\xC3",
+};
+
+// Converts the string in place with the given flags and returns the result
+static String convert_inplace(String str, StrCase to, StrCaseFlags flags) {
+    String s = str_clone(str);
+    str_case(to, flags, &s);
+    return s;
+}
+
+// Converts the string with the ASCII letters only, one byte at a time
+static String ascii_reference(String str, StrCase to) {
+    String out = str_nalloc(str.str, str.len);
+    bool cased = false;
+
+    for (size_t i = 0; i < out.len; i++) {
+        char c = out.str[i];
+        bool up = to == STR_CASE_UPPER || (to == STR_CASE_TITLE && !cased);
+
+        if (up && str_isclass(c, STR_CLASS_LOWER)) out.str[i] = c - 0x20;
+        if (!up && str_isclass(c, STR_CLASS_UPPER)) out.str[i] = c + 0x20;
+        cased = str_isclass(c, STR_CLASS_ALPHA);
+    }
+
+    return out;
+}
+
+// Converts random strings to every case with every kernel, in place and copying,
+// and compares the results to the scalar ones. Returns the number of mismatches.
+static size_t check_random(size_t count) {
+    size_t mismatches = 0;
+
+    for (size_t t = 0; t < count; t++) {
+        String str = str_alloc("");
+        for (size_t n = rand() % 40; n--;)
+            str_pushs(str_ref(PIECES[rand() % (sizeof PIECES / sizeof *PIECES)]), &str);
+
+        for (StrCase to = STR_CASE_LOWER; to <= STR_CASE_TITLE; to++) {
+            String want = str_to_case(str, to, STR_CASE_NO_SIMD);
+            String got = convert_inplace(str, to, STR_CASE_NO_SIMD);
+            mismatches += !str_eq(want, got);
+            str_free(&got);
+
+            for (size_t k = 0; k < sizeof KERNELS / sizeof *KERNELS; k++) {
+                got = str_to_case(str, to, KERNELS[k]);
+                mismatches += !str_eq(want, got);
+                str_free(&got);
+
+                got = convert_inplace(str, to, KERNELS[k]);
+                mismatches += !str_eq(want, got);
+                str_free(&got);
+            }
+
+            str_free(&want);
+            want = ascii_reference(str, to);
+            got = str_to_case(str, to, STR_CASE_ASCII);
+            mismatches += !str_eq(want, got);
+            str_free(&got);
+            str_free(&want);
+        }
+
+        str_free(&str);
+    }
+
+    return mismatches;
+}
+
+// Checks the conversion of the string to the given case, copying and in place.
+// Returns the number of mismatches.
+static size_t check_case(const char *str, StrCase to, const char *expected) {
+    String want = str_ref(expected);
+    String got = str_to_case(str_ref(str), to, 0);
+    size_t mismatches = !str_eq(want, got);
+    str_free(&got);
+
+    String s = str_alloc(str);
+    str_case(to, 0, &s);
+    mismatches += !str_eq(want, s);
+    str_free(&s);
+
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    test("str_case_map", {
+        assert_eq((uint32_t)'A', str_case_map('a', STR_CASE_UPPER), "%u");
+        assert_eq((uint32_t)'a', str_case_map('a', STR_CASE_LOWER), "%u");
+        assert_eq((uint32_t)0x1C5, str_case_map(0x1C6, STR_CASE_TITLE), "%u");
+        assert_eq((uint32_t)0x1C4, str_case_map(0x1C6, STR_CASE_UPPER), "%u");
+        // No simple mapping for ß, only the full one to "SS"
+        assert_eq((uint32_t)0xDF, str_case_map(0xDF, STR_CASE_UPPER), "%u");
+        assert_eq((uint32_t)'i', str_case_map(0x130, STR_CASE_LOWER), "%u");
+        assert_eq((uint32_t)0x1F88, str_case_map(0x1F80, STR_CASE_UPPER), "%u");
+        assert_eq((uint32_t)0x10400, str_case_map(0x10428, STR_CASE_UPPER), "%u");
+        assert_eq((uint32_t)0x1F600, str_case_map(0x1F600, STR_CASE_LOWER), "%u");
+
+        assert(str_case_is_cased('x'));
+        assert(str_case_is_cased(0x1C5));
+        assert(!str_case_is_cased('3'));
+    });
+
+    test("str_to_case", {
+        const char *mixed = "Hello, World! ÀÉÎÕÜ àéîõü";
+        assert_eq((size_t)0, check_case(mixed, STR_CASE_UPPER, "HELLO, WORLD! ÀÉÎÕÜ ÀÉÎÕÜ"), "%zu");
+        assert_eq((size_t)0, check_case(mixed, STR_CASE_LOWER, "hello, world! àéîõü àéîõü"), "%zu");
+        assert_eq((size_t)0, check_case(mixed, STR_CASE_TITLE, "Hello, World! Àéîõü Àéîõü"), "%zu");
+
+        assert_eq((size_t)0, check_case("ǅemal ǆ", STR_CASE_UPPER, "ǄEMAL Ǆ"), "%zu");
+        assert_eq((size_t)0, check_case("ǅemal ǆ", STR_CASE_TITLE, "ǅemal ǅ"), "%zu");
+        assert_eq((size_t)0, check_case("ﬁne straße", STR_CASE_UPPER, "ﬁNE STRAßE"), "%zu");
+        assert_eq((size_t)0, check_case("ᾀ ᾈ ΐ", STR_CASE_UPPER, "ᾈ ᾈ ΐ"), "%zu");
+
+        assert_eq((size_t)0, check_case("hello wORLD, 3rd-party o'neil 𐐨𐐨 xyz", STR_CASE_TITLE,
+                                        "Hello World, 3Rd-Party O'Neil 𐐀𐐨 Xyz"), "%zu");
+
+        // Invalid bytes are copied
+        assert_eq((size_t)0, check_case("\xFF" "abc\xC3", STR_CASE_UPPER, "\xFF" "ABC\xC3"), "%zu");
+    });
+
+    test("str_case (length changes)", {
+        // 'ı' and 'ſ' shrink to 1 byte, the Kelvin sign from 3 bytes to 1
+        assert_eq((size_t)0, check_case("ınvalid ſ Ⱥ ⱥ K", STR_CASE_UPPER, "INVALID S Ⱥ Ⱥ K"), "%zu");
+        assert_eq((size_t)0, check_case("ınvalid ſ Ⱥ ⱥ K", STR_CASE_LOWER, "ınvalid ſ ⱥ ⱥ k"), "%zu");
+
+        // 'Ⱥ' grows from 2 to 3 bytes
+        String s = str_alloc("");
+        for (size_t i = 0; i < 100; i++) str_pushs(str_ref("Ⱥ"), &s);
+        str_case(STR_CASE_LOWER, 0, &s);
+        assert_eq((size_t)300, s.len, "%zu");
+        assert(str_startswith(str_ref("ⱥⱥ"), s));
+        str_free(&s);
+
+        // The clones of a shared string keep their case
+        s = str_alloc("shared Ⱥ");
+        str_make_shared(&s);
+        String clone = str_clone(s);
+        str_case(STR_CASE_UPPER, 0, &s);
+        assert_string_eq(str_ref("SHARED Ⱥ"), s);
+        assert_string_eq(str_ref("shared Ⱥ"), clone);
+        str_case(STR_CASE_LOWER, 0, &clone);
+        assert_string_eq(str_ref("shared ⱥ"), clone);
+        str_free(&clone);
+        str_free(&s);
+    });
+
+    test("str_case (ascii)", {
+        String s = str_to_case(str_ref("éa ÀB"), STR_CASE_UPPER, STR_CASE_ASCII);
+        assert_string_eq(str_ref("éA ÀB"), s);
+        str_free(&s);
+    });
+
+    test("str_case (kernels)", {
+        assert_eq((size_t)0, check_random(500), "%zu");
+    });
+
+    return 0;
+}
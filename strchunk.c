@@ -0,0 +1,335 @@
+#include "strchunk.h"
+
+#include <string.h>
+
+/* * * * * * * Rolling hash * * * * * * */
+
+// Random values of the bytes (splitmix64 outputs)
+static const uint64_t GEAR[256] = {
+    0xC84CA231937C00A8, 0x0AE634A6AE78B2BE, 0xC04C5FCAF01F398D, 0x6810F6CC7147BA9F,
+    0x59B910587938AABF, 0xB1A4C85A7DD4EDDB, 0xF914C0739408E3BE, 0xDE34FF735B17055C,
+    0x0920450C9DC32CD3, 0xA059CFCCBF69B5EB, 0xFF5BAAFA2D943F5F, 0x16A739153A9F5B6E,
+    0xA427011AB50D9C6C, 0xCDFCEA8A2BDB6B81, 0xB091D22F33900886, 0xEDE0F47F9E36F388,
+    0xCC99B2EAA8B899EB, 0xC65AF4FB29F1EC88, 0xAC2CFFA45047D782, 0x44335E43DCAB1631,
+    0x499FF1B7A30C8BB6, 0x4F6BD7D33438FC98, 0x11E1B06C951E0376, 0x795A58611233DC00,
+    0x36E1689DF40A6091, 0xF43BA4CD427B5118, 0xE5068B848A79E8D6, 0xA848AE2909686525,
+    0x7ED9B77272B5359B, 0x341FF081B3E187F3, 0x9E6CD1A8C087762E, 0xE695D818AA958A7D,
+    0xDBA78207DEA6D423, 0x4F85A624CEB951E2, 0x82E5F5D306E8036B, 0x0BED503E520B9727,
+    0x66CB08AB51BB6C98, 0xF63D536A9B45D88E, 0xB1C6A12F163163C7, 0x1E42C44DA033A38C,
+    0xF008F045ECB947E6, 0x68BB7AE8C9D4417E, 0xEBC011572B952D48, 0xC315E9858D3FA600,
+    0xE6058B278013C9E0, 0xF0B4130122D20635, 0x75DBA54FAE78287E, 0xBB6D9A5ADC2E8C04,
+    0x3E72C026C57A3D27, 0xD49AD0DECFB5DA57, 0xF10222A64788BE36, 0x7940844ED7D91C83,
+    0xCB31945F94706A29, 0x03A78E808F3E42C2, 0x6AF317157FDF6412, 0x63C242E3B1845E0B,
+    0xB47AABC58C716CFD, 0x1E8673A5AE0FDC22, 0xBE6B1258CC73132D, 0xE7BC9338589070DB,
+    0x8AECB1BFC4C88200, 0xE6E728BF3051B58C, 0x83F663A983E22425, 0x9D45ED8374CF37A3,
+    0xAEB2C88B9EBAF03B, 0x0CC767708E6B5BA8, 0x3BC5EFC41580F308, 0xB90FA2AEFD19B757,
+    0x6900FC0B2066CEF7, 0x878981D97A314105, 0x0EE8259674190A4F, 0xA76948EE83501D6E,
+    0x6C11B1FB4893BF28, 0xCA9E3B62AB9EA268, 0xA17F169367BC632F, 0x57A3B7622B61162F,
+    0x156472ECF8D3F047, 0xC2B6BEB024825094, 0x21C4C18CF040E284, 0x09790417AA115B26,
+    0xF4113847BDF6B669, 0xB3D060251DD42D3A, 0xBA1104EF8BA1395A, 0xA1D7130D8428F85B,
+    0x0BA3FF7C7F3B08A5, 0x728F395ADFC00C41, 0xC88127CA2A5BB41E, 0xD3A89B8B98131489,
+    0x3E0FD9DB3DDB1704, 0xBA11A7A6BAE486CA, 0x55EB28F89DDC4868, 0x0790583942C9B334,
+    0xF6457723619A8C87, 0x21B996802EA8E7FF, 0x6C0A688D8A902CD8, 0xDF7C84A8F848B42E,
+    0x9C5B9F2CDE550AD4, 0xDB924311C09879B8, 0xB8725A7E2AD8A701, 0xB237DA604AFDE8F6,
+    0xC05CC65959B9E773, 0xE0AF356CFA744183, 0xAD1AAB4448C958C9, 0x265511931D6D5DF3,
+    0xD86A03CC0B1C29FB, 0xC2DAA14CAA20551F, 0x8D6C759D8145948A, 0xE276A0F5900C84F0,
+    0x17E9AF37DE2FA944, 0xB94F5D1A9E143E54, 0x14B403877165C326, 0xB964D8802501756C,
+    0xD506E8795152F325, 0x0F5CCFE0002265D3, 0x53F7A0BCD148F639, 0xF8D8542ABC74DDB0,
+    0xAEA7604A12FA2C43, 0x07FC45D9B3983CD8, 0x2A0F7D169F86E4D5, 0xD9C159A4EC5F95D3,
+    0x6904DCEAF8B0FCF2, 0xEF2C1EBAEF0A5358, 0xB7AC3DCB9D1937C0, 0x917F1F7664E86D1F,
+    0x4049DAE84DF25153, 0x1B5D1C7F8C541388, 0xE6CF06E32CBA9374, 0x96ACFE78BB7823E7,
+    0xAA49BA76ED38D766, 0xAA921B67BDCC0D65, 0xCC9C98987B3C92EE, 0xDD22C4E7C830144A,
+    0x083617D929388D85, 0x5B5D56C046537091, 0xD41BB570216019C0, 0xB8D2C70DB10FB166,
+    0xA21A3DB819B6CAAE, 0xB609588B5265D585, 0x5950702B6BB4A485, 0x4AC695C9E3D0919A,
+    0x00B6AF6AE0A91CBE, 0xD0FE5ABB28202977, 0x5D5DDA2A6D827FFC, 0x87E77406ACDF67FC,
+    0x337A0E60A10A55C0, 0xC1241366F5AA70EA, 0x703B37954E8CD21E, 0x5A2CCBA2E46A423E,
+    0x853511B872FCEDAA, 0xD5D8144E918A7D57, 0xF6ACE16BCCEE38BC, 0x3ACA2D15C0647AF1,
+    0x76360ADF4B02836B, 0x621A26EE85D6DC41, 0x93E62AFC95B2E0D4, 0x44A0A1FBD5333FC3,
+    0x3656F85842AE6175, 0x0DF906DFFB512E30, 0xBF5E9D930E30D484, 0x732E4378E6B90BE8,
+    0x6C6DD6C85308F10E, 0xD56CF9DA93DCDEE2, 0xEBC8A33A43CA1BFF, 0xD929AB650B088BD5,
+    0x9E3AA70CEA816AF0, 0x6D07815FB52EDCF3, 0x7974C7D1F4BC047D, 0x7FB683233A13AF05,
+    0x09A6B0769D802C78, 0xE84BE88BD5781DC6, 0x1A5929EB00BFADC9, 0x66F3146C06246505,
+    0x7F20E2FD18835CE2, 0x047EF1837EDD2FC1, 0xFA9027E6D57A14C4, 0xFACD6DB7A4A801F7,
+    0x1C03DDB862F5F4EE, 0x0CC1DF521FF484D1, 0xA813D49010A7035C, 0x676219D8D531910A,
+    0x3CB8D4384AFFFE9E, 0xFA5F8E98FDC2CFB7, 0x40271FDCC4F180C7, 0xE357C5DDA2A51497,
+    0xEA35508F8BCF7662, 0x60C831FAE9CE6569, 0xA0A22D7FC1FB31B3, 0x35E40C31380D98C4,
+    0x4AF315CE15A651EE, 0x35E6A98C7B46122A, 0x099541BDDC0A3615, 0x4C5F17223E6058F6,
+    0xDD6648853DBE4B8E, 0x71F5BFDAADEA2896, 0xC89289405A295277, 0xF8A66B224B5E2877,
+    0x564C18167C7104D3, 0x73CE5B70B7C357BC, 0x583E95D6A6800825, 0x01F81D465F9BBE0E,
+    0x64F3807752C0A523, 0x4CA57420397F7B9B, 0xD03C33D95497956F, 0x8C0D8A8FF6F30CE4,
+    0xBA2B4FAECF1312A2, 0xF7D27F6897E6F727, 0x7C3213F3FC935256, 0xF6DAA2D991A452DE,
+    0xC97E5B09053B9767, 0xCC4DBB07657A8004, 0x74D38FCA6B4303F9, 0x8F417E326AF0F5A0,
+    0x97C35D6EC2EB05E2, 0x3E0D55C3682E57D8, 0xAB77133677287C77, 0x9FA3F4F6E18FEED0,
+    0x0FFC75580AB2F754, 0x040350BB217AE7C2, 0xD512B242841E91EC, 0xE2CDCA73485F5CDB,
+    0xC9A9842FFE439E4B, 0x6ACCE894A7F7E9F6, 0xBE4D6D3AAC641507, 0xDFECF9E994B91211,
+    0x8C7955941755E826, 0xA69C4A6C5C93A4DE, 0x262D98D20A7329D4, 0x7238462EACE81FCF,
+    0x2B8B1E1125CFFA8E, 0x8C9D9E73E70522AA, 0x856B9B472A3843F5, 0xA5EA55D3CED96DC5,
+    0xB17775245C150DE2, 0xD2BC675D76F91800, 0x2E504D2018385338, 0x2C9C3BBAC1651864,
+    0x3F6BF48BB9A9C2EA, 0xCEE017EEEBC9D040, 0x11A740F7B3573D30, 0xDA5095C921FD9A6D,
+    0xB2561434E7C5C21B, 0xBAC66B62E40ED3A9, 0x7F38EF9A4F7FF9BA, 0xF1064B063504CDC1,
+    0x61AEAE44392C1886, 0x6E2C8125E5AE4E1F, 0x7011C7DBA47D6FF4, 0x379735F6B6659345,
+    0x0AB69CA035E8C7C0, 0x8D96C407512D58A3, 0x1E11E0C7CCD0831B, 0xF15E324136276E9B,
+    0xAD25028B20D1E77C, 0xBD95A3A1F8642979, 0x039E5BA0ECD5DA8C, 0xFDFFB35B531CAF39,
+};
+
+uint64_t str_gear_hash(String str) {
+    const uint8_t *s = (const uint8_t *)str.str;
+    uint64_t h = 0;
+
+    for (size_t i = 0; i < str.len; i++) h = (h << 1) + GEAR[s[i]];
+    return h;
+}
+
+/* * * * * * * Content-defined chunking * * * * * * */
+
+// `bits` one bits right below the top bit. The top bits of the hash depend on the
+// most bytes, and keeping bit 63 clear allows rolling two bytes at once (see roll()).
+static inline uint64_t boundary_mask(unsigned bits) {
+    return (((uint64_t)1 << bits) - 1) << (63 - bits);
+}
+
+// Rolls the hash over s[*pos..end) until the bits of the mask are all zero.
+// Returns true with *pos past the byte that made them zero, or false with *pos at
+// `end` and the hash updated. Two bytes are rolled per step, as
+// h2 = (h0 << 2) + (GEAR[a] << 1) + GEAR[b] and h1 << 1 (the first half) has the
+// mask bits of h1 shifted by one.
+static inline bool roll(uint64_t *hash, const uint8_t *s, size_t *pos, size_t end, uint64_t mask) {
+    uint64_t h = *hash;
+    size_t i = *pos;
+
+    for (; i + 2 <= end; i += 2) {
+        h = (h << 2) + (GEAR[s[i]] << 1);
+        if (!(h & mask << 1)) {
+            *pos = i + 1;
+            return true;
+        }
+
+        h += GEAR[s[i + 1]];
+        if (!(h & mask)) {
+            *pos = i + 2;
+            return true;
+        }
+    }
+
+    *pos = end;
+    if (i < end) {
+        h = (h << 1) + GEAR[s[i]];
+        if (!(h & mask)) return true;
+    }
+
+    *hash = h;
+    return false;
+}
+
+StrChunker str_chunker(String str, size_t min, size_t avg, size_t max) {
+    if (!avg) avg = STR_CHUNK_AVG;
+    if (avg < 64) avg = 64;
+
+    // Round the average down to a power of two
+    unsigned bits = 63 - __builtin_clzll(avg);
+    avg = (size_t)1 << bits;
+
+    if (!min) min = avg / 4;
+    if (!max) max = avg * 8;
+    if (min < 64)  min = 64;
+    if (min > avg) min = avg;
+    if (max < avg) max = avg;
+
+    // Normalized chunking: boundaries are 4 times less likely than 1 / avg until
+    // the average size, and 4 times more likely after it
+    return (StrChunker){
+        .str    = str,
+        .min    = min,
+        .avg    = avg,
+        .max    = max,
+        .mask_s = boundary_mask(bits + 2),
+        .mask_l = boundary_mask(bits - 2),
+    };
+}
+
+size_t str_chunk_len(const StrChunker *c, String str) {
+    const uint8_t *s = (const uint8_t *)str.str;
+    size_t n = str.len;
+
+    // The first bytes of a chunk are skipped, their boundaries would be too close
+    if (n <= c->min) return n;
+    if (n > c->max) n = c->max;
+
+    size_t normal = c->avg < n ? c->avg : n;
+    uint64_t h = 0;
+
+    size_t i = c->min;
+    if (roll(&h, s, &i, normal, c->mask_s)) return i;
+
+    roll(&h, s, &i, n, c->mask_l);
+    return i;
+}
+
+bool str_chunk_next(StrChunker *c, String *out) {
+    if (c->pos >= c->str.len) return false;
+
+    String rest = str_nref(c->str.str + c->pos, c->str.len - c->pos);
+    size_t len = str_chunk_len(c, rest);
+
+    *out = str_nref(rest.str, len);
+    c->pos += len;
+    return true;
+}
+
+/* * * * * * * Multi-needle search * * * * * * */
+
+// Slot of a key, by multiplicative hashing (the top bits of the window hash mostly
+// depend on the first byte of the window when the shift is large)
+#define GOLDEN 0x9E3779B97F4A7C15ull
+
+static inline size_t slot_of(uint64_t key, unsigned bits) {
+    return (key * GOLDEN) >> (64 - bits);
+}
+
+// Number of 64-bit words of the filter
+static inline size_t filter_words(const StrMultiSearch *m) {
+    return ((size_t)1 << m->filter_bits) / 64;
+}
+
+StrMultiSearch str_multi_search_new(const String *needles, size_t count) {
+    StrMultiSearch m = {0};
+    if (!count || !needles[0].len) return m;
+
+    m.len   = needles[0].len;
+    m.cap   = count;
+    m.alloc = str_allocator_slot(NULL);
+
+    // Every byte of the window shifts the hash by up to 8 bits (the entropy of a byte)
+    // while the window fits in the 64 bits, so that short needles still hash to many bits
+    size_t shift = 64 / m.len;
+    m.shift = shift < 1 ? 1 : shift > 8 ? 8 : shift;
+    m.mask = m.shift * m.len >= 64 ? UINT64_MAX : ((uint64_t)1 << (m.shift * m.len)) - 1;
+
+    // At most a quarter of the slots are used, and 1 / 256 of the filter bits
+    m.bits = 4;
+    while (((size_t)1 << m.bits) < 4 * count) m.bits++;
+    m.filter_bits = m.bits + 6;
+
+    size_t size = (size_t)1 << m.bits;
+    m.bytes  = str_mem_alloc_with(m.alloc, count * m.len);
+    m.index  = str_mem_alloc_with(m.alloc, count * sizeof *m.index);
+    m.next   = str_mem_alloc_with(m.alloc, count * sizeof *m.next);
+    m.hashes = str_mem_alloc_with(m.alloc, size * sizeof *m.hashes);
+    m.slots  = str_mem_alloc_with(m.alloc, size * sizeof *m.slots);
+    m.filter = str_mem_alloc_with(m.alloc, filter_words(&m) * sizeof *m.filter);
+    memset(m.slots, 0, size * sizeof *m.slots);
+    memset(m.filter, 0, filter_words(&m) * sizeof *m.filter);
+
+    for (size_t k = 0; k < count; k++) {
+        const uint8_t *s = (const uint8_t *)needles[k].str;
+        if (needles[k].len != m.len) continue;
+
+        uint64_t h = 0;
+        for (size_t i = 0; i < m.len; i++) h = (h << m.shift) + GEAR[s[i]];
+        h &= m.mask;
+
+        size_t slot = slot_of(h, m.bits);
+        while (m.slots[slot] && m.hashes[slot] != h) slot = (slot + 1) & (size - 1);
+
+        // Chain the needles with the same hash, skipping duplicates
+        uint32_t *link = &m.slots[slot];
+        bool dup = false;
+        for (; *link && !dup; link = &m.next[*link - 1])
+            dup = !memcmp(m.bytes + (*link - 1) * m.len, s, m.len);
+        if (dup) continue;
+
+        memcpy(m.bytes + m.count * m.len, s, m.len);
+        m.index[m.count] = k;
+        m.next[m.count] = 0;
+        size_t bit = slot_of(h, m.filter_bits);
+        m.filter[bit / 64] |= (uint64_t)1 << bit % 64;
+        m.hashes[slot] = h;
+        *link = ++m.count;
+    }
+
+    return m;
+}
+
+void str_multi_search_free(StrMultiSearch *m) {
+    if (!m->len) return;
+
+    size_t size = (size_t)1 << m->bits;
+    str_mem_free_with(m->alloc, m->bytes, m->cap * m->len);
+    str_mem_free_with(m->alloc, m->index, m->cap * sizeof *m->index);
+    str_mem_free_with(m->alloc, m->next, m->cap * sizeof *m->next);
+    str_mem_free_with(m->alloc, m->hashes, size * sizeof *m->hashes);
+    str_mem_free_with(m->alloc, m->slots, size * sizeof *m->slots);
+    str_mem_free_with(m->alloc, m->filter, filter_words(m) * sizeof *m->filter);
+    *m = (StrMultiSearch){0};
+}
+
+// Looks up the key of the window ending before s[end] and reports a match.
+// Returns false if the callback stops the search.
+static inline bool probe(const StrMultiSearch *m, uint64_t key,
+                         const uint8_t *s, size_t end, StrMultiSearchFn fn, void *ctx,
+                         size_t *matches) {
+    // Most windows are ruled out by the filter
+    size_t bit = slot_of(key, m->filter_bits);
+    if (!(m->filter[bit / 64] >> bit % 64 & 1)) return true;
+
+    const size_t wrap = ((size_t)1 << m->bits) - 1;
+    const size_t len = m->len;
+    size_t slot = slot_of(key, m->bits);
+
+    for (; m->slots[slot]; slot = (slot + 1) & wrap) {
+        if (m->hashes[slot] != key) continue;
+
+        const uint8_t *window = s + end - len;
+        for (uint32_t k = m->slots[slot]; k; k = m->next[k - 1]) {
+            if (memcmp(window, m->bytes + (k - 1) * len, len)) continue;
+
+            (*matches)++;
+            return !fn || fn(ctx, window - s, m->index[k - 1]);
+        }
+        break;
+    }
+
+    return true;
+}
+
+size_t str_multi_search(const StrMultiSearch *m, String haystack,
+                        StrMultiSearchFn fn, void *ctx) {
+    const uint8_t *s = (const uint8_t *)haystack.str;
+    const size_t n = haystack.len;
+    size_t len = m->len;
+    if (!m->count || n < len) return 0;
+
+    const unsigned shift = m->shift;
+    const uint64_t mask = m->mask;
+    size_t matches = 0;
+
+    // The hash of the first window is complete at its last byte
+    uint64_t h = 0;
+    for (size_t i = 0; i + 1 < len; i++) h = (h << shift) + GEAR[s[i]];
+
+    // Four bytes are rolled per step: the hashes of the windows ending at every byte
+    // only depend on the hash before the step, which keeps the dependency chain short
+    size_t i = len - 1;
+    for (; i + 4 <= n; i += 4) {
+        uint64_t g1 = GEAR[s[i]];
+        uint64_t g2 = (g1 << shift) + GEAR[s[i + 1]];
+        uint64_t g3 = (g2 << shift) + GEAR[s[i + 2]];
+        uint64_t g4 = (g3 << shift) + GEAR[s[i + 3]];
+        uint64_t h1 = (h << shift) + g1;
+        uint64_t h2 = (h << 2 * shift) + g2;
+        uint64_t h3 = (h << 3 * shift) + g3;
+        h = (h << 4 * shift) + g4;
+
+        if (!probe(m, h1 & mask, s, i + 1, fn, ctx, &matches)) return matches;
+        if (!probe(m, h2 & mask, s, i + 2, fn, ctx, &matches)) return matches;
+        if (!probe(m, h3 & mask, s, i + 3, fn, ctx, &matches)) return matches;
+        if (!probe(m, h & mask, s, i + 4, fn, ctx, &matches)) return matches;
+    }
+
+    for (; i < n; i++) {
+        h = (h << shift) + GEAR[s[i]];
+        if (!probe(m, h & mask, s, i + 1, fn, ctx, &matches)) return matches;
+    }
+
+    return matches;
+}
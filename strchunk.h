@@ -0,0 +1,98 @@
+#ifndef _STRCHUNK_H
+#define _STRCHUNK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+/* * * * * * * Rolling hash * * * * * * */
+
+// Both the chunker and the multi-needle search roll a Gear hash over the bytes:
+//   hash = (hash << shift) + GEAR[byte]
+// with a table of 256 random 64-bit values. A byte stops contributing to the hash
+// after 64 / shift bytes, and the low `shift * n` bits only depend on the last `n`.
+
+// Returns the Gear hash of the bytes, with a shift of 1 (as used by the chunker).
+// Only the last 64 bytes make a difference.
+uint64_t str_gear_hash(String str);
+
+/* * * * * * * Content-defined chunking * * * * * * */
+
+// Default chunk sizes
+#define STR_CHUNK_AVG (8 << 10)
+#define STR_CHUNK_MIN (STR_CHUNK_AVG / 4)
+#define STR_CHUNK_MAX (STR_CHUNK_AVG * 8)
+
+// Splits a string into chunks whose boundaries depend on the content around them
+// (FastCDC), so that an insertion or a deletion only changes the chunks around it.
+// Identical runs of data in different strings produce mostly identical chunks,
+// which makes them a good unit of deduplication.
+typedef struct {
+    String   str;    // string being split (by reference, has to outlive the chunker)
+    size_t   pos;    // offset of the next chunk
+    size_t   min;    // chunk size limits
+    size_t   avg;
+    size_t   max;
+    uint64_t mask_s; // boundary mask below the average size (harder to match)
+    uint64_t mask_l; // boundary mask above the average size (easier to match)
+} StrChunker;
+
+// Creates a chunker over the string. Sizes of 0 are replaced by the defaults (the
+// minimum and maximum default to a quarter and 8 times the average). The average
+// is rounded down to a power of two, and the sizes are adjusted so that
+// 64 <= min <= avg <= max.
+StrChunker str_chunker(String str, size_t min, size_t avg, size_t max);
+
+// Writes the next chunk (by reference) to `out` and returns true,
+// or returns false when the whole string has been split.
+// The chunks are at least `min` bytes long (except the last one) and at most `max`,
+// and their lengths follow a normal-like distribution around `avg`.
+bool str_chunk_next(StrChunker *chunker, String *out);
+
+// Returns the length of the first chunk of the string, as str_chunk_next() would
+// (the bytes past `max` are never read, so this can run over a growing buffer)
+size_t str_chunk_len(const StrChunker *chunker, String str);
+
+/* * * * * * * Multi-needle search * * * * * * */
+
+// Set of needles of the same length, searched for at once by rolling the Gear hash
+// over the haystack and looking up the hash of every window in a bit filter, then in
+// a table of the needle hashes. Candidate positions are verified, so hash collisions
+// only cost time.
+typedef struct {
+    size_t    len;          // length of the needles
+    size_t    count;        // number of distinct needles
+    size_t    cap;          // number of needles given
+    char     *bytes;        // distinct needles back to back (count * len bytes)
+    uint32_t *index;        // index of every distinct needle among the needles given
+    uint32_t *next;         // next distinct needle + 1 with the same hash, 0 for none
+    unsigned  shift;        // shift of the hash, so that the window fills as many bits as possible
+    uint64_t  mask;         // bits of the hash that only depend on the window
+    unsigned  bits;         // log2 of the number of table slots
+    uint64_t *hashes;       // hash of the needles of every slot
+    uint32_t *slots;        // first distinct needle + 1 of every slot, 0 for an empty slot
+    unsigned  filter_bits;  // log2 of the number of filter bits
+    uint64_t *filter;       // bit of the hash of every needle, checked before the table
+    unsigned  alloc;        // allocator slot of the arrays
+} StrMultiSearch;
+
+// Called for every match in haystack order with the offset of the match and the index
+// of the needle (for duplicate needles, the first one). Returning false stops the search.
+typedef bool (*StrMultiSearchFn)(void *ctx, size_t offset, size_t needle);
+
+// Prepares the search for the given needles, which must all have the same non-zero
+// length (the needles of a different length than the first one are ignored).
+// Requires str_multi_search_free()
+StrMultiSearch str_multi_search_new(const String *needles, size_t count);
+
+// Frees the memory allocated for the search
+void str_multi_search_free(StrMultiSearch *search);
+
+// Searches the haystack for all needles, calling `fn` (if not NULL) for every match.
+// Overlapping matches are all reported. Returns the number of matches.
+size_t str_multi_search(const StrMultiSearch *search, String haystack,
+                        StrMultiSearchFn fn, void *ctx);
+
+#endif // _STRCHUNK_H
@@ -0,0 +1,265 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strchunk.h"
+
+#define MAX_MATCHES 4096
+
+// Matches collected by the callback
+typedef struct {
+    size_t count;
+    size_t limit; // stop after this many matches (0 for no limit)
+    size_t offset[MAX_MATCHES];
+    size_t needle[MAX_MATCHES];
+} Collected;
+
+static bool collect(void *ctx, size_t offset, size_t needle) {
+    Collected *c = ctx;
+
+    if (c->count < MAX_MATCHES) {
+        c->offset[c->count] = offset;
+        c->needle[c->count] = needle;
+    }
+
+    return ++c->count != c->limit;
+}
+
+static Collected got;
+
+// Needles of the same length, with a duplicate and one of another length
+static String NEEDLES[5];
+
+// Random bytes from a few different values, so that needles occur
+static String random_text(size_t len, int values) {
+    String text = str_alloc("");
+    str_reserve(len, &text);
+    for (size_t i = 0; i < len; i++) text.str[i] = 'a' + rand() % values;
+    text.len = len;
+    return text;
+}
+
+// Length of the first chunk, rolling the hash one byte at a time
+static size_t reference_len(const StrChunker *c, String str) {
+    size_t n = str.len;
+    if (n <= c->min) return n;
+    if (n > c->max) n = c->max;
+
+    size_t normal = c->avg < n ? c->avg : n;
+
+    for (size_t end = c->min + 1; end <= n; end++) {
+        // The hash only depends on the last 64 bytes
+        size_t start = end - c->min > 64 ? end - 64 : c->min;
+        uint64_t h = str_gear_hash(str_nref(str.str + start, end - start));
+        if (!(h & (end <= normal ? c->mask_s : c->mask_l))) return end;
+    }
+
+    return n;
+}
+
+// Compares str_chunk_len() with the reference on random texts.
+// Returns the number of mismatches, and counts the cuts at exactly avg in `at_avg`.
+static size_t check_reference(size_t count, size_t *at_avg) {
+    StrChunker c = str_chunker(str_ref(""), 0, 128, 0);
+    size_t mismatches = 0;
+
+    for (size_t t = 0; t < count; t++) {
+        String text = random_text(c.max + 64, 256);
+        size_t want = reference_len(&c, text);
+
+        mismatches += str_chunk_len(&c, text) != want;
+        *at_avg += want == c.avg;
+        str_free(&text);
+    }
+
+    return mismatches;
+}
+
+// Splits the text and checks the sizes and the concatenation of the chunks.
+// Returns the number of chunks, or 0 if a check fails.
+static size_t check_chunks(String text, size_t min, size_t avg, size_t max, String *chunks) {
+    StrChunker c = str_chunker(text, min, avg, max);
+    String chunk;
+    size_t n = 0, pos = 0;
+
+    while (str_chunk_next(&c, &chunk)) {
+        if (chunk.str != text.str + pos) return 0;
+        if (chunk.len > c.max || !chunk.len) return 0;
+        if (chunk.len < c.min && pos + chunk.len != text.len) return 0;
+
+        pos += chunk.len;
+        chunks[n++] = chunk;
+    }
+
+    return pos == text.len ? n : 0;
+}
+
+// Searches random texts for random needles and compares to a brute force search.
+// Returns the number of mismatches.
+static size_t check_multi_search(size_t len, size_t nlen, size_t count, int values) {
+    String text = random_text(len, values);
+    String *needles = malloc(count * sizeof *needles);
+    size_t mismatches = 0;
+
+    for (size_t k = 0; k < count; k++) {
+        // Some needles are taken from the text, some are duplicates
+        size_t at = rand() % (len - nlen);
+        needles[k] = k % 5 == 4 ? needles[k - 1] : random_text(nlen, values);
+        if (k % 2) memcpy(needles[k].str, text.str + at, nlen);
+    }
+
+    StrMultiSearch search = str_multi_search_new(needles, count);
+    memset(&got, 0, sizeof got);
+    size_t matches = str_multi_search(&search, text, collect, &got);
+
+    size_t expected = 0;
+    for (size_t i = 0; i + nlen <= len; i++) {
+        for (size_t k = 0; k < count; k++) {
+            if (memcmp(text.str + i, needles[k].str, nlen)) continue;
+
+            if (expected < MAX_MATCHES)
+                mismatches += got.offset[expected] != i || got.needle[expected] != k;
+            expected++;
+            break;
+        }
+    }
+    mismatches += matches != expected || got.count != expected;
+
+    str_multi_search_free(&search);
+    for (size_t k = 0; k < count; k++)
+        if (k % 5 != 4) str_free(&needles[k]);
+    free(needles);
+    str_free(&text);
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    NEEDLES[0] = str_ref("abc");
+    NEEDLES[1] = str_ref("bcd");
+    NEEDLES[2] = str_ref("xyz");
+    NEEDLES[3] = str_ref("abc");
+    NEEDLES[4] = str_ref("toolong");
+
+    test("str_gear_hash", {
+        String a = str_ref("the same 64 bytes at the end of the string give the same hash....");
+        String b = str_fmt("different start, %.*s", STR_FMT_ARGS(a));
+        assert(a.len > 64);
+
+        assert(str_gear_hash(str_slice_ref(a, a.len - 64, 64)) == str_gear_hash(str_slice_ref(b, b.len - 64, 64)));
+        assert(str_gear_hash(a) == str_gear_hash(b));
+        assert(str_gear_hash(str_slice_ref(a, 0, 64)) != str_gear_hash(str_slice_ref(a, 1, 64)));
+        str_free(&b);
+    });
+
+    test("str_chunker", {
+        StrChunker c = str_chunker(str_ref(""), 0, 0, 0);
+        assert_eq((size_t)STR_CHUNK_MIN, c.min, "%zu");
+        assert_eq((size_t)STR_CHUNK_AVG, c.avg, "%zu");
+        assert_eq((size_t)STR_CHUNK_MAX, c.max, "%zu");
+
+        c = str_chunker(str_ref(""), 1, 3000, 100);
+        assert_eq((size_t)64, c.min, "%zu");
+        assert_eq((size_t)2048, c.avg, "%zu");
+        assert_eq((size_t)2048, c.max, "%zu");
+
+        String chunk;
+        assert(!str_chunk_next(&c, &chunk));
+    });
+
+    test("str_chunk_next", {
+        static String chunks[4096];
+        String text = random_text(1 << 20, 256);
+
+        size_t n = check_chunks(text, 0, 4096, 0, chunks);
+        assert(n > 0);
+        // Lengths are around the average
+        assert(n > (1 << 20) / 4096 / 2 && n < (1 << 20) / 4096 * 2);
+
+        // Tiny strings are a single chunk
+        assert_eq((size_t)1, check_chunks(str_ref("tiny"), 0, 0, 0, chunks), "%zu");
+
+        // Uniform data is cut into identical chunks
+        String zeros = str_alloc("");
+        for (size_t i = 0; i < 10000; i++) str_push('z', &zeros);
+        n = check_chunks(zeros, 64, 256, 2048, chunks);
+        assert(n > 1);
+        for (size_t i = 1; i + 1 < n; i++) assert_eq(chunks[0].len, chunks[i].len, "%zu");
+        str_free(&zeros);
+
+        str_free(&text);
+    });
+
+    test("str_chunk_len", {
+        size_t at_avg = 0;
+        assert_eq((size_t)0, check_reference(5000, &at_avg), "%zu");
+        // Boundaries on the last byte before the normal size were cut
+        assert(at_avg > 0);
+    });
+
+    test("str_chunk_next (shift)", {
+        static String before[1024];
+        static String after[1024];
+        String text = random_text(1 << 20, 256);
+        size_t n = check_chunks(text, 0, 4096, 0, before);
+
+        // Inserting bytes in the middle only changes the chunks around them
+        String edited = str_clone(text);
+        str_inserts(str_ref("inserted bytes"), text.len / 2, &edited);
+        size_t m = check_chunks(edited, 0, 4096, 0, after);
+        assert(n > 0 && m > 0);
+
+        size_t same = 0;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < n && j < m) {
+            // Offsets in the original text
+            size_t a = before[i].str - text.str;
+            size_t b = after[j].str - edited.str;
+            if (b > text.len / 2) b -= 14;
+
+            if (a == b) same += str_eq(before[i], after[j]);
+            if (a <= b) i++;
+            else j++;
+        }
+        assert(same + 3 >= n);
+
+        str_free(&edited);
+        str_free(&text);
+    });
+
+    test("str_multi_search", {
+        StrMultiSearch search = str_multi_search_new(NEEDLES, 5);
+        assert_eq((size_t)3, search.count, "%zu");
+
+        memset(&got, 0, sizeof got);
+        size_t n = str_multi_search(&search, str_ref("abcdxyzabc"), collect, &got);
+        assert_eq((size_t)4, n, "%zu");
+        assert_eq((size_t)1, got.offset[1], "%zu");
+        assert_eq((size_t)1, got.needle[1], "%zu");
+        assert_eq((size_t)0, got.needle[3], "%zu");
+
+        memset(&got, 0, sizeof got);
+        got.limit = 2;
+        assert_eq((size_t)2, str_multi_search(&search, str_ref("abcdxyzabc"), collect, &got), "%zu");
+        assert_eq((size_t)0, str_multi_search(&search, str_ref("ab"), NULL, NULL), "%zu");
+        str_multi_search_free(&search);
+
+        search = str_multi_search_new(NEEDLES, 0);
+        assert_eq((size_t)0, str_multi_search(&search, str_ref("abc"), NULL, NULL), "%zu");
+        str_multi_search_free(&search);
+    });
+
+    test("str_multi_search (random)", {
+        assert_eq((size_t)0, check_multi_search(5000, 1, 3, 8), "%zu");
+        assert_eq((size_t)0, check_multi_search(5000, 3, 20, 4), "%zu");
+        assert_eq((size_t)0, check_multi_search(20000, 8, 100, 2), "%zu");
+        assert_eq((size_t)0, check_multi_search(20000, 13, 50, 2), "%zu");
+        assert_eq((size_t)0, check_multi_search(20000, 100, 10, 2), "%zu");
+    });
+
+    return 0;
+}
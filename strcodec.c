@@ -0,0 +1,594 @@
+#include "strcodec.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CODEC_X86
+#include <immintrin.h>
+
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#define TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+static const char HEX_LOWER[] = "0123456789abcdef";
+static const char HEX_UPPER[] = "0123456789ABCDEF";
+
+static const char B64_STD[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char B64_URL[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Instruction sets of the kernels
+typedef enum { ISA_SCALAR, ISA_SSE, ISA_AVX2 } Isa;
+
+// Best instruction set supported by the CPU and allowed by the flags
+static Isa isa(StrCodecFlags flags) {
+#ifdef CODEC_X86
+    if (flags & STR_CODEC_NO_SIMD) return ISA_SCALAR;
+    if (!(flags & STR_CODEC_NO_AVX2) && __builtin_cpu_supports("avx2")) return ISA_AVX2;
+    if (__builtin_cpu_supports("ssse3")) return ISA_SSE;
+#endif
+    return ISA_SCALAR;
+}
+
+static inline int hex_value(uint8_t c) {
+    if ((unsigned)(c - '0') < 10) return c - '0';
+    c |= 0x20;
+    if ((unsigned)(c - 'a') < 6) return c - 'a' + 10;
+    return -1;
+}
+
+static inline int b64_value(uint8_t c, bool url) {
+    if ((unsigned)(c - 'A') < 26) return c - 'A';
+    if ((unsigned)(c - 'a') < 26) return c - 'a' + 26;
+    if ((unsigned)(c - '0') < 10) return c - '0' + 52;
+    if (c == (url ? '-' : '+')) return 62;
+    if (c == (url ? '_' : '/')) return 63;
+    return -1;
+}
+
+/* * * * * * * Hex kernels * * * * * * */
+
+// The kernels process whole blocks and return the number of input bytes consumed.
+// Decoders stop at the first block with an invalid character.
+
+#ifdef CODEC_X86
+
+TARGET_SSSE3
+static size_t hex_encode_sse(char *out, const uint8_t *src, size_t n, const char *digits) {
+    const __m128i lut  = _mm_loadu_si128((const __m128i *)digits);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v  = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+        __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, mask));
+
+        _mm_storeu_si128((__m128i *)(out + 2 * i),      _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i *)(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+
+    return i;
+}
+
+TARGET_AVX2
+static size_t hex_encode_avx2(char *out, const uint8_t *src, size_t n, const char *digits) {
+    const __m256i lut  = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)digits));
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v  = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+        __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, mask));
+
+        // Unpacking interleaves within 128-bit lanes, put the lanes back in order
+        __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256((__m256i *)(out + 2 * i),      _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+
+    return i;
+}
+
+TARGET_SSSE3
+static size_t hex_decode_sse(uint8_t *out, const char *src, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i c     = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i digit = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+        __m128i alpha = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+        // Unsigned range checks: x <= max  <=>  min(x, max) == x
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+        __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+        if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF) break;
+
+        __m128i v = _mm_or_si128(_mm_and_si128(is_digit, digit),
+                                 _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+
+        // The first digit of every pair is the high nibble (and the low byte of the word)
+        __m128i w = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0xFF)), 4),
+                                 _mm_srli_epi16(v, 8));
+        _mm_storel_epi64((__m128i *)(out + i / 2), _mm_packus_epi16(w, w));
+    }
+
+    return i;
+}
+
+TARGET_AVX2
+static size_t hex_decode_avx2(uint8_t *out, const char *src, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i c     = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i digit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+        __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)),
+                                        _mm256_set1_epi8('a'));
+
+        __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+        if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)) != -1) break;
+
+        __m256i v = _mm256_or_si256(
+            _mm256_and_si256(is_digit, digit),
+            _mm256_and_si256(is_alpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+
+        __m256i w = _mm256_or_si256(
+            _mm256_slli_epi16(_mm256_and_si256(v, _mm256_set1_epi16(0xFF)), 4),
+            _mm256_srli_epi16(v, 8));
+
+        // Packing works within 128-bit lanes, gather the low half of each lane
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(w, w), 0x08);
+        _mm_storeu_si128((__m128i *)(out + i / 2), _mm256_castsi256_si128(packed));
+    }
+
+    return i;
+}
+
+#endif // CODEC_X86
+
+/* * * * * * * Base64 kernels * * * * * * */
+
+// Vectorized base64 after Muła and Lemire, "Faster Base64 Encoding and Decoding
+// Using AVX2 Instructions": 3 bytes are spread into 4 bytes of 6 bits with
+// multiplications, then translated to ASCII with a shuffle of per-range offsets.
+
+#ifdef CODEC_X86
+
+// Offsets added to the 6-bit values of each range (see b64_translate_sse())
+#define B64_OFFSETS(c62, c63) \
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, \
+    '0' - 52, '0' - 52, '0' - 52, (c62) - 62, (c63) - 63, 'A', 0, 0
+
+TARGET_SSSE3
+static inline __m128i b64_split_sse(__m128i in) {
+    // Bytes [b c a b] for every 3 input bytes a, b, c
+    in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+    __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+TARGET_SSSE3
+static inline __m128i b64_translate_sse(__m128i values, __m128i offsets) {
+    // 0 for 26..51, 1..12 for 52..63 and 13 for 0..25
+    __m128i range = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+    range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+    return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, range));
+}
+
+TARGET_SSSE3
+static size_t b64_encode_sse(char *out, const uint8_t *src, size_t n, bool url) {
+    const __m128i offsets = url ? _mm_setr_epi8(B64_OFFSETS('-', '_'))
+                                : _mm_setr_epi8(B64_OFFSETS('+', '/'));
+
+    // Loads 16 bytes and uses 12
+    size_t i = 0;
+    for (; i + 16 <= n; i += 12) {
+        __m128i in = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i values = b64_split_sse(in);
+        _mm_storeu_si128((__m128i *)(out + i / 3 * 4), b64_translate_sse(values, offsets));
+    }
+
+    return i;
+}
+
+TARGET_AVX2
+static size_t b64_encode_avx2(char *out, const uint8_t *src, size_t n, bool url) {
+    const __m256i offsets = url
+        ? _mm256_setr_epi8(B64_OFFSETS('-', '_'), B64_OFFSETS('-', '_'))
+        : _mm256_setr_epi8(B64_OFFSETS('+', '/'), B64_OFFSETS('+', '/'));
+    const __m256i split = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    // Loads 32 bytes and uses 24, 12 in each lane
+    size_t i = 0;
+    for (; i + 32 <= n; i += 24) {
+        __m256i in = _mm256_loadu_si256((const __m256i *)(src + i));
+        in = _mm256_permutevar8x32_epi32(in, _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0));
+        in = _mm256_shuffle_epi8(in, split);
+
+        __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+        __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+        __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        __m256i values = _mm256_or_si256(t1, t3);
+
+        __m256i range = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+        range = _mm256_or_si256(range, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        __m256i ascii = _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, range));
+
+        _mm256_storeu_si256((__m256i *)(out + i / 3 * 4), ascii);
+    }
+
+    return i;
+}
+
+// Decodes 16 characters into 6-bit values. Returns false if any is invalid.
+TARGET_SSSE3
+static inline bool b64_values_sse(__m128i c, bool url, __m128i *values) {
+    __m128i upper = _mm_sub_epi8(c, _mm_set1_epi8('A'));
+    __m128i lower = _mm_sub_epi8(c, _mm_set1_epi8('a'));
+    __m128i digit = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+
+    __m128i is_upper = _mm_cmpeq_epi8(_mm_min_epu8(upper, _mm_set1_epi8(25)), upper);
+    __m128i is_lower = _mm_cmpeq_epi8(_mm_min_epu8(lower, _mm_set1_epi8(25)), lower);
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i is_62 = _mm_cmpeq_epi8(c, _mm_set1_epi8(url ? '-' : '+'));
+    __m128i is_63 = _mm_cmpeq_epi8(c, _mm_set1_epi8(url ? '_' : '/'));
+
+    __m128i valid = _mm_or_si128(_mm_or_si128(is_upper, is_lower),
+                                 _mm_or_si128(is_digit, _mm_or_si128(is_62, is_63)));
+    if (_mm_movemask_epi8(valid) != 0xFFFF) return false;
+
+    __m128i v = _mm_and_si128(is_upper, upper);
+    v = _mm_or_si128(v, _mm_and_si128(is_lower, _mm_add_epi8(lower, _mm_set1_epi8(26))));
+    v = _mm_or_si128(v, _mm_and_si128(is_digit, _mm_add_epi8(digit, _mm_set1_epi8(52))));
+    v = _mm_or_si128(v, _mm_and_si128(is_62, _mm_set1_epi8(62)));
+    v = _mm_or_si128(v, _mm_and_si128(is_63, _mm_set1_epi8(63)));
+
+    *values = v;
+    return true;
+}
+
+// Packs the 6-bit values of every 4 bytes into 24 bits, byte-swapped in 32 bits
+TARGET_SSSE3
+static inline __m128i b64_pack_sse(__m128i values) {
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    return _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+}
+
+TARGET_SSSE3
+static size_t b64_decode_sse(uint8_t *out, const char *src, size_t n, bool url) {
+    const __m128i order = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    // Writes 16 bytes and uses 12, the following 8 characters make up the difference
+    size_t i = 0;
+    for (; i + 24 <= n; i += 16) {
+        __m128i values;
+        if (!b64_values_sse(_mm_loadu_si128((const __m128i *)(src + i)), url, &values)) break;
+
+        __m128i bytes = _mm_shuffle_epi8(b64_pack_sse(values), order);
+        _mm_storeu_si128((__m128i *)(out + i / 4 * 3), bytes);
+    }
+
+    return i;
+}
+
+TARGET_AVX2
+static size_t b64_decode_avx2(uint8_t *out, const char *src, size_t n, bool url) {
+    const __m256i order = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    // Writes 32 bytes and uses 24, the following 12 characters make up the difference
+    size_t i = 0;
+    for (; i + 44 <= n; i += 32) {
+        __m256i c = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        __m256i upper = _mm256_sub_epi8(c, _mm256_set1_epi8('A'));
+        __m256i lower = _mm256_sub_epi8(c, _mm256_set1_epi8('a'));
+        __m256i digit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+
+        __m256i is_upper = _mm256_cmpeq_epi8(_mm256_min_epu8(upper, _mm256_set1_epi8(25)), upper);
+        __m256i is_lower = _mm256_cmpeq_epi8(_mm256_min_epu8(lower, _mm256_set1_epi8(25)), lower);
+        __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+        __m256i is_62 = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(url ? '-' : '+'));
+        __m256i is_63 = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(url ? '_' : '/'));
+
+        __m256i valid = _mm256_or_si256(_mm256_or_si256(is_upper, is_lower),
+                                        _mm256_or_si256(is_digit, _mm256_or_si256(is_62, is_63)));
+        if (_mm256_movemask_epi8(valid) != -1) break;
+
+        __m256i v = _mm256_and_si256(is_upper, upper);
+        v = _mm256_or_si256(v, _mm256_and_si256(is_lower, _mm256_add_epi8(lower, _mm256_set1_epi8(26))));
+        v = _mm256_or_si256(v, _mm256_and_si256(is_digit, _mm256_add_epi8(digit, _mm256_set1_epi8(52))));
+        v = _mm256_or_si256(v, _mm256_and_si256(is_62, _mm256_set1_epi8(62)));
+        v = _mm256_or_si256(v, _mm256_and_si256(is_63, _mm256_set1_epi8(63)));
+
+        __m256i pairs = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+        __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        __m256i bytes = _mm256_shuffle_epi8(words, order);
+
+        // 12 bytes at the start of each lane
+        bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256((__m256i *)(out + i / 4 * 3), bytes);
+    }
+
+    return i;
+}
+
+#endif // CODEC_X86
+
+/* * * * * * * Hex * * * * * * */
+
+size_t str_hex_encoded_len(size_t n) {
+    return n * 2;
+}
+
+size_t str_hex_decoded_len(String src) {
+    return src.len / 2;
+}
+
+size_t str_hex_encode_to(char *out, String src, StrCodecFlags flags) {
+    const uint8_t *s = (const uint8_t *)src.str;
+    const char *digits = flags & STR_CODEC_UPPER ? HEX_UPPER : HEX_LOWER;
+    size_t i = 0;
+
+#ifdef CODEC_X86
+    switch (isa(flags)) {
+        case ISA_AVX2:
+            i = hex_encode_avx2(out, s, src.len, digits);
+            // fall through
+        case ISA_SSE:
+            i += hex_encode_sse(out + 2 * i, s + i, src.len - i, digits);
+            break;
+        default:
+            break;
+    }
+#endif
+
+    for (; i < src.len; i++) {
+        out[2 * i]     = digits[s[i] >> 4];
+        out[2 * i + 1] = digits[s[i] & 0xF];
+    }
+
+    return src.len * 2;
+}
+
+String str_hex_encode(String src, StrCodecFlags flags) {
+    String out = str_alloc("");
+    str_reserve(str_hex_encoded_len(src.len), &out);
+    out.len = str_hex_encode_to(out.str, src, flags);
+    return out;
+}
+
+bool str_hex_decode_to(char *out, String src, StrCodecFlags flags, size_t *invalid) {
+    uint8_t *o = (uint8_t *)out;
+    size_t n = src.len & ~(size_t)1;
+    size_t i = 0;
+
+#ifdef CODEC_X86
+    switch (isa(flags)) {
+        case ISA_AVX2:
+            i = hex_decode_avx2(o, src.str, n);
+            // fall through
+        case ISA_SSE:
+            i += hex_decode_sse(o + i / 2, src.str + i, n - i);
+            break;
+        default:
+            break;
+    }
+#endif
+
+    for (; i < n; i += 2) {
+        int hi = hex_value(src.str[i]);
+        int lo = hex_value(src.str[i + 1]);
+
+        if (hi < 0 || lo < 0) {
+            if (invalid) *invalid = hi < 0 ? i : i + 1;
+            return false;
+        }
+        o[i / 2] = (uint8_t)(hi << 4 | lo);
+    }
+
+    if (n != src.len) {
+        if (invalid) *invalid = src.len;
+        return false;
+    }
+
+    return true;
+}
+
+bool str_hex_decode(String src, StrCodecFlags flags, String *out) {
+    String dec = str_alloc("");
+    str_reserve(str_hex_decoded_len(src), &dec);
+
+    if (!str_hex_decode_to(dec.str, src, flags, NULL)) {
+        str_free(&dec);
+        return false;
+    }
+
+    dec.len = str_hex_decoded_len(src);
+    *out = dec;
+    return true;
+}
+
+/* * * * * * * Base64 * * * * * * */
+
+size_t str_base64_encoded_len(size_t n, StrCodecFlags flags) {
+    return flags & STR_CODEC_NO_PAD ? (n * 4 + 2) / 3 : (n + 2) / 3 * 4;
+}
+
+// Length of the string without its padding
+static size_t b64_unpadded_len(String src, StrCodecFlags flags) {
+    size_t n = src.len;
+    if (flags & STR_CODEC_NO_PAD) return n;
+
+    for (size_t k = 0; k < 2 && n && src.str[n - 1] == '='; k++) n--;
+    return n;
+}
+
+size_t str_base64_decoded_len(String src, StrCodecFlags flags) {
+    size_t n = b64_unpadded_len(src, flags);
+    return n / 4 * 3 + (n % 4 ? n % 4 - 1 : 0);
+}
+
+size_t str_base64_encode_to(char *out, String src, StrCodecFlags flags) {
+    const uint8_t *s = (const uint8_t *)src.str;
+    const char *abc = flags & STR_CODEC_URL ? B64_URL : B64_STD;
+    bool url = flags & STR_CODEC_URL;
+    size_t i = 0;
+
+#ifdef CODEC_X86
+    switch (isa(flags)) {
+        case ISA_AVX2:
+            i = b64_encode_avx2(out, s, src.len, url);
+            // fall through
+        case ISA_SSE:
+            i += b64_encode_sse(out + i / 3 * 4, s + i, src.len - i, url);
+            break;
+        default:
+            break;
+    }
+#endif
+
+    char *w = out + i / 3 * 4;
+
+    for (; i + 3 <= src.len; i += 3) {
+        uint32_t v = (uint32_t)s[i] << 16 | s[i + 1] << 8 | s[i + 2];
+        w[0] = abc[v >> 18];
+        w[1] = abc[v >> 12 & 0x3F];
+        w[2] = abc[v >> 6 & 0x3F];
+        w[3] = abc[v & 0x3F];
+        w += 4;
+    }
+
+    // 1 or 2 remaining bytes
+    if (i < src.len) {
+        bool two = i + 1 < src.len;
+        uint32_t v = (uint32_t)s[i] << 16 | (two ? s[i + 1] << 8 : 0);
+
+        *w++ = abc[v >> 18];
+        *w++ = abc[v >> 12 & 0x3F];
+        if (two) *w++ = abc[v >> 6 & 0x3F];
+
+        if (!(flags & STR_CODEC_NO_PAD)) {
+            if (!two) *w++ = '=';
+            *w++ = '=';
+        }
+    }
+
+    return w - out;
+}
+
+String str_base64_encode(String src, StrCodecFlags flags) {
+    String out = str_alloc("");
+    str_reserve(str_base64_encoded_len(src.len, flags), &out);
+    out.len = str_base64_encode_to(out.str, src, flags);
+    return out;
+}
+
+bool str_base64_decode_to(char *out, String src, StrCodecFlags flags, size_t *invalid) {
+    const uint8_t *s = (const uint8_t *)src.str;
+    uint8_t *o = (uint8_t *)out;
+    bool url = flags & STR_CODEC_URL;
+
+    size_t bad;
+    size_t n = b64_unpadded_len(src, flags);
+
+    // Padded input comes in whole quads, unpadded input can not end with 6 bits
+    if ((!(flags & STR_CODEC_NO_PAD) && src.len % 4) || n % 4 == 1) {
+        bad = src.len;
+        goto fail;
+    }
+
+    size_t full = n / 4 * 4;
+    size_t i = 0;
+
+#ifdef CODEC_X86
+    switch (isa(flags)) {
+        case ISA_AVX2:
+            i = b64_decode_avx2(o, src.str, full, url);
+            // fall through
+        case ISA_SSE:
+            i += b64_decode_sse(o + i / 4 * 3, src.str + i, full - i, url);
+            break;
+        default:
+            break;
+    }
+#endif
+
+    for (; i < full; i += 4) {
+        uint32_t v = 0;
+        for (size_t k = 0; k < 4; k++) {
+            int d = b64_value(s[i + k], url);
+            if (d < 0) {
+                bad = i + k;
+                goto fail;
+            }
+            v = v << 6 | d;
+        }
+
+        o[i / 4 * 3]     = (uint8_t)(v >> 16);
+        o[i / 4 * 3 + 1] = (uint8_t)(v >> 8);
+        o[i / 4 * 3 + 2] = (uint8_t)v;
+    }
+
+    // 2 or 3 remaining characters (1 or 2 bytes)
+    if (i < n) {
+        uint32_t v = 0;
+        for (size_t k = i; k < n; k++) {
+            int d = b64_value(s[k], url);
+            if (d < 0) {
+                bad = k;
+                goto fail;
+            }
+            v = v << 6 | d;
+        }
+
+        // The unused trailing bits have to be zero
+        size_t extra = n - i == 2 ? 4 : 2;
+        if (v & ((1u << extra) - 1)) {
+            bad = n - 1;
+            goto fail;
+        }
+        v >>= extra;
+
+        if (n - i == 2) {
+            o[i / 4 * 3] = (uint8_t)v;
+        } else {
+            o[i / 4 * 3]     = (uint8_t)(v >> 8);
+            o[i / 4 * 3 + 1] = (uint8_t)v;
+        }
+    }
+
+    return true;
+
+fail:
+    if (invalid) *invalid = bad;
+    return false;
+}
+
+bool str_base64_decode(String src, StrCodecFlags flags, String *out) {
+    String dec = str_alloc("");
+    str_reserve(str_base64_decoded_len(src, flags), &dec);
+
+    if (!str_base64_decode_to(dec.str, src, flags, NULL)) {
+        str_free(&dec);
+        return false;
+    }
+
+    dec.len = str_base64_decoded_len(src, flags);
+    *out = dec;
+    return true;
+}
@@ -0,0 +1,79 @@
+#ifndef _STRCODEC_H
+#define _STRCODEC_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Flags for the hex and base64 encoders and decoders
+typedef enum {
+    // Hex: encode with uppercase digits (both cases are always decoded)
+    STR_CODEC_UPPER   = 0x1,
+    // Base64: use the URL and filename safe alphabet ('-' and '_' instead of '+' and '/')
+    STR_CODEC_URL     = 0x2,
+    // Base64: do not write padding, and reject it when decoding
+    STR_CODEC_NO_PAD  = 0x4,
+    // Only use the scalar code (for testing and benchmarking)
+    STR_CODEC_NO_SIMD = 0x8,
+    // Do not use the AVX2 kernels, only SSE (for testing and benchmarking)
+    STR_CODEC_NO_AVX2 = 0x10,
+} StrCodecFlags;
+
+// The SIMD kernels are picked at runtime from the features of the CPU.
+// Decoding is strict: any character outside of the alphabet, misplaced padding
+// or non-zero trailing bits make the whole input invalid.
+
+/* * * * * * * Hex * * * * * * */
+
+// Length of the hex encoding of `n` bytes
+size_t str_hex_encoded_len(size_t n);
+
+// Length of the bytes decoded from the hex string (if it is valid)
+size_t str_hex_decoded_len(String src);
+
+// Encodes the bytes as hex into the given buffer (str_hex_encoded_len() bytes)
+// without a nul-terminator and returns the number of bytes written
+size_t str_hex_encode_to(char *out, String src, StrCodecFlags flags);
+
+// Returns the hex encoding of the bytes
+// Requires str_free()
+String str_hex_encode(String src, StrCodecFlags flags);
+
+// Decodes the hex string into the given buffer (str_hex_decoded_len() bytes).
+// Returns false if the input is invalid, writing the offset of the first invalid
+// character (or the length for an odd length) to `invalid`, which may be NULL.
+bool str_hex_decode_to(char *out, String src, StrCodecFlags flags, size_t *invalid);
+
+// Decodes the hex string into a new string.
+// Returns false (leaving `out` untouched) if the input is invalid
+// Requires str_free() (if successful)
+bool str_hex_decode(String src, StrCodecFlags flags, String *out);
+
+/* * * * * * * Base64 * * * * * * */
+
+// Length of the base64 encoding of `n` bytes
+size_t str_base64_encoded_len(size_t n, StrCodecFlags flags);
+
+// Length of the bytes decoded from the base64 string (if it is valid)
+size_t str_base64_decoded_len(String src, StrCodecFlags flags);
+
+// Encodes the bytes as base64 into the given buffer (str_base64_encoded_len() bytes)
+// without a nul-terminator and returns the number of bytes written
+size_t str_base64_encode_to(char *out, String src, StrCodecFlags flags);
+
+// Returns the base64 encoding of the bytes
+// Requires str_free()
+String str_base64_encode(String src, StrCodecFlags flags);
+
+// Decodes the base64 string into the given buffer (str_base64_decoded_len() bytes).
+// Returns false if the input is invalid, writing the offset of the first invalid
+// character (or the length for a truncated input) to `invalid`, which may be NULL.
+bool str_base64_decode_to(char *out, String src, StrCodecFlags flags, size_t *invalid);
+
+// Decodes the base64 string into a new string.
+// Returns false (leaving `out` untouched) if the input is invalid
+// Requires str_free() (if successful)
+bool str_base64_decode(String src, StrCodecFlags flags, String *out);
+
+#endif // _STRCODEC_H
@@ -0,0 +1,175 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strcodec.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+// Kernel selections compared against the scalar code
+static const StrCodecFlags KERNELS[] = { 0, STR_CODEC_NO_AVX2 };
+
+// RFC 4648 test vectors
+static const char *B64_PLAIN[]   = { "", "f", "fo", "foo", "foob", "fooba", "foobar" };
+static const char *B64_ENCODED[] = { "", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy" };
+
+// Encodes and decodes random bytes of every length up to `max` with all kernels.
+// Returns the number of mismatches.
+static size_t check_roundtrips(size_t max) {
+    size_t mismatches = 0;
+
+    for (size_t len = 0; len <= max; len++) {
+        char *bytes = malloc(len + 1);
+        for (size_t i = 0; i < len; i++) bytes[i] = (char)rand();
+        String src = str_nref(bytes, len);
+
+        for (size_t f = 0; f < 4; f++) {
+            StrCodecFlags format = (f & 1 ? STR_CODEC_UPPER | STR_CODEC_URL : 0)
+                                 | (f & 2 ? STR_CODEC_NO_PAD : 0);
+
+            String hex = str_hex_encode(src, format | STR_CODEC_NO_SIMD);
+            String b64 = str_base64_encode(src, format | STR_CODEC_NO_SIMD);
+            mismatches += hex.len != str_hex_encoded_len(len);
+            mismatches += b64.len != str_base64_encoded_len(len, format);
+
+            for (size_t k = 0; k < sizeof KERNELS / sizeof *KERNELS; k++) {
+                StrCodecFlags flags = format | KERNELS[k];
+                String enc, dec;
+
+                enc = str_hex_encode(src, flags);
+                mismatches += !str_eq(hex, enc);
+                str_free(&enc);
+
+                enc = str_base64_encode(src, flags);
+                mismatches += !str_eq(b64, enc);
+                str_free(&enc);
+
+                if (str_hex_decode(hex, flags, &dec)) {
+                    mismatches += !str_eq(src, dec);
+                    str_free(&dec);
+                } else mismatches++;
+
+                if (str_base64_decode(b64, flags, &dec)) {
+                    mismatches += !str_eq(src, dec);
+                    str_free(&dec);
+                } else mismatches++;
+            }
+
+            // A corrupted character is reported at its position by every kernel
+            if (len) {
+                size_t data = b64.len;
+                while (b64.str[data - 1] == '=') data--;
+
+                size_t pos = rand() % data, invalid = 0;
+                char saved = b64.str[pos];
+                b64.str[pos] = '*';
+
+                for (size_t k = 0; k < sizeof KERNELS / sizeof *KERNELS; k++) {
+                    char out[512];
+                    mismatches += str_base64_decode_to(out, b64, format | KERNELS[k], &invalid);
+                    mismatches += invalid != pos;
+
+                    hex.str[pos % hex.len] = 'g';
+                    mismatches += str_hex_decode_to(out, hex, KERNELS[k], &invalid);
+                    mismatches += invalid != pos % hex.len;
+                }
+
+                b64.str[pos] = saved;
+            }
+
+            str_free(&hex);
+            str_free(&b64);
+        }
+
+        free(bytes);
+    }
+
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    test("str_hex_encode", {
+        String hex = str_hex_encode(str_nref("\x00\x7F\xAB\xff", 4), 0);
+        assert_string_eq(str_ref("007fabff"), hex);
+        str_free(&hex);
+
+        hex = str_hex_encode(str_ref("Hello, hex encoding with SIMD!!"), STR_CODEC_UPPER);
+        assert_string_eq(str_ref("48656C6C6F2C2068657820656E636F64696E6720776974682053494D442121"), hex);
+        str_free(&hex);
+    });
+
+    test("str_hex_decode", {
+        String dec;
+        size_t invalid = 0;
+        char out[8];
+
+        assert(str_hex_decode(str_ref("007fABff"), 0, &dec));
+        assert_string_eq(str_nref("\x00\x7F\xAB\xff", 4), dec);
+        str_free(&dec);
+
+        assert(!str_hex_decode_to(out, str_ref("0g"), 0, &invalid));
+        assert_eq((size_t)1, invalid, "%zu");
+        assert(!str_hex_decode_to(out, str_ref("abc"), 0, &invalid));
+        assert_eq((size_t)3, invalid, "%zu");
+        assert(!str_hex_decode(str_ref("0x12"), 0, &dec));
+    });
+
+    test("str_base64_encode", {
+        for (size_t i = 0; i < sizeof B64_PLAIN / sizeof *B64_PLAIN; i++) {
+            String enc = str_base64_encode(str_ref(B64_PLAIN[i]), 0);
+            assert_string_eq(str_ref(B64_ENCODED[i]), enc);
+            str_free(&enc);
+        }
+
+        String enc = str_base64_encode(str_nref("\xfb\xff\xbf", 3), STR_CODEC_URL);
+        assert_string_eq(str_ref("-_-_"), enc);
+        str_free(&enc);
+
+        enc = str_base64_encode(str_ref("fo"), STR_CODEC_NO_PAD);
+        assert_string_eq(str_ref("Zm8"), enc);
+        str_free(&enc);
+    });
+
+    test("str_base64_decode", {
+        String dec;
+        size_t invalid = 0;
+        char out[8];
+
+        for (size_t i = 0; i < sizeof B64_PLAIN / sizeof *B64_PLAIN; i++) {
+            assert(str_base64_decode(str_ref(B64_ENCODED[i]), 0, &dec));
+            assert_string_eq(str_ref(B64_PLAIN[i]), dec);
+            str_free(&dec);
+        }
+
+        assert(str_base64_decode(str_ref("Zm8"), STR_CODEC_NO_PAD, &dec));
+        assert_string_eq(str_ref("fo"), dec);
+        str_free(&dec);
+
+        // Missing or unexpected padding
+        assert(!str_base64_decode_to(out, str_ref("Zm8"), 0, &invalid));
+        assert_eq((size_t)3, invalid, "%zu");
+        assert(!str_base64_decode_to(out, str_ref("Zm8="), STR_CODEC_NO_PAD, &invalid));
+        assert_eq((size_t)3, invalid, "%zu");
+        assert(!str_base64_decode(str_ref("Zg=a"), 0, &dec));
+        assert(!str_base64_decode(str_ref("Z==="), 0, &dec));
+
+        // Non-zero trailing bits
+        assert(!str_base64_decode_to(out, str_ref("Zh=="), 0, &invalid));
+        assert_eq((size_t)1, invalid, "%zu");
+
+        // Alphabets are not mixed
+        assert(!str_base64_decode(str_ref("-_-_"), 0, &dec));
+        assert(!str_base64_decode(str_ref("+/+/"), STR_CODEC_URL, &dec));
+    });
+
+    test("strcodec kernels", {
+        assert_eq((size_t)0, check_roundtrips(200), "%zu");
+    });
+
+    return 0;
+}
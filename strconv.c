@@ -0,0 +1,792 @@
+#include "strconv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <math.h>
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Pairs of decimal digits for 00..99
+static const char DIGITS2[201] =
+    "00010203040506070809" "10111213141516171819"
+    "20212223242526272829" "30313233343536373839"
+    "40414243444546474849" "50515253545556575859"
+    "60616263646566676869" "70717273747576777879"
+    "80818283848586878889" "90919293949596979899";
+
+static const uint32_t POW10_32[] = {
+    1, 10, 100, 1000, 10000, 100000,
+    1000000, 10000000, 100000000, 1000000000,
+};
+
+// Writes the decimal digits of `value` ending right before `end`
+// and returns a pointer to the first digit
+static char *fmt_digits_rev(char *end, uint64_t value) {
+    while (value >= 100) {
+        size_t i = (value % 100) * 2;
+        value /= 100;
+        *--end = DIGITS2[i + 1];
+        *--end = DIGITS2[i];
+    }
+
+    if (value >= 10) {
+        *--end = DIGITS2[value * 2 + 1];
+        *--end = DIGITS2[value * 2];
+    } else *--end = '0' + value;
+
+    return end;
+}
+
+/* * * * * * * Grisu3 * * * * * * */
+
+// Floating point number with a 64-bit significand (f * 2^e)
+typedef struct {
+    uint64_t f;
+    int      e;
+} DiyFp;
+
+#define DP_SIGNIFICAND_MASK 0x000FFFFFFFFFFFFFull
+#define DP_EXPONENT_MASK    0x7FF0000000000000ull
+#define DP_HIDDEN_BIT       0x0010000000000000ull
+#define DP_SIGNIFICAND_SIZE 52
+#define DP_EXPONENT_BIAS    (0x3FF + DP_SIGNIFICAND_SIZE)
+#define DP_MIN_EXPONENT     (-DP_EXPONENT_BIAS)
+
+// Normalized cached powers of ten, 10^-348 .. 10^340 in steps of 8
+// (generated, rounded to nearest)
+static const DiyFp CACHED_POWERS[] = {
+    { 0xfa8fd5a0081c0288, -1220 }, { 0xbaaee17fa23ebf76, -1193 }, { 0x8b16fb203055ac76, -1166 },
+    { 0xcf42894a5dce35ea, -1140 }, { 0x9a6bb0aa55653b2d, -1113 }, { 0xe61acf033d1a45df, -1087 },
+    { 0xab70fe17c79ac6ca, -1060 }, { 0xff77b1fcbebcdc4f, -1034 }, { 0xbe5691ef416bd60c, -1007 },
+    { 0x8dd01fad907ffc3c,  -980 }, { 0xd3515c2831559a83,  -954 }, { 0x9d71ac8fada6c9b5,  -927 },
+    { 0xea9c227723ee8bcb,  -901 }, { 0xaecc49914078536d,  -874 }, { 0x823c12795db6ce57,  -847 },
+    { 0xc21094364dfb5637,  -821 }, { 0x9096ea6f3848984f,  -794 }, { 0xd77485cb25823ac7,  -768 },
+    { 0xa086cfcd97bf97f4,  -741 }, { 0xef340a98172aace5,  -715 }, { 0xb23867fb2a35b28e,  -688 },
+    { 0x84c8d4dfd2c63f3b,  -661 }, { 0xc5dd44271ad3cdba,  -635 }, { 0x936b9fcebb25c996,  -608 },
+    { 0xdbac6c247d62a584,  -582 }, { 0xa3ab66580d5fdaf6,  -555 }, { 0xf3e2f893dec3f126,  -529 },
+    { 0xb5b5ada8aaff80b8,  -502 }, { 0x87625f056c7c4a8b,  -475 }, { 0xc9bcff6034c13053,  -449 },
+    { 0x964e858c91ba2655,  -422 }, { 0xdff9772470297ebd,  -396 }, { 0xa6dfbd9fb8e5b88f,  -369 },
+    { 0xf8a95fcf88747d94,  -343 }, { 0xb94470938fa89bcf,  -316 }, { 0x8a08f0f8bf0f156b,  -289 },
+    { 0xcdb02555653131b6,  -263 }, { 0x993fe2c6d07b7fac,  -236 }, { 0xe45c10c42a2b3b06,  -210 },
+    { 0xaa242499697392d3,  -183 }, { 0xfd87b5f28300ca0e,  -157 }, { 0xbce5086492111aeb,  -130 },
+    { 0x8cbccc096f5088cc,  -103 }, { 0xd1b71758e219652c,   -77 }, { 0x9c40000000000000,   -50 },
+    { 0xe8d4a51000000000,   -24 }, { 0xad78ebc5ac620000,     3 }, { 0x813f3978f8940984,    30 },
+    { 0xc097ce7bc90715b3,    56 }, { 0x8f7e32ce7bea5c70,    83 }, { 0xd5d238a4abe98068,   109 },
+    { 0x9f4f2726179a2245,   136 }, { 0xed63a231d4c4fb27,   162 }, { 0xb0de65388cc8ada8,   189 },
+    { 0x83c7088e1aab65db,   216 }, { 0xc45d1df942711d9a,   242 }, { 0x924d692ca61be758,   269 },
+    { 0xda01ee641a708dea,   295 }, { 0xa26da3999aef774a,   322 }, { 0xf209787bb47d6b85,   348 },
+    { 0xb454e4a179dd1877,   375 }, { 0x865b86925b9bc5c2,   402 }, { 0xc83553c5c8965d3d,   428 },
+    { 0x952ab45cfa97a0b3,   455 }, { 0xde469fbd99a05fe3,   481 }, { 0xa59bc234db398c25,   508 },
+    { 0xf6c69a72a3989f5c,   534 }, { 0xb7dcbf5354e9bece,   561 }, { 0x88fcf317f22241e2,   588 },
+    { 0xcc20ce9bd35c78a5,   614 }, { 0x98165af37b2153df,   641 }, { 0xe2a0b5dc971f303a,   667 },
+    { 0xa8d9d1535ce3b396,   694 }, { 0xfb9b7cd9a4a7443c,   720 }, { 0xbb764c4ca7a44410,   747 },
+    { 0x8bab8eefb6409c1a,   774 }, { 0xd01fef10a657842c,   800 }, { 0x9b10a4e5e9913129,   827 },
+    { 0xe7109bfba19c0c9d,   853 }, { 0xac2820d9623bf429,   880 }, { 0x80444b5e7aa7cf85,   907 },
+    { 0xbf21e44003acdd2d,   933 }, { 0x8e679c2f5e44ff8f,   960 }, { 0xd433179d9c8cb841,   986 },
+    { 0x9e19db92b4e31ba9,  1013 }, { 0xeb96bf6ebadf77d9,  1039 }, { 0xaf87023b9bf0ee6b,  1066 },
+};
+
+static DiyFp diyfp_from_double(double d) {
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof bits);
+
+    int biased_e = (bits & DP_EXPONENT_MASK) >> DP_SIGNIFICAND_SIZE;
+    uint64_t significand = bits & DP_SIGNIFICAND_MASK;
+
+    if (biased_e)
+        return (DiyFp){ significand + DP_HIDDEN_BIT, biased_e - DP_EXPONENT_BIAS };
+    else
+        return (DiyFp){ significand, DP_MIN_EXPONENT + 1 };
+}
+
+// Multiplies two numbers keeping the upper (rounded) 64 bits of the product
+static DiyFp diyfp_mul(DiyFp a, DiyFp b) {
+    const uint64_t M32 = 0xFFFFFFFFu;
+
+    uint64_t ah = a.f >> 32, al = a.f & M32;
+    uint64_t bh = b.f >> 32, bl = b.f & M32;
+
+    uint64_t hh = ah * bh, hl = ah * bl, lh = al * bh, ll = al * bl;
+    uint64_t tmp = (ll >> 32) + (hl & M32) + (lh & M32);
+    tmp += 1u << 31; // round
+
+    return (DiyFp){ hh + (hl >> 32) + (lh >> 32) + (tmp >> 32), a.e + b.e + 64 };
+}
+
+static DiyFp diyfp_normalize(DiyFp x) {
+    while (!(x.f & (1ull << 63))) { x.f <<= 1; x.e--; }
+    return x;
+}
+
+// Computes the normalized boundaries m- and m+ between which all numbers
+// round to the given double
+static void diyfp_boundaries(DiyFp v, DiyFp *minus, DiyFp *plus) {
+    DiyFp pl = { (v.f << 1) + 1, v.e - 1 };
+    while (!(pl.f & (DP_HIDDEN_BIT << 1))) { pl.f <<= 1; pl.e--; }
+    pl.f <<= 64 - DP_SIGNIFICAND_SIZE - 2;
+    pl.e -= 64 - DP_SIGNIFICAND_SIZE - 2;
+
+    // The lower boundary is closer if the significand is a power of two
+    // (except for the smallest normal exponent, where the subnormals continue the spacing)
+    DiyFp mi = (v.f == DP_HIDDEN_BIT && v.e > DP_MIN_EXPONENT + 1)
+        ? (DiyFp){ (v.f << 2) - 1, v.e - 2 }
+        : (DiyFp){ (v.f << 1) - 1, v.e - 1 };
+    mi.f <<= mi.e - pl.e;
+    mi.e = pl.e;
+
+    *minus = mi;
+    *plus  = pl;
+}
+
+// Returns a cached power c such that c * 2^e has a binary exponent in [-60, -32]
+// and its decimal exponent (negated) to `k`
+static DiyFp cached_power(int e, int *k) {
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int ik = (int)dk;
+    if (dk - ik > 0.0) ik++;
+
+    unsigned index = (unsigned)((ik >> 3) + 1);
+    *k = -(-348 + (int)index * 8);
+    return CACHED_POWERS[index];
+}
+
+// Moves the last generated digit closer to the exact value while staying inside
+// the rounding interval. All quantities are known within `ulp`: returns false if
+// that error could change the result (the digits may then not be the closest ones,
+// or not even inside the interval).
+static bool grisu_round_weed(char *buf, size_t len, uint64_t wp_w, uint64_t delta,
+                             uint64_t rest, uint64_t ten_kappa, uint64_t ulp) {
+    uint64_t wp_w_up   = wp_w - ulp;
+    uint64_t wp_w_down = wp_w + ulp;
+
+    while (rest < wp_w_up && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w_up || wp_w_up - rest >= rest + ten_kappa - wp_w_up)) {
+        buf[len - 1]--;
+        rest += ten_kappa;
+    }
+
+    // The digits closest to the lower end of the error bound would differ
+    if (rest < wp_w_down && delta - rest >= ten_kappa &&
+        (rest + ten_kappa < wp_w_down || wp_w_down - rest > rest + ten_kappa - wp_w_down))
+        return false;
+
+    // The digits have to be inside the interval even in the worst case
+    return 2 * ulp <= rest && rest <= delta - 4 * ulp;
+}
+
+// Generates the shortest digits of the (unsafe) interval [low - 1, high + 1] around w,
+// stopping at the first digit that leaves it. Returns false if the digits may not be
+// the shortest or closest ones.
+static bool grisu_digits(DiyFp low, DiyFp w, DiyFp high, char *buf, size_t *len, int *k) {
+    uint64_t unit = 1;
+    DiyFp too_low  = { low.f - unit, low.e };
+    DiyFp too_high = { high.f + unit, high.e };
+    uint64_t unsafe = too_high.f - too_low.f;
+
+    const DiyFp one = { 1ull << -w.e, w.e };
+    uint32_t p1 = (uint32_t)(too_high.f >> -one.e);
+    uint64_t p2 = too_high.f & (one.f - 1);
+
+    int kappa = 1;
+    while (kappa < 10 && p1 >= POW10_32[kappa]) kappa++;
+
+    *len = 0;
+
+    while (kappa > 0) {
+        uint32_t d = p1 / POW10_32[kappa - 1];
+        p1 %= POW10_32[kappa - 1];
+
+        buf[(*len)++] = '0' + d;
+        kappa--;
+
+        uint64_t rest = ((uint64_t)p1 << -one.e) + p2;
+        if (rest < unsafe) {
+            *k += kappa;
+            return grisu_round_weed(buf, *len, too_high.f - w.f, unsafe, rest,
+                                    (uint64_t)POW10_32[kappa] << -one.e, unit);
+        }
+    }
+
+    for (;;) {
+        p2     *= 10;
+        unit   *= 10;
+        unsafe *= 10;
+
+        buf[(*len)++] = '0' + (char)(p2 >> -one.e);
+        p2 &= one.f - 1;
+        kappa--;
+
+        if (p2 < unsafe) {
+            *k += kappa;
+            return grisu_round_weed(buf, *len, (too_high.f - w.f) * unit, unsafe, p2,
+                                    one.f, unit);
+        }
+    }
+}
+
+// Generates the shortest digits of a positive double into `buf` (closest to the value
+// if several are as short), so that value = digits * 10^k.
+// Returns false for the few doubles (about 0.5%) where the precision of Grisu3 is
+// not enough to tell.
+static bool grisu3(double value, char *buf, size_t *len, int *k) {
+    DiyFp v = diyfp_from_double(value);
+
+    DiyFp w_m, w_p;
+    diyfp_boundaries(v, &w_m, &w_p);
+
+    DiyFp c_mk = cached_power(w_p.e, k);
+    DiyFp w  = diyfp_mul(diyfp_normalize(v), c_mk);
+    DiyFp wp = diyfp_mul(w_p, c_mk);
+    DiyFp wm = diyfp_mul(w_m, c_mk);
+
+    return grisu_digits(wm, w, wp, buf, len, k);
+}
+
+// Tells whether m * 10^k parses back to the value
+static bool digits_roundtrip(double value, uint64_t m, int k) {
+    char tmp[STR_NUM_MAXLEN];
+    snprintf(tmp, sizeof tmp, "%" PRIu64 "e%d", m, k);
+    return strtod(tmp, NULL) == value;
+}
+
+// Exact fallback for grisu3(): the correctly rounded digits of printf() for increasing
+// precisions, until they parse back to the value with strtod(). When the rounded digits
+// just miss the rounding interval (which is not symmetric at powers of two), the
+// neighbour on the other side of the value in the last digit may still be inside it.
+static size_t shortest_exact(double value, char *buf, int *k) {
+    char tmp[STR_NUM_MAXLEN];
+    uint64_t m = 0;
+
+    for (int p = 1; p <= 17; p++) {
+        snprintf(tmp, sizeof tmp, "%.*e", p - 1, value);
+
+        const char *c = tmp;
+        for (m = 0; *c != 'e'; c++)
+            if (*c != '.') m = m * 10 + (*c - '0');
+        *k = atoi(c + 1) - (p - 1);
+
+        if (digits_roundtrip(value, m, *k)) break;
+
+        char near[STR_NUM_MAXLEN];
+        snprintf(near, sizeof near, "%" PRIu64 "e%d", m, *k);
+        uint64_t other = strtod(near, NULL) < value ? m + 1 : m - 1;
+
+        if (other && digits_roundtrip(value, other, *k)) {
+            m = other;
+            break;
+        }
+    }
+
+    while (m % 10 == 0) { m /= 10; ++*k; }
+
+    char *d = fmt_digits_rev(tmp + sizeof tmp, m);
+    size_t len = tmp + sizeof tmp - d;
+    memcpy(buf, d, len);
+    return len;
+}
+
+// Generates the shortest digits of a positive double, so that value = digits * 10^k
+static size_t shortest_digits(double value, char *buf, int *k) {
+    size_t len;
+    if (grisu3(value, buf, &len, k)) return len;
+    return shortest_exact(value, buf, k);
+}
+
+// Lays out `len` digits with decimal exponent `k` in place
+static size_t prettify(char *buf, size_t len, int k) {
+    int n  = (int)len;
+    int kk = n + k; // 10^(kk - 1) <= value < 10^kk
+
+    if (k >= 0 && kk <= 21) {
+        // 1234e7 -> 12340000000
+        memset(buf + n, '0', kk - n);
+        return kk;
+    }
+
+    if (kk > 0 && kk <= 21) {
+        // 1234e-2 -> 12.34
+        memmove(buf + kk + 1, buf + kk, n - kk);
+        buf[kk] = '.';
+        return n + 1;
+    }
+
+    if (kk > -6 && kk <= 0) {
+        // 1234e-6 -> 0.001234
+        int offset = 2 - kk;
+        memmove(buf + offset, buf, n);
+        buf[0] = '0';
+        buf[1] = '.';
+        memset(buf + 2, '0', offset - 2);
+        return n + offset;
+    }
+
+    // 1e30, 1234e30 -> 1.234e33
+    size_t i = 1;
+    if (n > 1) {
+        memmove(buf + 2, buf + 1, n - 1);
+        buf[1] = '.';
+        i = n + 1;
+    }
+    buf[i++] = 'e';
+
+    int exp = kk - 1;
+    if (exp < 0) { buf[i++] = '-'; exp = -exp; }
+
+    char tmp[4];
+    char *d = fmt_digits_rev(tmp + sizeof tmp, exp);
+    size_t dlen = tmp + sizeof tmp - d;
+    memcpy(buf + i, d, dlen);
+
+    return i + dlen;
+}
+
+/* * * * * * * FORMATTING * * * * * * */
+
+size_t fmt_uint(char *buf, uint64_t value) {
+    char tmp[20];
+    char *d = fmt_digits_rev(tmp + sizeof tmp, value);
+    size_t len = tmp + sizeof tmp - d;
+    memcpy(buf, d, len);
+    return len;
+}
+
+size_t fmt_int(char *buf, int64_t value) {
+    if (value >= 0) return fmt_uint(buf, value);
+
+    // Negate as unsigned, so INT64_MIN doesn't overflow
+    *buf = '-';
+    return fmt_uint(buf + 1, -(uint64_t)value) + 1;
+}
+
+size_t fmt_hex(char *buf, uint64_t value, size_t width, StrHexFlags flags) {
+    const char *digits = (flags & STR_HEX_UPPER)
+        ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    size_t len = 1;
+    for (uint64_t v = value >> 4; v; v >>= 4) len++;
+
+    if (width > 16) width = 16;
+    if (len < width) len = width;
+
+    for (size_t i = len; i > 0; i--, value >>= 4)
+        buf[i - 1] = digits[value & 0xF];
+
+    return len;
+}
+
+size_t fmt_double(char *buf, double value) {
+    if (isnan(value)) { memcpy(buf, "nan", 3); return 3; }
+
+    size_t i = 0;
+    if (signbit(value)) { buf[i++] = '-'; value = -value; }
+
+    if (isinf(value)) { memcpy(buf + i, "inf", 3); return i + 3; }
+    if (value == 0.0) { buf[i++] = '0'; return i; }
+
+    int k;
+    size_t len = shortest_digits(value, buf + i, &k);
+    return i + prettify(buf + i, len, k);
+}
+
+void str_push_int(int64_t value, String *str) {
+    char buf[STR_NUM_MAXLEN];
+    str_pushs(str_nref(buf, fmt_int(buf, value)), str);
+}
+
+void str_push_uint(uint64_t value, String *str) {
+    char buf[STR_NUM_MAXLEN];
+    str_pushs(str_nref(buf, fmt_uint(buf, value)), str);
+}
+
+void str_push_hex(uint64_t value, size_t width, StrHexFlags flags, String *str) {
+    char buf[STR_NUM_MAXLEN];
+    str_pushs(str_nref(buf, fmt_hex(buf, value, width, flags)), str);
+}
+
+void str_push_double(double value, String *str) {
+    char buf[STR_NUM_MAXLEN];
+    str_pushs(str_nref(buf, fmt_double(buf, value)), str);
+}
+
+/* * * * * * * SWAR digits * * * * * * */
+
+static uint64_t load_le64(const char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof v);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+// Tells whether all 8 bytes of the word are ASCII digits
+static bool swar_is_8digits(uint64_t v) {
+    return !(((v & 0xF0F0F0F0F0F0F0F0ull) |
+              (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+             ^ 0x3333333333333333ull);
+}
+
+// Converts 8 ASCII digits (first digit in the lowest byte) into their value
+static uint32_t swar_parse_8digits(uint64_t v) {
+    v = (v & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;
+    v = (v & 0x00FF00FF00FF00FFull) * 6553601 >> 16;
+    return (uint32_t)((v & 0x0000FFFF0000FFFFull) * 42949672960001ull >> 32);
+}
+
+#define IS_DIGIT(c) ((unsigned char)((c) - '0') < 10)
+
+// Accumulates the digits at str[*i..] into `*value` (wrapping on overflow),
+// 8 at a time where possible. Returns the number of digits read.
+static size_t parse_digits(String str, size_t *i, uint64_t *value) {
+    size_t start = *i;
+    uint64_t v = *value;
+
+    while (*i + 8 <= str.len) {
+        uint64_t chunk = load_le64(str.str + *i);
+        if (!swar_is_8digits(chunk)) break;
+
+        v = v * 100000000 + swar_parse_8digits(chunk);
+        *i += 8;
+    }
+
+    while (*i < str.len && IS_DIGIT(str.str[*i]))
+        v = v * 10 + (str.str[(*i)++] - '0');
+
+    *value = v;
+    return *i - start;
+}
+
+/* * * * * * * Integers * * * * * * */
+
+// Parses the digits of an unsigned magnitude, starting at str[*i]
+static StrParseStatus parse_magnitude(String str, size_t *i, uint64_t *out) {
+    size_t start = *i;
+
+    // Skip leading zeroes, so the SWAR loop sees only significant digits
+    while (*i < str.len && str.str[*i] == '0') (*i)++;
+    size_t sig = *i;
+
+    // Up to 19 digits can never overflow
+    uint64_t v = 0;
+    String head = str;
+    if (head.len > sig + 19) head.len = sig + 19;
+    parse_digits(head, i, &v);
+
+    if (*i == start) return STR_PARSE_INVALID;
+
+    bool overflow = false;
+    for (; *i < str.len && IS_DIGIT(str.str[*i]); (*i)++) {
+        if (overflow) continue;
+        overflow = __builtin_mul_overflow(v, 10, &v)
+                || __builtin_add_overflow(v, str.str[*i] - '0', &v);
+    }
+
+    *out = overflow ? UINT64_MAX : v;
+    return overflow ? STR_PARSE_OVERFLOW : STR_PARSE_OK;
+}
+
+StrParseStatus str_parse_uint(String str, uint64_t *out, size_t *consumed) {
+    size_t i = 0;
+    if (str.len && str.str[0] == '+') i++;
+
+    uint64_t v = 0;
+    StrParseStatus status = parse_magnitude(str, &i, &v);
+
+    if (status == STR_PARSE_INVALID) i = 0;
+    else if (out) *out = v;
+
+    if (consumed) *consumed = i;
+    return status;
+}
+
+StrParseStatus str_parse_int(String str, int64_t *out, size_t *consumed) {
+    size_t i = 0;
+    bool neg = false;
+    if (str.len && (str.str[0] == '+' || str.str[0] == '-'))
+        neg = str.str[i++] == '-';
+
+    uint64_t v = 0;
+    StrParseStatus status = parse_magnitude(str, &i, &v);
+
+    if (status == STR_PARSE_INVALID) {
+        if (consumed) *consumed = 0;
+        return status;
+    }
+
+    uint64_t limit = neg ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+    if (v > limit) {
+        v = limit;
+        status = STR_PARSE_OVERFLOW;
+    }
+
+    if (out) *out = neg ? (int64_t)(0 - v) : (int64_t)v;
+    if (consumed) *consumed = i;
+    return status;
+}
+
+/* * * * * * * Doubles * * * * * * */
+
+#define POW5_MIN_Q -64
+#define POW5_MAX_Q  64
+
+// 128-bit normalized approximations of 5^q for q in [-64, 64]
+// (generated, as in the Eisel-Lemire paper: reciprocals rounded up,
+// positive powers truncated)
+static const uint64_t POW5_128[][2] = {
+    { 0xa87fea27a539e9a5, 0x3f2398d747b36224 }, { 0xd29fe4b18e88640e, 0x8eec7f0d19a03aad },
+    { 0x83a3eeeef9153e89, 0x1953cf68300424ac }, { 0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7 },
+    { 0xcdb02555653131b6, 0x3792f412cb06794d }, { 0x808e17555f3ebf11, 0xe2bbd88bbee40bd0 },
+    { 0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4 }, { 0xc8de047564d20a8b, 0xf245825a5a445275 },
+    { 0xfb158592be068d2e, 0xeed6e2f0f0d56712 }, { 0x9ced737bb6c4183d, 0x55464dd69685606b },
+    { 0xc428d05aa4751e4c, 0xaa97e14c3c26b886 }, { 0xf53304714d9265df, 0xd53dd99f4b3066a8 },
+    { 0x993fe2c6d07b7fab, 0xe546a8038efe4029 }, { 0xbf8fdb78849a5f96, 0xde98520472bdd033 },
+    { 0xef73d256a5c0f77c, 0x963e66858f6d4440 }, { 0x95a8637627989aad, 0xdde7001379a44aa8 },
+    { 0xbb127c53b17ec159, 0x5560c018580d5d52 }, { 0xe9d71b689dde71af, 0xaab8f01e6e10b4a6 },
+    { 0x9226712162ab070d, 0xcab3961304ca70e8 }, { 0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22 },
+    { 0xe45c10c42a2b3b05, 0x8cb89a7db77c506a }, { 0x8eb98a7a9a5b04e3, 0x77f3608e92adb242 },
+    { 0xb267ed1940f1c61c, 0x55f038b237591ed3 }, { 0xdf01e85f912e37a3, 0x6b6c46dec52f6688 },
+    { 0x8b61313bbabce2c6, 0x2323ac4b3b3da015 }, { 0xae397d8aa96c1b77, 0xabec975e0a0d081a },
+    { 0xd9c7dced53c72255, 0x96e7bd358c904a21 }, { 0x881cea14545c7575, 0x7e50d64177da2e54 },
+    { 0xaa242499697392d2, 0xdde50bd1d5d0b9e9 }, { 0xd4ad2dbfc3d07787, 0x955e4ec64b44e864 },
+    { 0x84ec3c97da624ab4, 0xbd5af13bef0b113e }, { 0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e },
+    { 0xcfb11ead453994ba, 0x67de18eda5814af2 }, { 0x81ceb32c4b43fcf4, 0x80eacf948770ced7 },
+    { 0xa2425ff75e14fc31, 0xa1258379a94d028d }, { 0xcad2f7f5359a3b3e, 0x096ee45813a04330 },
+    { 0xfd87b5f28300ca0d, 0x8bca9d6e188853fc }, { 0x9e74d1b791e07e48, 0x775ea264cf55347e },
+    { 0xc612062576589dda, 0x95364afe032a819e }, { 0xf79687aed3eec551, 0x3a83ddbd83f52205 },
+    { 0x9abe14cd44753b52, 0xc4926a9672793543 }, { 0xc16d9a0095928a27, 0x75b7053c0f178294 },
+    { 0xf1c90080baf72cb1, 0x5324c68b12dd6339 }, { 0x971da05074da7bee, 0xd3f6fc16ebca5e04 },
+    { 0xbce5086492111aea, 0x88f4bb1ca6bcf585 }, { 0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6 },
+    { 0x9392ee8e921d5d07, 0x3aff322e62439fd0 }, { 0xb877aa3236a4b449, 0x09befeb9fad487c3 },
+    { 0xe69594bec44de15b, 0x4c2ebe687989a9b4 }, { 0x901d7cf73ab0acd9, 0x0f9d37014bf60a11 },
+    { 0xb424dc35095cd80f, 0x538484c19ef38c95 }, { 0xe12e13424bb40e13, 0x2865a5f206b06fba },
+    { 0x8cbccc096f5088cb, 0xf93f87b7442e45d4 }, { 0xafebff0bcb24aafe, 0xf78f69a51539d749 },
+    { 0xdbe6fecebdedd5be, 0xb573440e5a884d1c }, { 0x89705f4136b4a597, 0x31680a88f8953031 },
+    { 0xabcc77118461cefc, 0xfdc20d2b36ba7c3e }, { 0xd6bf94d5e57a42bc, 0x3d32907604691b4d },
+    { 0x8637bd05af6c69b5, 0xa63f9a49c2c1b110 }, { 0xa7c5ac471b478423, 0x0fcf80dc33721d54 },
+    { 0xd1b71758e219652b, 0xd3c36113404ea4a9 }, { 0x83126e978d4fdf3b, 0x645a1cac083126ea },
+    { 0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4 }, { 0xcccccccccccccccc, 0xcccccccccccccccd },
+    { 0x8000000000000000, 0x0000000000000000 }, { 0xa000000000000000, 0x0000000000000000 },
+    { 0xc800000000000000, 0x0000000000000000 }, { 0xfa00000000000000, 0x0000000000000000 },
+    { 0x9c40000000000000, 0x0000000000000000 }, { 0xc350000000000000, 0x0000000000000000 },
+    { 0xf424000000000000, 0x0000000000000000 }, { 0x9896800000000000, 0x0000000000000000 },
+    { 0xbebc200000000000, 0x0000000000000000 }, { 0xee6b280000000000, 0x0000000000000000 },
+    { 0x9502f90000000000, 0x0000000000000000 }, { 0xba43b74000000000, 0x0000000000000000 },
+    { 0xe8d4a51000000000, 0x0000000000000000 }, { 0x9184e72a00000000, 0x0000000000000000 },
+    { 0xb5e620f480000000, 0x0000000000000000 }, { 0xe35fa931a0000000, 0x0000000000000000 },
+    { 0x8e1bc9bf04000000, 0x0000000000000000 }, { 0xb1a2bc2ec5000000, 0x0000000000000000 },
+    { 0xde0b6b3a76400000, 0x0000000000000000 }, { 0x8ac7230489e80000, 0x0000000000000000 },
+    { 0xad78ebc5ac620000, 0x0000000000000000 }, { 0xd8d726b7177a8000, 0x0000000000000000 },
+    { 0x878678326eac9000, 0x0000000000000000 }, { 0xa968163f0a57b400, 0x0000000000000000 },
+    { 0xd3c21bcecceda100, 0x0000000000000000 }, { 0x84595161401484a0, 0x0000000000000000 },
+    { 0xa56fa5b99019a5c8, 0x0000000000000000 }, { 0xcecb8f27f4200f3a, 0x0000000000000000 },
+    { 0x813f3978f8940984, 0x4000000000000000 }, { 0xa18f07d736b90be5, 0x5000000000000000 },
+    { 0xc9f2c9cd04674ede, 0xa400000000000000 }, { 0xfc6f7c4045812296, 0x4d00000000000000 },
+    { 0x9dc5ada82b70b59d, 0xf020000000000000 }, { 0xc5371912364ce305, 0x6c28000000000000 },
+    { 0xf684df56c3e01bc6, 0xc732000000000000 }, { 0x9a130b963a6c115c, 0x3c7f400000000000 },
+    { 0xc097ce7bc90715b3, 0x4b9f100000000000 }, { 0xf0bdc21abb48db20, 0x1e86d40000000000 },
+    { 0x96769950b50d88f4, 0x1314448000000000 }, { 0xbc143fa4e250eb31, 0x17d955a000000000 },
+    { 0xeb194f8e1ae525fd, 0x5dcfab0800000000 }, { 0x92efd1b8d0cf37be, 0x5aa1cae500000000 },
+    { 0xb7abc627050305ad, 0xf14a3d9e40000000 }, { 0xe596b7b0c643c719, 0x6d9ccd05d0000000 },
+    { 0x8f7e32ce7bea5c6f, 0xe4820023a2000000 }, { 0xb35dbf821ae4f38b, 0xdda2802c8a800000 },
+    { 0xe0352f62a19e306e, 0xd50b2037ad200000 }, { 0x8c213d9da502de45, 0x4526f422cc340000 },
+    { 0xaf298d050e4395d6, 0x9670b12b7f410000 }, { 0xdaf3f04651d47b4c, 0x3c0cdd765f114000 },
+    { 0x88d8762bf324cd0f, 0xa5880a69fb6ac800 }, { 0xab0e93b6efee0053, 0x8eea0d047a457a00 },
+    { 0xd5d238a4abe98068, 0x72a4904598d6d880 }, { 0x85a36366eb71f041, 0x47a6da2b7f864750 },
+    { 0xa70c3c40a64e6c51, 0x999090b65f67d924 }, { 0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d },
+    { 0x82818f1281ed449f, 0xbff8f10e7a8921a4 }, { 0xa321f2d7226895c7, 0xaff72d52192b6a0d },
+    { 0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490 }, { 0xfee50b7025c36a08, 0x02f236d04753d5b4 },
+    { 0x9f4f2726179a2245, 0x01d762422c946590 }, { 0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5 },
+    { 0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2 }, { 0x9b934c3b330c8577, 0x63cc55f49f88eb2f },
+    { 0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb },
+};
+
+// Powers of ten exactly representable as doubles
+static const double POW10_EXACT[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static void mul_128(uint64_t a, uint64_t b, uint64_t *hi, uint64_t *lo) {
+    unsigned __int128 r = (unsigned __int128)a * b;
+    *hi = (uint64_t)(r >> 64);
+    *lo = (uint64_t)r;
+}
+
+// Computes the bits of w * 10^q (correctly rounded) using the Eisel-Lemire
+// algorithm. Returns false if the result cannot be decided this way.
+static bool eisel_lemire(uint64_t w, int q, uint64_t *bits) {
+    if (q < POW5_MIN_Q || q > POW5_MAX_Q) return false;
+
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+
+    // Product with the 128-bit power of five, refined with the lower
+    // half only if the upper bits needed for rounding are all ones
+    const uint64_t *pow5 = POW5_128[q - POW5_MIN_Q];
+    uint64_t hi, lo;
+    mul_128(w, pow5[0], &hi, &lo);
+
+    if ((hi & 0x1FF) == 0x1FF) {
+        uint64_t hi2, lo2;
+        mul_128(w, pow5[1], &hi2, &lo2);
+        lo += hi2;
+        if (hi2 > lo) hi++;
+    }
+
+    // The product may be off by one in the lowest bit, which matters
+    // only in the ambiguous halfway case
+    if (lo == UINT64_MAX && (q < -27 || q > 55)) return false;
+
+    int upper = (int)(hi >> 63);
+    int shift = upper + 64 - DP_SIGNIFICAND_SIZE - 3;
+    uint64_t mantissa = hi >> shift;
+    int power2 = (((152170 + 65536) * q) >> 16) + 63 + upper - lz + 1023;
+
+    if (power2 <= 0) {
+        // Subnormal
+        if (-power2 + 1 >= 64) { *bits = 0; return true; }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < DP_HIDDEN_BIT ? 0 : 1;
+        *bits = (mantissa & DP_SIGNIFICAND_MASK) | ((uint64_t)power2 << DP_SIGNIFICAND_SIZE);
+        return true;
+    }
+
+    // Exactly halfway between two doubles: round to even
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+        (mantissa << shift) == hi)
+        mantissa &= ~1ull;
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (DP_HIDDEN_BIT << 1)) {
+        mantissa = DP_HIDDEN_BIT;
+        power2++;
+    }
+
+    if (power2 >= 0x7FF) {
+        *bits = DP_EXPONENT_MASK;
+        return true;
+    }
+
+    *bits = (mantissa & DP_SIGNIFICAND_MASK) | ((uint64_t)power2 << DP_SIGNIFICAND_SIZE);
+    return true;
+}
+
+// Case-insensitively matches the lowercase word at str[i..]
+static bool match_word(String str, size_t i, const char *word) {
+    size_t n = strlen(word);
+    if (str.len - i < n) return false;
+
+    for (size_t j = 0; j < n; j++)
+        if ((str.str[i + j] | 0x20) != word[j]) return false;
+
+    return true;
+}
+
+// Parses the number with strtod() from a nul-terminated copy
+static double parse_double_slow(String num) {
+    char stack[64];
+    unsigned slot = str_allocator_slot(NULL);
+    char *buf = num.len < sizeof stack ? stack : str_mem_alloc_with(slot, num.len + 1);
+
+    memcpy(buf, num.str, num.len);
+    buf[num.len] = '\0';
+
+    double d = strtod(buf, NULL);
+
+    if (buf != stack) str_mem_free_with(slot, buf, num.len + 1);
+    return d;
+}
+
+StrParseStatus str_parse_double(String str, double *out, size_t *consumed) {
+    size_t i = 0;
+    bool neg = false;
+    if (str.len && (str.str[0] == '+' || str.str[0] == '-'))
+        neg = str.str[i++] == '-';
+
+    double d;
+    bool literal = true; // "inf" and "nan" cannot overflow
+
+    if (match_word(str, i, "inf")) {
+        i += match_word(str, i, "infinity") ? 8 : 3;
+        d = INFINITY;
+        goto done;
+    }
+
+    if (match_word(str, i, "nan")) {
+        i += 3;
+        d = NAN;
+        goto done;
+    }
+
+    // Mantissa
+    uint64_t w = 0;
+    size_t mant_start = i;
+    size_t int_digits = parse_digits(str, &i, &w);
+    size_t frac_digits = 0;
+
+    if (i < str.len && str.str[i] == '.') {
+        size_t dot = i++;
+        frac_digits = parse_digits(str, &i, &w);
+        if (!int_digits && !frac_digits) i = dot;
+    }
+
+    if (!int_digits && !frac_digits) {
+        if (consumed) *consumed = 0;
+        return STR_PARSE_INVALID;
+    }
+
+    // Exponent (only consumed if followed by digits)
+    int64_t exp = 0;
+    if (i < str.len && (str.str[i] | 0x20) == 'e') {
+        size_t j = i + 1;
+        bool exp_neg = false;
+        if (j < str.len && (str.str[j] == '+' || str.str[j] == '-'))
+            exp_neg = str.str[j++] == '-';
+
+        if (j < str.len && IS_DIGIT(str.str[j])) {
+            for (; j < str.len && IS_DIGIT(str.str[j]); j++)
+                if (exp < 100000) exp = exp * 10 + (str.str[j] - '0');
+
+            if (exp_neg) exp = -exp;
+            i = j;
+        }
+    }
+
+    // Leading zeroes don't count towards the 19 digits that fit into `w`
+    size_t digits = int_digits + frac_digits;
+    if (digits > 19) {
+        for (size_t j = mant_start; j < i && digits; j++) {
+            if (str.str[j] == '.') continue;
+            if (str.str[j] != '0') break;
+            digits--;
+        }
+    }
+
+    int64_t q = exp - (int64_t)frac_digits;
+    uint64_t bits;
+    literal = false;
+
+    if (digits > 19) {
+        d = parse_double_slow(str_nref(str.str + mant_start, i - mant_start));
+    } else if (w == 0) {
+        d = 0.0;
+    } else if (q >= -22 && q <= 22 && w <= (1ull << 53)) {
+        // Clinger's fast path: both operands and the result are exact
+        d = (double)w;
+        d = q < 0 ? d / POW10_EXACT[-q] : d * POW10_EXACT[q];
+    } else if (eisel_lemire(w, (int)q, &bits)) {
+        memcpy(&d, &bits, sizeof d);
+    } else {
+        d = parse_double_slow(str_nref(str.str + mant_start, i - mant_start));
+    }
+
+done:
+    if (out) *out = neg ? -d : d;
+    if (consumed) *consumed = i;
+    return !literal && isinf(d) ? STR_PARSE_OVERFLOW : STR_PARSE_OK;
+}
@@ -0,0 +1,73 @@
+#ifndef _STRCONV_H
+#define _STRCONV_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+/* * * * * * * FORMATTING * * * * * * */
+
+// Maximum number of bytes appended by any of the str_push_* number formatters
+#define STR_NUM_MAXLEN 32
+
+// Appends the decimal representation of a signed integer to the given string
+void str_push_int(int64_t value, String *str);
+
+// Appends the decimal representation of an unsigned integer to the given string
+void str_push_uint(uint64_t value, String *str);
+
+// Flags for str_push_hex()
+typedef enum {
+    // Use uppercase digits (A-F)
+    STR_HEX_UPPER = 0x1,
+} StrHexFlags;
+
+// Appends the hexadecimal representation of an unsigned integer to the given string
+// The number is padded with leading zeroes to at least `width` digits (up to 16)
+void str_push_hex(uint64_t value, size_t width, StrHexFlags flags, String *str);
+
+// Appends the shortest decimal representation of a double that parses back to the
+// exact same value (Grisu3, with an exact but slower fallback for the rare doubles it
+// cannot decide). Uses fixed notation for moderate exponents ("123", "0.001")
+// and exponent notation otherwise ("1e21", "1.5e-7").
+// NaN and infinities are written as "nan", "inf" and "-inf".
+void str_push_double(double value, String *str);
+
+// Formats a number into the given buffer (at least STR_NUM_MAXLEN bytes long)
+// without a nul-terminator and returns the number of bytes written
+size_t fmt_int(char *buf, int64_t value);
+size_t fmt_uint(char *buf, uint64_t value);
+size_t fmt_hex(char *buf, uint64_t value, size_t width, StrHexFlags flags);
+size_t fmt_double(char *buf, double value);
+
+/* * * * * * * PARSING * * * * * * */
+
+// Result of the str_parse_* functions
+typedef enum {
+    // A number was parsed
+    STR_PARSE_OK = 0,
+    // The string does not start with a number
+    STR_PARSE_INVALID,
+    // The number does not fit the output type. The output is clamped
+    // to the nearest representable value (or infinity for doubles).
+    STR_PARSE_OVERFLOW,
+} StrParseStatus;
+
+// Parses a decimal signed integer ([+-]?[0-9]+) at the beginning of the given
+// string, without requiring it to be nul-terminated. The number of bytes making
+// up the number (0 if invalid) is written to `consumed`, which may be NULL.
+StrParseStatus str_parse_int(String str, int64_t *out, size_t *consumed);
+
+// Parses a decimal unsigned integer (\+?[0-9]+). See str_parse_int().
+StrParseStatus str_parse_uint(String str, uint64_t *out, size_t *consumed);
+
+// Parses a decimal floating point number (as accepted by strtod(), without
+// leading whitespace and hex floats), including "inf", "infinity" and "nan".
+// Correctly rounded. Uses the Clinger and Eisel-Lemire fast paths and only
+// falls back to strtod() for more than 19 significant digits or extreme exponents.
+// See str_parse_int().
+StrParseStatus str_parse_double(String str, double *out, size_t *consumed);
+
+#endif // _STRCONV_H
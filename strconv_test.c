@@ -0,0 +1,279 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strconv.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+// Returns true if the shortest representation of `d` parses back to `d`
+static bool double_roundtrips(double d) {
+    char buf[STR_NUM_MAXLEN + 1];
+    buf[fmt_double(buf, d)] = '\0';
+    return strtod(buf, NULL) == d;
+}
+
+// Formats the double with the given bit pattern
+static String double_from_bits(uint64_t bits) {
+    double d;
+    memcpy(&d, &bits, sizeof d);
+
+    String str = str_alloc("");
+    str_push_double(d, &str);
+    return str;
+}
+
+// Parses `s` with both str_parse_double() and strtod() and compares the results
+static bool double_parses_like_strtod(const char *s) {
+    double a, b;
+    size_t n;
+    char *end;
+
+    str_parse_double(str_ref(s), &a, &n);
+    b = strtod(s, &end);
+
+    return n == (size_t)(end - s) && !memcmp(&a, &b, sizeof a);
+}
+
+int main() {
+    test("str_push_int", {
+        String str = str_alloc("");
+
+        str_push_int(0, &str);
+        assert_string_eq(str_ref("0"), str);
+
+        str.len = 0;
+        str_push_int(-1234567, &str);
+        assert_string_eq(str_ref("-1234567"), str);
+
+        str.len = 0;
+        str_push_int(INT64_MIN, &str);
+        assert_string_eq(str_ref("-9223372036854775808"), str);
+
+        str.len = 0;
+        str_push_int(INT64_MAX, &str);
+        assert_string_eq(str_ref("9223372036854775807"), str);
+
+        str_free(&str);
+    });
+
+    test("str_push_uint", {
+        String str = str_alloc("n=");
+
+        str_push_uint(UINT64_MAX, &str);
+        assert_string_eq(str_ref("n=18446744073709551615"), str);
+
+        str.len = 0;
+        str_push_uint(9, &str);
+        str_push_uint(10, &str);
+        str_push_uint(100, &str);
+        assert_string_eq(str_ref("910100"), str);
+
+        str_free(&str);
+    });
+
+    test("str_push_hex", {
+        String str = str_alloc("");
+
+        str_push_hex(0, 0, 0, &str);
+        assert_string_eq(str_ref("0"), str);
+
+        str.len = 0;
+        str_push_hex(0xBEEF, 0, 0, &str);
+        assert_string_eq(str_ref("beef"), str);
+
+        str.len = 0;
+        str_push_hex(0x0F, 2, STR_HEX_UPPER, &str);
+        assert_string_eq(str_ref("0F"), str);
+
+        str.len = 0;
+        str_push_hex(UINT64_MAX, 32, STR_HEX_UPPER, &str);
+        assert_string_eq(str_ref("FFFFFFFFFFFFFFFF"), str);
+
+        str_free(&str);
+    });
+
+    test("str_push_double", {
+        String str = str_alloc("");
+
+        str_push_double(0.1, &str);
+        assert_string_eq(str_ref("0.1"), str);
+
+        str.len = 0;
+        str_push_double(-0.0, &str);
+        assert_string_eq(str_ref("-0"), str);
+
+        str.len = 0;
+        str_push_double(123.0, &str);
+        assert_string_eq(str_ref("123"), str);
+
+        str.len = 0;
+        str_push_double(1.5e-7, &str);
+        assert_string_eq(str_ref("1.5e-7"), str);
+
+        str.len = 0;
+        str_push_double(1e21, &str);
+        assert_string_eq(str_ref("1e21"), str);
+
+        str.len = 0;
+        str_push_double(0.001234, &str);
+        assert_string_eq(str_ref("0.001234"), str);
+
+        str.len = 0;
+        str_push_double(-INFINITY, &str);
+        assert_string_eq(str_ref("-inf"), str);
+
+        str.len = 0;
+        str_push_double(NAN, &str);
+        assert_string_eq(str_ref("nan"), str);
+
+        str_free(&str);
+    });
+
+    test("str_push_double (shortest)", {
+        // Grisu2 alone writes 17 digits for these
+        String str = double_from_bits(0x7953a0dc0d3db461);
+        assert_string_eq(str_ref("2.718316374298659e276"), str);
+        str_free(&str);
+
+        str = double_from_bits(0x435b702ab297ac10);
+        assert_string_eq(str_ref("30892612233637950"), str);
+        str_free(&str);
+
+        str = double_from_bits(0x2d139f7fee0bb82e);
+        assert_string_eq(str_ref("1.505177592653168e-91"), str);
+        str_free(&str);
+
+        // The lower boundary of the smallest normal is not closer
+        str = double_from_bits(0x0010000000000000);
+        assert_string_eq(str_ref("2.2250738585072014e-308"), str);
+        str_free(&str);
+    });
+
+    test("fmt_double roundtrip", {
+        assert(double_roundtrips(5e-324));
+        assert(double_roundtrips(1.7976931348623157e308));
+        assert(double_roundtrips(2.2250738585072014e-308));
+        assert(double_roundtrips(0.3));
+        assert(double_roundtrips(1.0 / 3.0));
+
+        srand(1234);
+        bool ok = true;
+        for (int i = 0; i < 100000 && ok; i++) {
+            uint64_t bits = 0;
+            for (int j = 0; j < 4; j++) bits = (bits << 16) ^ (rand() & 0xFFFF);
+
+            double d;
+            memcpy(&d, &bits, sizeof d);
+            if (isfinite(d)) ok = double_roundtrips(d);
+        }
+        assert(ok);
+    });
+
+    test("str_parse_uint", {
+        uint64_t u;
+        size_t n;
+
+        assert_eq(STR_PARSE_OK, str_parse_uint(str_ref("12345678901234567x"), &u, &n), "%d");
+        assert_eq((uint64_t)12345678901234567ull, u, "%lu");
+        assert_eq((size_t)17, n, "%zu");
+
+        assert_eq(STR_PARSE_OK, str_parse_uint(str_ref("18446744073709551615"), &u, &n), "%d");
+        assert_eq(UINT64_MAX, u, "%lu");
+
+        assert_eq(STR_PARSE_OVERFLOW, str_parse_uint(str_ref("18446744073709551616,"), &u, &n), "%d");
+        assert_eq(UINT64_MAX, u, "%lu");
+        assert_eq((size_t)20, n, "%zu");
+
+        assert_eq(STR_PARSE_OK, str_parse_uint(str_ref("000000000000000000000042"), &u, &n), "%d");
+        assert_eq((uint64_t)42, u, "%lu");
+
+        assert_eq(STR_PARSE_INVALID, str_parse_uint(str_ref("-1"), &u, &n), "%d");
+        assert_eq((size_t)0, n, "%zu");
+
+        // Slice of a larger buffer, not nul-terminated
+        assert_eq(STR_PARSE_OK, str_parse_uint(str_nref("123456789", 4), &u, &n), "%d");
+        assert_eq((uint64_t)1234, u, "%lu");
+    });
+
+    test("str_parse_int", {
+        int64_t i;
+        size_t n;
+
+        assert_eq(STR_PARSE_OK, str_parse_int(str_ref("-42;"), &i, &n), "%d");
+        assert_eq((int64_t)-42, i, "%ld");
+        assert_eq((size_t)3, n, "%zu");
+
+        assert_eq(STR_PARSE_OK, str_parse_int(str_ref("-9223372036854775808"), &i, NULL), "%d");
+        assert_eq(INT64_MIN, i, "%ld");
+
+        assert_eq(STR_PARSE_OVERFLOW, str_parse_int(str_ref("9223372036854775808"), &i, NULL), "%d");
+        assert_eq(INT64_MAX, i, "%ld");
+
+        assert_eq(STR_PARSE_INVALID, str_parse_int(str_ref("+"), &i, &n), "%d");
+        assert_eq((size_t)0, n, "%zu");
+    });
+
+    test("str_parse_double", {
+        double d;
+        size_t n;
+
+        assert_eq(STR_PARSE_OK, str_parse_double(str_ref("3.25,"), &d, &n), "%d");
+        assert_eq(3.25, d, "%g");
+        assert_eq((size_t)4, n, "%zu");
+
+        assert_eq(STR_PARSE_OK, str_parse_double(str_ref("1e5x"), &d, &n), "%d");
+        assert_eq(1e5, d, "%g");
+        assert_eq((size_t)3, n, "%zu");
+
+        assert_eq(STR_PARSE_OK, str_parse_double(str_ref("2e"), &d, &n), "%d");
+        assert_eq((size_t)1, n, "%zu");
+
+        assert_eq(STR_PARSE_OVERFLOW, str_parse_double(str_ref("-1e999"), &d, &n), "%d");
+        assert_eq(-INFINITY, d, "%g");
+
+        assert_eq(STR_PARSE_OK, str_parse_double(str_ref("-Infinity"), &d, &n), "%d");
+        assert_eq((size_t)9, n, "%zu");
+
+        assert_eq(STR_PARSE_INVALID, str_parse_double(str_ref("."), &d, &n), "%d");
+        assert_eq(STR_PARSE_INVALID, str_parse_double(str_ref("e5"), &d, &n), "%d");
+    });
+
+    test("parse_double (strtod)", {
+        assert(double_parses_like_strtod("0.1"));
+        assert(double_parses_like_strtod("9007199254740993"));
+        assert(double_parses_like_strtod("2.2250738585072011e-308"));
+        assert(double_parses_like_strtod("4.9e-324"));
+        assert(double_parses_like_strtod("1.7976931348623157e308"));
+        assert(double_parses_like_strtod("123456789012345678901234567890"));
+        assert(double_parses_like_strtod("0.000000000000000000000000012345"));
+        assert(double_parses_like_strtod("7.3177701707893310e+15"));
+
+        srand(4321);
+        bool ok = true;
+        char buf[64];
+        for (int i = 0; i < 200000 && ok; i++) {
+            uint64_t bits = 0;
+            for (int j = 0; j < 4; j++) bits = (bits << 16) ^ (rand() & 0xFFFF);
+
+            double d;
+            memcpy(&d, &bits, sizeof d);
+            if (!isfinite(d)) continue;
+
+            switch (i % 3) {
+            case 0: snprintf(buf, sizeof buf, "%.17g", d); break;
+            case 1: buf[fmt_double(buf, d)] = '\0'; break;
+            case 2: snprintf(buf, sizeof buf, "%u.%ue%d", rand() % 100000,
+                             rand(), rand() % 80 - 40); break;
+            }
+            ok = double_parses_like_strtod(buf);
+            if (!ok) printf(" %s ", buf);
+        }
+        assert(ok);
+    });
+}
@@ -0,0 +1,313 @@
+#include "strcsv.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CSV_X86
+#include <immintrin.h>
+
+#define TARGET_AVX2 __attribute__((target("avx2,pclmul")))
+#endif
+
+#define QUOTE '"'
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Instruction sets of the kernels
+typedef enum { ISA_SCALAR, ISA_SSE, ISA_AVX2 } Isa;
+
+// Best instruction set supported by the CPU and allowed by the flags
+static Isa isa(StrCsvFlags flags) {
+#ifdef CSV_X86
+    if (flags & STR_CSV_NO_SIMD) return ISA_SCALAR;
+    if (!(flags & STR_CSV_NO_AVX2) && __builtin_cpu_supports("avx2")
+        && __builtin_cpu_supports("pclmul")) return ISA_AVX2;
+#endif
+#ifdef __SSE2__
+    if (!(flags & STR_CSV_NO_SIMD)) return ISA_SSE;
+#endif
+    return ISA_SCALAR;
+}
+
+// Bit masks of a block of 64 bytes
+typedef struct {
+    uint64_t quotes;
+    uint64_t structural; // delimiters and newlines
+} Block;
+
+// Sets every bit from a quote bit up to (not including) the next quote bit:
+// the bits inside the quotes (with the opening quote)
+static uint64_t prefix_xor(uint64_t m) {
+    m ^= m << 1;
+    m ^= m << 2;
+    m ^= m << 4;
+    m ^= m << 8;
+    m ^= m << 16;
+    m ^= m << 32;
+    return m;
+}
+
+/* * * * * * * Kernels * * * * * * */
+
+// The kernels classify the 64 bytes at `p`
+
+static Block classify_scalar(const char *p, char delim) {
+    Block b = {0};
+
+    for (int i = 0; i < 64; i++) {
+        uint64_t bit = (uint64_t)1 << i;
+        if (p[i] == QUOTE) b.quotes |= bit;
+        if (p[i] == delim || p[i] == '\n') b.structural |= bit;
+    }
+
+    return b;
+}
+
+#ifdef __SSE2__
+
+static inline uint64_t eq_sse(const __m128i v[4], __m128i c) {
+    uint64_t m0 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v[0], c));
+    uint64_t m1 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v[1], c));
+    uint64_t m2 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v[2], c));
+    uint64_t m3 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v[3], c));
+    return m0 | m1 << 16 | m2 << 32 | m3 << 48;
+}
+
+static Block classify_sse(const char *p, char delim) {
+    const __m128i *q = (const __m128i *)p;
+    __m128i v[4] = {
+        _mm_loadu_si128(q + 0), _mm_loadu_si128(q + 1),
+        _mm_loadu_si128(q + 2), _mm_loadu_si128(q + 3),
+    };
+
+    return (Block){
+        .quotes     = eq_sse(v, _mm_set1_epi8(QUOTE)),
+        .structural = eq_sse(v, _mm_set1_epi8(delim)) | eq_sse(v, _mm_set1_epi8('\n')),
+    };
+}
+
+#endif
+
+#ifdef CSV_X86
+
+TARGET_AVX2
+static inline uint64_t eq_avx2(__m256i lo, __m256i hi, __m256i c) {
+    uint64_t m0 = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, c));
+    uint64_t m1 = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, c));
+    return m0 | m1 << 32;
+}
+
+TARGET_AVX2
+static Block classify_avx2(const char *p, char delim) {
+    __m256i lo = _mm256_loadu_si256((const __m256i *)p);
+    __m256i hi = _mm256_loadu_si256((const __m256i *)(p + 32));
+
+    return (Block){
+        .quotes     = eq_avx2(lo, hi, _mm256_set1_epi8(QUOTE)),
+        .structural = eq_avx2(lo, hi, _mm256_set1_epi8(delim))
+                    | eq_avx2(lo, hi, _mm256_set1_epi8('\n')),
+    };
+}
+
+// Same as prefix_xor(): a carry-less multiplication by all ones
+TARGET_AVX2
+static uint64_t prefix_xor_clmul(uint64_t m) {
+    __m128i x = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)m), _mm_set1_epi8(-1), 0);
+    return (uint64_t)_mm_cvtsi128_si64(x);
+}
+
+#endif
+
+// Classifies the next block of the string. Blocks are 64 bytes, except at the end of
+// the bytes given so far. Returns false if there are no bytes to classify.
+static bool classify(StrCsv *c) {
+    size_t n = c->str.len - c->scanned;
+    if (!n) return false;
+
+    const char *p = c->str.str + c->scanned;
+    char tail[64];
+
+    // Copy the end to a padded block. The padding has no quotes, so the quote state
+    // at the end of the block is the state after the last byte.
+    if (n < 64) {
+        memset(tail, ' ', sizeof tail);
+        memcpy(tail, p, n);
+        p = tail;
+    }
+
+    Block b;
+    uint64_t inside;
+    switch ((Isa)c->isa) {
+#ifdef CSV_X86
+        case ISA_AVX2:
+            b = classify_avx2(p, c->delim);
+            inside = prefix_xor_clmul(b.quotes);
+            break;
+#endif
+#ifdef __SSE2__
+        case ISA_SSE:
+            b = classify_sse(p, c->delim);
+            inside = prefix_xor(b.quotes);
+            break;
+#endif
+        default:
+            b = classify_scalar(p, c->delim);
+            inside = prefix_xor(b.quotes);
+            break;
+    }
+
+    if (c->flags & STR_CSV_NO_QUOTES) b.quotes = inside = 0;
+
+    // The prefix XOR starts outside quotes: flip it if the block starts inside
+    inside ^= c->quoted;
+    c->quoted = (uint64_t)((int64_t)inside >> 63);
+
+    // The quotes left in the previous block belong to the current field
+    c->fquotes |= c->quotes != 0;
+    c->quotes = b.quotes;
+
+    c->base = c->scanned;
+    c->mask = b.structural & ~inside;
+    if (n < 64) c->mask &= ((uint64_t)1 << n) - 1;
+    c->scanned += n < 64 ? n : 64;
+    return true;
+}
+
+/* * * * * * * Records * * * * * * */
+
+static void push_end(StrCsv *c, size_t offset) {
+    if (c->nends == c->cap) {
+        size_t cap = c->cap ? c->cap * 2 : 16;
+        c->ends   = str_mem_realloc_with(c->alloc, c->ends, c->cap * sizeof *c->ends,
+                                         cap * sizeof *c->ends);
+        c->fields = str_mem_realloc_with(c->alloc, c->fields, c->cap * sizeof *c->fields,
+                                         cap * sizeof *c->fields);
+        c->cap    = cap;
+    }
+
+    c->ends[c->nends++] = offset;
+}
+
+// Removes the quotes of src[0..n) into `out`: quotes toggle the quoted state, and
+// a doubled quote inside quotes stands for a quote. Returns the length written.
+static size_t unescape(char *out, const char *src, size_t n) {
+    bool in = false;
+    size_t w = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        if (src[i] != QUOTE) {
+            out[w++] = src[i];
+        } else if (in && i + 1 < n && src[i + 1] == QUOTE) {
+            out[w++] = QUOTE;
+            i++;
+        } else {
+            in = !in;
+        }
+    }
+
+    return w;
+}
+
+// Ends the current field at `offset`, recording whether it has quotes
+static inline void end_field(StrCsv *c, size_t offset) {
+    push_end(c, offset << 1 | c->fquotes);
+    c->fquotes = false;
+}
+
+// Turns the delimiters found into the fields of the record ending at `end`
+// (at the newline, or at the end of the input) and starts the next record at `next`
+static void finish_record(StrCsv *c, size_t end, size_t next) {
+    const char *s = c->str.str;
+    bool newline = next > end;
+    end_field(c, end);
+
+    // Unescaped fields are never longer than the record
+    size_t len = end - c->pos;
+    if (len > c->buf_cap && !(c->flags & STR_CSV_NO_QUOTES)) {
+        c->buf     = str_mem_realloc_with(c->alloc, c->buf, c->buf_cap, len);
+        c->buf_cap = len;
+    }
+
+    size_t start = c->pos;
+    size_t w = 0;
+
+    for (size_t k = 0; k < c->nends; k++) {
+        size_t stop = c->ends[k] >> 1;
+        if (k + 1 == c->nends && newline && stop > start && s[stop - 1] == '\r') stop--;
+
+        const char *field = s + start;
+        size_t n = stop - start;
+
+        if (c->ends[k] & 1) {
+            n = unescape(c->buf + w, field, n);
+            field = c->buf + w;
+            w += n;
+        }
+
+        // Same as str_nref(), which is not inlined across files
+        c->fields[k] = (String){ .flags = STR_VALID, .len = n, .str = (char *)field };
+
+        start = (c->ends[k] >> 1) + 1;
+    }
+
+    c->count = c->nends;
+    c->nends = 0;
+    c->pos   = next;
+}
+
+/* * * * * * * Parser * * * * * * */
+
+StrCsv str_csv(String str, char delim, StrCsvFlags flags) {
+    return (StrCsv){
+        .str   = str,
+        .delim = delim,
+        .flags = flags,
+        .last  = !(flags & STR_CSV_STREAM),
+        .isa   = isa(flags),
+        .alloc = str_allocator_slot(NULL),
+    };
+}
+
+void str_csv_free(StrCsv *c) {
+    str_mem_free_with(c->alloc, c->ends, c->cap * sizeof *c->ends);
+    str_mem_free_with(c->alloc, c->fields, c->cap * sizeof *c->fields);
+    str_mem_free_with(c->alloc, c->buf, c->buf_cap);
+    memset(c, 0, sizeof *c);
+}
+
+void str_csv_update(StrCsv *c, String str, bool last) {
+    c->str  = str;
+    c->last = last;
+}
+
+bool str_csv_next(StrCsv *c) {
+    c->count = 0;
+
+    for (;;) {
+        while (!c->mask) {
+            if (classify(c)) continue;
+
+            // End of the input: the rest is the last record (without a line break)
+            if (!c->last || c->pos >= c->str.len) return false;
+            c->fquotes |= c->quotes != 0;
+            c->quotes = 0;
+            finish_record(c, c->str.len, c->str.len);
+            return true;
+        }
+
+        unsigned bit = __builtin_ctzll(c->mask);
+        size_t at = c->base + bit;
+        c->mask &= c->mask - 1;
+
+        // Take the quotes of the block up to the delimiter
+        c->fquotes |= (c->quotes & (((uint64_t)1 << bit) - 1)) != 0;
+        c->quotes &= ~(((uint64_t)2 << bit) - 1);
+
+        if (c->str.str[at] == '\n') {
+            finish_record(c, at, at + 1);
+            return true;
+        }
+
+        end_field(c, at);
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef _STRCSV_H
+#define _STRCSV_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Flags for str_csv()
+typedef enum {
+    // The string is the beginning of a stream, continued with str_csv_update()
+    STR_CSV_STREAM    = 0x1,
+    // Quotes are ordinary bytes (TSV)
+    STR_CSV_NO_QUOTES = 0x2,
+    // Kernel selection (for tests and benchmarks)
+    STR_CSV_NO_SIMD   = 0x4,
+    STR_CSV_NO_AVX2   = 0x8,
+} StrCsvFlags;
+
+// Parser of delimiter-separated records (RFC 4180 CSV, TSV).
+// Records are terminated by "\n" or "\r\n". Fields may be enclosed in double quotes,
+// inside which delimiters and line breaks are part of the field and a doubled quote
+// stands for a quote. The bytes are classified 64 at a time into bit masks of quotes,
+// delimiters and newlines, and the quoted regions are masked out with a prefix XOR
+// of the quote bits, so that the parser never walks the bytes one by one.
+typedef struct {
+    String      str;     // string being parsed (by reference)
+    size_t      pos;     // offset of the next record
+    char        delim;   // field delimiter
+    StrCsvFlags flags;
+    bool        last;    // the string holds the end of the input
+
+    String     *fields;  // fields of the current record
+    size_t      count;   // number of fields of the current record
+
+    // Private state
+    size_t      cap;     // capacity of `fields` and `ends`
+    size_t     *ends;    // offsets of the ends of the fields of the current record,
+                         // shifted left by one with the low bit set for quoted fields
+    size_t      nends;   // number of fields ended in the current record
+    size_t      scanned; // number of bytes classified
+    size_t      base;    // offset of the last block classified
+    uint64_t    mask;    // delimiters and newlines of that block not consumed yet
+    uint64_t    quoted;  // all ones if the classified bytes end inside quotes
+    uint64_t    quotes;  // quotes of that block after the last delimiter consumed
+    bool        fquotes; // the current field has quotes in earlier blocks
+    uint8_t     isa;     // kernel used to classify the bytes
+    char       *buf;     // unescaped fields of the current record
+    size_t      buf_cap;
+    unsigned    alloc;   // allocator slot of `fields`, `ends` and `buf`
+} StrCsv;
+
+// Creates a parser over the string, with the given delimiter (usually ',' or '\t').
+// Requires str_csv_free()
+StrCsv str_csv(String str, char delim, StrCsvFlags flags);
+
+// Frees the memory allocated by the parser
+void str_csv_free(StrCsv *csv);
+
+// Parses the next record into csv->fields[0..csv->count) and returns true,
+// or returns false at the end of the string.
+// The fields are references to the string, except the fields with quotes, which are
+// unescaped into a buffer of the parser. Either way they are valid until the next call.
+// With STR_CSV_STREAM, a record is only parsed once its line break is in the string
+// (or once the string is marked as the end of the input), and false means that more
+// input is needed.
+bool str_csv_next(StrCsv *csv);
+
+// Continues a stream with the bytes appended to the string since the last call
+// (the string may have been reallocated, but the bytes already given must not
+// have changed). `last` marks the end of the input.
+void str_csv_update(StrCsv *csv, String str, bool last);
+
+#endif // _STRCSV_H
@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strcsv.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+// Separators of the dumps of the records
+#define FIELD_SEP  '|'
+#define RECORD_SEP '/'
+
+// Kernel selections compared against the scalar code
+static const StrCsvFlags KERNELS[] = { STR_CSV_NO_SIMD, STR_CSV_NO_AVX2, 0 };
+
+// Pieces of the random inputs: quotes around delimiters and line breaks, doubled
+// quotes, empty fields, CRLF, and runs longer than a block
+static const char *PIECES[] = {
+    "a", "bc", ",", ",", "\n", "\r\n", "\"", "\"\"", "\"x,y\"", "\"multi\nline\"",
+    "\t", " ", "\"\"\"q\"\"\"",
+    "a long field without anything special that spans more than a block of 64 bytes",
+};
+
+// Appends the fields of the current record to the dump
+static void dump_record(const StrCsv *csv, String *dump) {
+    for (size_t k = 0; k < csv->count; k++) {
+        if (k) str_push(FIELD_SEP, dump);
+        str_pushs(csv->fields[k], dump);
+    }
+    str_push(RECORD_SEP, dump);
+}
+
+// Parses the input, given to the parser `chunk` bytes at a time (0 for all at once),
+// and returns the dump of the records
+static String parse(String input, char delim, StrCsvFlags flags, size_t chunk) {
+    String dump = str_alloc("");
+
+    if (!chunk) {
+        StrCsv csv = str_csv(input, delim, flags);
+        while (str_csv_next(&csv)) dump_record(&csv, &dump);
+        str_csv_free(&csv);
+        return dump;
+    }
+
+    // Stream through a growing buffer
+    String buf = str_alloc("");
+    StrCsv csv = str_csv(buf, delim, flags | STR_CSV_STREAM);
+
+    for (size_t i = 0; i < input.len; i += chunk) {
+        size_t n = input.len - i < chunk ? input.len - i : chunk;
+        str_pushs(str_nref(input.str + i, n), &buf);
+        str_csv_update(&csv, buf, i + n == input.len);
+        while (str_csv_next(&csv)) dump_record(&csv, &dump);
+    }
+
+    str_csv_free(&csv);
+    str_free(&buf);
+    return dump;
+}
+
+// Parses the input byte by byte (the state machine the parser replaces)
+static String reference(String input, char delim) {
+    String dump = str_alloc("");
+    bool quoted = false;
+    size_t field = 0; // start of the current field in the dump
+
+    for (size_t i = 0; i < input.len; i++) {
+        char c = input.str[i];
+
+        if (c == '"') {
+            if (quoted && i + 1 < input.len && input.str[i + 1] == '"') {
+                str_push('"', &dump);
+                i++;
+            } else {
+                quoted = !quoted;
+            }
+        } else if (quoted || (c != delim && c != '\n')) {
+            str_push(c, &dump);
+        } else if (c == delim) {
+            str_push(FIELD_SEP, &dump);
+            field = dump.len;
+        } else {
+            // A carriage return before the line break is dropped if it was not quoted
+            if (dump.len > field && dump.str[dump.len - 1] == '\r' && input.str[i - 1] == '\r')
+                dump.len--;
+            str_push(RECORD_SEP, &dump);
+            field = dump.len;
+        }
+    }
+
+    // The rest is a record unless the input ends with an unquoted line break
+    if (input.len && (quoted || input.str[input.len - 1] != '\n')) str_push(RECORD_SEP, &dump);
+    return dump;
+}
+
+// Parses random inputs with every kernel, at once and streamed, and compares the
+// results to the reference. Returns the number of mismatches.
+static size_t check_random(size_t count) {
+    size_t mismatches = 0;
+
+    for (size_t t = 0; t < count; t++) {
+        String input = str_alloc("");
+        for (size_t n = rand() % 80; n--;)
+            str_pushs(str_ref(PIECES[rand() % (sizeof PIECES / sizeof *PIECES)]), &input);
+
+        String want = reference(input, ',');
+
+        for (size_t k = 0; k < sizeof KERNELS / sizeof *KERNELS; k++) {
+            String got = parse(input, ',', KERNELS[k], 0);
+            mismatches += !str_eq(want, got);
+            str_free(&got);
+
+            got = parse(input, ',', KERNELS[k], 1 + rand() % 100);
+            mismatches += !str_eq(want, got);
+            str_free(&got);
+        }
+
+        str_free(&want);
+        str_free(&input);
+    }
+
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    test("str_csv_next", {
+        String input = str_ref("name,age\nalice,30\r\nbob,\n");
+        StrCsv csv = str_csv(input, ',', 0);
+
+        assert(str_csv_next(&csv));
+        assert_eq((size_t)2, csv.count, "%zu");
+        assert_string_eq(str_ref("name"), csv.fields[0]);
+        assert_string_eq(str_ref("age"), csv.fields[1]);
+        // Fields without quotes are references to the input
+        assert(csv.fields[0].str == input.str);
+
+        assert(str_csv_next(&csv));
+        assert_string_eq(str_ref("30"), csv.fields[1]);
+
+        assert(str_csv_next(&csv));
+        assert_eq((size_t)2, csv.count, "%zu");
+        assert_string_eq(str_ref(""), csv.fields[1]);
+
+        assert(!str_csv_next(&csv));
+        assert_eq((size_t)0, csv.count, "%zu");
+        str_csv_free(&csv);
+    });
+
+    test("str_csv_next (quotes)", {
+        String input = str_ref("\"a,b\",\"say \"\"hi\"\"\",\"two\nlines\"\r\nlast");
+        StrCsv csv = str_csv(input, ',', 0);
+
+        assert(str_csv_next(&csv));
+        assert_eq((size_t)3, csv.count, "%zu");
+        assert_string_eq(str_ref("a,b"), csv.fields[0]);
+        assert_string_eq(str_ref("say \"hi\""), csv.fields[1]);
+        assert_string_eq(str_ref("two\nlines"), csv.fields[2]);
+
+        // The last record has no line break
+        assert(str_csv_next(&csv));
+        assert_eq((size_t)1, csv.count, "%zu");
+        assert_string_eq(str_ref("last"), csv.fields[0]);
+        assert(!str_csv_next(&csv));
+        str_csv_free(&csv);
+    });
+
+    test("str_csv_next (tsv)", {
+        String input = str_ref("a\t\"b\"\t\n\tc\n");
+        String got = parse(input, '\t', STR_CSV_NO_QUOTES, 0);
+        assert_string_eq(str_ref("a|\"b\"|/|c/"), got);
+        str_free(&got);
+
+        got = parse(input, '\t', 0, 0);
+        assert_string_eq(str_ref("a|b|/|c/"), got);
+        str_free(&got);
+
+        got = parse(str_ref(""), ',', 0, 0);
+        assert_string_eq(str_ref(""), got);
+        str_free(&got);
+
+        got = parse(str_ref("\n\n"), ',', 0, 0);
+        assert_string_eq(str_ref("//"), got);
+        str_free(&got);
+    });
+
+    test("str_csv_update", {
+        String buf = str_alloc("x,\"1");
+        StrCsv csv = str_csv(buf, ',', STR_CSV_STREAM);
+        assert(!str_csv_next(&csv));
+
+        // The record is complete at its line break, even in the middle of a block
+        str_pushs(str_ref("\n2\"\ny"), &buf);
+        str_csv_update(&csv, buf, false);
+        assert(str_csv_next(&csv));
+        assert_eq((size_t)2, csv.count, "%zu");
+        assert_string_eq(str_ref("1\n2"), csv.fields[1]);
+        assert(!str_csv_next(&csv));
+
+        str_csv_update(&csv, buf, true);
+        assert(str_csv_next(&csv));
+        assert_string_eq(str_ref("y"), csv.fields[0]);
+        assert(!str_csv_next(&csv));
+
+        str_csv_free(&csv);
+        str_free(&buf);
+    });
+
+    test("str_csv_next (kernels)", {
+        assert_eq((size_t)0, check_random(500), "%zu");
+    });
+
+    return 0;
+}
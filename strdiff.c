@@ -0,0 +1,413 @@
+#include "strdiff.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "strvec.h"
+
+/* * * * * * * Private Utilities * * * * * * */
+
+#define IS_CONT(c) (((uint8_t)(c) & 0xC0) == 0x80)
+
+// Length of the common prefix of a[0..n) and b[0..n)
+static size_t common_prefix(const char *a, const char *b, size_t n) {
+    size_t i = 0;
+    while (i + 64 <= n && !memcmp(a + i, b + i, 64)) i += 64;
+    while (i < n && a[i] == b[i]) i++;
+    return i;
+}
+
+// Length of the common suffix of a[0..alen) and b[0..blen), at most n
+static size_t common_suffix(const char *a, size_t alen, const char *b, size_t blen, size_t n) {
+    size_t i = 0;
+    while (i + 64 <= n && !memcmp(a + alen - i - 64, b + blen - i - 64, 64)) i += 64;
+    while (i < n && a[alen - i - 1] == b[blen - i - 1]) i++;
+    return i;
+}
+
+// Symbols of the part of a string left after trimming
+typedef struct {
+    size_t         n;
+    size_t         base;  // byte offset of the part in the string
+    const uint8_t *bytes; // byte mode
+    uint32_t      *ids;   // UTF-8 and line modes: number of every symbol
+    size_t        *offs;  // UTF-8 and line modes: byte offset of every symbol (n + 1 entries)
+    size_t         cap;
+    unsigned       alloc; // allocator slot of `ids` and `offs`
+} Seq;
+
+static void seq_alloc(Seq *s, size_t cap) {
+    s->cap  = cap;
+    s->ids  = str_mem_alloc_with(s->alloc, (cap ? cap : 1) * sizeof *s->ids);
+    s->offs = str_mem_alloc_with(s->alloc, (cap + 1) * sizeof *s->offs);
+}
+
+static void seq_free(Seq *s) {
+    if (!s->ids) return;
+    str_mem_free_with(s->alloc, s->ids, (s->cap ? s->cap : 1) * sizeof *s->ids);
+    str_mem_free_with(s->alloc, s->offs, (s->cap + 1) * sizeof *s->offs);
+}
+
+// Byte offset of the i-th symbol in the string
+static inline size_t seq_offset(const Seq *s, size_t i) {
+    return s->offs ? s->offs[i] : s->base + i;
+}
+
+// Length of the UTF-8 sequence at s[0..n), 1 for ASCII and invalid bytes
+static size_t utf8_seq_len(const uint8_t *s, size_t n) {
+    size_t len = s[0] < 0xC0 ? 1 : s[0] < 0xE0 ? 2 : s[0] < 0xF0 ? 3 : s[0] < 0xF8 ? 4 : 1;
+    if (len > n) return 1;
+
+    for (size_t k = 1; k < len; k++)
+        if (!IS_CONT(s[k])) return 1;
+    return len;
+}
+
+// Splits str[base..end) into UTF-8 sequences, numbered by their bytes
+// (the lead byte tells the length, so that the numbers are distinct)
+static Seq seq_utf8(String str, size_t base, size_t end, unsigned slot) {
+    Seq s = { .base = base, .alloc = slot };
+    seq_alloc(&s, end - base);
+
+    const uint8_t *p = (const uint8_t *)str.str;
+    for (size_t i = base; i < end;) {
+        size_t len = utf8_seq_len(p + i, end - i);
+        uint32_t id = 0;
+        memcpy(&id, p + i, len);
+
+        s.ids[s.n]    = id;
+        s.offs[s.n++] = i;
+        i += len;
+    }
+
+    s.offs[s.n] = end;
+    return s;
+}
+
+// Splits str[base..end) into lines, with their line breaks. The lines are numbered later.
+static Seq seq_lines(String str, size_t base, size_t end, unsigned slot) {
+    String part = str_nref(str.str + base, end - base);
+
+    size_t count = 1;
+    for (const char *nl = part.str; (nl = memchr(nl, '\n', part.str + part.len - nl)); nl++)
+        count++;
+
+    Seq s = { .base = base, .alloc = slot };
+    seq_alloc(&s, count);
+
+    String line = {0};
+    while (str_split(part, str_ref("\n"), &line)) {
+        size_t start = line.str - str.str;
+        if (start == end) break; // after the last line break
+
+        s.offs[s.n++] = start;
+    }
+
+    s.offs[s.n] = end;
+    return s;
+}
+
+/* * * * * * * Line numbering * * * * * * */
+
+// Distinct line of the table
+typedef struct {
+    uint64_t    hash;
+    const char *str;
+    size_t      len;
+    uint32_t    id;
+} Line;
+
+typedef struct {
+    Line  *slots; // slots with a NULL `str` are empty
+    size_t mask;
+    size_t count;
+} LineTable;
+
+// Numbers the lines of the sequence, equal lines getting the same number
+static void number_lines(LineTable *t, Seq *s, String str) {
+    for (size_t i = 0; i < s->n; i++) {
+        const char *line = str.str + s->offs[i];
+        size_t len = s->offs[i + 1] - s->offs[i];
+        uint64_t hash = strvec_hash_str(str_nref(line, len));
+
+        size_t slot = hash & t->mask;
+        for (;; slot = (slot + 1) & t->mask) {
+            Line *l = &t->slots[slot];
+
+            if (!l->str) {
+                *l = (Line){ .hash = hash, .str = line, .len = len, .id = t->count++ };
+                break;
+            }
+            if (l->hash == hash && l->len == len && !memcmp(l->str, line, len)) break;
+        }
+
+        s->ids[i] = t->slots[slot].id;
+    }
+}
+
+/* * * * * * * Myers * * * * * * */
+
+typedef struct {
+    const Seq *a;
+    const Seq *b;
+    ptrdiff_t *fd;       // furthest x reached on every diagonal x - y, forward
+    ptrdiff_t *bd;       // and backward
+    bool      *del;      // symbols of `a` deleted
+    bool      *ins;      // symbols of `b` inserted
+    ptrdiff_t  cost_max; // cost after which the search is cut
+} Ctx;
+
+// Split point of a part, and whether the halves have to be diffed minimally
+typedef struct {
+    ptrdiff_t x;
+    ptrdiff_t y;
+    bool      lo_minimal;
+    bool      hi_minimal;
+} Split;
+
+static inline bool eq(const Ctx *c, ptrdiff_t x, ptrdiff_t y) {
+    if (c->a->bytes) return c->a->bytes[x] == c->b->bytes[y];
+    return c->a->ids[x] == c->b->ids[y];
+}
+
+// Finds the middle snake of a[xoff..xlim) and b[yoff..ylim), searching forward from
+// the start and backward from the end one edit at a time until the searches overlap.
+// Both parts must be non-empty and differ at both ends.
+static Split middle_snake(Ctx *c, ptrdiff_t xoff, ptrdiff_t xlim,
+                          ptrdiff_t yoff, ptrdiff_t ylim, bool minimal) {
+    ptrdiff_t *fd = c->fd, *bd = c->bd;
+    const ptrdiff_t dmin = xoff - ylim; // diagonals of the part
+    const ptrdiff_t dmax = xlim - yoff;
+    const ptrdiff_t fmid = xoff - yoff; // diagonals the searches start on
+    const ptrdiff_t bmid = xlim - ylim;
+    const bool odd = (fmid - bmid) & 1;
+
+    ptrdiff_t fmin = fmid, fmax = fmid; // diagonals reached by the searches
+    ptrdiff_t bmin = bmid, bmax = bmid;
+
+    fd[fmid] = xoff;
+    bd[bmid] = xlim;
+
+    for (ptrdiff_t cost = 1;; cost++) {
+        // Extend the forward search by one edit on every diagonal
+        if (fmin > dmin) fd[--fmin - 1] = -1;
+        else fmin++;
+        if (fmax < dmax) fd[++fmax + 1] = -1;
+        else fmax--;
+
+        for (ptrdiff_t d = fmax; d >= fmin; d -= 2) {
+            ptrdiff_t lo = fd[d - 1], hi = fd[d + 1];
+            ptrdiff_t x = lo < hi ? hi : lo + 1;
+            ptrdiff_t y = x - d;
+
+            while (x < xlim && y < ylim && eq(c, x, y)) x++, y++;
+            fd[d] = x;
+
+            if (odd && bmin <= d && d <= bmax && bd[d] <= x)
+                return (Split){ x, y, true, true };
+        }
+
+        // Extend the backward search the same way
+        if (bmin > dmin) bd[--bmin - 1] = PTRDIFF_MAX;
+        else bmin++;
+        if (bmax < dmax) bd[++bmax + 1] = PTRDIFF_MAX;
+        else bmax--;
+
+        for (ptrdiff_t d = bmax; d >= bmin; d -= 2) {
+            ptrdiff_t lo = bd[d - 1], hi = bd[d + 1];
+            ptrdiff_t x = lo < hi ? lo : hi - 1;
+            ptrdiff_t y = x - d;
+
+            while (x > xoff && y > yoff && eq(c, x - 1, y - 1)) x--, y--;
+            bd[d] = x;
+
+            if (!odd && fmin <= d && d <= fmax && x <= fd[d])
+                return (Split){ x, y, true, true };
+        }
+
+        if (minimal || cost < c->cost_max) continue;
+
+        // Too expensive: split at the diagonal that went the furthest, forward or
+        // backward, and diff the half it leaves minimally
+        ptrdiff_t fxy = -1, fx = xoff;
+        for (ptrdiff_t d = fmax; d >= fmin; d -= 2) {
+            ptrdiff_t x = fd[d] < xlim ? fd[d] : xlim;
+            ptrdiff_t y = x - d;
+            if (y > ylim) x = ylim + d, y = ylim;
+            if (x + y > fxy) fxy = x + y, fx = x;
+        }
+
+        ptrdiff_t bxy = PTRDIFF_MAX, bx = xlim;
+        for (ptrdiff_t d = bmax; d >= bmin; d -= 2) {
+            ptrdiff_t x = bd[d] > xoff ? bd[d] : xoff;
+            ptrdiff_t y = x - d;
+            if (y < yoff) x = yoff + d, y = yoff;
+            if (x + y < bxy) bxy = x + y, bx = x;
+        }
+
+        if ((xlim + ylim) - bxy < fxy - (xoff + yoff))
+            return (Split){ fx, fxy - fx, true, false };
+        return (Split){ bx, bxy - bx, false, true };
+    }
+}
+
+// Marks the deleted and inserted symbols of a[xoff..xlim) and b[yoff..ylim)
+static void compare(Ctx *c, ptrdiff_t xoff, ptrdiff_t xlim,
+                    ptrdiff_t yoff, ptrdiff_t ylim, bool minimal) {
+    // Slide over the equal symbols at both ends
+    while (xoff < xlim && yoff < ylim && eq(c, xoff, yoff)) xoff++, yoff++;
+    while (xoff < xlim && yoff < ylim && eq(c, xlim - 1, ylim - 1)) xlim--, ylim--;
+
+    if (xoff == xlim) {
+        for (ptrdiff_t y = yoff; y < ylim; y++) c->ins[y] = true;
+    } else if (yoff == ylim) {
+        for (ptrdiff_t x = xoff; x < xlim; x++) c->del[x] = true;
+    } else {
+        Split s = middle_snake(c, xoff, xlim, yoff, ylim, minimal);
+        compare(c, xoff, s.x, yoff, s.y, s.lo_minimal);
+        compare(c, s.x, xlim, s.y, ylim, s.hi_minimal);
+    }
+}
+
+/* * * * * * * Edit script * * * * * * */
+
+static void push_edit(StrDiff *diff, StrDiffOp op, size_t offset, size_t len) {
+    if (!len) return;
+
+    // Merge with the previous edit
+    StrDiffEdit *last = diff->count ? &diff->edits[diff->count - 1] : NULL;
+    if (last && last->op == op && last->offset + last->len == offset) {
+        last->len += len;
+        return;
+    }
+
+    if (diff->count == diff->cap) {
+        size_t cap = diff->cap ? diff->cap * 2 : 16;
+        diff->edits = str_mem_realloc_with(diff->alloc, diff->edits,
+                                           diff->cap * sizeof *diff->edits,
+                                           cap * sizeof *diff->edits);
+        diff->cap = cap;
+    }
+
+    diff->edits[diff->count++] = (StrDiffEdit){ op, offset, len };
+}
+
+// Turns the marks into edits, a run of equal symbols, then the deletions and insertions
+// before the next equal symbol
+static void push_marks(StrDiff *diff, const Seq *a, const Seq *b, const bool *del, const bool *ins) {
+    size_t i = 0, j = 0;
+
+    while (i < a->n || j < b->n) {
+        size_t i0 = i, j0 = j;
+        while (i < a->n && j < b->n && !del[i] && !ins[j]) i++, j++;
+        push_edit(diff, STR_DIFF_EQUAL, seq_offset(a, i0), seq_offset(a, i) - seq_offset(a, i0));
+
+        i0 = i;
+        while (i < a->n && del[i]) i++;
+        push_edit(diff, STR_DIFF_DELETE, seq_offset(a, i0), seq_offset(a, i) - seq_offset(a, i0));
+
+        j0 = j;
+        while (j < b->n && ins[j]) j++;
+        push_edit(diff, STR_DIFF_INSERT, seq_offset(b, j0), seq_offset(b, j) - seq_offset(b, j0));
+    }
+}
+
+StrDiff str_diff(String a, String b, StrDiffFlags flags) {
+    StrDiff diff = { .alloc = str_allocator_slot(NULL) };
+
+    // Trim the common prefix and suffix, keeping whole symbols
+    size_t shorter = a.len < b.len ? a.len : b.len;
+    size_t pre = common_prefix(a.str, b.str, shorter);
+    size_t suf = common_suffix(a.str, a.len, b.str, b.len, shorter - pre);
+
+    if (flags & STR_DIFF_LINES) {
+        while (pre && a.str[pre - 1] != '\n') pre--;
+
+        // The suffix has to start after a line break in both strings
+        while (suf) {
+            size_t sa = a.len - suf, sb = b.len - suf;
+            if ((sa == pre || a.str[sa - 1] == '\n') && (sb == pre || b.str[sb - 1] == '\n')) break;
+
+            const char *nl = memchr(a.str + sa, '\n', suf);
+            suf = nl ? (size_t)(a.str + a.len - nl - 1) : 0;
+        }
+    } else if (flags & STR_DIFF_UTF8) {
+        while (pre && ((pre < a.len && IS_CONT(a.str[pre])) || (pre < b.len && IS_CONT(b.str[pre]))))
+            pre--;
+        while (suf && IS_CONT(a.str[a.len - suf])) suf--;
+    }
+
+    push_edit(&diff, STR_DIFF_EQUAL, 0, pre);
+
+    Seq sa, sb;
+    if (flags & STR_DIFF_LINES) {
+        sa = seq_lines(a, pre, a.len - suf, diff.alloc);
+        sb = seq_lines(b, pre, b.len - suf, diff.alloc);
+
+        LineTable t = {0};
+        size_t size = 16;
+        while (size < 2 * (sa.n + sb.n)) size *= 2;
+
+        t.slots = str_mem_alloc_with(diff.alloc, size * sizeof *t.slots);
+        t.mask  = size - 1;
+        memset(t.slots, 0, size * sizeof *t.slots);
+
+        number_lines(&t, &sa, a);
+        number_lines(&t, &sb, b);
+        str_mem_free_with(diff.alloc, t.slots, size * sizeof *t.slots);
+    } else if (flags & STR_DIFF_UTF8) {
+        sa = seq_utf8(a, pre, a.len - suf, diff.alloc);
+        sb = seq_utf8(b, pre, b.len - suf, diff.alloc);
+    } else {
+        sa = (Seq){ .n = a.len - suf - pre, .base = pre, .bytes = (const uint8_t *)a.str + pre };
+        sb = (Seq){ .n = b.len - suf - pre, .base = pre, .bytes = (const uint8_t *)b.str + pre };
+    }
+
+    if (sa.n || sb.n) {
+        size_t n = sa.n, m = sb.n;
+        size_t diags = n + m + 3;
+
+        // The cost limit grows with the square root of the number of diagonals
+        ptrdiff_t cost_max = 1;
+        for (size_t k = diags; k; k >>= 2) cost_max <<= 1;
+        if (cost_max < STR_DIFF_COST_MIN) cost_max = STR_DIFF_COST_MIN;
+
+        ptrdiff_t *v = str_mem_alloc_with(diff.alloc, 2 * diags * sizeof *v);
+        bool *marks = str_mem_alloc_with(diff.alloc, (n + m ? n + m : 1) * sizeof *marks);
+        memset(marks, 0, (n + m) * sizeof *marks);
+
+        Ctx c = {
+            .a        = &sa,
+            .b        = &sb,
+            .fd       = v + m + 1,
+            .bd       = v + diags + m + 1,
+            .del      = marks,
+            .ins      = marks + n,
+            .cost_max = cost_max,
+        };
+
+        compare(&c, 0, n, 0, m, flags & STR_DIFF_MINIMAL);
+        push_marks(&diff, &sa, &sb, c.del, c.ins);
+
+        str_mem_free_with(diff.alloc, v, 2 * diags * sizeof *v);
+        str_mem_free_with(diff.alloc, marks, (n + m ? n + m : 1) * sizeof *marks);
+    }
+
+    seq_free(&sa);
+    seq_free(&sb);
+
+    push_edit(&diff, STR_DIFF_EQUAL, a.len - suf, suf);
+    return diff;
+}
+
+void str_diff_free(StrDiff *diff) {
+    str_mem_free_with(diff->alloc, diff->edits, diff->cap * sizeof *diff->edits);
+    memset(diff, 0, sizeof *diff);
+}
+
+size_t str_diff_changes(const StrDiff *diff) {
+    size_t n = 0;
+    for (size_t k = 0; k < diff->count; k++)
+        if (diff->edits[k].op != STR_DIFF_EQUAL) n += diff->edits[k].len;
+    return n;
+}
@@ -0,0 +1,62 @@
+#ifndef _STRDIFF_H
+#define _STRDIFF_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Flags for str_diff()
+typedef enum {
+    // Compare UTF-8 sequences instead of bytes (invalid bytes are compared one by one)
+    STR_DIFF_UTF8    = 0x1,
+    // Compare lines split at "\n" (the line break is part of the line)
+    STR_DIFF_LINES   = 0x2,
+    // Always find a shortest edit script, however expensive (see str_diff())
+    STR_DIFF_MINIMAL = 0x4,
+} StrDiffFlags;
+
+// Operation of an edit
+typedef enum {
+    STR_DIFF_EQUAL,  // the slice is in both strings
+    STR_DIFF_DELETE, // the slice of the first string is not in the second
+    STR_DIFF_INSERT, // the slice of the second string is not in the first
+} StrDiffOp;
+
+// Slice of one of the diffed strings
+typedef struct {
+    StrDiffOp op;
+    size_t    offset; // byte offset in the first string (EQUAL, DELETE) or in the second (INSERT)
+    size_t    len;    // byte length of the slice
+} StrDiffEdit;
+
+// Edit script turning a string into another: the EQUAL and DELETE slices are the
+// first string in order, the EQUAL and INSERT slices the second. Consecutive edits
+// have different operations, and deletions come before insertions.
+typedef struct {
+    StrDiffEdit *edits;
+    size_t       count;
+    size_t       cap;
+    unsigned     alloc; // allocator slot of `edits`
+} StrDiff;
+
+// Computes an edit script from `a` to `b` with the O(ND) algorithm of Myers, in its
+// linear space variant: the middle snake of every part is found by searching from both
+// ends, then both halves are diffed recursively. The common prefix and suffix are
+// trimmed (with memcmp()) first, and lines are hashed to numbers before the search.
+// Unless STR_DIFF_MINIMAL is given, a search costing more than about the square root of
+// the input size (at least STR_DIFF_COST_MIN) is cut at the furthest diagonal reached,
+// which bounds the time on huge inputs, at the cost of a longer script.
+// Requires str_diff_free()
+StrDiff str_diff(String a, String b, StrDiffFlags flags);
+
+// Minimum cost of the search before the heuristic cuts it
+#define STR_DIFF_COST_MIN 1024
+
+// Frees the memory allocated for the edit script
+void str_diff_free(StrDiff *diff);
+
+// Returns the number of bytes deleted and inserted by the edit script
+size_t str_diff_changes(const StrDiff *diff);
+
+#endif // _STRDIFF_H
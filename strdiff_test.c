@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strdiff.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+// Checks that the edit script turns `a` into `b`: the EQUAL and DELETE slices
+// cover `a` in order, the EQUAL and INSERT slices rebuild `b`, and consecutive
+// edits have different operations. Returns false if a check fails.
+static bool check_script(const StrDiff *diff, String a, String b) {
+    String rebuilt = str_alloc("");
+    size_t pos = 0;
+    bool ok = true;
+
+    for (size_t k = 0; k < diff->count && ok; k++) {
+        StrDiffEdit e = diff->edits[k];
+        ok = e.len > 0 && (!k || diff->edits[k - 1].op != e.op);
+        if (k && diff->edits[k - 1].op == STR_DIFF_INSERT) ok &= e.op != STR_DIFF_DELETE;
+
+        if (e.op == STR_DIFF_INSERT) {
+            ok &= e.offset + e.len <= b.len;
+            if (ok) str_pushs(str_nref(b.str + e.offset, e.len), &rebuilt);
+        } else {
+            ok &= e.offset == pos && pos + e.len <= a.len;
+            if (ok && e.op == STR_DIFF_EQUAL) str_pushs(str_nref(a.str + e.offset, e.len), &rebuilt);
+            pos += e.len;
+        }
+    }
+
+    ok = ok && pos == a.len && str_eq(rebuilt, b);
+    str_free(&rebuilt);
+    return ok;
+}
+
+// Length of the longest common subsequence of the bytes (dynamic programming)
+static size_t lcs(String a, String b) {
+    size_t *row = calloc(b.len + 1, sizeof *row);
+
+    for (size_t i = 0; i < a.len; i++) {
+        size_t diag = 0;
+        for (size_t j = 0; j < b.len; j++) {
+            size_t up = row[j + 1];
+            row[j + 1] = a.str[i] == b.str[j] ? diag + 1 : (up > row[j] ? up : row[j]);
+            diag = up;
+        }
+    }
+
+    size_t n = row[b.len];
+    free(row);
+    return n;
+}
+
+// Random string of `len` bytes among `values` different ones
+static String random_str(size_t len, int values) {
+    String s = str_alloc("");
+    for (size_t i = 0; i < len; i++) str_push('a' + rand() % values, &s);
+    return s;
+}
+
+// Diffs random strings and checks the scripts, minimal ones against the LCS.
+// Returns the number of failures.
+static size_t check_random(size_t count, size_t len, StrDiffFlags flags) {
+    size_t failures = 0;
+
+    for (size_t t = 0; t < count; t++) {
+        String a = random_str(rand() % len, 1 + rand() % 4);
+        String b = str_clone(a);
+
+        // Mostly similar strings: a few random edits
+        for (size_t k = rand() % 6; k--;) {
+            size_t at = b.len ? rand() % b.len : 0;
+            if (rand() % 2 && b.len) str_replace_slice(at, 1 + rand() % (b.len - at), str_ref(""), &b);
+            else str_inserts(str_ref("xyz\n"), at, &b);
+        }
+        if (t % 4 == 0) {
+            str_free(&b);
+            b = random_str(rand() % len, 3);
+        }
+
+        StrDiff diff = str_diff(a, b, flags);
+        failures += !check_script(&diff, a, b);
+        if (flags == STR_DIFF_MINIMAL)
+            failures += str_diff_changes(&diff) != a.len + b.len - 2 * lcs(a, b);
+
+        str_diff_free(&diff);
+        str_free(&a);
+        str_free(&b);
+    }
+
+    return failures;
+}
+
+int main() {
+    srand(42);
+
+    test("str_diff", {
+        String a = str_ref("the quick brown fox");
+        String b = str_ref("the quack brown fix");
+        StrDiff diff = str_diff(a, b, 0);
+
+        assert(check_script(&diff, a, b));
+        assert_eq((size_t)4, str_diff_changes(&diff), "%zu");
+        assert_eq((size_t)7, diff.count, "%zu");
+        assert_eq(STR_DIFF_EQUAL, diff.edits[0].op, "%d");
+        assert_eq((size_t)6, diff.edits[0].len, "%zu");
+        assert_eq(STR_DIFF_DELETE, diff.edits[1].op, "%d");
+        assert_eq((size_t)6, diff.edits[1].offset, "%zu");
+        assert_eq(STR_DIFF_INSERT, diff.edits[2].op, "%d");
+        assert_eq((size_t)6, diff.edits[2].offset, "%zu");
+        str_diff_free(&diff);
+
+        diff = str_diff(a, a, 0);
+        assert_eq((size_t)1, diff.count, "%zu");
+        str_diff_free(&diff);
+
+        diff = str_diff(str_ref(""), str_ref(""), 0);
+        assert_eq((size_t)0, diff.count, "%zu");
+        str_diff_free(&diff);
+
+        diff = str_diff(str_ref(""), a, 0);
+        assert_eq((size_t)1, diff.count, "%zu");
+        assert_eq(STR_DIFF_INSERT, diff.edits[0].op, "%d");
+        str_diff_free(&diff);
+    });
+
+    test("str_diff (lines)", {
+        String a = str_ref("alpha\nbeta\ngamma\ndelta\nomega");
+        String b = str_ref("alpha\nbeta 2\ngamma\ndelta\nomega\n");
+        StrDiff diff = str_diff(a, b, STR_DIFF_LINES);
+
+        assert(check_script(&diff, a, b));
+        assert_eq((size_t)6, diff.count, "%zu");
+        assert_string_eq(str_ref("beta\n"), str_nref(a.str + diff.edits[1].offset, diff.edits[1].len));
+        assert_string_eq(str_ref("beta 2\n"), str_nref(b.str + diff.edits[2].offset, diff.edits[2].len));
+        // The last line differs by its line break
+        assert_string_eq(str_ref("omega"), str_nref(a.str + diff.edits[4].offset, diff.edits[4].len));
+        assert_string_eq(str_ref("omega\n"), str_nref(b.str + diff.edits[5].offset, diff.edits[5].len));
+        str_diff_free(&diff);
+
+        // A common suffix in the middle of a line is not trimmed
+        a = str_ref("x\nsame end\n");
+        b = str_ref("x\nnot the same end\n");
+        diff = str_diff(a, b, STR_DIFF_LINES);
+        assert(check_script(&diff, a, b));
+        assert_eq((size_t)3, diff.count, "%zu");
+        assert_eq((size_t)9, diff.edits[1].len, "%zu");
+        str_diff_free(&diff);
+    });
+
+    test("str_diff (utf8)", {
+        String a = str_ref("h\xC3\xA9llo w\xC3\xB6rld");
+        String b = str_ref("h\xC3\xA8llo w\xC3\xB6rld!");
+        StrDiff diff = str_diff(a, b, STR_DIFF_UTF8);
+
+        assert(check_script(&diff, a, b));
+        assert_eq((size_t)5, diff.count, "%zu");
+        assert_eq((size_t)1, diff.edits[1].offset, "%zu");
+        assert_eq((size_t)2, diff.edits[1].len, "%zu");
+        assert_eq((size_t)5, str_diff_changes(&diff), "%zu");
+        str_diff_free(&diff);
+
+        // Bytes split the sequences
+        diff = str_diff(a, b, 0);
+        assert(check_script(&diff, a, b));
+        assert_eq((size_t)3, str_diff_changes(&diff), "%zu");
+        str_diff_free(&diff);
+    });
+
+    test("str_diff (random)", {
+        assert_eq((size_t)0, check_random(300, 60, STR_DIFF_MINIMAL), "%zu");
+        assert_eq((size_t)0, check_random(300, 60, 0), "%zu");
+        assert_eq((size_t)0, check_random(300, 60, STR_DIFF_UTF8), "%zu");
+        assert_eq((size_t)0, check_random(300, 60, STR_DIFF_LINES), "%zu");
+    });
+
+    test("str_diff (heuristic)", {
+        String a = random_str(6000, 4);
+        String b = random_str(6000, 4);
+
+        StrDiff minimal = str_diff(a, b, STR_DIFF_MINIMAL);
+        StrDiff diff = str_diff(a, b, 0);
+        assert(check_script(&minimal, a, b));
+        assert(check_script(&diff, a, b));
+        assert_eq(a.len + b.len - 2 * lcs(a, b), str_diff_changes(&minimal), "%zu");
+        assert(str_diff_changes(&diff) >= str_diff_changes(&minimal));
+
+        str_diff_free(&diff);
+        str_diff_free(&minimal);
+        str_free(&a);
+        str_free(&b);
+    });
+
+    return 0;
+}
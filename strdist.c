@@ -0,0 +1,323 @@
+#include "strdist.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "utf8.h"
+
+/* * * * * * * Private Utilities * * * * * * */
+
+#define IS_CONT(c) (((uint8_t)(c) & 0xC0) == 0x80)
+
+// Symbols of a string: its bytes, or its decoded codepoints
+typedef struct {
+    size_t         n;
+    const uint8_t *bytes; // byte mode
+    uint32_t      *cps;   // UTF-8 mode
+    size_t        *offs;  // UTF-8 mode: byte offset of each codepoint (n + 1 entries)
+    size_t         cap;
+    unsigned       alloc; // allocator slot of `cps` and `offs`
+} Symbols;
+
+static Symbols symbols_load(String s, StrDistFlags flags) {
+    Symbols sym = { .n = s.len, .bytes = (const uint8_t *)s.str };
+    if (!(flags & STR_DIST_UTF8)) return sym;
+
+    sym.cap   = s.len;
+    sym.alloc = str_allocator_slot(NULL);
+    sym.cps   = str_mem_alloc_with(sym.alloc, (sym.cap ? sym.cap : 1) * sizeof *sym.cps);
+    sym.offs  = str_mem_alloc_with(sym.alloc, (sym.cap + 1) * sizeof *sym.offs);
+    sym.n    = 0;
+
+    utf8_Decoder d;
+    utf8_decoder_init(&d);
+
+    size_t start = 0;
+    for (size_t i = 0; i < s.len; i++) {
+        if (!d.state) start = i;
+        if (utf8_decode(&d, s.str[i])) {
+            sym.cps[sym.n]    = d.codepoint;
+            sym.offs[sym.n++] = start;
+        }
+    }
+
+    sym.offs[sym.n] = s.len;
+    return sym;
+}
+
+static void symbols_free(Symbols *sym) {
+    if (!sym->cps) return;
+    str_mem_free_with(sym->alloc, sym->cps,  (sym->cap ? sym->cap : 1) * sizeof *sym->cps);
+    str_mem_free_with(sym->alloc, sym->offs, (sym->cap + 1) * sizeof *sym->offs);
+}
+
+// Byte offset of the i-th symbol
+static size_t symbols_offset(const Symbols *sym, size_t i) {
+    return sym->offs ? sym->offs[i] : i;
+}
+
+// Pattern match vectors: bit i of row r is set if the i-th pattern symbol maps to r
+typedef struct {
+    size_t    words;
+    size_t    rows;
+    uint64_t *eq;   // [rows][words]
+    // Codepoint -> row hash table (UTF-8 mode, row 0 is for codepoints not in the pattern)
+    uint32_t *keys;
+    uint32_t *vals;
+    size_t    cap;
+    unsigned  alloc; // allocator slot of the arrays
+} Peq;
+
+static size_t peq_slot(const Peq *p, uint32_t cp) {
+    size_t h = (cp * 0x9E3779B1u) & (p->cap - 1);
+    while (p->vals[h] && p->keys[h] != cp) h = (h + 1) & (p->cap - 1);
+    return h;
+}
+
+// Row of the i-th symbol
+static inline size_t peq_row(const Peq *p, const Symbols *sym, size_t i) {
+    if (!sym->cps) return sym->bytes[i];
+    return p->vals[peq_slot(p, sym->cps[i])];
+}
+
+// Builds the match vectors of the pattern, optionally reversed
+static Peq peq_build(const Symbols *pat, bool reverse) {
+    Peq p = { .words = (pat->n + 63) / 64, .alloc = str_allocator_slot(NULL) };
+
+    if (pat->cps) {
+        for (p.cap = 16; p.cap < pat->n * 2; p.cap <<= 1);
+        p.keys = str_mem_alloc_with(p.alloc, p.cap * sizeof *p.keys);
+        p.vals = str_mem_alloc_with(p.alloc, p.cap * sizeof *p.vals);
+        memset(p.vals, 0, p.cap * sizeof *p.vals);
+
+        // Assign rows to distinct codepoints
+        p.rows = 1;
+        for (size_t i = 0; i < pat->n; i++) {
+            size_t h = peq_slot(&p, pat->cps[i]);
+            if (!p.vals[h]) {
+                p.keys[h] = pat->cps[i];
+                p.vals[h] = (uint32_t)p.rows++;
+            }
+        }
+    } else p.rows = 256;
+
+    size_t size = p.rows * p.words * sizeof *p.eq;
+    p.eq = str_mem_alloc_with(p.alloc, size);
+    memset(p.eq, 0, size);
+
+    for (size_t i = 0; i < pat->n; i++) {
+        size_t row = peq_row(&p, pat, reverse ? pat->n - 1 - i : i);
+        p.eq[row * p.words + i / 64] |= 1ull << (i % 64);
+    }
+
+    return p;
+}
+
+static void peq_free(Peq *p) {
+    str_mem_free_with(p->alloc, p->eq, p->rows * p->words * sizeof *p->eq);
+    if (p->keys) {
+        str_mem_free_with(p->alloc, p->keys, p->cap * sizeof *p->keys);
+        str_mem_free_with(p->alloc, p->vals, p->cap * sizeof *p->vals);
+    }
+}
+
+/* * * * * * * Myers' algorithm * * * * * * */
+
+// Column of the dynamic programming matrix encoded as vertical deltas
+typedef struct {
+    size_t    words;
+    uint64_t  last;  // bit of the last pattern row in the last word
+    uint64_t *pv;    // [words] +1 vertical deltas
+    uint64_t *mv;    // [words] -1 vertical deltas
+    size_t    score; // value in the last pattern row
+    size_t    m;
+    unsigned  alloc; // allocator slot of `pv` and `mv`
+} Myers;
+
+static Myers myers_init(size_t m) {
+    Myers s = {
+        .words = (m + 63) / 64,
+        .last  = 1ull << ((m - 1) % 64),
+        .m     = m,
+        .alloc = str_allocator_slot(NULL),
+    };
+
+    s.pv = str_mem_alloc_with(s.alloc, s.words * 2 * sizeof *s.pv);
+    s.mv = s.pv + s.words;
+    return s;
+}
+
+// Resets the column to D[i][0] = i
+static void myers_reset(Myers *s) {
+    memset(s->pv, 0xFF, s->words * sizeof *s->pv);
+    memset(s->mv, 0x00, s->words * sizeof *s->mv);
+    s->score = s->m;
+}
+
+static void myers_free(Myers *s) {
+    str_mem_free_with(s->alloc, s->pv, s->words * 2 * sizeof *s->pv);
+}
+
+// Advances the column by one text symbol with the given match vector.
+// `hin` is the horizontal delta entering the first row: 1 for global
+// alignment (D[0][j] = j), 0 for searching (D[0][j] = 0).
+static inline void myers_step(Myers *s, const uint64_t *eq, int hin) {
+    for (size_t b = 0; b < s->words; b++) {
+        uint64_t pv = s->pv[b], mv = s->mv[b], e = eq[b];
+        uint64_t hin_neg = hin < 0;
+
+        uint64_t xv = e | mv;
+        e |= hin_neg;
+        uint64_t xh = (((e & pv) + pv) ^ pv) | e;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+
+        // Horizontal delta leaving the block through its last row
+        uint64_t top = b + 1 == s->words ? s->last : 1ull << 63;
+        int hout = !!(ph & top) - !!(mh & top);
+
+        ph = (ph << 1) | (hin > 0);
+        mh = (mh << 1) | hin_neg;
+
+        s->pv[b] = mh | ~(xv | ph);
+        s->mv[b] = ph & xv;
+
+        hin = hout;
+    }
+
+    if (hin > 0) s->score++;
+    else if (hin < 0) s->score--;
+}
+
+/* * * * * * * Edit distance * * * * * * */
+
+size_t str_edit_distance(String a, String b, size_t max, StrDistFlags flags) {
+    size_t over = max == SIZE_MAX ? SIZE_MAX : max + 1;
+
+    // Trim the common prefix and suffix (at codepoint boundaries in UTF-8 mode)
+    size_t common = a.len < b.len ? a.len : b.len;
+    size_t pre = 0;
+    while (pre < common && a.str[pre] == b.str[pre]) pre++;
+
+    size_t suf = 0;
+    while (suf < common - pre &&
+           a.str[a.len - 1 - suf] == b.str[b.len - 1 - suf]) suf++;
+
+    if (flags & STR_DIST_UTF8) {
+        while (pre && ((pre < a.len && IS_CONT(a.str[pre])) ||
+                       (pre < b.len && IS_CONT(b.str[pre])))) pre--;
+        while (suf && IS_CONT(a.str[a.len - suf])) suf--;
+    }
+
+    a = str_nref(a.str + pre, a.len - pre - suf);
+    b = str_nref(b.str + pre, b.len - pre - suf);
+
+    Symbols pat  = symbols_load(a, flags);
+    Symbols text = symbols_load(b, flags);
+
+    // The shorter string becomes the pattern
+    if (pat.n > text.n) {
+        Symbols t = pat;
+        pat = text;
+        text = t;
+    }
+
+    size_t m = pat.n, n = text.n;
+    size_t dist;
+
+    if (n - m > max) {
+        dist = over;
+    } else if (m == 0) {
+        dist = n;
+    } else {
+        Peq peq = peq_build(&pat, false);
+        Myers s = myers_init(m);
+        myers_reset(&s);
+
+        for (size_t j = 0; j < n; j++) {
+            myers_step(&s, peq.eq + peq_row(&peq, &text, j) * peq.words, 1);
+
+            // The last row can decrease by at most 1 per remaining column
+            size_t remaining = n - 1 - j;
+            if (s.score > remaining && s.score - remaining > max) break;
+        }
+
+        dist = s.score;
+
+        myers_free(&s);
+        peq_free(&peq);
+    }
+
+    symbols_free(&pat);
+    symbols_free(&text);
+
+    return dist > max ? over : dist;
+}
+
+/* * * * * * * Fuzzy search * * * * * * */
+
+bool str_fuzzy_find(String needle, String haystack, size_t k,
+                    StrDistFlags flags, StrFuzzyMatch *out) {
+    Symbols pat  = symbols_load(needle, flags);
+    Symbols text = symbols_load(haystack, flags);
+
+    size_t m = pat.n, n = text.n;
+    bool found = false;
+
+    if (m == 0) {
+        if (out) *out = (StrFuzzyMatch){ 0, 0, 0 };
+        found = true;
+        goto done;
+    }
+
+    Peq peq = peq_build(&pat, false);
+    Myers s = myers_init(m);
+    myers_reset(&s);
+
+    // Find the end of the best match (the empty prefix has distance m)
+    size_t best = m, end = 0;
+    for (size_t j = 0; j < n && best; j++) {
+        myers_step(&s, peq.eq + peq_row(&peq, &text, j) * peq.words, 0);
+
+        // Prefer the first best match, but extend it while the distance holds
+        if (s.score < best || (s.score == best && end == j)) {
+            best = s.score;
+            end  = j + 1;
+        }
+    }
+
+    peq_free(&peq);
+
+    if (best > k) {
+        myers_free(&s);
+        goto done;
+    }
+
+    // Find its start by aligning the reversed needle backwards from the end
+    peq = peq_build(&pat, true);
+    myers_reset(&s);
+
+    // No alignment longer than m + best symbols can have distance best
+    size_t limit = m + best < end ? m + best : end;
+    size_t len = 0;
+    for (size_t l = 1; l <= limit; l++) {
+        myers_step(&s, peq.eq + peq_row(&peq, &text, end - l) * peq.words, 1);
+        if (s.score == best) len = l;
+    }
+
+    peq_free(&peq);
+    myers_free(&s);
+
+    if (out) {
+        size_t start = symbols_offset(&text, end - len);
+        out->pos  = start;
+        out->len  = symbols_offset(&text, end) - start;
+        out->dist = best;
+    }
+    found = true;
+
+done:
+    symbols_free(&pat);
+    symbols_free(&text);
+    return found;
+}
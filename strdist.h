@@ -0,0 +1,35 @@
+#ifndef _STRDIST_H
+#define _STRDIST_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Flags for str_edit_distance() and str_fuzzy_find()
+typedef enum {
+    // Compare UTF-8 codepoints instead of bytes
+    STR_DIST_UTF8 = 0x1,
+} StrDistFlags;
+
+// Computes the Levenshtein distance between two strings using the bit-parallel
+// algorithm of Myers (multi-word blocks by Hyyrö), in O(n * m / 64) time.
+// Gives up as soon as the distance is known to exceed `max` and returns max + 1
+// in that case. Pass SIZE_MAX for no limit.
+size_t str_edit_distance(String a, String b, size_t max, StrDistFlags flags);
+
+// Approximate match found by str_fuzzy_find()
+typedef struct {
+    size_t pos;  // byte offset of the match in the haystack
+    size_t len;  // byte length of the match
+    size_t dist; // edit distance between the needle and the match
+} StrFuzzyMatch;
+
+// Finds the substring of the haystack with the lowest edit distance to the needle,
+// which must be at most `k`. Among equally good matches the first one is returned,
+// extended as far as the distance allows in both directions.
+// Returns false if there is no such substring.
+bool str_fuzzy_find(String needle, String haystack, size_t k,
+                    StrDistFlags flags, StrFuzzyMatch *out);
+
+#endif // _STRDIST_H
@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strdist.h"
+
+// Textbook O(n * m) dynamic programming reference
+static size_t naive_distance(const char *a, size_t n, const char *b, size_t m) {
+    size_t *row = malloc((m + 1) * sizeof *row);
+    for (size_t j = 0; j <= m; j++) row[j] = j;
+
+    for (size_t i = 1; i <= n; i++) {
+        size_t diag = row[0];
+        row[0] = i;
+
+        for (size_t j = 1; j <= m; j++) {
+            size_t up = row[j];
+            size_t best = diag + (a[i - 1] != b[j - 1]);
+            if (up + 1 < best) best = up + 1;
+            if (row[j - 1] + 1 < best) best = row[j - 1] + 1;
+            row[j] = best;
+            diag = up;
+        }
+    }
+
+    size_t d = row[m];
+    free(row);
+    return d;
+}
+
+// Lowest distance between the needle and any substring of the haystack
+static size_t naive_fuzzy(const char *needle, const char *haystack) {
+    size_t n = strlen(haystack), best = SIZE_MAX;
+
+    for (size_t i = 0; i <= n; i++)
+        for (size_t j = i; j <= n; j++) {
+            size_t d = naive_distance(needle, strlen(needle), haystack + i, j - i);
+            if (d < best) best = d;
+        }
+
+    return best;
+}
+
+static void random_string(char *buf, size_t len, const char *alphabet) {
+    size_t k = strlen(alphabet);
+    for (size_t i = 0; i < len; i++) buf[i] = alphabet[rand() % k];
+    buf[len] = '\0';
+}
+
+int main() {
+    test("str_edit_distance", {
+        assert_eq((size_t)0, str_edit_distance(str_ref(""), str_ref(""), SIZE_MAX, 0), "%zu");
+        assert_eq((size_t)3, str_edit_distance(str_ref("abc"), str_ref(""), SIZE_MAX, 0), "%zu");
+        assert_eq((size_t)3, str_edit_distance(str_ref("kitten"), str_ref("sitting"), SIZE_MAX, 0), "%zu");
+        assert_eq((size_t)2, str_edit_distance(str_ref("flaw"), str_ref("lawn"), SIZE_MAX, 0), "%zu");
+        assert_eq((size_t)0, str_edit_distance(str_ref("same"), str_ref("same"), 0, 0), "%zu");
+    });
+
+    test("str_edit_distance (max)", {
+        assert_eq((size_t)2, str_edit_distance(str_ref("kitten"), str_ref("sitting"), 1, 0), "%zu");
+        assert_eq((size_t)3, str_edit_distance(str_ref("kitten"), str_ref("sitting"), 3, 0), "%zu");
+        assert_eq((size_t)6, str_edit_distance(str_ref("a"), str_ref("abcdefghij"), 5, 0), "%zu");
+    });
+
+    test("str_edit_distance (utf8)", {
+        String a = str_ref("naïve café");
+        String b = str_ref("naive cafe");
+
+        assert_eq((size_t)4, str_edit_distance(a, b, SIZE_MAX, 0), "%zu");
+        assert_eq((size_t)2, str_edit_distance(a, b, SIZE_MAX, STR_DIST_UTF8), "%zu");
+        assert_eq((size_t)1, str_edit_distance(str_ref("日本語"), str_ref("日本人"),
+                                               SIZE_MAX, STR_DIST_UTF8), "%zu");
+        assert_eq((size_t)1, str_edit_distance(str_ref("😀x"), str_ref("😁x"),
+                                               SIZE_MAX, STR_DIST_UTF8), "%zu");
+    });
+
+    test("str_edit_distance (vs naive)", {
+        srand(7);
+        bool ok = true;
+        char a[301];
+        char b[301];
+
+        for (int i = 0; i < 2000 && ok; i++) {
+            size_t n = rand() % (i < 1000 ? 20 : 300);
+            size_t m = rand() % (i < 1000 ? 20 : 300);
+            random_string(a, n, "acgt");
+            random_string(b, m, "acgt");
+
+            size_t max = i % 2 ? SIZE_MAX : (size_t)(rand() % 100);
+            size_t expected = naive_distance(a, n, b, m);
+            if (expected > max) expected = max + 1;
+
+            ok = str_edit_distance(str_nref(a, n), str_nref(b, m), max, 0) == expected;
+            if (!ok) printf(" %s %s ", a, b);
+        }
+
+        assert(ok);
+    });
+
+    test("str_fuzzy_find", {
+        StrFuzzyMatch m;
+
+        assert(str_fuzzy_find(str_ref("world"), str_ref("hello, wrold!"), 2, 0, &m));
+        assert_eq((size_t)2, m.dist, "%zu");
+        assert_eq((size_t)7, m.pos, "%zu");
+
+        assert(str_fuzzy_find(str_ref("needle"), str_ref("haystack with a needle in it"), 0, 0, &m));
+        assert_eq((size_t)0, m.dist, "%zu");
+        assert_eq((size_t)16, m.pos, "%zu");
+        assert_eq((size_t)6, m.len, "%zu");
+
+        assert(!str_fuzzy_find(str_ref("needle"), str_ref("haystack"), 1, 0, &m));
+
+        assert(str_fuzzy_find(str_ref("café"), str_ref("le cafe est bon"), 1, STR_DIST_UTF8, &m));
+        assert_eq((size_t)1, m.dist, "%zu");
+        assert_eq((size_t)3, m.pos, "%zu");
+        assert_eq((size_t)4, m.len, "%zu");
+    });
+
+    test("str_fuzzy_find (long)", {
+        // Needle spanning multiple words
+        char needle[151];
+        char haystack[1001];
+        random_string(needle, 150, "ab");
+        random_string(haystack, 1000, "ab");
+        memcpy(haystack + 500, needle, 150);
+        haystack[520] ^= 'a' ^ 'b';
+        haystack[600] ^= 'a' ^ 'b';
+
+        StrFuzzyMatch m;
+        assert(str_fuzzy_find(str_ref(needle), str_ref(haystack), 10, 0, &m));
+        assert(m.dist <= 2);
+        assert(m.pos >= 495 && m.pos <= 505);
+    });
+
+    test("str_fuzzy_find (vs naive)", {
+        srand(11);
+        bool ok = true;
+        char needle[8];
+        char haystack[16];
+
+        for (int i = 0; i < 1000 && ok; i++) {
+            random_string(needle, 1 + rand() % 7, "abc");
+            random_string(haystack, rand() % 15, "abc");
+
+            StrFuzzyMatch m;
+            size_t expected = naive_fuzzy(needle, haystack);
+            ok = str_fuzzy_find(str_ref(needle), str_ref(haystack), SIZE_MAX - 1, 0, &m)
+                && m.dist == expected
+                && naive_distance(needle, strlen(needle), haystack + m.pos, m.len) == expected;
+            if (!ok) printf(" %s %s ", needle, haystack);
+        }
+
+        assert(ok);
+    });
+}
@@ -0,0 +1,288 @@
+#include "strglob.h"
+
+#include <string.h>
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Single element of a pattern: either a star or a set of accepted bytes
+typedef struct {
+    bool     star;
+    bool     literal; // accepts a single byte
+    uint64_t set[4];
+} Atom;
+
+#define SET_ADD(set, c)  ((set)[(uint8_t)(c) >> 6] |= 1ull << ((uint8_t)(c) & 63))
+#define SET_HAS(set, c) (((set)[(uint8_t)(c) >> 6] >> ((uint8_t)(c) & 63)) & 1)
+
+#define BIT_SET(v, i) ((v)[(i) >> 6] |= 1ull << ((i) & 63))
+#define BIT_HAS(v, i) (((v)[(i) >> 6] >> ((i) & 63)) & 1)
+
+// Parses a bracket expression starting after the `[` at pattern[*i].
+// Returns false if the expression is not terminated.
+static bool parse_class(String pattern, size_t *i, Atom *atom) {
+    size_t j = *i;
+    bool negate = false;
+
+    if (j < pattern.len && (pattern.str[j] == '!' || pattern.str[j] == '^')) {
+        negate = true;
+        j++;
+    }
+
+    uint64_t set[4] = {0};
+    bool first = true;
+
+    for (; j < pattern.len; j++, first = false) {
+        uint8_t lo = pattern.str[j];
+
+        if (lo == ']' && !first) {
+            if (negate)
+                for (int w = 0; w < 4; w++) set[w] = ~set[w];
+
+            memcpy(atom->set, set, sizeof set);
+            atom->star = false;
+            atom->literal = false;
+            *i = j + 1;
+            return true;
+        }
+
+        if (lo == '\\' && j + 1 < pattern.len) lo = pattern.str[++j];
+
+        uint8_t hi = lo;
+        if (j + 2 < pattern.len && pattern.str[j + 1] == '-' && pattern.str[j + 2] != ']') {
+            j += 2;
+            hi = pattern.str[j];
+            if (hi == '\\' && j + 1 < pattern.len) hi = pattern.str[++j];
+        }
+
+        for (unsigned c = lo; c <= hi; c++) SET_ADD(set, c);
+    }
+
+    return false;
+}
+
+// Splits the pattern into atoms, collapsing consecutive stars.
+// Returns the number of atoms written to `atoms` (at most pattern.len).
+static size_t parse_atoms(String pattern, Atom *atoms) {
+    size_t n = 0;
+
+    for (size_t i = 0; i < pattern.len;) {
+        char c = pattern.str[i];
+        Atom *a = &atoms[n];
+        memset(a, 0, sizeof *a);
+
+        if (c == '*') {
+            i++;
+            if (n && atoms[n - 1].star) continue;
+            a->star = true;
+        } else if (c == '?') {
+            i++;
+            memset(a->set, 0xFF, sizeof a->set);
+        } else if (c == '[') {
+            size_t j = i + 1;
+            if (parse_class(pattern, &j, a)) {
+                i = j;
+            } else {
+                // Unterminated bracket expression: match '[' literally
+                SET_ADD(a->set, '[');
+                a->literal = true;
+                i++;
+            }
+        } else {
+            if (c == '\\' && i + 1 < pattern.len) c = pattern.str[++i];
+            SET_ADD(a->set, c);
+            a->literal = true;
+            i++;
+        }
+
+        n++;
+    }
+
+    return n;
+}
+
+/* * * * * * * Compilation * * * * * * */
+
+StrGlob strglob_compile(String pattern) {
+    StrGlob g = { .alloc = str_allocator_slot(NULL) };
+
+    size_t cap = pattern.len ? pattern.len : 1;
+    Atom *atoms = str_mem_alloc_with(g.alloc, cap * sizeof *atoms);
+    size_t m = parse_atoms(pattern, atoms);
+
+    g.natoms = m;
+    g.words  = (m + 1 + 63) / 64; // positions 0..m
+
+    // Literal prefix and suffix used as a prefilter
+    String lit = str_alloc("");
+
+    size_t plen = 0;
+    while (plen < m && atoms[plen].literal) {
+        for (unsigned c = 0; c < 256; c++)
+            if (SET_HAS(atoms[plen].set, c)) str_push(c, &lit);
+        plen++;
+    }
+    g.prefix = lit;
+
+    lit = str_alloc("");
+    size_t slen = 0;
+    if (plen < m) {
+        while (slen < m - plen && atoms[m - 1 - slen].literal) slen++;
+
+        for (size_t k = m - slen; k < m; k++)
+            for (unsigned c = 0; c < 256; c++)
+                if (SET_HAS(atoms[k].set, c)) str_push(c, &lit);
+    }
+    g.suffix = lit;
+
+    // Star mask and minimum length
+    g.stars = str_mem_alloc_with(g.alloc, g.words * sizeof *g.stars);
+    memset(g.stars, 0, g.words * sizeof *g.stars);
+
+    for (size_t k = 0; k < m; k++) {
+        if (atoms[k].star) {
+            BIT_SET(g.stars, k + 1);
+            g.has_star = true;
+        } else g.min_len++;
+    }
+
+    // Group bytes accepted by the same atoms into equivalence classes
+    uint64_t *column = str_mem_alloc_with(g.alloc, g.words * sizeof *column);
+    size_t nclasses = 0;
+    size_t classes_cap = 4;
+    g.masks = str_mem_alloc_with(g.alloc, classes_cap * g.words * sizeof *g.masks);
+
+    for (unsigned c = 0; c < 256; c++) {
+        memset(column, 0, g.words * sizeof *column);
+        for (size_t k = 0; k < m; k++)
+            if (!atoms[k].star && SET_HAS(atoms[k].set, c)) BIT_SET(column, k + 1);
+
+        size_t cls = 0;
+        while (cls < nclasses &&
+               memcmp(g.masks + cls * g.words, column, g.words * sizeof *column))
+            cls++;
+
+        if (cls == nclasses) {
+            if (nclasses == classes_cap) {
+                g.masks = str_mem_realloc_with(g.alloc, g.masks,
+                    classes_cap * g.words * sizeof *g.masks,
+                    classes_cap * 2 * g.words * sizeof *g.masks);
+                classes_cap *= 2;
+            }
+
+            memcpy(g.masks + nclasses * g.words, column, g.words * sizeof *column);
+            nclasses++;
+        }
+
+        g.classes[c] = (uint8_t)cls;
+    }
+
+    // Shrink the mask table to the classes actually used
+    g.masks = str_mem_realloc_with(g.alloc, g.masks,
+        classes_cap * g.words * sizeof *g.masks,
+        nclasses * g.words * sizeof *g.masks);
+    g.nclasses = nclasses;
+
+    str_mem_free_with(g.alloc, column, g.words * sizeof *column);
+    str_mem_free_with(g.alloc, atoms, cap * sizeof *atoms);
+
+    return g;
+}
+
+void strglob_free(StrGlob *g) {
+    str_mem_free_with(g->alloc, g->masks, g->nclasses * g->words * sizeof *g->masks);
+    str_mem_free_with(g->alloc, g->stars, g->words * sizeof *g->stars);
+    str_free(&g->prefix);
+    str_free(&g->suffix);
+    memset(g, 0, sizeof *g);
+}
+
+/* * * * * * * Matching * * * * * * */
+
+// Epsilon transitions into star positions (consecutive stars are collapsed,
+// so a single step is enough)
+static void close_stars(const StrGlob *g, uint64_t *d) {
+    uint64_t carry = 0;
+
+    for (size_t w = 0; w < g->words; w++) {
+        uint64_t v = d[w];
+        d[w] |= ((v << 1) | carry) & g->stars[w];
+        carry = v >> 63;
+    }
+}
+
+// Simulates the pattern NFA (Shift-And) over the text, starting in position
+// `start` and accepting in position `end`
+static bool run_nfa(const StrGlob *g, const char *text, size_t len,
+                    size_t start, size_t end) {
+    // Single word fast path
+    if (g->words == 1) {
+        uint64_t stars = g->stars[0];
+        uint64_t d = 1ull << start;
+        d |= (d << 1) & stars;
+
+        for (size_t i = 0; i < len && d; i++) {
+            uint64_t accept = g->masks[g->classes[(uint8_t)text[i]]];
+            d = ((d << 1) & accept) | (d & stars);
+            d |= (d << 1) & stars;
+        }
+
+        return (d >> end) & 1;
+    }
+
+    uint64_t stack[8];
+    uint64_t *d = g->words <= 8 ? stack : str_mem_alloc_with(g->alloc, g->words * sizeof *d);
+    memset(d, 0, g->words * sizeof *d);
+
+    BIT_SET(d, start);
+    close_stars(g, d);
+
+    for (size_t i = 0; i < len; i++) {
+        const uint64_t *accept = g->masks + g->classes[(uint8_t)text[i]] * g->words;
+        uint64_t carry = 0, any = 0;
+
+        for (size_t w = 0; w < g->words; w++) {
+            uint64_t v = d[w];
+            d[w] = (((v << 1) | carry) & accept[w]) | (v & g->stars[w]);
+            carry = v >> 63;
+            any |= d[w];
+        }
+
+        if (!any) break;
+        close_stars(g, d);
+    }
+
+    bool match = BIT_HAS(d, end);
+    if (d != stack) str_mem_free_with(g->alloc, d, g->words * sizeof *d);
+    return match;
+}
+
+bool strglob_match(const StrGlob *g, String str) {
+    if (str.len < g->min_len) return false;
+    if (!g->has_star && str.len != g->min_len) return false;
+
+    // Pattern without wildcards
+    if (g->prefix.len == g->natoms) return str_eq(g->prefix, str);
+
+    if (!str_startswith(g->prefix, str)) return false;
+    if (!str_endswith(g->suffix, str)) return false;
+
+    size_t start = g->prefix.len;
+    size_t end   = g->natoms - g->suffix.len;
+
+    // Only a star between the prefix and the suffix
+    if (end - start == 1 && BIT_HAS(g->stars, end)) return true;
+
+    return run_nfa(g, str.str + start, str.len - start - g->suffix.len, start, end);
+}
+
+size_t strglob_match_all(const StrGlob *g, const String *strs, size_t n, bool *out) {
+    size_t matches = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        bool m = strglob_match(g, strs[i]);
+        if (out) out[i] = m;
+        matches += m;
+    }
+
+    return matches;
+}
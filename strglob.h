@@ -0,0 +1,49 @@
+#ifndef _STRGLOB_H
+#define _STRGLOB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Compiled glob pattern
+//
+// Supported syntax (matched byte-wise):
+//   *        any sequence of bytes (including empty)
+//   ?        any single byte
+//   [abc]    any of the listed bytes, ranges like [a-z] are allowed,
+//            `]` can be listed first ([]a]) to match it literally
+//   [!abc]   any byte except the listed ones ([^abc] is also accepted)
+//   \x       the byte x literally
+// An unterminated `[` matches itself literally.
+typedef struct {
+    uint8_t   classes[256]; // byte -> equivalence class
+    uint64_t *masks;        // [class][word] atoms accepting the bytes of a class
+    size_t    nclasses;     // number of byte equivalence classes
+    uint64_t *stars;        // [word] atoms that are a `*`
+    size_t    words;        // number of 64-bit words per state vector
+    size_t    natoms;       // number of atoms (stars count as one)
+    size_t    min_len;      // minimum length of a matching string
+    bool      has_star;
+    String    prefix;       // literal prefix (heap-allocated)
+    String    suffix;       // literal suffix after the last non-literal atom (heap-allocated)
+    unsigned  alloc;        // allocator slot of the tables
+} StrGlob;
+
+// Compiles the pattern into a matcher.
+// Requires strglob_free()
+StrGlob strglob_compile(String pattern);
+
+// Frees the memory allocated for the compiled pattern
+void strglob_free(StrGlob *glob);
+
+// Tells whether the whole string matches the pattern.
+// Runs in O(len * natoms / 64) time, after checking the literal prefix and suffix.
+bool strglob_match(const StrGlob *glob, String str);
+
+// Matches the pattern against an array of strings, writing the results to `out`
+// (which may be NULL). Returns the number of matching strings.
+size_t strglob_match_all(const StrGlob *glob, const String *strs, size_t n, bool *out);
+
+#endif // _STRGLOB_H
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strglob.h"
+
+// Compiles the pattern, matches it against the string and frees it
+static bool glob(const char *pattern, const char *str) {
+    StrGlob g = strglob_compile(str_ref(pattern));
+    bool m = strglob_match(&g, str_ref(str));
+    strglob_free(&g);
+    return m;
+}
+
+// Backtracking reference matcher for patterns made of literals, '?' and '*'
+static bool naive(const char *p, const char *s) {
+    if (!*p) return !*s;
+    if (*p == '*') return naive(p + 1, s) || (*s && naive(p, s + 1));
+    return *s && (*p == '?' || *p == *s) && naive(p + 1, s + 1);
+}
+
+int main() {
+    test("strglob_match", {
+        assert(glob("", ""));
+        assert(!glob("", "a"));
+        assert(glob("*", ""));
+        assert(glob("*", "anything"));
+        assert(glob("foo", "foo"));
+        assert(!glob("foo", "fo"));
+        assert(glob("*.log", "/var/log/app.log"));
+        assert(!glob("*.log", "/var/log/app.log.1"));
+        assert(glob("/var/*/app.*", "/var/log/app.log.1"));
+        assert(glob("a?c", "abc"));
+        assert(!glob("a?c", "ac"));
+        assert(glob("a**b***c", "aXbYc"));
+        assert(glob("*a*b*", "xxaxxbxx"));
+        assert(!glob("*a*b*", "xxbxxaxx"));
+    });
+
+    test("strglob (classes)", {
+        assert(glob("[abc]x", "bx"));
+        assert(!glob("[abc]x", "dx"));
+        assert(glob("file[0-9][0-9]", "file42"));
+        assert(!glob("file[0-9][0-9]", "file4x"));
+        assert(glob("[!0-9]*", "x1"));
+        assert(!glob("[^0-9]*", "1x"));
+        assert(glob("[]]", "]"));
+        assert(glob("[a-]", "-"));
+        assert(glob("\\*", "*"));
+        assert(!glob("\\*", "x"));
+        assert(glob("[abc", "[abc"));
+    });
+
+    test("strglob (long)", {
+        // Pattern longer than a single 64-bit state word
+        char pattern[200];
+        char str[300];
+        memset(pattern, '?', 150);
+        strcpy(pattern + 150, "*x*y?");
+        memset(str, 'a', 250);
+        strcpy(str + 250, "x__y_");
+
+        assert(glob(pattern, str));
+        str[253] = 'z';
+        assert(!glob(pattern, str));
+    });
+
+    test("strglob (pathological)", {
+        // Exponential for backtracking matchers
+        char str[201];
+        memset(str, 'a', 200);
+        str[200] = '\0';
+
+        assert(!glob("*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*b", str));
+        assert(glob("*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a", str));
+    });
+
+    test("strglob (vs naive)", {
+        srand(42);
+        bool ok = true;
+
+        for (int i = 0; i < 20000 && ok; i++) {
+            char p[12];
+            char s[16];
+            int pn = rand() % 11;
+            int sn = rand() % 15;
+
+            for (int j = 0; j < pn; j++) p[j] = "ab?*"[rand() % 4];
+            for (int j = 0; j < sn; j++) s[j] = "abc"[rand() % 3];
+            p[pn] = s[sn] = '\0';
+
+            ok = glob(p, s) == naive(p, s);
+            if (!ok) printf(" %s %s ", p, s);
+        }
+
+        assert(ok);
+    });
+
+    String paths[] = {
+        str_ref("src/main.c"), str_ref("src/main.h"),
+        str_ref("README.md"), str_ref("src/util/str.c"),
+    };
+
+    test("strglob_match_all", {
+        bool out[4];
+
+        StrGlob g = strglob_compile(str_ref("src/*.c"));
+        assert_eq((size_t)2, strglob_match_all(&g, paths, 4, out), "%zu");
+        assert(out[0] && !out[1] && !out[2] && out[3]);
+        strglob_free(&g);
+    });
+}
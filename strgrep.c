@@ -0,0 +1,391 @@
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "strutils.h"
+#include "strsearch.h"
+#include "strwrite.h"
+
+// Searches the files of directory trees for a fixed string, like `grep -rF`.
+// Directories and files are tasks of a work-stealing pool: every worker pushes
+// the entries of the directories it lists to its own deque and pops from it,
+// idle workers steal the oldest tasks of the others.
+// Exits with 0 if a line matched, 1 if none did, and 2 if an error occurred.
+
+#define MAX_THREADS 256
+
+typedef enum {
+    OPT_LINE_NUMBERS = 0x1,  // -n
+    OPT_COUNT        = 0x2,  // -c
+    OPT_FILES        = 0x4,  // -l
+    OPT_STREAM       = 0x8,  // --stream
+    OPT_TIMING       = 0x10, // -t
+} Options;
+
+typedef struct {
+    char *path;
+    bool  dir;
+} Task;
+
+// Tasks of a worker, popped by the worker at the bottom and stolen at the top
+typedef struct {
+    pthread_mutex_t lock;
+    Task  *tasks;
+    size_t top;
+    size_t bottom;
+    size_t cap;
+    unsigned alloc; // allocator slot of `tasks`
+} Deque;
+
+typedef struct Pool Pool;
+
+typedef struct {
+    Pool     *pool;
+    size_t    id;
+    Deque     deque;
+    String    out;     // output of the current file
+    uint64_t  files;
+    uint64_t  bytes;
+    uint64_t  matches; // matching lines
+    uint64_t  steals;
+    uint64_t  errors;  // files and directories that could not be read
+    pthread_t thread;
+    bool      started; // the thread was created (worker 0 runs on the main thread)
+} Worker;
+
+struct Pool {
+    String    needle;
+    Options   opts;
+    size_t    nworkers;
+    Worker   *workers;
+    size_t    pending; // tasks pushed and not finished yet
+    StrWriter writer;
+    pthread_mutex_t out_lock;
+};
+
+/* * * * * * * Deque * * * * * * */
+
+static void deque_push(Deque *d, Task t) {
+    pthread_mutex_lock(&d->lock);
+
+    if (d->bottom == d->cap && d->top) {
+        // Reuse the room of the stolen tasks before growing
+        memmove(d->tasks, d->tasks + d->top, (d->bottom - d->top) * sizeof *d->tasks);
+        d->bottom -= d->top;
+        d->top = 0;
+    }
+
+    if (d->bottom == d->cap) {
+        size_t cap = d->cap ? d->cap * 2 : 64;
+        d->tasks = str_mem_realloc_with(d->alloc, d->tasks, d->cap * sizeof *d->tasks,
+                                        cap * sizeof *d->tasks);
+        d->cap = cap;
+    }
+
+    d->tasks[d->bottom++] = t;
+    pthread_mutex_unlock(&d->lock);
+}
+
+static bool deque_pop(Deque *d, Task *t) {
+    pthread_mutex_lock(&d->lock);
+    bool ok = d->bottom > d->top;
+    if (ok) *t = d->tasks[--d->bottom];
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+static bool deque_steal(Deque *d, Task *t) {
+    pthread_mutex_lock(&d->lock);
+    bool ok = d->bottom > d->top;
+    if (ok) *t = d->tasks[d->top++];
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+/* * * * * * * Tasks * * * * * * */
+
+static void push_task(Worker *w, char *path, bool dir) {
+    __atomic_add_fetch(&w->pool->pending, 1, __ATOMIC_RELAXED);
+    deque_push(&w->deque, (Task){ .path = path, .dir = dir });
+}
+
+// Prints an error about the path, which makes the exit status 2
+static void report_error(Worker *w, const char *path, int err) {
+    fprintf(stderr, "strgrep: %s: %s\n", path, strerror(err));
+    w->errors++;
+}
+
+static char *join_path(const char *dir, const char *name) {
+    size_t len = strlen(dir);
+    String path = str_fmt(len && dir[len - 1] == '/' ? "%s%s" : "%s/%s", dir, name);
+    char *c = cstr(path);
+    str_free(&path);
+    return c;
+}
+
+static void list_dir(Worker *w, const char *path) {
+    DIR *dir = opendir(path);
+    if (!dir) {
+        report_error(w, path, errno);
+        return;
+    }
+
+    for (struct dirent *e; (e = readdir(dir));) {
+        if (!strcmp(e->d_name, ".") || !strcmp(e->d_name, "..")) continue;
+
+        unsigned char type = e->d_type;
+        char *child = join_path(path, e->d_name);
+
+        if (type == DT_UNKNOWN) {
+            struct stat st;
+            if (!lstat(child, &st)) type = S_ISDIR(st.st_mode) ? DT_DIR : S_ISREG(st.st_mode) ? DT_REG : 0;
+        }
+
+        // Symbolic links and special files are skipped
+        if (type == DT_DIR || type == DT_REG) push_task(w, child, type == DT_DIR);
+        else cstr_free(child);
+    }
+
+    closedir(dir);
+}
+
+typedef struct {
+    Worker     *w;
+    const char *path;
+} FileCtx;
+
+static bool on_match(void *ctx, const StrSearchMatch *match) {
+    FileCtx *f = ctx;
+    Options opts = f->w->pool->opts;
+
+    if (opts & OPT_COUNT) return true;
+
+    str_pushs(str_ref(f->path), &f->w->out);
+    if (opts & OPT_FILES) {
+        str_push('\n', &f->w->out);
+        return false;
+    }
+
+    str_push(':', &f->w->out);
+    if (opts & OPT_LINE_NUMBERS) str_pushf(&f->w->out, "%" PRIu64 ":", match->line + 1);
+    str_pushs(match->text, &f->w->out);
+    str_push('\n', &f->w->out);
+    return true;
+}
+
+static void search_file(Worker *w, const char *path) {
+    Pool *pool = w->pool;
+    FileCtx ctx = { .w = w, .path = path };
+    StrSearchFlags flags = STR_SEARCH_LINES | STR_SEARCH_SYNC;
+
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st)) {
+        report_error(w, path, errno);
+        if (fd >= 0) close(fd);
+        return;
+    }
+
+    StrSearchResult res = {0};
+    void *map = MAP_FAILED;
+
+    if (!(pool->opts & OPT_STREAM) && st.st_size > 0)
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (map != MAP_FAILED) {
+        madvise(map, st.st_size, MADV_SEQUENTIAL);
+        res = str_search_str(str_nref(map, st.st_size), pool->needle, flags, on_match, &ctx);
+        munmap(map, st.st_size);
+    } else {
+        res = str_search_fd(fd, pool->needle, 0, flags, on_match, &ctx);
+        if (res.error) report_error(w, path, res.error);
+    }
+    close(fd);
+
+    if (pool->opts & OPT_COUNT) str_pushf(&w->out, "%s:%" PRIu64 "\n", path, res.matches);
+
+    w->files++;
+    w->bytes += res.bytes;
+    w->matches += res.matches;
+
+    // The lines of a file are written together
+    if (w->out.len) {
+        pthread_mutex_lock(&pool->out_lock);
+        str_write_copy(w->out, &pool->writer);
+        pthread_mutex_unlock(&pool->out_lock);
+        w->out.len = 0;
+    }
+}
+
+/* * * * * * * Pool * * * * * * */
+
+static bool next_task(Worker *w, Task *t) {
+    if (deque_pop(&w->deque, t)) return true;
+
+    Pool *pool = w->pool;
+    for (size_t i = 1; i < pool->nworkers; i++) {
+        Worker *victim = &pool->workers[(w->id + i) % pool->nworkers];
+        if (deque_steal(&victim->deque, t)) {
+            w->steals++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void *worker_main(void *arg) {
+    Worker *w = arg;
+    Pool *pool = w->pool;
+
+    while (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE)) {
+        Task t;
+        if (!next_task(w, &t)) {
+            sched_yield();
+            continue;
+        }
+
+        if (t.dir) list_dir(w, t.path);
+        else search_file(w, t.path);
+
+        cstr_free(t.path);
+        __atomic_sub_fetch(&pool->pending, 1, __ATOMIC_RELEASE);
+    }
+
+    return NULL;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+        "Usage: strgrep [-n] [-c] [-l] [-t] [-j THREADS] [--stream] STRING PATH...\n"
+        "Searches the files under the paths for a fixed string.\n"
+        "  -n        prefix lines with their line number\n"
+        "  -c        print the number of matching lines of every file\n"
+        "  -l        print the names of the matching files only\n"
+        "  -t        print timings and totals to stderr\n"
+        "  -j N      number of threads (default: number of CPUs)\n"
+        "  --stream  read files in chunks instead of mapping them\n");
+}
+
+int main(int argc, char **argv) {
+    Pool pool = { .nworkers = sysconf(_SC_NPROCESSORS_ONLN) };
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+        const char *arg = argv[i];
+
+        if (!strcmp(arg, "--")) {
+            i++;
+            break;
+        } else if (!strcmp(arg, "--stream")) {
+            pool.opts |= OPT_STREAM;
+        } else if (!strcmp(arg, "-j") && i + 1 < argc) {
+            pool.nworkers = strtoul(argv[++i], NULL, 10);
+        } else if (arg[1] != '-') {
+            for (const char *c = arg + 1; *c; c++) {
+                switch (*c) {
+                    case 'n': pool.opts |= OPT_LINE_NUMBERS; break;
+                    case 'c': pool.opts |= OPT_COUNT;        break;
+                    case 'l': pool.opts |= OPT_FILES;        break;
+                    case 't': pool.opts |= OPT_TIMING;       break;
+                    default:  usage(); return 2;
+                }
+            }
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    if (argc - i < 2) {
+        usage();
+        return 2;
+    }
+
+    if (pool.nworkers < 1) pool.nworkers = 1;
+    if (pool.nworkers > MAX_THREADS) pool.nworkers = MAX_THREADS;
+
+    pool.needle = str_ref(argv[i++]);
+    pool.writer = str_writer_fd(STDOUT_FILENO);
+    pthread_mutex_init(&pool.out_lock, NULL);
+
+    Worker workers[MAX_THREADS] = {0};
+    pool.workers = workers;
+
+    for (size_t k = 0; k < pool.nworkers; k++) {
+        workers[k].pool = &pool;
+        workers[k].id = k;
+        workers[k].out = str_alloc("");
+        workers[k].deque.alloc = str_allocator_slot(NULL);
+        pthread_mutex_init(&workers[k].deque.lock, NULL);
+    }
+
+    // The paths given are spread over the workers
+    for (size_t k = 0; i < argc; i++, k++) {
+        struct stat st;
+        if (stat(argv[i], &st)) {
+            report_error(&workers[0], argv[i], errno);
+            continue;
+        }
+
+        char *path = cstr(str_ref(argv[i]));
+        push_task(&workers[k % pool.nworkers], path, S_ISDIR(st.st_mode));
+    }
+
+    double start = now();
+
+    // The tasks of a worker whose thread could not be created are stolen by the others
+    for (size_t k = 1; k < pool.nworkers; k++)
+        workers[k].started = !pthread_create(&workers[k].thread, NULL, worker_main, &workers[k]);
+    worker_main(&workers[0]);
+    for (size_t k = 1; k < pool.nworkers; k++)
+        if (workers[k].started) pthread_join(workers[k].thread, NULL);
+
+    str_writer_flush(&pool.writer);
+    double elapsed = now() - start;
+
+    uint64_t files = 0, bytes = 0, matches = 0, steals = 0, errors = 0;
+    for (size_t k = 0; k < pool.nworkers; k++) {
+        files   += workers[k].files;
+        bytes   += workers[k].bytes;
+        matches += workers[k].matches;
+        steals  += workers[k].steals;
+        errors  += workers[k].errors;
+
+        str_free(&workers[k].out);
+        str_mem_free_with(workers[k].deque.alloc, workers[k].deque.tasks,
+                          workers[k].deque.cap * sizeof(Task));
+        pthread_mutex_destroy(&workers[k].deque.lock);
+    }
+
+    if (pool.opts & OPT_TIMING) {
+        fprintf(stderr,
+            "strgrep: %" PRIu64 " files, %.1f MB in %.3f s (%.1f MB/s), %" PRIu64 " matching lines, "
+            "%zu threads, %" PRIu64 " steals, %zu writes\n",
+            files, bytes / 1e6, elapsed, bytes / 1e6 / elapsed, matches,
+            pool.nworkers, steals, pool.writer.syscalls);
+    }
+
+    pthread_mutex_destroy(&pool.out_lock);
+
+    // Like grep, errors take precedence over matches
+    if (pool.writer.error || errors) return 2;
+    return matches ? 0 : 1;
+}
@@ -0,0 +1,787 @@
+#include "strindex.h"
+
+#include <string.h>
+#include <pthread.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* * * * * * * SA-IS * * * * * * */
+
+// Input of a recursion level: the text bytes at the top level (shifted up by one,
+// followed by a virtual 0 sentinel), the names of the LMS substrings below
+typedef struct {
+    const uint8_t *bytes;
+    const int32_t *ints;
+    int32_t        n; // including the sentinel
+    unsigned       alloc; // allocator slot of the work arrays
+} SaisInput;
+
+static inline int32_t sais_chr(const SaisInput *s, int32_t i) {
+    if (s->bytes) return i == s->n - 1 ? 0 : s->bytes[i] + 1;
+    return s->ints[i];
+}
+
+// Suffix types: 1 for S-type, 0 for L-type
+#define TGET(t, i) (((t)[(i) >> 3] >> ((i) & 7)) & 1)
+#define TSET(t, i) ((t)[(i) >> 3] |= 1 << ((i) & 7))
+#define IS_LMS(t, i) ((i) > 0 && TGET(t, i) && !TGET(t, (i) - 1))
+
+// Counts the occurrences of every symbol
+static void sais_counts(const SaisInput *s, int32_t *cnt, int32_t K) {
+    memset(cnt, 0, (K + 1) * sizeof *cnt);
+    for (int32_t i = 0; i < s->n; i++) cnt[sais_chr(s, i)]++;
+}
+
+// Computes the start (or end) of the bucket of every symbol
+static void sais_buckets(const int32_t *cnt, int32_t *bkt, int32_t K, bool end) {
+    int32_t sum = 0;
+    for (int32_t i = 0; i <= K; i++) {
+        sum += cnt[i];
+        bkt[i] = end ? sum : sum - cnt[i];
+    }
+}
+
+// Induces the order of the L-type suffixes from the sorted LMS suffixes
+static void sais_induce_l(const uint8_t *t, int32_t *SA, const SaisInput *s,
+                          const int32_t *cnt, int32_t *bkt, int32_t K) {
+    sais_buckets(cnt, bkt, K, false);
+    for (int32_t i = 0; i < s->n; i++) {
+        int32_t j = SA[i] - 1;
+        if (j >= 0 && !TGET(t, j)) SA[bkt[sais_chr(s, j)]++] = j;
+    }
+}
+
+// Induces the order of the S-type suffixes from the sorted L-type suffixes
+static void sais_induce_s(const uint8_t *t, int32_t *SA, const SaisInput *s,
+                          const int32_t *cnt, int32_t *bkt, int32_t K) {
+    sais_buckets(cnt, bkt, K, true);
+    for (int32_t i = s->n - 1; i >= 0; i--) {
+        int32_t j = SA[i] - 1;
+        if (j >= 0 && TGET(t, j)) SA[--bkt[sais_chr(s, j)]] = j;
+    }
+}
+
+// Sorts the suffixes of the input (at least 2 symbols, ending with a unique
+// smallest 0 sentinel, other symbols up to K), by Nong, Zhang and Chan
+static void sais(const SaisInput *s, int32_t *SA, int32_t K) {
+    int32_t n = s->n;
+
+    size_t tsize = (n + 7) / 8;
+    uint8_t *t = str_mem_alloc_with(s->alloc, tsize);
+    memset(t, 0, tsize);
+
+    TSET(t, n - 1);
+    for (int32_t i = n - 3; i >= 0; i--) {
+        int32_t a = sais_chr(s, i), b = sais_chr(s, i + 1);
+        if (a < b || (a == b && TGET(t, i + 1))) TSET(t, i);
+    }
+
+    int32_t *cnt = str_mem_alloc_with(s->alloc, 2 * (K + 1) * sizeof *cnt);
+    int32_t *bkt = cnt + K + 1;
+    sais_counts(s, cnt, K);
+
+    // Stage 1: sort the LMS substrings
+    sais_buckets(cnt, bkt, K, true);
+    for (int32_t i = 0; i < n; i++) SA[i] = -1;
+    for (int32_t i = 1; i < n; i++)
+        if (IS_LMS(t, i)) SA[--bkt[sais_chr(s, i)]] = i;
+
+    sais_induce_l(t, SA, s, cnt, bkt, K);
+    sais_induce_s(t, SA, s, cnt, bkt, K);
+
+    // Compact the sorted LMS substrings into the first n1 items
+    int32_t n1 = 0;
+    for (int32_t i = 0; i < n; i++)
+        if (IS_LMS(t, SA[i])) SA[n1++] = SA[i];
+
+    // Name the LMS substrings (equal substrings get equal names)
+    for (int32_t i = n1; i < n; i++) SA[i] = -1;
+
+    int32_t name = 0, prev = -1;
+    for (int32_t i = 0; i < n1; i++) {
+        int32_t pos = SA[i];
+        bool diff = false;
+
+        for (int32_t d = 0; d < n; d++) {
+            if (prev == -1 || sais_chr(s, pos + d) != sais_chr(s, prev + d) ||
+                TGET(t, pos + d) != TGET(t, prev + d)) {
+                diff = true;
+                break;
+            }
+            if (d > 0 && (IS_LMS(t, pos + d) || IS_LMS(t, prev + d))) break;
+        }
+
+        if (diff) {
+            name++;
+            prev = pos;
+        }
+        SA[n1 + pos / 2] = name - 1;
+    }
+
+    for (int32_t i = n - 1, j = n - 1; i >= n1; i--)
+        if (SA[i] >= 0) SA[j--] = SA[i];
+
+    // Stage 2: sort the reduced string (recursively if names are not unique)
+    int32_t *SA1 = SA, *s1 = SA + n - n1;
+    if (name < n1) {
+        SaisInput reduced = { .ints = s1, .n = n1, .alloc = s->alloc };
+        sais(&reduced, SA1, name - 1);
+    } else {
+        for (int32_t i = 0; i < n1; i++) SA1[s1[i]] = i;
+    }
+
+    // Stage 3: induce the suffix array from the sorted LMS suffixes
+    sais_buckets(cnt, bkt, K, true);
+    for (int32_t i = 1, j = 0; i < n; i++)
+        if (IS_LMS(t, i)) s1[j++] = i;
+    for (int32_t i = 0; i < n1; i++) SA1[i] = s1[SA1[i]];
+    for (int32_t i = n1; i < n; i++) SA[i] = -1;
+
+    for (int32_t i = n1 - 1; i >= 0; i--) {
+        int32_t j = SA[i];
+        SA[i] = -1;
+        SA[--bkt[sais_chr(s, j)]] = j;
+    }
+
+    sais_induce_l(t, SA, s, cnt, bkt, K);
+    sais_induce_s(t, SA, s, cnt, bkt, K);
+
+    str_mem_free_with(s->alloc, cnt, 2 * (K + 1) * sizeof *cnt);
+    str_mem_free_with(s->alloc, t, tsize);
+}
+
+/* * * * * * * Private Utilities * * * * * * */
+
+#define SUPER_SHIFT 16
+#define BLOCK_SHIFT 8
+
+// Number of entries in the occurrence tables, BWT and sampled bit vector
+static inline size_t rows(const StrIndex *idx)     { return idx->len + 1; }
+static inline size_t nsuper(const StrIndex *idx)   { return (rows(idx) >> SUPER_SHIFT) + 1; }
+static inline size_t nblocks(const StrIndex *idx)  { return (rows(idx) >> BLOCK_SHIFT) + 1; }
+static inline size_t nwords(const StrIndex *idx)   { return rows(idx) / 64 + 1; }
+
+// Counts the occurrences of a byte in a buffer
+static size_t count_byte(const uint8_t *p, size_t n, uint8_t c) {
+    size_t count = 0, i = 0;
+
+#ifdef __SSE2__
+    const __m128i v = _mm_set1_epi8(c);
+    for (; i + 16 <= n; i += 16) {
+        __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + i)), v);
+        count += __builtin_popcount(_mm_movemask_epi8(eq));
+    }
+#endif
+
+    for (; i < n; i++) count += p[i] == c;
+    return count;
+}
+
+// Number of occurrences of a byte in the BWT before the given row
+static size_t occ(const StrIndex *idx, uint8_t c, size_t row) {
+    if (idx->C[c + 1] == idx->C[c]) return 0;
+
+    size_t s    = idx->sym[c];
+    size_t base = row >> BLOCK_SHIFT << BLOCK_SHIFT;
+
+    size_t n = idx->occ_super[(row >> SUPER_SHIFT) * idx->sigma + s]
+             + idx->occ_block[(row >> BLOCK_SHIFT) * idx->sigma + s]
+             + count_byte(idx->bwt + base, row - base, c);
+
+    // The end marker is stored as a 0 byte, but not counted
+    if (idx->primary >= base && idx->primary < row && c == 0) n--;
+    return n;
+}
+
+// Finds the range of BWT rows prefixed by the needle (backward search)
+static bool fm_range(const StrIndex *idx, String needle, size_t *sp, size_t *ep) {
+    size_t lo = 0, hi = rows(idx);
+
+    for (size_t i = needle.len; i-- > 0;) {
+        uint8_t c = needle.str[i];
+        lo = idx->C[c] + occ(idx, c, lo);
+        hi = idx->C[c] + occ(idx, c, hi);
+        if (lo >= hi) return false;
+    }
+
+    *sp = lo;
+    *ep = hi;
+    return true;
+}
+
+// Compares the suffix at the given position with the needle,
+// treating suffixes prefixed by the needle as equal
+static int suffix_cmp(const StrIndex *idx, uint32_t pos, String needle) {
+    size_t avail = idx->len - pos;
+    size_t n = avail < needle.len ? avail : needle.len;
+
+    int cmp = memcmp(idx->text.str + pos, needle.str, n);
+    if (cmp) return cmp;
+    return avail < needle.len ? -1 : 0;
+}
+
+// Finds the range of the suffix array prefixed by the needle (binary search)
+static bool sa_range(const StrIndex *idx, String needle, size_t *sp, size_t *ep) {
+    size_t lo = 0, hi = idx->len;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (suffix_cmp(idx, idx->sa[mid], needle) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    *sp = lo;
+
+    hi = idx->len;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (suffix_cmp(idx, idx->sa[mid], needle) <= 0) lo = mid + 1;
+        else hi = mid;
+    }
+    *ep = lo;
+
+    return *sp < *ep;
+}
+
+// Text position of the suffix in the given BWT row, walking back to a sampled row.
+// A sampled row is at most STR_INDEX_SAMPLE - 1 steps away, the walk stops there
+// and returns the length of the text if the index is corrupted.
+static size_t fm_position(const StrIndex *idx, size_t row) {
+    if (idx->sa) return idx->sa[row - 1];
+
+    for (size_t steps = 0; steps < STR_INDEX_SAMPLE && row < rows(idx); steps++) {
+        if ((idx->sampled[row / 64] >> (row % 64)) & 1) {
+            uint64_t below = idx->sampled[row / 64] & ((1ull << (row % 64)) - 1);
+            size_t rank = idx->sampled_rank[row / 64] + __builtin_popcountll(below);
+            return idx->samples[rank] + steps;
+        }
+
+        uint8_t c = idx->bwt[row];
+        row = idx->C[c] + occ(idx, c, row);
+    }
+
+    return idx->len;
+}
+
+/* * * * * * * Parallel build * * * * * * */
+
+// Work on a range of units
+typedef void (*TaskFn)(void *ctx, size_t lo, size_t hi);
+
+typedef struct {
+    TaskFn  fn;
+    void   *ctx;
+    size_t  lo;
+    size_t  hi;
+} Task;
+
+static void *task_run(void *arg) {
+    Task *task = arg;
+    task->fn(task->ctx, task->lo, task->hi);
+    return NULL;
+}
+
+// Splits `n` units into contiguous ranges processed by up to `threads` threads
+static void parallel_for(size_t n, size_t threads, TaskFn fn, void *ctx) {
+    if (threads > n) threads = n;
+    if (threads <= 1) {
+        fn(ctx, 0, n);
+        return;
+    }
+
+    Task tasks[STR_INDEX_THREADS];
+    pthread_t ids[STR_INDEX_THREADS];
+    bool started[STR_INDEX_THREADS] = {0};
+
+    for (size_t t = 0; t < threads; t++) {
+        tasks[t] = (Task){ fn, ctx, n * t / threads, n * (t + 1) / threads };
+        // The calling thread takes the first range
+        if (t) started[t] = !pthread_create(&ids[t], NULL, task_run, &tasks[t]);
+    }
+
+    task_run(&tasks[0]);
+
+    for (size_t t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(ids[t], NULL);
+        else task_run(&tasks[t]);
+    }
+}
+
+typedef struct {
+    StrIndex      *idx;
+    const int32_t *SA; // full suffix array (with the end marker in row 0)
+} Build;
+
+// BWT rows [lo, hi)
+static void build_bwt(void *ctx, size_t lo, size_t hi) {
+    Build *b = ctx;
+    const uint8_t *text = (const uint8_t *)b->idx->text.str;
+
+    for (size_t r = lo; r < hi; r++) {
+        if (b->SA[r]) {
+            b->idx->bwt[r] = text[b->SA[r] - 1];
+        } else {
+            b->idx->bwt[r] = 0;
+            b->idx->primary = r;
+        }
+    }
+}
+
+// Block counts of superblocks [lo, hi) and their totals (stored in the next superblock)
+static void build_occ(void *ctx, size_t lo, size_t hi) {
+    StrIndex *idx = ((Build *)ctx)->idx;
+    size_t sigma = idx->sigma;
+    uint32_t counts[256];
+
+    for (size_t sb = lo; sb < hi; sb++) {
+        memset(counts, 0, sigma * sizeof *counts);
+
+        size_t end = (sb + 1) << SUPER_SHIFT;
+        if (end > rows(idx) + 1) end = rows(idx) + 1;
+
+        for (size_t r = sb << SUPER_SHIFT; r < end; r++) {
+            if (!(r & ((1 << BLOCK_SHIFT) - 1))) {
+                uint16_t *block = idx->occ_block + (r >> BLOCK_SHIFT) * sigma;
+                for (size_t s = 0; s < sigma; s++) block[s] = counts[s];
+            }
+            if (r < rows(idx) && r != idx->primary) counts[idx->sym[idx->bwt[r]]]++;
+        }
+
+        if (sb + 1 < nsuper(idx))
+            memcpy(idx->occ_super + (sb + 1) * sigma, counts, sigma * sizeof *counts);
+    }
+}
+
+// Sampled bits of words [lo, hi)
+static void build_sampled(void *ctx, size_t lo, size_t hi) {
+    Build *b = ctx;
+    StrIndex *idx = b->idx;
+
+    for (size_t w = lo; w < hi; w++) {
+        uint64_t bits = 0;
+        for (size_t r = w * 64; r < w * 64 + 64 && r < rows(idx); r++)
+            if (b->SA[r] % STR_INDEX_SAMPLE == 0) bits |= 1ull << (r % 64);
+        idx->sampled[w] = bits;
+    }
+}
+
+// Samples of words [lo, hi)
+static void build_samples(void *ctx, size_t lo, size_t hi) {
+    Build *b = ctx;
+    StrIndex *idx = b->idx;
+
+    for (size_t w = lo; w < hi; w++) {
+        size_t k = idx->sampled_rank[w];
+        for (uint64_t bits = idx->sampled[w]; bits; bits &= bits - 1)
+            idx->samples[k++] = b->SA[w * 64 + __builtin_ctzll(bits)];
+    }
+}
+
+// Sets C, sym and sigma from the byte counts of the text
+static void count_symbols(StrIndex *idx) {
+    size_t counts[256] = {0};
+    const uint8_t *text = (const uint8_t *)idx->text.str;
+    for (size_t i = 0; i < idx->len; i++) counts[text[i]]++;
+
+    idx->sigma = 0;
+    idx->C[0] = 1;
+    for (size_t c = 0; c < 256; c++) {
+        idx->C[c + 1] = idx->C[c] + counts[c];
+        idx->sym[c] = (uint8_t)idx->sigma;
+        if (counts[c]) idx->sigma++;
+    }
+    if (!idx->sigma) idx->sigma = 1;
+}
+
+// Builds the occurrence tables from the BWT: block counts in parallel,
+// then a prefix sum over superblocks
+static void fm_build_occ(StrIndex *idx) {
+    size_t threads = idx->flags & STR_INDEX_PARALLEL ? STR_INDEX_THREADS : 1;
+    size_t sigma = idx->sigma;
+    Build b = { idx, NULL };
+
+    idx->occ_super = str_mem_alloc_with(idx->alloc, nsuper(idx) * sigma * sizeof *idx->occ_super);
+    idx->occ_block = str_mem_alloc_with(idx->alloc, nblocks(idx) * sigma * sizeof *idx->occ_block);
+    memset(idx->occ_super, 0, sigma * sizeof *idx->occ_super);
+
+    parallel_for(nsuper(idx), threads, build_occ, &b);
+
+    for (size_t sb = 1; sb < nsuper(idx); sb++)
+        for (size_t s = 0; s < sigma; s++)
+            idx->occ_super[sb * sigma + s] += idx->occ_super[(sb - 1) * sigma + s];
+}
+
+static void fm_build(StrIndex *idx, const int32_t *SA) {
+    size_t threads = idx->flags & STR_INDEX_PARALLEL ? STR_INDEX_THREADS : 1;
+    Build b = { idx, SA };
+
+    count_symbols(idx);
+
+    idx->bwt = str_mem_alloc_with(idx->alloc, rows(idx));
+    parallel_for(rows(idx), threads, build_bwt, &b);
+
+    fm_build_occ(idx);
+
+    if (!(idx->flags & STR_INDEX_DROP_SA)) return;
+
+    // Sampled suffix array
+    idx->sampled      = str_mem_alloc_with(idx->alloc, nwords(idx) * sizeof *idx->sampled);
+    idx->sampled_rank = str_mem_alloc_with(idx->alloc, nwords(idx) * sizeof *idx->sampled_rank);
+    parallel_for(nwords(idx), threads, build_sampled, &b);
+
+    size_t total = 0;
+    for (size_t w = 0; w < nwords(idx); w++) {
+        idx->sampled_rank[w] = (uint32_t)total;
+        total += __builtin_popcountll(idx->sampled[w]);
+    }
+
+    idx->nsamples = total;
+    idx->samples = str_mem_alloc_with(idx->alloc, (total ? total : 1) * sizeof *idx->samples);
+    parallel_for(nwords(idx), threads, build_samples, &b);
+}
+
+/* * * * * * * Index * * * * * * */
+
+StrIndex strindex_build(String text, StrIndexFlags flags) {
+    StrIndex idx = { .alloc = str_allocator_slot(NULL) };
+
+    if (text.len > STR_INDEX_MAX_LEN) {
+        fprintf(stderr, "Text too long passed to strindex_build\n");
+        text.len = 0;
+    }
+
+    if (!(flags & STR_INDEX_FM)) flags &= ~STR_INDEX_DROP_SA;
+
+    idx.flags = flags;
+    idx.text  = str_nref(text.str, text.len);
+    idx.len   = text.len;
+
+    // Suffix array including the end marker (which sorts first)
+    size_t n = rows(&idx);
+    int32_t *SA = str_mem_alloc_with(idx.alloc, n * sizeof *SA);
+
+    if (n == 1) {
+        SA[0] = 0;
+    } else {
+        SaisInput in = {
+            .bytes = (const uint8_t *)text.str,
+            .n     = (int32_t)n,
+            .alloc = idx.alloc,
+        };
+        sais(&in, SA, 256);
+    }
+
+    if (flags & STR_INDEX_FM) fm_build(&idx, SA);
+
+    if (flags & STR_INDEX_DROP_SA) {
+        str_mem_free_with(idx.alloc, SA, n * sizeof *SA);
+    } else {
+        memmove(SA, SA + 1, idx.len * sizeof *SA);
+        idx.sa = (uint32_t *)SA;
+    }
+
+    return idx;
+}
+
+void strindex_free(StrIndex *idx) {
+    size_t sigma = idx->sigma;
+
+    unsigned slot = idx->alloc;
+
+    str_mem_free_with(slot, idx->sa, rows(idx) * sizeof *idx->sa);
+    str_mem_free_with(slot, idx->bwt, rows(idx));
+    str_mem_free_with(slot, idx->occ_super, nsuper(idx) * sigma * sizeof *idx->occ_super);
+    str_mem_free_with(slot, idx->occ_block, nblocks(idx) * sigma * sizeof *idx->occ_block);
+    str_mem_free_with(slot, idx->sampled, nwords(idx) * sizeof *idx->sampled);
+    str_mem_free_with(slot, idx->sampled_rank, nwords(idx) * sizeof *idx->sampled_rank);
+    str_mem_free_with(slot, idx->samples,
+                      (idx->nsamples ? idx->nsamples : 1) * sizeof *idx->samples);
+
+    memset(idx, 0, sizeof *idx);
+}
+
+/* * * * * * * Queries * * * * * * */
+
+size_t strindex_count(const StrIndex *idx, String needle) {
+    // The empty string occurs at every position
+    if (!needle.len) return idx->len + 1;
+
+    size_t sp, ep;
+    bool found = idx->bwt ? fm_range(idx, needle, &sp, &ep) : sa_range(idx, needle, &sp, &ep);
+    return found ? ep - sp : 0;
+}
+
+bool strindex_exists(const StrIndex *idx, String needle) {
+    return strindex_count(idx, needle) > 0;
+}
+
+size_t strindex_locate(const StrIndex *idx, String needle, size_t *out, size_t max) {
+    if (!needle.len) {
+        for (size_t i = 0; i < max && i <= idx->len; i++) out[i] = i;
+        return idx->len + 1;
+    }
+
+    size_t sp, ep;
+
+    if (idx->bwt) {
+        if (!fm_range(idx, needle, &sp, &ep)) return 0;
+        for (size_t r = sp; r < ep && r - sp < max; r++) out[r - sp] = fm_position(idx, r);
+    } else {
+        if (!sa_range(idx, needle, &sp, &ep)) return 0;
+        for (size_t r = sp; r < ep && r - sp < max; r++) out[r - sp] = idx->sa[r];
+    }
+
+    return ep - sp;
+}
+
+/* * * * * * * Serialization * * * * * * */
+
+#define INDEX_MAGIC   "STRINDEX"
+#define INDEX_VERSION 3
+
+typedef struct {
+    char     magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t len;
+    uint64_t primary;
+    uint64_t sigma;
+    uint64_t nsamples;
+    uint64_t checksum; // of the indexed text
+    uint64_t payload;  // checksum of the arrays written after the header
+} IndexHeader;
+
+#define FNV_OFFSET 0xCBF29CE484222325ull
+
+// FNV-1a over 8-byte words, continuing from `h`
+static uint64_t checksum(uint64_t h, const void *data, size_t len) {
+    const uint8_t *p = data;
+    size_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+        h = (h ^ w) * 0x100000001B3ull;
+    }
+    for (; i < len; i++) h = (h ^ p[i]) * 0x100000001B3ull;
+
+    return h;
+}
+
+// The index is only valid for the exact same text
+static uint64_t text_checksum(String text) {
+    return checksum(FNV_OFFSET, text.str, text.len) ^ text.len;
+}
+
+// Checksum of the arrays written by strindex_save(), in the same order.
+// It is sequential and much cheaper than checking the FM-index against the text
+// (which would have to invert the BWT with a random access per text byte).
+static uint64_t payload_checksum(const StrIndex *idx) {
+    uint64_t h = FNV_OFFSET;
+
+    if (idx->sa) h = checksum(h, idx->sa, idx->len * sizeof *idx->sa);
+
+    if (idx->bwt) {
+        h = checksum(h, idx->bwt, rows(idx));
+        h = checksum(h, idx->C, sizeof idx->C);
+        h = checksum(h, idx->sym, sizeof idx->sym);
+    }
+
+    if (idx->samples) {
+        h = checksum(h, idx->sampled, nwords(idx) * sizeof *idx->sampled);
+        h = checksum(h, idx->sampled_rank, nwords(idx) * sizeof *idx->sampled_rank);
+        h = checksum(h, idx->samples, idx->nsamples * sizeof *idx->samples);
+    }
+
+    return h;
+}
+
+bool strindex_save(const StrIndex *idx, FILE *f) {
+    IndexHeader h = {
+        .magic    = INDEX_MAGIC,
+        .version  = INDEX_VERSION,
+        .flags    = idx->flags,
+        .len      = idx->len,
+        .primary  = idx->primary,
+        .sigma    = idx->sigma,
+        .nsamples = idx->nsamples,
+        .checksum = text_checksum(idx->text),
+        .payload  = payload_checksum(idx),
+    };
+
+    bool ok = fwrite(&h, sizeof h, 1, f) == 1;
+
+    if (ok && idx->sa)
+        ok = fwrite(idx->sa, sizeof *idx->sa, idx->len, f) == idx->len;
+
+    if (ok && idx->bwt) {
+        ok = fwrite(idx->bwt, 1, rows(idx), f) == rows(idx)
+          && fwrite(idx->C, sizeof idx->C, 1, f) == 1
+          && fwrite(idx->sym, sizeof idx->sym, 1, f) == 1;
+    }
+
+    if (ok && idx->samples) {
+        ok = fwrite(idx->sampled, sizeof *idx->sampled, nwords(idx), f) == nwords(idx)
+          && fwrite(idx->sampled_rank, sizeof *idx->sampled_rank, nwords(idx), f) == nwords(idx)
+          && fwrite(idx->samples, sizeof *idx->samples, idx->nsamples, f) == idx->nsamples;
+    }
+
+    return ok;
+}
+
+// Allocates an array and reads it from the file
+static bool read_array(FILE *f, unsigned slot, void **out, size_t size, size_t count,
+                       size_t alloc_count) {
+    *out = str_mem_alloc_with(slot, alloc_count * size);
+    return fread(*out, size, count, f) == count;
+}
+
+// Tells whether the header describes an index of the text, as strindex_build() makes
+static bool header_valid(const IndexHeader *h, String text) {
+    const uint32_t known = STR_INDEX_FM | STR_INDEX_DROP_SA | STR_INDEX_PARALLEL;
+
+    if (memcmp(h->magic, INDEX_MAGIC, sizeof h->magic) || h->version != INDEX_VERSION ||
+        h->len != text.len || (h->flags & ~known))
+        return false;
+
+    if (h->flags & STR_INDEX_FM) {
+        if (h->primary > h->len || h->sigma < 1 || h->sigma > 256) return false;
+    } else if ((h->flags & STR_INDEX_DROP_SA) || h->primary || h->sigma) {
+        return false;
+    }
+
+    // Every position multiple of the sample rate, end marker included, is sampled
+    uint64_t nsamples = h->flags & STR_INDEX_DROP_SA ? h->len / STR_INDEX_SAMPLE + 1 : 0;
+    if (h->nsamples != nsamples) return false;
+
+    return h->checksum == text_checksum(text);
+}
+
+// Number of bytes written by strindex_save() after the header
+static uint64_t payload_size(const StrIndex *idx) {
+    uint64_t size = 0;
+
+    if (!(idx->flags & STR_INDEX_DROP_SA)) size += idx->len * sizeof *idx->sa;
+
+    if (idx->flags & STR_INDEX_FM) {
+        size += rows(idx) + sizeof idx->C + sizeof idx->sym;
+    }
+
+    if (idx->flags & STR_INDEX_DROP_SA) {
+        size += nwords(idx) * (sizeof *idx->sampled + sizeof *idx->sampled_rank)
+              + idx->nsamples * sizeof *idx->samples;
+    }
+
+    return size;
+}
+
+// Tells whether at least `size` bytes are left in the file
+// (always true if the file is not seekable, reading fails instead)
+static bool remaining(FILE *f, uint64_t size) {
+    long pos = ftell(f);
+    if (pos < 0 || fseek(f, 0, SEEK_END)) return true;
+
+    long end = ftell(f);
+    if (fseek(f, pos, SEEK_SET)) return false;
+    return end >= pos && (uint64_t)(end - pos) >= size;
+}
+
+// Tells whether the arrays read from the file are consistent with the text
+static bool arrays_valid(const StrIndex *idx) {
+    // The suffix array has to be a permutation of the positions (its order is only
+    // covered by the payload checksum)
+    if (idx->sa) {
+        size_t words = idx->len / 64 + 1;
+        uint64_t *seen = str_mem_alloc_with(idx->alloc, words * sizeof *seen);
+        memset(seen, 0, words * sizeof *seen);
+
+        bool ok = true;
+        for (size_t i = 0; i < idx->len && ok; i++) {
+            uint32_t p = idx->sa[i];
+            ok = p < idx->len && !((seen[p / 64] >> (p % 64)) & 1);
+            if (ok) seen[p / 64] |= 1ull << (p % 64);
+        }
+
+        str_mem_free_with(idx->alloc, seen, words * sizeof *seen);
+        if (!ok) return false;
+    }
+
+    if (idx->bwt) {
+        StrIndex ref = { .text = idx->text, .len = idx->len };
+        count_symbols(&ref);
+        if (ref.sigma != idx->sigma || memcmp(ref.C, idx->C, sizeof ref.C) ||
+            memcmp(ref.sym, idx->sym, sizeof ref.sym))
+            return false;
+
+        // The BWT holds the bytes of the text, plus the end marker in the primary row,
+        // so that the LF mapping stays within the rows
+        if (idx->bwt[idx->primary]) return false;
+
+        size_t counts[256] = {0};
+        for (size_t r = 0; r < rows(idx); r++) counts[idx->bwt[r]]++;
+        counts[0]--;
+        for (size_t c = 0; c < 256; c++)
+            if (counts[c] != idx->C[c + 1] - idx->C[c]) return false;
+    }
+
+    if (idx->samples) {
+        size_t total = 0;
+        for (size_t w = 0; w < nwords(idx); w++) {
+            if (idx->sampled_rank[w] != total) return false;
+            total += __builtin_popcountll(idx->sampled[w]);
+        }
+        if (total != idx->nsamples) return false;
+    }
+
+    return true;
+}
+
+bool strindex_load(String text, FILE *f, StrIndex *out) {
+    IndexHeader h;
+    if (fread(&h, sizeof h, 1, f) != 1 || !header_valid(&h, text)) return false;
+
+    StrIndex idx = {
+        .flags    = h.flags,
+        .text     = str_nref(text.str, text.len),
+        .len      = h.len,
+        .primary  = h.primary,
+        .sigma    = h.sigma,
+        .nsamples = h.nsamples,
+        .alloc    = str_allocator_slot(NULL),
+    };
+    if (!remaining(f, payload_size(&idx))) return false;
+
+    bool ok = true;
+
+    if (!(idx.flags & STR_INDEX_DROP_SA))
+        ok = read_array(f, idx.alloc, (void **)&idx.sa, sizeof *idx.sa, idx.len, rows(&idx));
+
+    if (ok && (idx.flags & STR_INDEX_FM)) {
+        ok = read_array(f, idx.alloc, (void **)&idx.bwt, 1, rows(&idx), rows(&idx))
+          && fread(idx.C, sizeof idx.C, 1, f) == 1
+          && fread(idx.sym, sizeof idx.sym, 1, f) == 1;
+    }
+
+    if (ok && (idx.flags & STR_INDEX_DROP_SA)) {
+        size_t nsamples = idx.nsamples ? idx.nsamples : 1;
+        ok = read_array(f, idx.alloc, (void **)&idx.sampled, sizeof *idx.sampled,
+                        nwords(&idx), nwords(&idx))
+          && read_array(f, idx.alloc, (void **)&idx.sampled_rank, sizeof *idx.sampled_rank,
+                        nwords(&idx), nwords(&idx))
+          && read_array(f, idx.alloc, (void **)&idx.samples, sizeof *idx.samples,
+                        idx.nsamples, nsamples);
+    }
+
+    ok = ok && payload_checksum(&idx) == h.payload && arrays_valid(&idx);
+
+    // The occurrence tables are not saved, but rebuilt from the checked BWT
+    if (ok && idx.bwt) fm_build_occ(&idx);
+
+    if (!ok) {
+        strindex_free(&idx);
+        return false;
+    }
+
+    *out = idx;
+    return true;
+}
@@ -0,0 +1,87 @@
+#ifndef _STRINDEX_H
+#define _STRINDEX_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Flags for strindex_build()
+typedef enum {
+    // Build an FM-index, answering count and exists queries in O(needle length)
+    // instead of O(needle length * log text length)
+    STR_INDEX_FM       = 0x1,
+    // Only with STR_INDEX_FM: do not keep the suffix array (4 bytes per text byte).
+    // Locate queries walk the FM-index to sampled positions instead.
+    STR_INDEX_DROP_SA  = 0x2,
+    // Build the FM-index stages with STR_INDEX_THREADS threads
+    STR_INDEX_PARALLEL = 0x4,
+} StrIndexFlags;
+
+// Maximum length of an indexed text
+#define STR_INDEX_MAX_LEN ((size_t)INT32_MAX - 1)
+
+// Distance between the text positions sampled for locate queries (STR_INDEX_DROP_SA)
+#define STR_INDEX_SAMPLE 32
+
+// Number of threads used by STR_INDEX_PARALLEL
+#define STR_INDEX_THREADS 4
+
+// Full-text index of an immutable string
+typedef struct {
+    StrIndexFlags flags;
+    String    text;         // indexed text (by reference, has to outlive the index)
+    size_t    len;          // length of the text
+    uint32_t *sa;           // suffix array (len entries, NULL with STR_INDEX_DROP_SA)
+    // FM-index (rows are the len + 1 sorted rotations of the text + end marker)
+    uint8_t  *bwt;          // Burrows-Wheeler transform (len + 1 bytes)
+    size_t    primary;      // row of the end marker in the BWT
+    size_t    C[257];       // number of text bytes smaller than each byte + 1
+    uint8_t   sym[256];     // byte -> dense symbol in the occurrence tables
+    size_t    sigma;        // number of distinct bytes in the text
+    uint32_t *occ_super;    // symbol counts before every 65536th row [row >> 16][sigma]
+    uint16_t *occ_block;    // symbol counts before every 256th row, relative to
+                            // the enclosing superblock [row >> 8][sigma]
+    // Sampled suffix array (STR_INDEX_DROP_SA)
+    uint64_t *sampled;      // rows whose suffix starts at a multiple of STR_INDEX_SAMPLE
+    uint32_t *sampled_rank; // number of sampled rows before every 64th row
+    uint32_t *samples;      // text positions of the sampled rows
+    size_t    nsamples;
+    unsigned  alloc;        // allocator slot of the arrays
+} StrIndex;
+
+// Builds the suffix array of the text with SA-IS in O(len) time,
+// and the FM-index if requested. Texts longer than STR_INDEX_MAX_LEN are not indexed.
+// Requires strindex_free()
+StrIndex strindex_build(String text, StrIndexFlags flags);
+
+// Frees the memory allocated for the index
+void strindex_free(StrIndex *idx);
+
+// Counts the occurrences of the needle in the indexed text (overlapping ones included)
+size_t strindex_count(const StrIndex *idx, String needle);
+
+// Tells whether the needle occurs in the indexed text
+bool strindex_exists(const StrIndex *idx, String needle);
+
+// Finds the positions of all occurrences of the needle in the indexed text,
+// writing up to `max` of them (in no particular order) to `out`.
+// Returns the total number of occurrences.
+size_t strindex_locate(const StrIndex *idx, String needle, size_t *out, size_t max);
+
+// Writes the index to a file (in the byte order of the machine)
+// Returns false if writing fails
+bool strindex_save(const StrIndex *idx, FILE *f);
+
+// Reads an index written by strindex_save() for the given text.
+// Returns false if the file is invalid or was built from a different text.
+// The arrays are checked against a checksum stored in the file and with sequential
+// scans (byte counts of the BWT, the suffix array being a permutation, the sample
+// ranks), and the occurrence tables are rebuilt rather than read. The suffix order
+// is not checked: a corrupted file with a matching checksum gives wrong results.
+// Requires strindex_free() (if successful)
+bool strindex_load(String text, FILE *f, StrIndex *out);
+
+#endif // _STRINDEX_H
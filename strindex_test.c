@@ -0,0 +1,306 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strindex.h"
+
+static const StrIndexFlags VARIANTS[] = {
+    0,
+    STR_INDEX_FM,
+    STR_INDEX_FM | STR_INDEX_DROP_SA,
+    STR_INDEX_FM | STR_INDEX_DROP_SA | STR_INDEX_PARALLEL,
+};
+
+#define NVARIANTS (sizeof VARIANTS / sizeof *VARIANTS)
+
+static const uint32_t ABRACADABRA_SA[] = { 10, 7, 0, 3, 5, 8, 1, 4, 6, 9, 2 };
+
+// Counts the (overlapping) occurrences of the needle by brute force
+static size_t naive_count(String text, String needle) {
+    size_t count = 0;
+    for (size_t i = 0; i + needle.len <= text.len; i++)
+        count += !memcmp(text.str + i, needle.str, needle.len);
+    return count;
+}
+
+static int cmp_size(const void *a, const void *b) {
+    size_t x = *(const size_t *)a, y = *(const size_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Offsets of the header fields written by strindex_save()
+#define HDR_FLAGS    12
+#define HDR_PRIMARY  24
+#define HDR_SIGMA    32
+#define HDR_NSAMPLES 40
+#define HDR_PAYLOAD  56
+#define HDR_SIZE     64
+
+// Loads the first `len` bytes of a saved index, with the field at `offset` replaced
+// by `value` (if offset is not 0). The flags and the arrays have 32-bit entries.
+static bool load_modified(String text, const char *saved, size_t len,
+                          size_t offset, uint64_t value) {
+    char *bytes = malloc(len);
+    memcpy(bytes, saved, len);
+    if (offset) memcpy(bytes + offset, &value, offset == HDR_FLAGS || offset >= HDR_SIZE ? 4 : 8);
+
+    FILE *f = tmpfile();
+    fwrite(bytes, 1, len, f);
+    rewind(f);
+
+    StrIndex idx;
+    bool ok = strindex_load(text, f, &idx);
+    if (ok) strindex_free(&idx);
+
+    fclose(f);
+    free(bytes);
+    return ok;
+}
+
+// Saves the index of every variant, and loads it with each byte after the header
+// flipped in turn. Returns the number of corrupted indexes that loaded.
+static size_t check_flips(String text) {
+    size_t loaded = 0;
+
+    for (size_t v = 0; v < NVARIANTS; v++) {
+        StrIndex idx = strindex_build(text, VARIANTS[v]);
+        char *saved = NULL;
+        size_t size = 0;
+        FILE *f = open_memstream(&saved, &size);
+        strindex_save(&idx, f);
+        fclose(f);
+        strindex_free(&idx);
+
+        for (size_t i = HDR_SIZE; i < size; i++) {
+            saved[i] ^= 0x10;
+            loaded += load_modified(text, saved, size, 0, 0);
+            saved[i] ^= 0x10;
+        }
+
+        free(saved);
+    }
+
+    return loaded;
+}
+
+// Checks count, exists and locate against brute force for every variant.
+// Returns the number of mismatches.
+static size_t check_needle(StrIndex *idx, String text, String needle) {
+    size_t expected = naive_count(text, needle);
+    size_t mismatches = 0;
+
+    size_t *pos = malloc((expected + 1) * sizeof *pos);
+
+    for (size_t v = 0; v < NVARIANTS; v++) {
+        mismatches += strindex_count(&idx[v], needle) != expected;
+        mismatches += strindex_exists(&idx[v], needle) != (expected > 0);
+
+        size_t total = strindex_locate(&idx[v], needle, pos, expected);
+        mismatches += total != expected;
+
+        qsort(pos, expected, sizeof *pos, cmp_size);
+        for (size_t i = 0, last = 0; i < expected; i++) {
+            mismatches += memcmp(text.str + pos[i], needle.str, needle.len) != 0;
+            mismatches += i && pos[i] == last;
+            last = pos[i];
+        }
+    }
+
+    free(pos);
+    return mismatches;
+}
+
+// Checks random substrings and random strings of a random text over a small alphabet
+static size_t check_random(size_t len, size_t alphabet) {
+    String text = str_alloc("");
+    for (size_t i = 0; i < len; i++) str_push('a' + rand() % alphabet, &text);
+
+    StrIndex idx[NVARIANTS];
+    for (size_t v = 0; v < NVARIANTS; v++) idx[v] = strindex_build(text, VARIANTS[v]);
+
+    size_t mismatches = 0;
+    char buf[16];
+
+    for (size_t k = 0; k < 200; k++) {
+        size_t n = 1 + rand() % 8;
+
+        if (len >= n) {
+            size_t start = rand() % (len - n + 1);
+            mismatches += check_needle(idx, text, str_slice_ref(text, start, n));
+        }
+
+        for (size_t i = 0; i < n; i++) buf[i] = 'a' + rand() % (alphabet + 1);
+        mismatches += check_needle(idx, text, str_nref(buf, n));
+    }
+
+    for (size_t v = 0; v < NVARIANTS; v++) strindex_free(&idx[v]);
+    str_free(&text);
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    String text = str_ref("abracadabra");
+
+    test("strindex_build", {
+        StrIndex idx = strindex_build(text, 0);
+
+        assert_eq(0, memcmp(ABRACADABRA_SA, idx.sa, sizeof ABRACADABRA_SA), "%d");
+
+        strindex_free(&idx);
+
+        idx = strindex_build(text, STR_INDEX_FM);
+        assert_eq(0, memcmp("ard\0rcaaaabb", idx.bwt, 12), "%d");
+        assert_eq((size_t)3, idx.primary, "%zu");
+        assert_eq((size_t)5, idx.sigma, "%zu");
+        strindex_free(&idx);
+    });
+
+    test("strindex_count", {
+        for (size_t v = 0; v < NVARIANTS; v++) {
+            StrIndex idx = strindex_build(text, VARIANTS[v]);
+
+            assert_eq((size_t)2,  strindex_count(&idx, str_ref("abra")), "%zu");
+            assert_eq((size_t)5,  strindex_count(&idx, str_ref("a")), "%zu");
+            assert_eq((size_t)1,  strindex_count(&idx, text), "%zu");
+            assert_eq((size_t)0,  strindex_count(&idx, str_ref("abracadabraa")), "%zu");
+            assert_eq((size_t)0,  strindex_count(&idx, str_ref("z")), "%zu");
+            assert_eq((size_t)12, strindex_count(&idx, str_ref("")), "%zu");
+            assert_eq(true,  strindex_exists(&idx, str_ref("cad")), "%d");
+            assert_eq(false, strindex_exists(&idx, str_ref("cab")), "%d");
+
+            strindex_free(&idx);
+        }
+
+        StrIndex empty = strindex_build(str_ref(""), STR_INDEX_FM | STR_INDEX_DROP_SA);
+        assert_eq((size_t)0, strindex_count(&empty, str_ref("a")), "%zu");
+        assert_eq((size_t)1, strindex_count(&empty, str_ref("")), "%zu");
+        strindex_free(&empty);
+    });
+
+    test("strindex_locate", {
+        size_t pos[4] = {0};
+
+        for (size_t v = 0; v < NVARIANTS; v++) {
+            StrIndex idx = strindex_build(text, VARIANTS[v]);
+
+            assert_eq((size_t)2, strindex_locate(&idx, str_ref("abra"), pos, 4), "%zu");
+            qsort(pos, 2, sizeof *pos, cmp_size);
+            assert_eq((size_t)0, pos[0], "%zu");
+            assert_eq((size_t)7, pos[1], "%zu");
+
+            // Only `max` positions are written
+            assert_eq((size_t)5, strindex_locate(&idx, str_ref("a"), pos, 1), "%zu");
+
+            strindex_free(&idx);
+        }
+    });
+
+    test("strindex random", {
+        assert_eq((size_t)0, check_random(1, 2), "%zu");
+        assert_eq((size_t)0, check_random(100, 2), "%zu");
+        assert_eq((size_t)0, check_random(1000, 4), "%zu");
+        assert_eq((size_t)0, check_random(70000, 3), "%zu");
+        assert_eq((size_t)0, check_random(5000, 26), "%zu");
+    });
+
+    test("strindex binary", {
+        String bin = str_alloc("");
+        for (size_t i = 0; i < 3000; i++) str_push((char)(rand() % 4 * 85), &bin);
+
+        StrIndex idx = strindex_build(bin, STR_INDEX_FM | STR_INDEX_DROP_SA);
+        String zeros = str_nref("\0\0", 2);
+        String mixed = str_nref("\0\xff\0", 3);
+
+        assert_eq(naive_count(bin, zeros), strindex_count(&idx, zeros), "%zu");
+        assert_eq(naive_count(bin, mixed), strindex_count(&idx, mixed), "%zu");
+        strindex_free(&idx);
+
+        str_free(&bin);
+    });
+
+    test("strindex_save", {
+        for (size_t v = 0; v < NVARIANTS; v++) {
+            StrIndex idx = strindex_build(text, VARIANTS[v]);
+
+            FILE *f = tmpfile();
+            assert_eq(true, strindex_save(&idx, f), "%d");
+            strindex_free(&idx);
+
+            rewind(f);
+            assert_eq(true, strindex_load(text, f, &idx), "%d");
+            assert_eq((size_t)2, strindex_count(&idx, str_ref("abra")), "%zu");
+
+            size_t pos = 0;
+            strindex_locate(&idx, str_ref("cad"), &pos, 1);
+            assert_eq((size_t)4, pos, "%zu");
+            strindex_free(&idx);
+
+            // A different text is rejected
+            rewind(f);
+            assert_eq(false, strindex_load(str_ref("abracadabrb"), f, &idx), "%d");
+
+            fclose(f);
+        }
+    });
+
+    test("strindex_locate (corrupted samples)", {
+        String long_text = str_alloc("");
+        for (size_t i = 0; i < 1000; i++) str_push('a' + i * 7 % 5, &long_text);
+
+        // Without sampled rows, the walk stops instead of cycling through the rows
+        StrIndex idx = strindex_build(long_text, STR_INDEX_FM | STR_INDEX_DROP_SA);
+        memset(idx.sampled, 0, (idx.len / 64 + 1) * sizeof *idx.sampled);
+
+        size_t pos[4];
+        assert_eq((size_t)200, strindex_locate(&idx, str_ref("ac"), pos, 4), "%zu");
+        for (size_t i = 0; i < 4; i++) assert(pos[i] <= idx.len);
+
+        strindex_free(&idx);
+        str_free(&long_text);
+    });
+
+    test("strindex_load (flipped bytes)", {
+        assert_eq((size_t)0, check_flips(str_ref("mississippi river, mississippi delta")), "%zu");
+    });
+
+    test("strindex_load (corrupted)", {
+        for (size_t v = 0; v < NVARIANTS; v++) {
+            StrIndex idx = strindex_build(text, VARIANTS[v]);
+            char *saved = NULL;
+            size_t size = 0;
+            FILE *f = open_memstream(&saved, &size);
+            strindex_save(&idx, f);
+            fclose(f);
+            bool fm = VARIANTS[v] & STR_INDEX_FM;
+
+            assert_eq(true, load_modified(text, saved, size, 0, 0), "%d");
+
+            // Truncated
+            assert_eq(false, load_modified(text, saved, size - 1, 0, 0), "%d");
+            assert_eq(false, load_modified(text, saved, HDR_SIZE, 0, 0), "%d");
+            assert_eq(false, load_modified(text, saved, HDR_SIZE - 1, 0, 0), "%d");
+
+            // Header fields out of range
+            assert_eq(false, load_modified(text, saved, size, HDR_FLAGS, 0x80 | VARIANTS[v]), "%d");
+            assert_eq(false, load_modified(text, saved, size, HDR_PRIMARY, idx.len + 1), "%d");
+            assert_eq(false, load_modified(text, saved, size, HDR_SIGMA, fm ? 257 : 1), "%d");
+            assert_eq(false, load_modified(text, saved, size, HDR_NSAMPLES, idx.nsamples + 1), "%d");
+
+            // Position past the end of the text, in the suffix array or the last sample
+            size_t pos = VARIANTS[v] & STR_INDEX_DROP_SA ? size - 4 : HDR_SIZE;
+            assert_eq(false, load_modified(text, saved, size, pos, 1000), "%d");
+
+            // Checksum of the arrays
+            assert_eq(false, load_modified(text, saved, size, HDR_PAYLOAD, 0), "%d");
+
+            strindex_free(&idx);
+            free(saved);
+        }
+    });
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "strlines.h"
+
+#include <string.h>
+#include <stdint.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* * * * * * * Private Utilities * * * * * * */
+
+static void push_newline(StrLineIndex *idx, size_t offset) {
+    if (idx->count == idx->cap) {
+        size_t cap = idx->cap ? idx->cap * 2 : 64;
+        idx->nl  = str_mem_realloc_with(idx->alloc, idx->nl, idx->cap * sizeof *idx->nl,
+                                        cap * sizeof *idx->nl);
+        idx->cap = cap;
+    }
+
+    idx->nl[idx->count++] = offset;
+}
+
+// Records the offsets of the set bits of a mask of 64 bytes starting at `base`
+static void push_mask(StrLineIndex *idx, uint64_t mask, size_t base) {
+    while (mask) {
+        push_newline(idx, base + __builtin_ctzll(mask));
+        mask &= mask - 1;
+    }
+}
+
+// Finds the '\n' bytes in str[from..]
+static void scan(StrLineIndex *idx, String str, size_t from) {
+    size_t i = from;
+
+#ifdef __SSE2__
+    // Compare 64 bytes at a time and collect the results into a bit mask
+    const __m128i nl = _mm_set1_epi8('\n');
+
+    for (; i + 64 <= str.len; i += 64) {
+        const __m128i *p = (const __m128i *)(str.str + i);
+
+        uint64_t m0 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p + 0), nl));
+        uint64_t m1 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p + 1), nl));
+        uint64_t m2 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p + 2), nl));
+        uint64_t m3 = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(p + 3), nl));
+
+        push_mask(idx, m0 | m1 << 16 | m2 << 32 | m3 << 48, i);
+    }
+#endif
+
+    for (const char *c; i < str.len; i = c - str.str + 1) {
+        c = memchr(str.str + i, '\n', str.len - i);
+        if (!c) break;
+        push_newline(idx, c - str.str);
+    }
+
+    idx->scanned = str.len;
+}
+
+/* * * * * * * Line index * * * * * * */
+
+StrLineIndex strlines_build(String str) {
+    StrLineIndex idx = { .alloc = str_allocator_slot(NULL) };
+    scan(&idx, str, 0);
+    return idx;
+}
+
+void strlines_update(StrLineIndex *idx, String str) {
+    if (str.len > idx->scanned) scan(idx, str, idx->scanned);
+}
+
+void strlines_free(StrLineIndex *idx) {
+    str_mem_free_with(idx->alloc, idx->nl, idx->cap * sizeof *idx->nl);
+    memset(idx, 0, sizeof *idx);
+}
+
+size_t strlines_count(const StrLineIndex *idx) {
+    size_t end = idx->count ? idx->nl[idx->count - 1] + 1 : 0;
+    return idx->count + (idx->scanned > end);
+}
+
+String strlines_get(const StrLineIndex *idx, String str, size_t line) {
+    if (line >= strlines_count(idx)) return str_nref(str.str, 0);
+
+    size_t start = line ? idx->nl[line - 1] + 1 : 0;
+    size_t end   = line < idx->count ? idx->nl[line] : idx->scanned;
+
+    if (end > start && str.str[end - 1] == '\r') end--;
+
+    return str_nref(str.str + start, end - start);
+}
+
+size_t strlines_find(const StrLineIndex *idx, size_t offset) {
+    // First newline at or after the offset
+    size_t lo = 0, hi = idx->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (idx->nl[mid] < offset) lo = mid + 1;
+        else hi = mid;
+    }
+
+    size_t lines = strlines_count(idx);
+    return lo < lines ? lo : (lines ? lines - 1 : 0);
+}
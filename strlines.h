@@ -0,0 +1,43 @@
+#ifndef _STRLINES_H
+#define _STRLINES_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Index of the line breaks of a string buffer
+// Lines are terminated by "\n" or "\r\n" (the terminator is not part of the line).
+// A non-empty remainder after the last line break counts as a line.
+typedef struct {
+    size_t *nl;      // offsets of the '\n' bytes
+    size_t  count;   // number of '\n' bytes
+    size_t  cap;
+    size_t  scanned; // number of bytes of the buffer indexed so far
+    unsigned alloc;  // allocator slot of `nl`
+} StrLineIndex;
+
+// Indexes the line breaks of the given string in a single (vectorized) pass.
+// Requires strlines_free()
+StrLineIndex strlines_build(String str);
+
+// Indexes the bytes appended to the string since the last build or update.
+// The already indexed part of the string must not have changed.
+void strlines_update(StrLineIndex *idx, String str);
+
+// Frees the memory allocated for the index
+void strlines_free(StrLineIndex *idx);
+
+// Returns the number of lines in the indexed string
+size_t strlines_count(const StrLineIndex *idx);
+
+// Returns the 0-based line `line` of the indexed string (by reference),
+// without the line terminator. Returns an empty string if out of bounds.
+String strlines_get(const StrLineIndex *idx, String str, size_t line);
+
+// Returns the 0-based number of the line containing the given byte offset,
+// in O(log lines). Line terminators belong to the line they terminate.
+// Offsets past the end map to the last line.
+size_t strlines_find(const StrLineIndex *idx, size_t offset);
+
+#endif // _STRLINES_H
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strlines.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+int main() {
+    String text = str_ref("first\r\nsecond\n\nfourth");
+
+    test("strlines_build", {
+        StrLineIndex idx = strlines_build(text);
+
+        assert_eq((size_t)4, strlines_count(&idx), "%zu");
+        assert_string_eq(str_ref("first"),  strlines_get(&idx, text, 0));
+        assert_string_eq(str_ref("second"), strlines_get(&idx, text, 1));
+        assert_string_eq(str_ref(""),       strlines_get(&idx, text, 2));
+        assert_string_eq(str_ref("fourth"), strlines_get(&idx, text, 3));
+        assert_string_eq(str_ref(""),       strlines_get(&idx, text, 4));
+
+        strlines_free(&idx);
+
+        idx = strlines_build(str_ref(""));
+        assert_eq((size_t)0, strlines_count(&idx), "%zu");
+        strlines_free(&idx);
+
+        idx = strlines_build(str_ref("a\n"));
+        assert_eq((size_t)1, strlines_count(&idx), "%zu");
+        strlines_free(&idx);
+    });
+
+    test("strlines_find", {
+        StrLineIndex idx = strlines_build(text);
+
+        assert_eq((size_t)0, strlines_find(&idx, 0), "%zu");
+        assert_eq((size_t)0, strlines_find(&idx, 6), "%zu");  // '\n' of "first\r\n"
+        assert_eq((size_t)1, strlines_find(&idx, 7), "%zu");
+        assert_eq((size_t)2, strlines_find(&idx, 14), "%zu");
+        assert_eq((size_t)3, strlines_find(&idx, 15), "%zu");
+        assert_eq((size_t)3, strlines_find(&idx, 100), "%zu");
+
+        strlines_free(&idx);
+    });
+
+    test("strlines_update", {
+        String log = str_alloc("one\ntw");
+        StrLineIndex idx = strlines_build(log);
+        assert_eq((size_t)2, strlines_count(&idx), "%zu");
+
+        str_pushs(str_ref("o\r"), &log);
+        strlines_update(&idx, log);
+        assert_string_eq(str_ref("two"), strlines_get(&idx, log, 1));
+
+        str_pushs(str_ref("\nthree\n"), &log);
+        strlines_update(&idx, log);
+        assert_eq((size_t)3, strlines_count(&idx), "%zu");
+        assert_string_eq(str_ref("two"),   strlines_get(&idx, log, 1));
+        assert_string_eq(str_ref("three"), strlines_get(&idx, log, 2));
+
+        strlines_free(&idx);
+        str_free(&log);
+    });
+
+    test("strlines (large)", {
+        // Exercise the vectorized scan and compare with str_split
+        String big = str_alloc("");
+        for (int i = 0; i < 1000; i++) {
+            for (int j = 0; j < i % 97; j++) str_push('x', &big);
+            str_pushs(str_ref(i % 3 ? "\n" : "\r\n"), &big);
+        }
+
+        StrLineIndex idx = strlines_build(big);
+        assert_eq((size_t)1000, strlines_count(&idx), "%zu");
+
+        String line = {0};
+        size_t i = 0;
+        bool ok = true;
+        while (str_split(big, str_ref("\n"), &line) && i < 1000) {
+            String expected = line;
+            if (expected.len && expected.str[expected.len - 1] == '\r') expected.len--;
+            ok = ok && str_eq(expected, strlines_get(&idx, big, i));
+            ok = ok && strlines_find(&idx, line.str - big.str) == i;
+            i++;
+        }
+        assert(ok);
+
+        strlines_free(&idx);
+        str_free(&big);
+    });
+}
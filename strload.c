@@ -0,0 +1,518 @@
+#define _GNU_SOURCE
+#include "strload.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#endif
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Creates the string a file of the given size is read into
+static String load_buf(const StrAllocator *alloc, size_t size) {
+    String str = str_nalloc_with(alloc, "", 0);
+    str_reserve(size + 1, &str);
+    return str;
+}
+
+// Publishes the result of loading a file
+static void load_finish(StrLoadResult *out, size_t *done, size_t index, int error, String str) {
+    if (error) {
+        str_free(&str);
+        str = str_nref("", 0);
+    }
+
+    out[(*done)++] = (StrLoadResult){ .index = index, .error = error, .str = str };
+}
+
+/* * * * * * * io_uring * * * * * * */
+
+#if defined(__linux__) && defined(__NR_io_uring_setup)
+
+#define URING_ENTRIES (STR_LOAD_DEPTH * 2)
+
+typedef struct {
+    int       fd;
+    unsigned  sq_mask;
+    unsigned  cq_mask;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned  tail;      // local SQ tail (published on submit)
+    unsigned  queued;    // SQEs not yet submitted
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void     *sq_ring;
+    void     *cq_ring;
+    size_t    sq_ring_sz;
+    size_t    cq_ring_sz;
+    size_t    sqes_sz;
+} Ring;
+
+static void ring_free(Ring *r) {
+    if (r->sqes) munmap(r->sqes, r->sqes_sz);
+    if (r->cq_ring && r->cq_ring != r->sq_ring) munmap(r->cq_ring, r->cq_ring_sz);
+    if (r->sq_ring) munmap(r->sq_ring, r->sq_ring_sz);
+    if (r->fd >= 0) close(r->fd);
+}
+
+// Tells whether the kernel supports all the operations used by the loader
+static bool ring_probe(Ring *r) {
+    static const uint8_t OPS[] = {
+        IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_CLOSE,
+    };
+
+    size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    unsigned slot = str_allocator_slot(NULL);
+    struct io_uring_probe *probe = str_mem_alloc_with(slot, size);
+    memset(probe, 0, size);
+
+    bool ok = syscall(__NR_io_uring_register, r->fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+    for (size_t i = 0; ok && i < sizeof OPS; i++)
+        ok = OPS[i] <= probe->last_op && (probe->ops[OPS[i]].flags & IO_URING_OP_SUPPORTED);
+
+    str_mem_free_with(slot, probe, size);
+    return ok;
+}
+
+static bool ring_init(Ring *r) {
+    memset(r, 0, sizeof *r);
+
+    struct io_uring_params p = {0};
+    r->fd = syscall(__NR_io_uring_setup, URING_ENTRIES, &p);
+    if (r->fd < 0) return false;
+
+    r->sq_ring_sz = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    r->cq_ring_sz = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (r->cq_ring_sz > r->sq_ring_sz) r->sq_ring_sz = r->cq_ring_sz;
+        r->cq_ring_sz = r->sq_ring_sz;
+    }
+
+    r->sq_ring = mmap(NULL, r->sq_ring_sz, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+    if (r->sq_ring == MAP_FAILED) { r->sq_ring = NULL; goto fail; }
+
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        r->cq_ring = r->sq_ring;
+    } else {
+        r->cq_ring = mmap(NULL, r->cq_ring_sz, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+        if (r->cq_ring == MAP_FAILED) { r->cq_ring = NULL; goto fail; }
+    }
+
+    r->sqes_sz = p.sq_entries * sizeof(struct io_uring_sqe);
+    r->sqes = mmap(NULL, r->sqes_sz, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+    if (r->sqes == MAP_FAILED) { r->sqes = NULL; goto fail; }
+
+    char *sq = r->sq_ring, *cq = r->cq_ring;
+    r->sq_head = (unsigned *)(sq + p.sq_off.head);
+    r->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+    r->sq_mask = *(unsigned *)(sq + p.sq_off.ring_mask);
+    r->cq_head = (unsigned *)(cq + p.cq_off.head);
+    r->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+    r->cq_mask = *(unsigned *)(cq + p.cq_off.ring_mask);
+    r->cqes    = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+    r->tail    = *r->sq_tail;
+
+    // SQE i always sits in slot i of the submission array
+    unsigned *array = (unsigned *)(sq + p.sq_off.array);
+    for (unsigned i = 0; i < p.sq_entries; i++) array[i] = i;
+
+    if (!ring_probe(r)) goto fail;
+    return true;
+
+fail:
+    ring_free(r);
+    return false;
+}
+
+// Returns a zeroed submission queue entry.
+// The loader never has more operations in flight than the ring has entries.
+static struct io_uring_sqe *ring_sqe(Ring *r, uint8_t op, uint64_t user_data) {
+    struct io_uring_sqe *sqe = &r->sqes[r->tail++ & r->sq_mask];
+    memset(sqe, 0, sizeof *sqe);
+    sqe->opcode    = op;
+    sqe->user_data = user_data;
+    r->queued++;
+    return sqe;
+}
+
+// Submits the queued entries and waits for at least one completion.
+// Returns 0 or a negative errno value.
+static int ring_submit_wait(Ring *r) {
+    __atomic_store_n(r->sq_tail, r->tail, __ATOMIC_RELEASE);
+
+    int ret;
+    do {
+        ret = syscall(__NR_io_uring_enter, r->fd, r->queued, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+    } while (ret < 0 && errno == EINTR);
+
+    if (ret >= 0) r->queued -= ret;
+    return ret < 0 ? -errno : 0;
+}
+
+// Tells whether ring_submit_wait() failed only for lack of resources or room in the
+// completion queue, and can be called again once the posted completions are reaped
+static bool ring_busy(int err) {
+    return err == -EAGAIN || err == -EBUSY;
+}
+
+// State of a file being loaded
+typedef struct {
+    size_t      index;
+    int         fd;
+    int         pending; // number of operations in flight
+    int         error;
+    bool        closing;
+    struct statx stx;
+    String      str;
+} Slot;
+
+// Operations encoded into the low bits of the user data
+enum { OP_OPEN, OP_STATX, OP_READ, OP_CLOSE };
+
+#define USER_DATA(slot, op) ((uint64_t)(slot) << 2 | (op))
+
+static void slot_start(Ring *r, Slot *slots, size_t s, size_t index, const char *path) {
+    Slot *f = &slots[s];
+    memset(f, 0, sizeof *f);
+    f->index   = index;
+    f->fd      = -1;
+    f->pending = 2;
+
+    struct io_uring_sqe *sqe = ring_sqe(r, IORING_OP_OPENAT, USER_DATA(s, OP_OPEN));
+    sqe->fd         = AT_FDCWD;
+    sqe->addr       = (uintptr_t)path;
+    sqe->open_flags = O_RDONLY | O_CLOEXEC;
+
+    sqe = ring_sqe(r, IORING_OP_STATX, USER_DATA(s, OP_STATX));
+    sqe->fd    = AT_FDCWD;
+    sqe->addr  = (uintptr_t)path;
+    sqe->len   = STATX_SIZE;
+    sqe->addr2 = (uintptr_t)&f->stx;
+}
+
+static void slot_read(Ring *r, Slot *slots, size_t s) {
+    Slot *f = &slots[s];
+    f->pending = 1;
+
+    struct io_uring_sqe *sqe = ring_sqe(r, IORING_OP_READ, USER_DATA(s, OP_READ));
+    sqe->fd   = f->fd;
+    sqe->addr = (uintptr_t)(f->str.str + f->str.len);
+    sqe->len  = f->str.bufsz - f->str.len;
+    sqe->off  = f->str.len;
+}
+
+static void slot_close(Ring *r, Slot *slots, size_t s) {
+    Slot *f = &slots[s];
+    f->pending = 1;
+    f->closing = true;
+
+    struct io_uring_sqe *sqe = ring_sqe(r, IORING_OP_CLOSE, USER_DATA(s, OP_CLOSE));
+    sqe->fd = f->fd;
+}
+
+// Handles a completion. Returns true if the file of the slot is done.
+static bool slot_complete(const StrAllocator *alloc, Ring *r, Slot *slots, size_t s,
+                          unsigned op, int res) {
+    Slot *f = &slots[s];
+    f->pending--;
+
+    switch (op) {
+    case OP_OPEN:
+        if (res < 0) f->error = -res;
+        else f->fd = res;
+        break;
+
+    case OP_STATX:
+        if (res < 0 && !f->error) f->error = -res;
+        break;
+
+    case OP_READ:
+        if (res < 0) {
+            f->error = -res;
+            break;
+        }
+
+        f->str.len += res;
+
+        // Files reporting a size (unlike e.g. procfs) are read up to that size
+        size_t size = f->stx.stx_size;
+        if (res == 0 || (size && f->str.len >= size)) break;
+
+        if (f->str.len == f->str.bufsz) str_reserve(f->str.bufsz * 2, &f->str);
+        slot_read(r, slots, s);
+        return false;
+
+    case OP_CLOSE:
+        return true;
+    }
+
+    if (f->pending) return false;
+
+    if (f->error || op == OP_READ) {
+        if (f->fd < 0) return true;
+        slot_close(r, slots, s);
+        return false;
+    }
+
+    // Opened and stat-ed: start reading
+    f->str = load_buf(alloc, f->stx.stx_size);
+    slot_read(r, slots, s);
+    return false;
+}
+
+// Waits for the operations in flight to complete without starting new ones, so that
+// the kernel no longer writes to the slots and their buffers.
+// Returns false if the ring cannot be waited on anymore.
+static bool ring_drain(Ring *r, Slot *slots) {
+    for (;;) {
+        bool pending = false;
+        for (size_t s = 0; s < STR_LOAD_DEPTH; s++) pending |= slots[s].pending > 0;
+        if (!pending) return true;
+
+        int err = ring_submit_wait(r);
+        if (err && !ring_busy(err)) return false;
+
+        unsigned head = *r->cq_head;
+        unsigned tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail; head++) {
+            struct io_uring_cqe *cqe = &r->cqes[head & r->cq_mask];
+            Slot *f = &slots[cqe->user_data >> 2];
+            unsigned op = cqe->user_data & 3;
+
+            f->pending--;
+            if (op == OP_OPEN && cqe->res >= 0) f->fd = cqe->res;
+            if (op == OP_CLOSE) f->fd = -1;
+        }
+
+        __atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+    }
+}
+
+// Loads the files through io_uring.
+// Returns false if io_uring is unavailable or breaks down, leaving the files it did
+// not finish (all of them if it is unavailable) to the caller.
+static bool load_uring(const StrAllocator *alloc, const char *const *paths, size_t n,
+                       StrLoadResult *out, size_t *done) {
+    Ring r;
+    if (!ring_init(&r)) return false;
+
+    // On the heap, to be leaked rather than freed if the kernel may still write to them
+    unsigned slots_alloc = str_allocator_slot(NULL);
+    Slot *slots = str_mem_alloc_with(slots_alloc, STR_LOAD_DEPTH * sizeof *slots);
+    memset(slots, 0, STR_LOAD_DEPTH * sizeof *slots);
+    size_t next = 0, active = 0;
+
+    for (size_t s = 0; s < STR_LOAD_DEPTH && next < n; s++, next++, active++)
+        slot_start(&r, slots, s, next, paths[next]);
+
+    while (active) {
+        int err = ring_submit_wait(&r);
+        if (err && !ring_busy(err)) {
+            // The ring broke down: wait for the operations in flight before releasing
+            // the files and buffers of the slots
+            if (!ring_drain(&r, slots)) {
+                // The kernel may still write to the slots and buffers: leak them
+                ring_free(&r);
+                return false;
+            }
+
+            ring_free(&r);
+            for (size_t s = 0; s < STR_LOAD_DEPTH; s++) {
+                if (slots[s].fd >= 0 && !slots[s].closing) close(slots[s].fd);
+                str_free(&slots[s].str);
+            }
+            str_mem_free_with(slots_alloc, slots, STR_LOAD_DEPTH * sizeof *slots);
+            return false;
+        }
+
+        unsigned head = *r.cq_head;
+        unsigned tail = __atomic_load_n(r.cq_tail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail; head++) {
+            struct io_uring_cqe *cqe = &r.cqes[head & r.cq_mask];
+            size_t s = cqe->user_data >> 2;
+
+            if (!slot_complete(alloc, &r, slots, s, cqe->user_data & 3, cqe->res)) continue;
+
+            // The buffer now belongs to the result
+            load_finish(out, done, slots[s].index, slots[s].error, slots[s].str);
+            slots[s] = (Slot){ .fd = -1 };
+
+            if (next < n) {
+                slot_start(&r, slots, s, next, paths[next]);
+                next++;
+            } else active--;
+        }
+
+        __atomic_store_n(r.cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    ring_free(&r);
+    str_mem_free_with(slots_alloc, slots, STR_LOAD_DEPTH * sizeof *slots);
+    return true;
+}
+
+#else
+
+static bool load_uring(const StrAllocator *alloc, const char *const *paths, size_t n,
+                       StrLoadResult *out, size_t *done) {
+    return false;
+}
+
+#endif
+
+/* * * * * * * pread() thread pool * * * * * * */
+
+typedef struct {
+    const StrAllocator *alloc;
+    const char *const  *paths;
+    const size_t       *indices; // indices of the files to load (NULL for all)
+    size_t              n;       // number of files to load
+    size_t              next;    // next file to load (atomic)
+    StrLoadResult      *out;
+    size_t             *done;
+    pthread_mutex_t     lock; // guards the allocator and the results
+} Pool;
+
+static int load_pread(Pool *pool, const char *path, String *str) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return errno;
+
+    int error = 0;
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        error = errno;
+        goto done;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    *str = load_buf(pool->alloc, st.st_size);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (;;) {
+        ssize_t res = pread(fd, str->str + str->len, str->bufsz - str->len, str->len);
+        if (res < 0) {
+            if (errno == EINTR) continue;
+            error = errno;
+            break;
+        }
+
+        str->len += res;
+        if (res == 0 || (st.st_size && str->len >= (size_t)st.st_size)) break;
+
+        if (str->len == str->bufsz) {
+            pthread_mutex_lock(&pool->lock);
+            str_reserve(str->bufsz * 2, str);
+            pthread_mutex_unlock(&pool->lock);
+        }
+    }
+
+done:
+    close(fd);
+    return error;
+}
+
+static void *pool_worker(void *arg) {
+    Pool *pool = arg;
+
+    for (;;) {
+        size_t i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED);
+        if (i >= pool->n) break;
+
+        if (pool->indices) i = pool->indices[i];
+
+        String str = str_nref("", 0);
+        int error = load_pread(pool, pool->paths[i], &str);
+
+        pthread_mutex_lock(&pool->lock);
+        load_finish(pool->out, pool->done, i, error, str);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    return NULL;
+}
+
+static void load_pool(const StrAllocator *alloc, const char *const *paths,
+                      const size_t *indices, size_t n, StrLoadResult *out, size_t *done) {
+    Pool pool = {
+        .alloc   = alloc,
+        .paths   = paths,
+        .indices = indices,
+        .n       = n,
+        .out     = out,
+        .done    = done,
+    };
+    pthread_mutex_init(&pool.lock, NULL);
+
+    // The calling thread works too
+    pthread_t threads[STR_LOAD_THREADS - 1];
+    size_t nthreads = 0;
+    while (nthreads < STR_LOAD_THREADS - 1 && nthreads + 1 < n &&
+           !pthread_create(&threads[nthreads], NULL, pool_worker, &pool))
+        nthreads++;
+
+    pool_worker(&pool);
+
+    for (size_t t = 0; t < nthreads; t++) pthread_join(threads[t], NULL);
+    pthread_mutex_destroy(&pool.lock);
+}
+
+/* * * * * * * Loading * * * * * * */
+
+// Loads the files without a result yet with the thread pool (after io_uring failed)
+static void load_rest(const StrAllocator *alloc, const char *const *paths, size_t n,
+                      StrLoadResult *out, size_t *done) {
+    if (!*done) {
+        load_pool(alloc, paths, NULL, n, out, done);
+        return;
+    }
+
+    unsigned slot = str_allocator_slot(NULL);
+    bool *loaded = str_mem_alloc_with(slot, n * sizeof *loaded);
+    memset(loaded, 0, n * sizeof *loaded);
+    for (size_t k = 0; k < *done; k++) loaded[out[k].index] = true;
+
+    size_t nrest = n - *done;
+    size_t *rest = str_mem_alloc_with(slot, nrest * sizeof *rest);
+    for (size_t i = 0, k = 0; i < n; i++)
+        if (!loaded[i]) rest[k++] = i;
+
+    load_pool(alloc, paths, rest, nrest, out, done);
+    str_mem_free_with(slot, rest, nrest * sizeof *rest);
+    str_mem_free_with(slot, loaded, n * sizeof *loaded);
+}
+
+inline size_t str_load_files(const char *const *paths, size_t n,
+                             StrLoadResult *out, StrLoadFlags flags) {
+    return str_load_files_with(NULL, paths, n, out, flags);
+}
+
+size_t str_load_files_with(const StrAllocator *alloc, const char *const *paths, size_t n,
+                           StrLoadResult *out, StrLoadFlags flags) {
+    size_t done = 0;
+
+    if (n == 0) return 0;
+
+    if ((flags & STR_LOAD_NO_URING) || !load_uring(alloc, paths, n, out, &done))
+        load_rest(alloc, paths, n, out, &done);
+
+    size_t loaded = 0;
+    for (size_t i = 0; i < n; i++) loaded += !out[i].error;
+    return loaded;
+}
@@ -0,0 +1,41 @@
+#ifndef _STRLOAD_H
+#define _STRLOAD_H
+
+#include <stddef.h>
+
+#include "strutils.h"
+
+// Result of loading a single file with str_load_files()
+typedef struct {
+    size_t index; // position of the file in the `paths` array
+    int    error; // 0 on success, errno value otherwise
+    String str;   // contents of the file (heap-allocated, empty on error)
+} StrLoadResult;
+
+// Flags for str_load_files()
+typedef enum {
+    // Never use io_uring, always load with the pread() thread pool
+    STR_LOAD_NO_URING = 0x1,
+} StrLoadFlags;
+
+// Maximum number of files loaded concurrently by str_load_files()
+#define STR_LOAD_DEPTH 32
+
+// Maximum number of threads used by the pread() fallback
+#define STR_LOAD_THREADS 8
+
+// Loads the entire contents of `n` files into new heap-allocated strings.
+// The opens, stats and reads are submitted through io_uring (if the kernel supports
+// it), otherwise the files are loaded by a pool of threads using pread().
+// Writes one result per file to `out` in completion order and returns the number
+// of files loaded successfully. Every result string requires str_free().
+size_t str_load_files(const char *const *paths, size_t n,
+                      StrLoadResult *out, StrLoadFlags flags);
+
+// Same as str_load_files(), but allocates with the given allocator (NULL for the
+// global one), e.g. an arena that is discarded with the whole batch.
+// The allocator is called from a single thread at a time.
+size_t str_load_files_with(const StrAllocator *alloc, const char *const *paths, size_t n,
+                           StrLoadResult *out, StrLoadFlags flags);
+
+#endif // _STRLOAD_H
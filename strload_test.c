@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strload.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+#define NFILES 100
+
+static char dir[] = "/tmp/strload_testXXXXXX";
+static char paths[NFILES + 2][64];
+static const char *path_ptrs[NFILES + 2];
+static String contents[NFILES];
+
+static void make_files(void) {
+    mkdtemp(dir);
+
+    for (int i = 0; i < NFILES; i++) {
+        snprintf(paths[i], sizeof paths[i], "%s/%d.txt", dir, i);
+
+        // Sizes from empty up to a few pages
+        String str = str_alloc("");
+        for (int j = 0; j < i * i; j++) str_push('a' + (i + j) % 26, &str);
+        contents[i] = str;
+
+        FILE *f = fopen(paths[i], "wb");
+        fwrite(str.str, 1, str.len, f);
+        fclose(f);
+    }
+
+    snprintf(paths[NFILES], sizeof paths[NFILES], "%s/missing.txt", dir);
+    // Reports a size of 0 but has contents
+    snprintf(paths[NFILES + 1], sizeof paths[NFILES + 1], "/proc/self/status");
+
+    for (int i = 0; i < NFILES + 2; i++) path_ptrs[i] = paths[i];
+}
+
+static void remove_files(void) {
+    for (int i = 0; i < NFILES; i++) {
+        unlink(paths[i]);
+        str_free(&contents[i]);
+    }
+    rmdir(dir);
+}
+
+// Checks the results of loading all the files in any order
+static bool check_results(StrLoadResult *res) {
+    bool seen[NFILES + 2] = {0};
+    bool ok = true;
+
+    for (int i = 0; i < NFILES + 2; i++) {
+        size_t k = res[i].index;
+        ok = ok && k < NFILES + 2 && !seen[k];
+        if (!ok) break;
+        seen[k] = true;
+
+        if (k < NFILES)
+            ok = !res[i].error && str_eq(contents[k], res[i].str);
+        else if (k == NFILES)
+            ok = res[i].error == ENOENT && res[i].str.len == 0;
+        else
+            ok = !res[i].error && str_startswith(str_ref("Name:"), res[i].str);
+    }
+
+    return ok;
+}
+
+static void free_results(StrLoadResult *res) {
+    for (int i = 0; i < NFILES + 2; i++) str_free(&res[i].str);
+}
+
+// Allocator counting its calls (str_load_files_with() calls it from one thread at a time)
+typedef struct {
+    int allocs;
+    int frees;
+    int live;
+} Counts;
+
+static void *counting_alloc(void *ctx, size_t size) {
+    Counts *c = ctx;
+    c->allocs++;
+    c->live++;
+    return malloc(size);
+}
+
+static void *counting_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)ctx; (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+    Counts *c = ctx;
+    (void)size;
+    c->frees++;
+    c->live--;
+    free(ptr);
+}
+
+static Counts counts;
+
+static const StrAllocator COUNTING = {
+    .alloc   = counting_alloc,
+    .realloc = counting_realloc,
+    .free    = counting_free,
+    .ctx     = &counts,
+};
+
+// Number of results whose buffer belongs to the allocator slot of `like`
+static int count_slot(StrLoadResult *res, String like) {
+    int n = 0;
+    for (int i = 0; i < NFILES + 2; i++)
+        n += (res[i].str.flags & STR_HEAP) && res[i].str.alloc == like.alloc;
+    return n;
+}
+
+// Loads the files through the counting allocator and checks that every buffer came
+// from it and went back to it. Returns false if a check fails.
+static bool check_with(StrLoadFlags flags) {
+    memset(&counts, 0, sizeof counts);
+    String probe = str_alloc_with(&COUNTING, "");
+    StrLoadResult res[NFILES + 2];
+
+    size_t loaded = str_load_files_with(&COUNTING, path_ptrs, NFILES + 2, res, flags);
+    bool ok = loaded == NFILES + 1 && check_results(res);
+
+    // Every loaded file is in a buffer of the allocator, and nothing else is left
+    ok = ok && count_slot(res, probe) == NFILES + 1 && counts.live == NFILES + 2;
+
+    free_results(res);
+    str_free(&probe);
+    return ok && counts.live == 0 && counts.frees == counts.allocs;
+}
+
+int main() {
+    make_files();
+
+    StrLoadResult res[NFILES + 2];
+
+    test("str_load_files", {
+        size_t loaded = str_load_files(path_ptrs, NFILES + 2, res, 0);
+        assert_eq((size_t)NFILES + 1, loaded, "%zu");
+        assert(check_results(res));
+        free_results(res);
+    });
+
+    test("str_load_files (threads)", {
+        size_t loaded = str_load_files(path_ptrs, NFILES + 2, res, STR_LOAD_NO_URING);
+        assert_eq((size_t)NFILES + 1, loaded, "%zu");
+        assert(check_results(res));
+        free_results(res);
+    });
+
+    test("str_load_files (empty)", {
+        assert_eq((size_t)0, str_load_files(path_ptrs, 0, res, 0), "%zu");
+    });
+
+    test("str_load_files (allocation stats)", {
+        str_alloc_stats_enable(true);
+        str_alloc_stats_reset();
+
+        str_load_files(path_ptrs, NFILES + 2, res, 0);
+        free_results(res);
+
+        StrAllocStats all = str_alloc_stats(STR_SITE_ALL);
+        assert_eq((size_t)0, all.in_use, "%zu");
+        assert(all.allocs >= NFILES);
+
+        str_alloc_stats_enable(false);
+    });
+
+    test("str_load_files_with", {
+        assert(check_with(0));
+        assert(check_with(STR_LOAD_NO_URING));
+
+        // NULL stands for the global allocator
+        String global = str_alloc("");
+        size_t loaded = str_load_files_with(NULL, path_ptrs, NFILES + 2, res, 0);
+        assert_eq((size_t)NFILES + 1, loaded, "%zu");
+        assert_eq(NFILES + 1, count_slot(res, global), "%d");
+        free_results(res);
+        str_free(&global);
+    });
+
+    remove_files();
+}
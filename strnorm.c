@@ -0,0 +1,302 @@
+#include "strnorm.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "utf8.h"
+
+/* * * * * * * Tables * * * * * * */
+
+// Normalization properties of a codepoint
+typedef struct {
+    uint8_t  ccc;   // canonical combining class
+    uint8_t  flags; // quick check results
+    uint8_t  dlen;  // length of the full canonical decomposition
+    uint16_t doff;  // offset of the decomposition in NORM_DECOMPS
+} NormProps;
+
+#define NFD_NO    0x1
+#define NFC_NO    0x2
+#define NFC_MAYBE 0x4
+
+#include "strnorm_tables.h"
+
+// Invalid UTF-8 bytes are carried through as RAW + byte
+#define RAW 0x110000
+
+// Hangul syllables are (de)composed algorithmically
+#define S_BASE  0xAC00
+#define L_BASE  0x1100
+#define V_BASE  0x1161
+#define T_BASE  0x11A7
+#define L_COUNT 19
+#define V_COUNT 21
+#define T_COUNT 28
+#define N_COUNT (V_COUNT * T_COUNT)
+#define S_COUNT (L_COUNT * N_COUNT)
+
+// Index of the properties of a codepoint in NORM_PROPS
+// (0 for normalized starters without a decomposition)
+static inline uint16_t props_index(uint32_t cp) {
+    if (cp >= NORM_LIMIT) return 0;
+    return NORM_STAGE2[NORM_STAGE1[cp / NORM_BLOCK]][cp % NORM_BLOCK];
+}
+
+static inline const NormProps *props(uint32_t cp) {
+    return &NORM_PROPS[props_index(cp)];
+}
+
+static inline uint8_t ccc(uint32_t cp) {
+    return props(cp)->ccc;
+}
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Decodes the codepoint at s[*i] and advances `i` past it
+static uint32_t decode(const uint8_t *s, size_t len, size_t *i) {
+    uint8_t c = s[*i];
+    if (c < 0x80) {
+        (*i)++;
+        return c;
+    }
+
+    size_t n;
+    uint32_t cp, min;
+    if      ((c & 0xE0) == 0xC0) { n = 1; cp = c & 0x1F; min = 0x80; }
+    else if ((c & 0xF0) == 0xE0) { n = 2; cp = c & 0x0F; min = 0x800; }
+    else if ((c & 0xF8) == 0xF0) { n = 3; cp = c & 0x07; min = 0x10000; }
+    else goto raw;
+
+    if (len - *i <= n) goto raw;
+
+    for (size_t k = 1; k <= n; k++) {
+        uint8_t b = s[*i + k];
+        if ((b & 0xC0) != 0x80) goto raw;
+        cp = cp << 6 | (b & 0x3F);
+    }
+
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp < 0xE000)) goto raw;
+
+    *i += n + 1;
+    return cp;
+
+raw:
+    (*i)++;
+    return RAW + c;
+}
+
+// Growable codepoint buffer
+typedef struct {
+    uint32_t *cps;
+    size_t    len;
+    size_t    cap;
+    unsigned  alloc; // allocator slot of `cps`
+} Buffer;
+
+// Appends a codepoint, moving it before the preceding codepoints with
+// a higher combining class (canonical ordering)
+static void buffer_push(Buffer *b, uint32_t cp) {
+    if (b->len == b->cap) {
+        size_t cap = b->cap ? b->cap * 2 : 64;
+        b->cps = str_mem_realloc_with(b->alloc, b->cps, b->cap * sizeof *b->cps,
+                                      cap * sizeof *b->cps);
+        b->cap = cap;
+    }
+
+    uint8_t cc = ccc(cp);
+    size_t j = b->len++;
+    if (cc) {
+        for (; j > 0 && ccc(b->cps[j - 1]) > cc; j--) b->cps[j] = b->cps[j - 1];
+    }
+    b->cps[j] = cp;
+}
+
+// Appends the full canonical decomposition of a codepoint
+static void decompose(Buffer *b, uint32_t cp) {
+    uint32_t s = cp - S_BASE;
+    if (s < S_COUNT) {
+        buffer_push(b, L_BASE + s / N_COUNT);
+        buffer_push(b, V_BASE + s % N_COUNT / T_COUNT);
+        if (s % T_COUNT) buffer_push(b, T_BASE + s % T_COUNT);
+        return;
+    }
+
+    const NormProps *p = props(cp);
+    if (!p->dlen) {
+        buffer_push(b, cp);
+        return;
+    }
+
+    for (size_t k = 0; k < p->dlen; k++) buffer_push(b, NORM_DECOMPS[p->doff + k]);
+}
+
+// Returns the primary composite of two codepoints, or 0 if there is none
+static uint32_t compose_pair(uint32_t a, uint32_t b) {
+    // L + V and LV + T
+    if (a - L_BASE < L_COUNT && b - V_BASE < V_COUNT)
+        return S_BASE + ((a - L_BASE) * V_COUNT + (b - V_BASE)) * T_COUNT;
+    if (a - S_BASE < S_COUNT && (a - S_BASE) % T_COUNT == 0 && b - T_BASE - 1 < T_COUNT - 1)
+        return a + (b - T_BASE);
+
+    if (a >= NORM_LIMIT || b >= NORM_LIMIT) return 0;
+
+    uint64_t key = (uint64_t)a << 21 | b;
+    size_t lo = 0, hi = sizeof NORM_PAIRS / sizeof *NORM_PAIRS;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (NORM_PAIRS[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo < sizeof NORM_PAIRS / sizeof *NORM_PAIRS && NORM_PAIRS[lo] == key
+        ? NORM_COMPOSITES[lo] : 0;
+}
+
+// Canonically composes the decomposed and ordered codepoints in place
+static void compose(Buffer *b) {
+    if (!b->len) return;
+
+    size_t starter = 0, out = 1;
+    // A leading non-starter blocks composition until the next starter
+    unsigned last_cc = ccc(b->cps[0]) ? 256 : 0;
+
+    for (size_t i = 1; i < b->len; i++) {
+        uint32_t cp = b->cps[i];
+        const NormProps *p = props(cp);
+        uint8_t cc = p->ccc;
+
+        // Only codepoints flagged "maybe" are the second half of a composite.
+        // Not blocked from the last starter (a starter can only be adjacent to it).
+        if ((p->flags & NFC_MAYBE) && (last_cc < cc || last_cc == 0)) {
+            uint32_t composite = compose_pair(b->cps[starter], cp);
+            if (composite) {
+                b->cps[starter] = composite;
+                continue;
+            }
+        }
+
+        if (cc == 0) starter = out;
+        last_cc = cc;
+        b->cps[out++] = cp;
+    }
+
+    b->len = out;
+}
+
+/* * * * * * * Quick check * * * * * * */
+
+typedef enum { QC_YES, QC_NO, QC_MAYBE } QuickCheck;
+
+// Runs the quick check algorithm. Writes the byte offset of the longest prefix
+// that normalization leaves unchanged to `safe` (meaningful if not QC_YES).
+static QuickCheck quick_check(String str, StrNormForm form, size_t *safe) {
+    const uint8_t *s = (const uint8_t *)str.str;
+    uint8_t no = form == STR_NFC ? NFC_NO : NFD_NO;
+
+    QuickCheck result = QC_YES;
+    size_t starter = 0;
+    uint8_t last_cc = 0;
+
+    for (size_t i = 0; i < str.len;) {
+        // ASCII runs are normalized starters
+        if (s[i] < 0x80) {
+            uint64_t w;
+            while (i + 8 <= str.len &&
+                   (memcpy(&w, s + i, 8), !(w & 0x8080808080808080ull))) i += 8;
+            while (i < str.len && s[i] < 0x80) i++;
+
+            starter = i - 1;
+            last_cc = 0;
+            continue;
+        }
+
+        size_t start = i;
+        uint16_t idx = props_index(decode(s, str.len, &i));
+        if (!idx) {
+            starter = start;
+            last_cc = 0;
+            continue;
+        }
+
+        const NormProps *p = &NORM_PROPS[idx];
+
+        if ((p->ccc && p->ccc < last_cc) || (p->flags & no)) {
+            if (result == QC_YES) *safe = starter;
+            return QC_NO;
+        }
+
+        if (form == STR_NFC && (p->flags & NFC_MAYBE) && result == QC_YES) {
+            *safe = starter;
+            result = QC_MAYBE;
+        }
+
+        if (!p->ccc) starter = start;
+        last_cc = p->ccc;
+    }
+
+    return result;
+}
+
+/* * * * * * * Normalization * * * * * * */
+
+// Normalizes the string past the given offset (the prefix is copied as is)
+static String normalize(String str, StrNormForm form, size_t safe) {
+    const uint8_t *s = (const uint8_t *)str.str;
+
+    Buffer b = { .alloc = str_allocator_slot(NULL) };
+    for (size_t i = safe; i < str.len;) decompose(&b, decode(s, str.len, &i));
+    if (form == STR_NFC) compose(&b);
+
+    String out = str_nalloc(str.str, safe);
+    str_reserve(safe + b.len * 4, &out);
+
+    char *w = out.str + out.len;
+    for (size_t k = 0; k < b.len; k++) {
+        if (b.cps[k] >= RAW) *w++ = (char)(b.cps[k] - RAW);
+        else w = utf8_encode(w, b.cps[k]);
+    }
+    out.len = w - out.str;
+
+    str_mem_free_with(b.alloc, b.cps, b.cap * sizeof *b.cps);
+    return out;
+}
+
+bool str_is_normalized(String str, StrNormForm form) {
+    size_t safe = 0;
+    QuickCheck qc = quick_check(str, form, &safe);
+    if (qc != QC_MAYBE) return qc == QC_YES;
+
+    String norm = normalize(str, form, safe);
+    bool eq = norm.len == str.len && !memcmp(norm.str, str.str, str.len);
+    str_free(&norm);
+    return eq;
+}
+
+String str_normalize(String str, StrNormForm form) {
+    size_t safe = 0;
+    QuickCheck qc = quick_check(str, form, &safe);
+    if (qc == QC_YES) return str_nref(str.str, str.len);
+
+    String norm = normalize(str, form, safe);
+
+    // Inconclusive quick check, but already normalized
+    if (qc == QC_MAYBE && norm.len == str.len && !memcmp(norm.str, str.str, str.len)) {
+        str_free(&norm);
+        return str_nref(str.str, str.len);
+    }
+
+    return norm;
+}
+
+bool str_norm_eq(String a, String b) {
+    if (a.len == b.len && !memcmp(a.str, b.str, a.len)) return true;
+
+    String na = str_normalize(a, STR_NFD);
+    String nb = str_normalize(b, STR_NFD);
+
+    bool eq = na.len == nb.len && !memcmp(na.str, nb.str, na.len);
+
+    str_free(&na);
+    str_free(&nb);
+    return eq;
+}
@@ -0,0 +1,31 @@
+#ifndef _STRNORM_H
+#define _STRNORM_H
+
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Unicode normalization forms
+typedef enum {
+    // Canonical decomposition followed by canonical composition
+    STR_NFC,
+    // Canonical decomposition
+    STR_NFD,
+} StrNormForm;
+
+// Tells whether the UTF-8 string is in the given normalization form.
+// Runs the quick check (skipping ASCII 8 bytes at a time) and only normalizes
+// if the quick check is inconclusive.
+bool str_is_normalized(String str, StrNormForm form);
+
+// Normalizes the UTF-8 string into the given form.
+// If the string is already normalized (e.g. all ASCII), a reference to the input
+// is returned and nothing is copied. Invalid UTF-8 bytes are passed through as is.
+// Requires str_free() (which does nothing for the returned reference)
+String str_normalize(String str, StrNormForm form);
+
+// Tells whether two UTF-8 strings are canonically equivalent,
+// i.e. equal after normalization
+bool str_norm_eq(String a, String b);
+
+#endif // _STRNORM_H
@@ -0,0 +1,4075 @@
+// Unicode 14.0.0 normalization tables (generated by strnorm_tables.py, do not edit)
+
+#define NORM_LIMIT 0x30000
+#define NORM_BLOCK 64
+
+// Codepoint block -> index of the block in NORM_STAGE2
+static const uint8_t NORM_STAGE1[3072] = {
+    0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 7, 8, 9, 10,
+    11, 12, 13, 14, 0, 0, 15, 16, 17, 18, 0, 19, 20, 21, 0, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 29, 35, 36, 37,
+    33, 38, 33, 39, 40, 41, 0, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 0, 52, 0, 0, 53, 54, 55, 0, 0, 0, 0, 0, 56, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 58,
+    0, 0, 59, 0, 60, 0, 0, 0, 61, 62, 63, 64, 65, 66, 67, 68,
+    69, 0, 0, 70, 0, 0, 0, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 0, 0, 81, 82, 0, 83, 84, 85, 86, 87, 88, 89, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0,
+    0, 0, 0, 91, 0, 92, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0,
+    94, 95, 96, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 99, 100, 0, 0, 0, 0,
+    101, 0, 0, 102, 103, 104, 105, 106, 0, 0, 107, 108, 0, 0, 0, 109,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 111, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 124, 0, 125, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 127, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 129, 0, 0, 130, 131, 0,
+    0, 132, 133, 0, 134, 105, 0, 135, 136, 0, 0, 137, 138, 139, 0, 0,
+    0, 140, 141, 142, 0, 0, 143, 144, 92, 0, 145, 0, 146, 0, 0, 0,
+    147, 0, 0, 0, 148, 149, 0, 150, 151, 152, 153, 0, 0, 0, 0, 0,
+    92, 0, 0, 0, 0, 154, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 157, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 158,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 160, 161, 162, 0, 163, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    164, 0, 0, 0, 157, 0, 0, 0, 0, 0, 165, 166, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 167, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    169, 170, 171, 172, 173, 174, 175, 176, 177, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// Codepoint -> index in NORM_PROPS
+static const uint16_t NORM_STAGE2[178][NORM_BLOCK] = {
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    1, 2, 3, 4, 5, 6, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    0, 16, 17, 18, 19, 20, 21, 0, 0, 22, 23, 24, 25, 26, 0, 0,
+    27, 28, 29, 30, 31, 32, 0, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    0, 42, 43, 44, 45, 46, 47, 0, 0, 48, 49, 50, 51, 52, 0, 53,
+    },
+    {
+    54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    0, 0, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 0, 0, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 0, 0, 0, 99, 100, 101, 102, 0, 103, 104, 105, 106, 107, 108, 0,
+    },
+    {
+    0, 0, 0, 109, 110, 111, 112, 113, 114, 0, 0, 0, 115, 116, 117, 118,
+    119, 120, 0, 0, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 0, 0, 139, 140, 141, 142, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    162, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164,
+    165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 167, 168,
+    169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 0, 182, 183,
+    184, 185, 186, 187, 0, 0, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+    198, 0, 0, 0, 199, 200, 0, 0, 201, 202, 203, 204, 205, 206, 207, 208,
+    },
+    {
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+    225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 0, 0, 237, 238,
+    0, 0, 0, 0, 0, 0, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+    249, 250, 251, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    253, 253, 253, 253, 253, 254, 253, 253, 253, 253, 253, 253, 253, 254, 254, 253,
+    254, 253, 254, 253, 253, 255, 256, 256, 256, 256, 255, 257, 256, 256, 256, 256,
+    256, 258, 258, 259, 259, 259, 259, 260, 260, 256, 256, 256, 256, 259, 259, 256,
+    259, 259, 256, 256, 261, 261, 261, 261, 262, 256, 256, 256, 256, 254, 254, 254,
+    },
+    {
+    263, 264, 253, 265, 266, 267, 254, 256, 256, 256, 254, 254, 254, 256, 256, 0,
+    254, 254, 254, 256, 256, 256, 256, 254, 255, 256, 256, 254, 268, 269, 269, 268,
+    269, 269, 268, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    0, 0, 0, 0, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 272, 273, 274, 275, 276, 277, 0, 278, 0, 279, 280,
+    281, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 283, 284, 285, 286, 287,
+    288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 289, 290, 291, 292, 293, 0,
+    0, 0, 0, 294, 295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    296, 297, 0, 298, 0, 0, 0, 299, 0, 0, 0, 0, 300, 301, 302, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 303, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    305, 306, 0, 307, 0, 0, 0, 308, 0, 0, 0, 0, 309, 310, 311, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 312, 313, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 314, 315, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    316, 317, 318, 319, 0, 0, 320, 321, 0, 0, 322, 323, 324, 325, 326, 327,
+    0, 0, 328, 329, 330, 331, 332, 333, 0, 0, 334, 335, 336, 337, 338, 339,
+    340, 341, 342, 343, 344, 345, 0, 0, 346, 347, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 256, 254, 254, 254, 254, 256, 254, 254, 254, 348, 256, 254, 254, 254, 254,
+    254, 254, 256, 256, 256, 256, 256, 256, 254, 254, 256, 254, 254, 348, 349, 254,
+    350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 359, 360, 361, 362, 0, 363,
+    },
+    {
+    0, 364, 365, 0, 254, 256, 0, 358, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 254, 366, 367, 368, 0, 0, 0, 0, 0,
+    0, 0, 369, 370, 371, 372, 373, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 374, 375, 376, 366, 367,
+    368, 377, 378, 253, 253, 259, 256, 254, 254, 254, 254, 254, 256, 254, 254, 256,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    380, 0, 381, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 382, 0, 0, 254, 254, 254, 254, 254, 254, 254, 0, 0, 254,
+    254, 254, 254, 256, 254, 0, 0, 254, 254, 0, 256, 254, 254, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 383, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 256, 254, 254, 256, 254, 254, 256, 256, 256, 254, 256, 256, 254, 256, 254,
+    },
+    {
+    254, 254, 256, 254, 256, 254, 256, 254, 256, 254, 254, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254,
+    254, 254, 256, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 0, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 0, 254, 254, 254, 0, 254, 254, 254, 254, 254, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 256, 256, 254, 254, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 256,
+    256, 256, 256, 256, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 0, 256, 254, 254, 256, 254, 254, 256, 254, 254, 254, 256, 256, 256,
+    374, 375, 376, 254, 254, 254, 256, 254, 254, 256, 256, 254, 254, 254, 254, 254,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0,
+    0, 385, 0, 0, 386, 0, 0, 0, 0, 0, 0, 0, 387, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+    0, 254, 256, 254, 254, 0, 0, 0, 389, 390, 391, 392, 393, 394, 395, 396,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 398, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 399, 400, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 401, 402, 0, 403,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 404, 0, 0, 405, 0, 0, 0, 0, 0, 397, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 407, 408, 0, 0, 409, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 410, 0, 0, 411, 412, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 398, 398, 0, 0, 0, 0, 413, 414, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 416, 417, 418, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 419, 0, 0, 0, 0, 388, 0, 0,
+    0, 0, 0, 0, 0, 420, 421, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    422, 0, 398, 0, 0, 0, 0, 423, 424, 0, 425, 426, 0, 388, 0, 0,
+    0, 0, 0, 0, 0, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 398, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 427, 428, 429, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 430, 0, 0, 0, 0, 398,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 431, 0, 432, 433, 434, 398,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 435, 435, 388, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 436, 436, 436, 436, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 437, 437, 388, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 438, 438, 438, 438, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 256, 0, 256, 0, 439, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 441, 0, 0,
+    0, 0, 442, 0, 0, 0, 0, 443, 0, 0, 0, 0, 444, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 445, 0, 0, 0, 0, 0, 0,
+    0, 446, 447, 448, 449, 450, 451, 0, 452, 0, 447, 447, 447, 447, 0, 0,
+    },
+    {
+    447, 453, 254, 254, 388, 0, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 454, 0, 0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 0,
+    0, 0, 456, 0, 0, 0, 0, 457, 0, 0, 0, 0, 458, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 460, 0, 0, 0, 0, 0, 0, 0, 398, 0,
+    0, 0, 0, 0, 0, 0, 0, 397, 0, 388, 388, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 398, 398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    },
+    {
+    398, 398, 398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 349, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 348, 254, 256, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 254, 256, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 256,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 256, 256, 256, 256, 256, 256, 254, 254, 256, 0, 256,
+    },
+    {
+    256, 254, 254, 256, 256, 254, 254, 254, 254, 254, 256, 254, 254, 254, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 461, 0, 462, 0, 463, 0, 464, 0, 465, 0,
+    0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 397, 398, 0, 0, 0, 0, 0, 467, 0, 468, 0, 0,
+    },
+    {
+    469, 470, 0, 471, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 256, 254, 254, 254,
+    254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 388, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 0, 261, 256, 256, 256, 256, 256, 254, 254, 256, 256, 256, 256,
+    254, 0, 261, 261, 261, 261, 261, 261, 261, 0, 0, 0, 0, 256, 0, 0,
+    0, 0, 0, 0, 254, 0, 0, 0, 254, 254, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    254, 254, 256, 254, 254, 254, 254, 254, 254, 254, 256, 254, 254, 269, 472, 256,
+    258, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 255, 349, 349, 256, 473, 254, 268, 256, 254, 256,
+    },
+    {
+    474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489,
+    490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+    506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
+    522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537,
+    },
+    {
+    538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553,
+    554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
+    570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585,
+    586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+    },
+    {
+    602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617,
+    618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 0, 628, 0, 0, 0, 0,
+    629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
+    645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660,
+    },
+    {
+    661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676,
+    677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+    693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+    709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
+    735, 736, 737, 738, 739, 740, 0, 0, 741, 742, 743, 744, 745, 746, 0, 0,
+    747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762,
+    763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778,
+    },
+    {
+    779, 780, 781, 782, 783, 784, 0, 0, 785, 786, 787, 788, 789, 790, 0, 0,
+    791, 792, 793, 794, 795, 796, 797, 798, 0, 799, 0, 800, 0, 801, 0, 802,
+    803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818,
+    819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 0, 0,
+    },
+    {
+    833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848,
+    849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864,
+    865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880,
+    881, 882, 883, 884, 885, 0, 886, 887, 888, 889, 890, 891, 892, 0, 893, 0,
+    },
+    {
+    0, 894, 895, 896, 897, 0, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907,
+    908, 909, 910, 911, 0, 0, 912, 913, 914, 915, 916, 917, 0, 918, 919, 920,
+    921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936,
+    0, 0, 937, 938, 939, 0, 940, 941, 942, 943, 944, 945, 946, 947, 0, 0,
+    },
+    {
+    948, 949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 261, 261, 254, 254, 254, 254, 261, 261, 261, 254, 254, 0, 0, 0,
+    0, 254, 0, 0, 0, 261, 261, 254, 256, 254, 261, 261, 256, 256, 256, 256,
+    254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 950, 0, 0, 0, 951, 952, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 953, 954, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 955, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 956, 957, 958,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 959, 0, 0, 0, 0, 960, 0, 0, 961, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 962, 0, 963, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 964, 0, 0, 965, 0, 0, 966, 0, 967, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    968, 0, 969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 970, 971, 972,
+    973, 974, 0, 0, 975, 976, 0, 0, 977, 978, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    979, 980, 0, 0, 981, 982, 0, 0, 983, 984, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 986, 987, 988,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    989, 990, 991, 992, 0, 0, 0, 0, 0, 0, 993, 994, 995, 996, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 997, 998, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 999, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254,
+    254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 473, 349, 255, 348, 1000, 1000,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1001, 0, 1002, 0,
+    1003, 0, 1004, 0, 1005, 0, 1006, 0, 1007, 0, 1008, 0, 1009, 0, 1010, 0,
+    1011, 0, 1012, 0, 0, 1013, 0, 1014, 0, 1015, 0, 0, 0, 0, 0, 0,
+    1016, 1017, 0, 1018, 1019, 0, 1020, 1021, 0, 1022, 1023, 0, 1024, 1025, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1026, 0, 0, 0, 0, 1027, 1027, 0, 0, 0, 1028, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1029, 0, 1030, 0,
+    1031, 0, 1032, 0, 1033, 0, 1034, 0, 1035, 0, 1036, 0, 1037, 0, 1038, 0,
+    },
+    {
+    1039, 0, 1040, 0, 0, 1041, 0, 1042, 0, 1043, 0, 0, 0, 0, 0, 0,
+    1044, 1045, 0, 1046, 1047, 0, 1048, 1049, 0, 1050, 1051, 0, 1052, 1053, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1054, 0, 0, 1055, 1056, 1057, 1058, 0, 0, 0, 1059, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254,
+    0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 0, 254, 254, 256, 0, 0, 254, 254, 0, 0, 0, 0, 0, 254, 254,
+    },
+    {
+    0, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    },
+    {
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+    1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
+    1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
+    1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+    1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
+    },
+    {
+    1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139,
+    1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1080, 1152, 1153, 1154,
+    1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
+    1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186,
+    },
+    {
+    1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
+    1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218,
+    1219, 1170, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1154, 1228, 1229, 1230, 1231, 1232,
+    1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1080,
+    },
+    {
+    1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+    1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1156, 1275, 1276, 1277, 1278,
+    1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+    1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
+    },
+    {
+    1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 0, 0,
+    1325, 0, 1326, 0, 0, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 0,
+    1337, 0, 1338, 0, 0, 1339, 1340, 0, 0, 0, 1341, 1342, 1343, 1344, 1345, 1346,
+    1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+    },
+    {
+    1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
+    1379, 1380, 1381, 1382, 1383, 1384, 1385, 1209, 1386, 1387, 1388, 1389, 1390, 1391, 1391, 1392,
+    1393, 1394, 1395, 1396, 1397, 1398, 1399, 1339, 1400, 1401, 1402, 1403, 1404, 1405, 0, 0,
+    1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1353, 1414, 1415, 1416, 1325, 1417, 1418, 1419,
+    },
+    {
+    1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1362, 1429, 1363, 1430, 1431, 1432, 1433,
+    1434, 1326, 1101, 1435, 1436, 1437, 1171, 1258, 1438, 1439, 1370, 1440, 1371, 1441, 1442, 1443,
+    1328, 1444, 1445, 1446, 1447, 1448, 1329, 1449, 1450, 1451, 1452, 1453, 1454, 1385, 1455, 1456,
+    1209, 1457, 1389, 1458, 1459, 1460, 1461, 1462, 1394, 1463, 1338, 1464, 1395, 1152, 1465, 1396,
+    },
+    {
+    1466, 1398, 1467, 1468, 1469, 1470, 1471, 1400, 1334, 1472, 1401, 1473, 1402, 1474, 1068, 1475,
+    1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1486, 1487, 1488,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1489, 1490, 1491, 1492, 1493, 1494,
+    1495, 1496, 1497, 1498, 1499, 1500, 1501, 0, 1502, 1503, 1504, 1505, 1506, 0, 1507, 0,
+    },
+    {
+    1508, 1509, 0, 1510, 1511, 0, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 256, 256, 256, 256, 256, 256, 256, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 254, 261, 256, 0, 0, 0, 0, 388,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 254, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 256, 256, 254, 254, 254, 256, 254, 256, 256, 256,
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 254, 256, 254, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1521, 0, 1522, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1523, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 387, 0, 0, 0, 0, 0,
+    },
+    {
+    254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 1524, 1525,
+    0, 0, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 388, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 397, 0, 398, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1526, 1527, 388, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 254, 0, 0, 0,
+    254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 388, 0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 1528, 1529, 398, 1530, 0,
+    },
+    {
+    0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1531, 1532, 0, 0, 0, 388,
+    },
+    {
+    397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 397, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    398, 0, 0, 0, 0, 0, 0, 0, 1533, 0, 0, 0, 0, 388, 388, 0,
+    },
+    {
+    0, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 397, 0, 388, 388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261, 261, 261, 261, 261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    254, 254, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1534, 1534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1535, 1536,
+    1537, 1538, 1539, 1540, 1541, 439, 439, 261, 261, 261, 0, 0, 0, 1542, 439, 439,
+    439, 439, 439, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256,
+    },
+    {
+    256, 256, 256, 0, 0, 254, 254, 254, 254, 254, 256, 256, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1543, 1544, 1545, 1546, 1547,
+    },
+    {
+    1548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 254, 254, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    254, 254, 254, 254, 254, 254, 254, 0, 254, 254, 254, 254, 254, 254, 254, 254,
+    254, 254, 254, 254, 254, 254, 254, 254, 254, 0, 0, 254, 254, 254, 254, 254,
+    254, 254, 0, 254, 254, 0, 254, 254, 254, 254, 254, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 254, 254, 254,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 256, 256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    0, 0, 0, 0, 254, 254, 254, 254, 254, 254, 397, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+    1549, 1550, 1551, 1552, 1553, 1347, 1554, 1555, 1556, 1557, 1348, 1558, 1559, 1560, 1349, 1561,
+    1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1407, 1573, 1574, 1575, 1576,
+    1577, 1578, 1579, 1580, 1581, 1412, 1350, 1351, 1413, 1582, 1583, 1158, 1584, 1352, 1585, 1586,
+    1587, 1588, 1588, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600,
+    },
+    {
+    1601, 1602, 1603, 1604, 1605, 1606, 1606, 1415, 1607, 1608, 1609, 1610, 1354, 1611, 1612, 1613,
+    1311, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628,
+    1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1639, 1640, 1641, 1642, 1154,
+    1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1359, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
+    },
+    {
+    1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1100, 1672,
+    1673, 1674, 1674, 1675, 1676, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686,
+    1687, 1688, 1689, 1360, 1690, 1691, 1692, 1693, 1427, 1693, 1694, 1362, 1695, 1696, 1697, 1698,
+    1363, 1073, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712,
+    },
+    {
+    1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1364, 1721, 1722, 1723, 1724, 1725, 1726, 1366,
+    1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1101, 1435, 1735, 1736, 1737, 1738, 1739, 1740,
+    1741, 1742, 1367, 1743, 1744, 1745, 1746, 1478, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754,
+    1755, 1756, 1757, 1758, 1759, 1171, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769,
+    },
+    {
+    1770, 1368, 1258, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1439, 1779, 1780, 1781, 1782,
+    1783, 1784, 1785, 1786, 1440, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+    1798, 1442, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1809, 1810, 1811,
+    1444, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1157, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
+    },
+    {
+    1450, 1826, 1827, 1828, 1829, 1830, 1831, 1831, 1451, 1480, 1832, 1833, 1834, 1835, 1836, 1119,
+    1453, 1837, 1838, 1379, 1839, 1840, 1333, 1841, 1842, 1383, 1843, 1844, 1845, 1846, 1846, 1847,
+    1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+    1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1389, 1874, 1875, 1876, 1877, 1878,
+    },
+    {
+    1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1675, 1890, 1891, 1892, 1893,
+    1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1175, 1902, 1903, 1904, 1905, 1906, 1907, 1392,
+    1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923,
+    1924, 1925, 1926, 1927, 1114, 1928, 1929, 1930, 1931, 1932, 1933, 1460, 1934, 1935, 1936, 1937,
+    },
+    {
+    1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953,
+    1465, 1466, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1467,
+    1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982,
+    1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1473, 1473,
+    },
+    {
+    1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 1474, 2007, 2008, 2009, 2010, 2011,
+    2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+};
+
+static const NormProps NORM_PROPS[2026] = {
+    {   0, 0x0, 0,    0 },
+    {   0, 0x1, 2,    0 },
+    {   0, 0x1, 2,    2 },
+    {   0, 0x1, 2,    4 },
+    {   0, 0x1, 2,    6 },
+    {   0, 0x1, 2,    8 },
+    {   0, 0x1, 2,   10 },
+    {   0, 0x1, 2,   12 },
+    {   0, 0x1, 2,   14 },
+    {   0, 0x1, 2,   16 },
+    {   0, 0x1, 2,   18 },
+    {   0, 0x1, 2,   20 },
+    {   0, 0x1, 2,   22 },
+    {   0, 0x1, 2,   24 },
+    {   0, 0x1, 2,   26 },
+    {   0, 0x1, 2,   28 },
+    {   0, 0x1, 2,   30 },
+    {   0, 0x1, 2,   32 },
+    {   0, 0x1, 2,   34 },
+    {   0, 0x1, 2,   36 },
+    {   0, 0x1, 2,   38 },
+    {   0, 0x1, 2,   40 },
+    {   0, 0x1, 2,   42 },
+    {   0, 0x1, 2,   44 },
+    {   0, 0x1, 2,   46 },
+    {   0, 0x1, 2,   48 },
+    {   0, 0x1, 2,   50 },
+    {   0, 0x1, 2,   52 },
+    {   0, 0x1, 2,   54 },
+    {   0, 0x1, 2,   56 },
+    {   0, 0x1, 2,   58 },
+    {   0, 0x1, 2,   60 },
+    {   0, 0x1, 2,   62 },
+    {   0, 0x1, 2,   64 },
+    {   0, 0x1, 2,   66 },
+    {   0, 0x1, 2,   68 },
+    {   0, 0x1, 2,   70 },
+    {   0, 0x1, 2,   72 },
+    {   0, 0x1, 2,   74 },
+    {   0, 0x1, 2,   76 },
+    {   0, 0x1, 2,   78 },
+    {   0, 0x1, 2,   80 },
+    {   0, 0x1, 2,   82 },
+    {   0, 0x1, 2,   84 },
+    {   0, 0x1, 2,   86 },
+    {   0, 0x1, 2,   88 },
+    {   0, 0x1, 2,   90 },
+    {   0, 0x1, 2,   92 },
+    {   0, 0x1, 2,   94 },
+    {   0, 0x1, 2,   96 },
+    {   0, 0x1, 2,   98 },
+    {   0, 0x1, 2,  100 },
+    {   0, 0x1, 2,  102 },
+    {   0, 0x1, 2,  104 },
+    {   0, 0x1, 2,  106 },
+    {   0, 0x1, 2,  108 },
+    {   0, 0x1, 2,  110 },
+    {   0, 0x1, 2,  112 },
+    {   0, 0x1, 2,  114 },
+    {   0, 0x1, 2,  116 },
+    {   0, 0x1, 2,  118 },
+    {   0, 0x1, 2,  120 },
+    {   0, 0x1, 2,  122 },
+    {   0, 0x1, 2,  124 },
+    {   0, 0x1, 2,  126 },
+    {   0, 0x1, 2,  128 },
+    {   0, 0x1, 2,  130 },
+    {   0, 0x1, 2,  132 },
+    {   0, 0x1, 2,  134 },
+    {   0, 0x1, 2,  136 },
+    {   0, 0x1, 2,  138 },
+    {   0, 0x1, 2,  140 },
+    {   0, 0x1, 2,  142 },
+    {   0, 0x1, 2,  144 },
+    {   0, 0x1, 2,  146 },
+    {   0, 0x1, 2,  148 },
+    {   0, 0x1, 2,  150 },
+    {   0, 0x1, 2,  152 },
+    {   0, 0x1, 2,  154 },
+    {   0, 0x1, 2,  156 },
+    {   0, 0x1, 2,  158 },
+    {   0, 0x1, 2,  160 },
+    {   0, 0x1, 2,  162 },
+    {   0, 0x1, 2,  164 },
+    {   0, 0x1, 2,  166 },
+    {   0, 0x1, 2,  168 },
+    {   0, 0x1, 2,  170 },
+    {   0, 0x1, 2,  172 },
+    {   0, 0x1, 2,  174 },
+    {   0, 0x1, 2,  176 },
+    {   0, 0x1, 2,  178 },
+    {   0, 0x1, 2,  180 },
+    {   0, 0x1, 2,  182 },
+    {   0, 0x1, 2,  184 },
+    {   0, 0x1, 2,  186 },
+    {   0, 0x1, 2,  188 },
+    {   0, 0x1, 2,  190 },
+    {   0, 0x1, 2,  192 },
+    {   0, 0x1, 2,  194 },
+    {   0, 0x1, 2,  196 },
+    {   0, 0x1, 2,  198 },
+    {   0, 0x1, 2,  200 },
+    {   0, 0x1, 2,  202 },
+    {   0, 0x1, 2,  204 },
+    {   0, 0x1, 2,  206 },
+    {   0, 0x1, 2,  208 },
+    {   0, 0x1, 2,  210 },
+    {   0, 0x1, 2,  212 },
+    {   0, 0x1, 2,  214 },
+    {   0, 0x1, 2,  216 },
+    {   0, 0x1, 2,  218 },
+    {   0, 0x1, 2,  220 },
+    {   0, 0x1, 2,  222 },
+    {   0, 0x1, 2,  224 },
+    {   0, 0x1, 2,  226 },
+    {   0, 0x1, 2,  228 },
+    {   0, 0x1, 2,  230 },
+    {   0, 0x1, 2,  232 },
+    {   0, 0x1, 2,  234 },
+    {   0, 0x1, 2,  236 },
+    {   0, 0x1, 2,  238 },
+    {   0, 0x1, 2,  240 },
+    {   0, 0x1, 2,  242 },
+    {   0, 0x1, 2,  244 },
+    {   0, 0x1, 2,  246 },
+    {   0, 0x1, 2,  248 },
+    {   0, 0x1, 2,  250 },
+    {   0, 0x1, 2,  252 },
+    {   0, 0x1, 2,  254 },
+    {   0, 0x1, 2,  256 },
+    {   0, 0x1, 2,  258 },
+    {   0, 0x1, 2,  260 },
+    {   0, 0x1, 2,  262 },
+    {   0, 0x1, 2,  264 },
+    {   0, 0x1, 2,  266 },
+    {   0, 0x1, 2,  268 },
+    {   0, 0x1, 2,  270 },
+    {   0, 0x1, 2,  272 },
+    {   0, 0x1, 2,  274 },
+    {   0, 0x1, 2,  276 },
+    {   0, 0x1, 2,  278 },
+    {   0, 0x1, 2,  280 },
+    {   0, 0x1, 2,  282 },
+    {   0, 0x1, 2,  284 },
+    {   0, 0x1, 2,  286 },
+    {   0, 0x1, 2,  288 },
+    {   0, 0x1, 2,  290 },
+    {   0, 0x1, 2,  292 },
+    {   0, 0x1, 2,  294 },
+    {   0, 0x1, 2,  296 },
+    {   0, 0x1, 2,  298 },
+    {   0, 0x1, 2,  300 },
+    {   0, 0x1, 2,  302 },
+    {   0, 0x1, 2,  304 },
+    {   0, 0x1, 2,  306 },
+    {   0, 0x1, 2,  308 },
+    {   0, 0x1, 2,  310 },
+    {   0, 0x1, 2,  312 },
+    {   0, 0x1, 2,  314 },
+    {   0, 0x1, 2,  316 },
+    {   0, 0x1, 2,  318 },
+    {   0, 0x1, 2,  320 },
+    {   0, 0x1, 2,  322 },
+    {   0, 0x1, 2,  324 },
+    {   0, 0x1, 2,  326 },
+    {   0, 0x1, 2,  328 },
+    {   0, 0x1, 2,  330 },
+    {   0, 0x1, 2,  332 },
+    {   0, 0x1, 2,  334 },
+    {   0, 0x1, 2,  336 },
+    {   0, 0x1, 2,  338 },
+    {   0, 0x1, 2,  340 },
+    {   0, 0x1, 2,  342 },
+    {   0, 0x1, 2,  344 },
+    {   0, 0x1, 3,  346 },
+    {   0, 0x1, 3,  349 },
+    {   0, 0x1, 3,  352 },
+    {   0, 0x1, 3,  355 },
+    {   0, 0x1, 3,  358 },
+    {   0, 0x1, 3,  361 },
+    {   0, 0x1, 3,  364 },
+    {   0, 0x1, 3,  367 },
+    {   0, 0x1, 3,  370 },
+    {   0, 0x1, 3,  373 },
+    {   0, 0x1, 3,  376 },
+    {   0, 0x1, 3,  379 },
+    {   0, 0x1, 2,  382 },
+    {   0, 0x1, 2,  384 },
+    {   0, 0x1, 2,  386 },
+    {   0, 0x1, 2,  388 },
+    {   0, 0x1, 2,  390 },
+    {   0, 0x1, 2,  392 },
+    {   0, 0x1, 2,  394 },
+    {   0, 0x1, 2,  396 },
+    {   0, 0x1, 3,  398 },
+    {   0, 0x1, 3,  401 },
+    {   0, 0x1, 2,  404 },
+    {   0, 0x1, 2,  406 },
+    {   0, 0x1, 2,  408 },
+    {   0, 0x1, 2,  410 },
+    {   0, 0x1, 2,  412 },
+    {   0, 0x1, 2,  414 },
+    {   0, 0x1, 2,  416 },
+    {   0, 0x1, 3,  418 },
+    {   0, 0x1, 3,  421 },
+    {   0, 0x1, 2,  424 },
+    {   0, 0x1, 2,  426 },
+    {   0, 0x1, 2,  428 },
+    {   0, 0x1, 2,  430 },
+    {   0, 0x1, 2,  432 },
+    {   0, 0x1, 2,  434 },
+    {   0, 0x1, 2,  436 },
+    {   0, 0x1, 2,  438 },
+    {   0, 0x1, 2,  440 },
+    {   0, 0x1, 2,  442 },
+    {   0, 0x1, 2,  444 },
+    {   0, 0x1, 2,  446 },
+    {   0, 0x1, 2,  448 },
+    {   0, 0x1, 2,  450 },
+    {   0, 0x1, 2,  452 },
+    {   0, 0x1, 2,  454 },
+    {   0, 0x1, 2,  456 },
+    {   0, 0x1, 2,  458 },
+    {   0, 0x1, 2,  460 },
+    {   0, 0x1, 2,  462 },
+    {   0, 0x1, 2,  464 },
+    {   0, 0x1, 2,  466 },
+    {   0, 0x1, 2,  468 },
+    {   0, 0x1, 2,  470 },
+    {   0, 0x1, 2,  472 },
+    {   0, 0x1, 2,  474 },
+    {   0, 0x1, 2,  476 },
+    {   0, 0x1, 2,  478 },
+    {   0, 0x1, 2,  480 },
+    {   0, 0x1, 2,  482 },
+    {   0, 0x1, 2,  484 },
+    {   0, 0x1, 2,  486 },
+    {   0, 0x1, 2,  488 },
+    {   0, 0x1, 2,  490 },
+    {   0, 0x1, 2,  492 },
+    {   0, 0x1, 2,  494 },
+    {   0, 0x1, 2,  496 },
+    {   0, 0x1, 2,  498 },
+    {   0, 0x1, 3,  500 },
+    {   0, 0x1, 3,  503 },
+    {   0, 0x1, 3,  506 },
+    {   0, 0x1, 3,  509 },
+    {   0, 0x1, 2,  512 },
+    {   0, 0x1, 2,  514 },
+    {   0, 0x1, 3,  516 },
+    {   0, 0x1, 3,  519 },
+    {   0, 0x1, 2,  522 },
+    {   0, 0x1, 2,  524 },
+    { 230, 0x4, 0,    0 },
+    { 230, 0x0, 0,    0 },
+    { 232, 0x0, 0,    0 },
+    { 220, 0x0, 0,    0 },
+    { 216, 0x4, 0,    0 },
+    { 202, 0x0, 0,    0 },
+    { 220, 0x4, 0,    0 },
+    { 202, 0x4, 0,    0 },
+    {   1, 0x0, 0,    0 },
+    {   1, 0x4, 0,    0 },
+    { 230, 0x3, 1,  526 },
+    { 230, 0x3, 1,  527 },
+    { 230, 0x3, 1,  528 },
+    { 230, 0x3, 2,  529 },
+    { 240, 0x4, 0,    0 },
+    { 233, 0x0, 0,    0 },
+    { 234, 0x0, 0,    0 },
+    {   0, 0x3, 1,  531 },
+    {   0, 0x3, 1,  532 },
+    {   0, 0x1, 2,  533 },
+    {   0, 0x1, 2,  535 },
+    {   0, 0x3, 1,  537 },
+    {   0, 0x1, 2,  538 },
+    {   0, 0x1, 2,  540 },
+    {   0, 0x1, 2,  542 },
+    {   0, 0x1, 2,  544 },
+    {   0, 0x1, 2,  546 },
+    {   0, 0x1, 2,  548 },
+    {   0, 0x1, 3,  550 },
+    {   0, 0x1, 2,  553 },
+    {   0, 0x1, 2,  555 },
+    {   0, 0x1, 2,  557 },
+    {   0, 0x1, 2,  559 },
+    {   0, 0x1, 2,  561 },
+    {   0, 0x1, 2,  563 },
+    {   0, 0x1, 3,  565 },
+    {   0, 0x1, 2,  568 },
+    {   0, 0x1, 2,  570 },
+    {   0, 0x1, 2,  572 },
+    {   0, 0x1, 2,  574 },
+    {   0, 0x1, 2,  576 },
+    {   0, 0x1, 2,  578 },
+    {   0, 0x1, 2,  580 },
+    {   0, 0x1, 2,  582 },
+    {   0, 0x1, 2,  584 },
+    {   0, 0x1, 2,  586 },
+    {   0, 0x1, 2,  588 },
+    {   0, 0x1, 2,  590 },
+    {   0, 0x1, 2,  592 },
+    {   0, 0x1, 2,  594 },
+    {   0, 0x1, 2,  596 },
+    {   0, 0x1, 2,  598 },
+    {   0, 0x1, 2,  600 },
+    {   0, 0x1, 2,  602 },
+    {   0, 0x1, 2,  604 },
+    {   0, 0x1, 2,  606 },
+    {   0, 0x1, 2,  608 },
+    {   0, 0x1, 2,  610 },
+    {   0, 0x1, 2,  612 },
+    {   0, 0x1, 2,  614 },
+    {   0, 0x1, 2,  616 },
+    {   0, 0x1, 2,  618 },
+    {   0, 0x1, 2,  620 },
+    {   0, 0x1, 2,  622 },
+    {   0, 0x1, 2,  624 },
+    {   0, 0x1, 2,  626 },
+    {   0, 0x1, 2,  628 },
+    {   0, 0x1, 2,  630 },
+    {   0, 0x1, 2,  632 },
+    {   0, 0x1, 2,  634 },
+    {   0, 0x1, 2,  636 },
+    {   0, 0x1, 2,  638 },
+    {   0, 0x1, 2,  640 },
+    {   0, 0x1, 2,  642 },
+    {   0, 0x1, 2,  644 },
+    {   0, 0x1, 2,  646 },
+    {   0, 0x1, 2,  648 },
+    {   0, 0x1, 2,  650 },
+    {   0, 0x1, 2,  652 },
+    {   0, 0x1, 2,  654 },
+    {   0, 0x1, 2,  656 },
+    {   0, 0x1, 2,  658 },
+    {   0, 0x1, 2,  660 },
+    {   0, 0x1, 2,  662 },
+    {   0, 0x1, 2,  664 },
+    {   0, 0x1, 2,  666 },
+    {   0, 0x1, 2,  668 },
+    {   0, 0x1, 2,  670 },
+    {   0, 0x1, 2,  672 },
+    {   0, 0x1, 2,  674 },
+    {   0, 0x1, 2,  676 },
+    {   0, 0x1, 2,  678 },
+    {   0, 0x1, 2,  680 },
+    {   0, 0x1, 2,  682 },
+    {   0, 0x1, 2,  684 },
+    { 222, 0x0, 0,    0 },
+    { 228, 0x0, 0,    0 },
+    {  10, 0x0, 0,    0 },
+    {  11, 0x0, 0,    0 },
+    {  12, 0x0, 0,    0 },
+    {  13, 0x0, 0,    0 },
+    {  14, 0x0, 0,    0 },
+    {  15, 0x0, 0,    0 },
+    {  16, 0x0, 0,    0 },
+    {  17, 0x0, 0,    0 },
+    {  18, 0x0, 0,    0 },
+    {  19, 0x0, 0,    0 },
+    {  20, 0x0, 0,    0 },
+    {  21, 0x0, 0,    0 },
+    {  22, 0x0, 0,    0 },
+    {  23, 0x0, 0,    0 },
+    {  24, 0x0, 0,    0 },
+    {  25, 0x0, 0,    0 },
+    {  30, 0x0, 0,    0 },
+    {  31, 0x0, 0,    0 },
+    {  32, 0x0, 0,    0 },
+    {   0, 0x1, 2,  686 },
+    {   0, 0x1, 2,  688 },
+    {   0, 0x1, 2,  690 },
+    {   0, 0x1, 2,  692 },
+    {   0, 0x1, 2,  694 },
+    {  27, 0x0, 0,    0 },
+    {  28, 0x0, 0,    0 },
+    {  29, 0x0, 0,    0 },
+    {  33, 0x0, 0,    0 },
+    {  34, 0x0, 0,    0 },
+    {  35, 0x0, 0,    0 },
+    {   0, 0x1, 2,  696 },
+    {   0, 0x1, 2,  698 },
+    {   0, 0x1, 2,  700 },
+    {  36, 0x0, 0,    0 },
+    {   0, 0x1, 2,  702 },
+    {   0, 0x1, 2,  704 },
+    {   0, 0x1, 2,  706 },
+    {   7, 0x4, 0,    0 },
+    {   9, 0x0, 0,    0 },
+    {   0, 0x3, 2,  708 },
+    {   0, 0x3, 2,  710 },
+    {   0, 0x3, 2,  712 },
+    {   0, 0x3, 2,  714 },
+    {   0, 0x3, 2,  716 },
+    {   0, 0x3, 2,  718 },
+    {   0, 0x3, 2,  720 },
+    {   0, 0x3, 2,  722 },
+    {   7, 0x0, 0,    0 },
+    {   0, 0x4, 0,    0 },
+    {   0, 0x1, 2,  724 },
+    {   0, 0x1, 2,  726 },
+    {   0, 0x3, 2,  728 },
+    {   0, 0x3, 2,  730 },
+    {   0, 0x3, 2,  732 },
+    {   0, 0x3, 2,  734 },
+    {   0, 0x3, 2,  736 },
+    {   0, 0x3, 2,  738 },
+    {   0, 0x3, 2,  740 },
+    {   0, 0x3, 2,  742 },
+    {   0, 0x3, 2,  744 },
+    {   0, 0x1, 2,  746 },
+    {   0, 0x1, 2,  748 },
+    {   0, 0x1, 2,  750 },
+    {   0, 0x3, 2,  752 },
+    {   0, 0x3, 2,  754 },
+    {   0, 0x1, 2,  756 },
+    {   0, 0x1, 2,  758 },
+    {   0, 0x1, 2,  760 },
+    {   0, 0x1, 2,  762 },
+    {   0, 0x1, 2,  764 },
+    {  84, 0x0, 0,    0 },
+    {  91, 0x4, 0,    0 },
+    {   0, 0x1, 2,  766 },
+    {   0, 0x1, 2,  768 },
+    {   0, 0x1, 2,  770 },
+    {   0, 0x1, 2,  772 },
+    {   0, 0x1, 3,  774 },
+    {   0, 0x1, 2,  777 },
+    {   0, 0x1, 2,  779 },
+    {   0, 0x1, 2,  781 },
+    {   9, 0x4, 0,    0 },
+    {   0, 0x1, 2,  783 },
+    {   0, 0x1, 2,  785 },
+    {   0, 0x1, 3,  787 },
+    {   0, 0x1, 2,  790 },
+    { 103, 0x0, 0,    0 },
+    { 107, 0x0, 0,    0 },
+    { 118, 0x0, 0,    0 },
+    { 122, 0x0, 0,    0 },
+    { 216, 0x0, 0,    0 },
+    {   0, 0x3, 2,  792 },
+    {   0, 0x3, 2,  794 },
+    {   0, 0x3, 2,  796 },
+    {   0, 0x3, 2,  798 },
+    {   0, 0x3, 2,  800 },
+    {   0, 0x3, 2,  802 },
+    { 129, 0x0, 0,    0 },
+    { 130, 0x0, 0,    0 },
+    {   0, 0x3, 2,  804 },
+    { 132, 0x0, 0,    0 },
+    {   0, 0x3, 2,  806 },
+    {   0, 0x3, 2,  808 },
+    {   0, 0x3, 2,  810 },
+    {   0, 0x3, 2,  812 },
+    {   0, 0x3, 2,  814 },
+    {   0, 0x3, 2,  816 },
+    {   0, 0x3, 2,  818 },
+    {   0, 0x3, 2,  820 },
+    {   0, 0x3, 2,  822 },
+    {   0, 0x3, 2,  824 },
+    {   0, 0x1, 2,  826 },
+    {   0, 0x1, 2,  828 },
+    {   0, 0x1, 2,  830 },
+    {   0, 0x1, 2,  832 },
+    {   0, 0x1, 2,  834 },
+    {   0, 0x1, 2,  836 },
+    {   0, 0x1, 2,  838 },
+    {   0, 0x1, 2,  840 },
+    {   0, 0x1, 2,  842 },
+    {   0, 0x1, 2,  844 },
+    {   0, 0x1, 2,  846 },
+    {   0, 0x1, 2,  848 },
+    { 214, 0x0, 0,    0 },
+    { 218, 0x0, 0,    0 },
+    {   0, 0x1, 2,  850 },
+    {   0, 0x1, 2,  852 },
+    {   0, 0x1, 2,  854 },
+    {   0, 0x1, 2,  856 },
+    {   0, 0x1, 2,  858 },
+    {   0, 0x1, 2,  860 },
+    {   0, 0x1, 2,  862 },
+    {   0, 0x1, 2,  864 },
+    {   0, 0x1, 3,  866 },
+    {   0, 0x1, 3,  869 },
+    {   0, 0x1, 2,  872 },
+    {   0, 0x1, 2,  874 },
+    {   0, 0x1, 2,  876 },
+    {   0, 0x1, 2,  878 },
+    {   0, 0x1, 2,  880 },
+    {   0, 0x1, 2,  882 },
+    {   0, 0x1, 2,  884 },
+    {   0, 0x1, 2,  886 },
+    {   0, 0x1, 2,  888 },
+    {   0, 0x1, 2,  890 },
+    {   0, 0x1, 3,  892 },
+    {   0, 0x1, 3,  895 },
+    {   0, 0x1, 3,  898 },
+    {   0, 0x1, 3,  901 },
+    {   0, 0x1, 2,  904 },
+    {   0, 0x1, 2,  906 },
+    {   0, 0x1, 2,  908 },
+    {   0, 0x1, 2,  910 },
+    {   0, 0x1, 3,  912 },
+    {   0, 0x1, 3,  915 },
+    {   0, 0x1, 2,  918 },
+    {   0, 0x1, 2,  920 },
+    {   0, 0x1, 2,  922 },
+    {   0, 0x1, 2,  924 },
+    {   0, 0x1, 2,  926 },
+    {   0, 0x1, 2,  928 },
+    {   0, 0x1, 2,  930 },
+    {   0, 0x1, 2,  932 },
+    {   0, 0x1, 2,  934 },
+    {   0, 0x1, 2,  936 },
+    {   0, 0x1, 2,  938 },
+    {   0, 0x1, 2,  940 },
+    {   0, 0x1, 2,  942 },
+    {   0, 0x1, 2,  944 },
+    {   0, 0x1, 2,  946 },
+    {   0, 0x1, 2,  948 },
+    {   0, 0x1, 3,  950 },
+    {   0, 0x1, 3,  953 },
+    {   0, 0x1, 2,  956 },
+    {   0, 0x1, 2,  958 },
+    {   0, 0x1, 2,  960 },
+    {   0, 0x1, 2,  962 },
+    {   0, 0x1, 2,  964 },
+    {   0, 0x1, 2,  966 },
+    {   0, 0x1, 2,  968 },
+    {   0, 0x1, 2,  970 },
+    {   0, 0x1, 3,  972 },
+    {   0, 0x1, 3,  975 },
+    {   0, 0x1, 2,  978 },
+    {   0, 0x1, 2,  980 },
+    {   0, 0x1, 2,  982 },
+    {   0, 0x1, 2,  984 },
+    {   0, 0x1, 2,  986 },
+    {   0, 0x1, 2,  988 },
+    {   0, 0x1, 2,  990 },
+    {   0, 0x1, 2,  992 },
+    {   0, 0x1, 2,  994 },
+    {   0, 0x1, 2,  996 },
+    {   0, 0x1, 2,  998 },
+    {   0, 0x1, 2, 1000 },
+    {   0, 0x1, 2, 1002 },
+    {   0, 0x1, 2, 1004 },
+    {   0, 0x1, 2, 1006 },
+    {   0, 0x1, 2, 1008 },
+    {   0, 0x1, 2, 1010 },
+    {   0, 0x1, 2, 1012 },
+    {   0, 0x1, 3, 1014 },
+    {   0, 0x1, 3, 1017 },
+    {   0, 0x1, 3, 1020 },
+    {   0, 0x1, 3, 1023 },
+    {   0, 0x1, 3, 1026 },
+    {   0, 0x1, 3, 1029 },
+    {   0, 0x1, 3, 1032 },
+    {   0, 0x1, 3, 1035 },
+    {   0, 0x1, 2, 1038 },
+    {   0, 0x1, 2, 1040 },
+    {   0, 0x1, 2, 1042 },
+    {   0, 0x1, 2, 1044 },
+    {   0, 0x1, 2, 1046 },
+    {   0, 0x1, 2, 1048 },
+    {   0, 0x1, 2, 1050 },
+    {   0, 0x1, 2, 1052 },
+    {   0, 0x1, 3, 1054 },
+    {   0, 0x1, 3, 1057 },
+    {   0, 0x1, 2, 1060 },
+    {   0, 0x1, 2, 1062 },
+    {   0, 0x1, 2, 1064 },
+    {   0, 0x1, 2, 1066 },
+    {   0, 0x1, 2, 1068 },
+    {   0, 0x1, 2, 1070 },
+    {   0, 0x1, 3, 1072 },
+    {   0, 0x1, 3, 1075 },
+    {   0, 0x1, 3, 1078 },
+    {   0, 0x1, 3, 1081 },
+    {   0, 0x1, 3, 1084 },
+    {   0, 0x1, 3, 1087 },
+    {   0, 0x1, 2, 1090 },
+    {   0, 0x1, 2, 1092 },
+    {   0, 0x1, 2, 1094 },
+    {   0, 0x1, 2, 1096 },
+    {   0, 0x1, 2, 1098 },
+    {   0, 0x1, 2, 1100 },
+    {   0, 0x1, 2, 1102 },
+    {   0, 0x1, 2, 1104 },
+    {   0, 0x1, 2, 1106 },
+    {   0, 0x1, 2, 1108 },
+    {   0, 0x1, 2, 1110 },
+    {   0, 0x1, 2, 1112 },
+    {   0, 0x1, 2, 1114 },
+    {   0, 0x1, 2, 1116 },
+    {   0, 0x1, 3, 1118 },
+    {   0, 0x1, 3, 1121 },
+    {   0, 0x1, 3, 1124 },
+    {   0, 0x1, 3, 1127 },
+    {   0, 0x1, 2, 1130 },
+    {   0, 0x1, 2, 1132 },
+    {   0, 0x1, 2, 1134 },
+    {   0, 0x1, 2, 1136 },
+    {   0, 0x1, 2, 1138 },
+    {   0, 0x1, 2, 1140 },
+    {   0, 0x1, 2, 1142 },
+    {   0, 0x1, 2, 1144 },
+    {   0, 0x1, 2, 1146 },
+    {   0, 0x1, 2, 1148 },
+    {   0, 0x1, 2, 1150 },
+    {   0, 0x1, 2, 1152 },
+    {   0, 0x1, 2, 1154 },
+    {   0, 0x1, 2, 1156 },
+    {   0, 0x1, 2, 1158 },
+    {   0, 0x1, 2, 1160 },
+    {   0, 0x1, 2, 1162 },
+    {   0, 0x1, 2, 1164 },
+    {   0, 0x1, 2, 1166 },
+    {   0, 0x1, 2, 1168 },
+    {   0, 0x1, 2, 1170 },
+    {   0, 0x1, 2, 1172 },
+    {   0, 0x1, 2, 1174 },
+    {   0, 0x1, 2, 1176 },
+    {   0, 0x1, 2, 1178 },
+    {   0, 0x1, 2, 1180 },
+    {   0, 0x1, 2, 1182 },
+    {   0, 0x1, 2, 1184 },
+    {   0, 0x1, 2, 1186 },
+    {   0, 0x1, 2, 1188 },
+    {   0, 0x1, 2, 1190 },
+    {   0, 0x1, 2, 1192 },
+    {   0, 0x1, 2, 1194 },
+    {   0, 0x1, 2, 1196 },
+    {   0, 0x1, 2, 1198 },
+    {   0, 0x1, 3, 1200 },
+    {   0, 0x1, 3, 1203 },
+    {   0, 0x1, 3, 1206 },
+    {   0, 0x1, 3, 1209 },
+    {   0, 0x1, 3, 1212 },
+    {   0, 0x1, 3, 1215 },
+    {   0, 0x1, 3, 1218 },
+    {   0, 0x1, 3, 1221 },
+    {   0, 0x1, 3, 1224 },
+    {   0, 0x1, 3, 1227 },
+    {   0, 0x1, 3, 1230 },
+    {   0, 0x1, 3, 1233 },
+    {   0, 0x1, 3, 1236 },
+    {   0, 0x1, 3, 1239 },
+    {   0, 0x1, 3, 1242 },
+    {   0, 0x1, 3, 1245 },
+    {   0, 0x1, 3, 1248 },
+    {   0, 0x1, 3, 1251 },
+    {   0, 0x1, 3, 1254 },
+    {   0, 0x1, 3, 1257 },
+    {   0, 0x1, 2, 1260 },
+    {   0, 0x1, 2, 1262 },
+    {   0, 0x1, 2, 1264 },
+    {   0, 0x1, 2, 1266 },
+    {   0, 0x1, 2, 1268 },
+    {   0, 0x1, 2, 1270 },
+    {   0, 0x1, 3, 1272 },
+    {   0, 0x1, 3, 1275 },
+    {   0, 0x1, 3, 1278 },
+    {   0, 0x1, 3, 1281 },
+    {   0, 0x1, 3, 1284 },
+    {   0, 0x1, 3, 1287 },
+    {   0, 0x1, 3, 1290 },
+    {   0, 0x1, 3, 1293 },
+    {   0, 0x1, 3, 1296 },
+    {   0, 0x1, 3, 1299 },
+    {   0, 0x1, 2, 1302 },
+    {   0, 0x1, 2, 1304 },
+    {   0, 0x1, 2, 1306 },
+    {   0, 0x1, 2, 1308 },
+    {   0, 0x1, 2, 1310 },
+    {   0, 0x1, 2, 1312 },
+    {   0, 0x1, 2, 1314 },
+    {   0, 0x1, 2, 1316 },
+    {   0, 0x1, 3, 1318 },
+    {   0, 0x1, 3, 1321 },
+    {   0, 0x1, 3, 1324 },
+    {   0, 0x1, 3, 1327 },
+    {   0, 0x1, 3, 1330 },
+    {   0, 0x1, 3, 1333 },
+    {   0, 0x1, 3, 1336 },
+    {   0, 0x1, 3, 1339 },
+    {   0, 0x1, 3, 1342 },
+    {   0, 0x1, 3, 1345 },
+    {   0, 0x1, 3, 1348 },
+    {   0, 0x1, 3, 1351 },
+    {   0, 0x1, 3, 1354 },
+    {   0, 0x1, 3, 1357 },
+    {   0, 0x1, 3, 1360 },
+    {   0, 0x1, 3, 1363 },
+    {   0, 0x1, 3, 1366 },
+    {   0, 0x1, 3, 1369 },
+    {   0, 0x1, 3, 1372 },
+    {   0, 0x1, 3, 1375 },
+    {   0, 0x1, 2, 1378 },
+    {   0, 0x1, 2, 1380 },
+    {   0, 0x1, 2, 1382 },
+    {   0, 0x1, 2, 1384 },
+    {   0, 0x1, 3, 1386 },
+    {   0, 0x1, 3, 1389 },
+    {   0, 0x1, 3, 1392 },
+    {   0, 0x1, 3, 1395 },
+    {   0, 0x1, 3, 1398 },
+    {   0, 0x1, 3, 1401 },
+    {   0, 0x1, 3, 1404 },
+    {   0, 0x1, 3, 1407 },
+    {   0, 0x1, 3, 1410 },
+    {   0, 0x1, 3, 1413 },
+    {   0, 0x1, 2, 1416 },
+    {   0, 0x1, 2, 1418 },
+    {   0, 0x1, 2, 1420 },
+    {   0, 0x1, 2, 1422 },
+    {   0, 0x1, 2, 1424 },
+    {   0, 0x1, 2, 1426 },
+    {   0, 0x1, 2, 1428 },
+    {   0, 0x1, 2, 1430 },
+    {   0, 0x1, 2, 1432 },
+    {   0, 0x1, 2, 1434 },
+    {   0, 0x1, 3, 1436 },
+    {   0, 0x1, 3, 1439 },
+    {   0, 0x1, 3, 1442 },
+    {   0, 0x1, 3, 1445 },
+    {   0, 0x1, 3, 1448 },
+    {   0, 0x1, 3, 1451 },
+    {   0, 0x1, 2, 1454 },
+    {   0, 0x1, 2, 1456 },
+    {   0, 0x1, 3, 1458 },
+    {   0, 0x1, 3, 1461 },
+    {   0, 0x1, 3, 1464 },
+    {   0, 0x1, 3, 1467 },
+    {   0, 0x1, 3, 1470 },
+    {   0, 0x1, 3, 1473 },
+    {   0, 0x1, 2, 1476 },
+    {   0, 0x1, 2, 1478 },
+    {   0, 0x1, 3, 1480 },
+    {   0, 0x1, 3, 1483 },
+    {   0, 0x1, 3, 1486 },
+    {   0, 0x1, 3, 1489 },
+    {   0, 0x1, 2, 1492 },
+    {   0, 0x1, 2, 1494 },
+    {   0, 0x1, 3, 1496 },
+    {   0, 0x1, 3, 1499 },
+    {   0, 0x1, 3, 1502 },
+    {   0, 0x1, 3, 1505 },
+    {   0, 0x1, 2, 1508 },
+    {   0, 0x1, 2, 1510 },
+    {   0, 0x1, 3, 1512 },
+    {   0, 0x1, 3, 1515 },
+    {   0, 0x1, 3, 1518 },
+    {   0, 0x1, 3, 1521 },
+    {   0, 0x1, 3, 1524 },
+    {   0, 0x1, 3, 1527 },
+    {   0, 0x1, 2, 1530 },
+    {   0, 0x1, 2, 1532 },
+    {   0, 0x1, 3, 1534 },
+    {   0, 0x1, 3, 1537 },
+    {   0, 0x1, 3, 1540 },
+    {   0, 0x1, 3, 1543 },
+    {   0, 0x1, 3, 1546 },
+    {   0, 0x1, 3, 1549 },
+    {   0, 0x1, 2, 1552 },
+    {   0, 0x1, 2, 1554 },
+    {   0, 0x1, 3, 1556 },
+    {   0, 0x1, 3, 1559 },
+    {   0, 0x1, 3, 1562 },
+    {   0, 0x1, 3, 1565 },
+    {   0, 0x1, 3, 1568 },
+    {   0, 0x1, 3, 1571 },
+    {   0, 0x1, 2, 1574 },
+    {   0, 0x1, 2, 1576 },
+    {   0, 0x1, 3, 1578 },
+    {   0, 0x1, 3, 1581 },
+    {   0, 0x1, 3, 1584 },
+    {   0, 0x1, 3, 1587 },
+    {   0, 0x1, 3, 1590 },
+    {   0, 0x1, 3, 1593 },
+    {   0, 0x1, 2, 1596 },
+    {   0, 0x1, 2, 1598 },
+    {   0, 0x1, 3, 1600 },
+    {   0, 0x1, 3, 1603 },
+    {   0, 0x1, 3, 1606 },
+    {   0, 0x1, 3, 1609 },
+    {   0, 0x1, 2, 1612 },
+    {   0, 0x1, 2, 1614 },
+    {   0, 0x1, 3, 1616 },
+    {   0, 0x1, 3, 1619 },
+    {   0, 0x1, 3, 1622 },
+    {   0, 0x1, 3, 1625 },
+    {   0, 0x1, 2, 1628 },
+    {   0, 0x1, 2, 1630 },
+    {   0, 0x1, 3, 1632 },
+    {   0, 0x1, 3, 1635 },
+    {   0, 0x1, 3, 1638 },
+    {   0, 0x1, 3, 1641 },
+    {   0, 0x1, 3, 1644 },
+    {   0, 0x1, 3, 1647 },
+    {   0, 0x1, 2, 1650 },
+    {   0, 0x1, 3, 1652 },
+    {   0, 0x1, 3, 1655 },
+    {   0, 0x1, 3, 1658 },
+    {   0, 0x1, 2, 1661 },
+    {   0, 0x1, 2, 1663 },
+    {   0, 0x1, 3, 1665 },
+    {   0, 0x1, 3, 1668 },
+    {   0, 0x1, 3, 1671 },
+    {   0, 0x1, 3, 1674 },
+    {   0, 0x1, 3, 1677 },
+    {   0, 0x1, 3, 1680 },
+    {   0, 0x1, 2, 1683 },
+    {   0, 0x1, 2, 1685 },
+    {   0, 0x1, 3, 1687 },
+    {   0, 0x1, 3, 1690 },
+    {   0, 0x1, 3, 1693 },
+    {   0, 0x1, 3, 1696 },
+    {   0, 0x1, 3, 1699 },
+    {   0, 0x1, 3, 1702 },
+    {   0, 0x1, 2, 1705 },
+    {   0, 0x3, 2,  557 },
+    {   0, 0x1, 2, 1707 },
+    {   0, 0x3, 2,  559 },
+    {   0, 0x1, 2, 1709 },
+    {   0, 0x3, 2,  561 },
+    {   0, 0x1, 2, 1711 },
+    {   0, 0x3, 2,  563 },
+    {   0, 0x1, 2, 1713 },
+    {   0, 0x3, 2,  572 },
+    {   0, 0x1, 2, 1715 },
+    {   0, 0x3, 2,  574 },
+    {   0, 0x1, 2, 1717 },
+    {   0, 0x3, 2,  576 },
+    {   0, 0x1, 3, 1719 },
+    {   0, 0x1, 3, 1722 },
+    {   0, 0x1, 4, 1725 },
+    {   0, 0x1, 4, 1729 },
+    {   0, 0x1, 4, 1733 },
+    {   0, 0x1, 4, 1737 },
+    {   0, 0x1, 4, 1741 },
+    {   0, 0x1, 4, 1745 },
+    {   0, 0x1, 3, 1749 },
+    {   0, 0x1, 3, 1752 },
+    {   0, 0x1, 4, 1755 },
+    {   0, 0x1, 4, 1759 },
+    {   0, 0x1, 4, 1763 },
+    {   0, 0x1, 4, 1767 },
+    {   0, 0x1, 4, 1771 },
+    {   0, 0x1, 4, 1775 },
+    {   0, 0x1, 3, 1779 },
+    {   0, 0x1, 3, 1782 },
+    {   0, 0x1, 4, 1785 },
+    {   0, 0x1, 4, 1789 },
+    {   0, 0x1, 4, 1793 },
+    {   0, 0x1, 4, 1797 },
+    {   0, 0x1, 4, 1801 },
+    {   0, 0x1, 4, 1805 },
+    {   0, 0x1, 3, 1809 },
+    {   0, 0x1, 3, 1812 },
+    {   0, 0x1, 4, 1815 },
+    {   0, 0x1, 4, 1819 },
+    {   0, 0x1, 4, 1823 },
+    {   0, 0x1, 4, 1827 },
+    {   0, 0x1, 4, 1831 },
+    {   0, 0x1, 4, 1835 },
+    {   0, 0x1, 3, 1839 },
+    {   0, 0x1, 3, 1842 },
+    {   0, 0x1, 4, 1845 },
+    {   0, 0x1, 4, 1849 },
+    {   0, 0x1, 4, 1853 },
+    {   0, 0x1, 4, 1857 },
+    {   0, 0x1, 4, 1861 },
+    {   0, 0x1, 4, 1865 },
+    {   0, 0x1, 3, 1869 },
+    {   0, 0x1, 3, 1872 },
+    {   0, 0x1, 4, 1875 },
+    {   0, 0x1, 4, 1879 },
+    {   0, 0x1, 4, 1883 },
+    {   0, 0x1, 4, 1887 },
+    {   0, 0x1, 4, 1891 },
+    {   0, 0x1, 4, 1895 },
+    {   0, 0x1, 2, 1899 },
+    {   0, 0x1, 2, 1901 },
+    {   0, 0x1, 3, 1903 },
+    {   0, 0x1, 2, 1906 },
+    {   0, 0x1, 3, 1908 },
+    {   0, 0x1, 2, 1911 },
+    {   0, 0x1, 3, 1913 },
+    {   0, 0x1, 2, 1916 },
+    {   0, 0x1, 2, 1918 },
+    {   0, 0x1, 2, 1920 },
+    {   0, 0x3, 2,  535 },
+    {   0, 0x1, 2, 1922 },
+    {   0, 0x3, 1, 1924 },
+    {   0, 0x1, 2, 1925 },
+    {   0, 0x1, 3, 1927 },
+    {   0, 0x1, 2, 1930 },
+    {   0, 0x1, 3, 1932 },
+    {   0, 0x1, 2, 1935 },
+    {   0, 0x1, 3, 1937 },
+    {   0, 0x1, 2, 1940 },
+    {   0, 0x3, 2,  538 },
+    {   0, 0x1, 2, 1942 },
+    {   0, 0x3, 2,  540 },
+    {   0, 0x1, 2, 1944 },
+    {   0, 0x1, 2, 1946 },
+    {   0, 0x1, 2, 1948 },
+    {   0, 0x1, 2, 1950 },
+    {   0, 0x1, 2, 1952 },
+    {   0, 0x1, 2, 1954 },
+    {   0, 0x1, 3, 1956 },
+    {   0, 0x3, 3,  550 },
+    {   0, 0x1, 2, 1959 },
+    {   0, 0x1, 3, 1961 },
+    {   0, 0x1, 2, 1964 },
+    {   0, 0x1, 2, 1966 },
+    {   0, 0x1, 2, 1968 },
+    {   0, 0x3, 2,  542 },
+    {   0, 0x1, 2, 1970 },
+    {   0, 0x1, 2, 1972 },
+    {   0, 0x1, 2, 1974 },
+    {   0, 0x1, 2, 1976 },
+    {   0, 0x1, 2, 1978 },
+    {   0, 0x1, 3, 1980 },
+    {   0, 0x3, 3,  565 },
+    {   0, 0x1, 2, 1983 },
+    {   0, 0x1, 2, 1985 },
+    {   0, 0x1, 2, 1987 },
+    {   0, 0x1, 3, 1989 },
+    {   0, 0x1, 2, 1992 },
+    {   0, 0x1, 2, 1994 },
+    {   0, 0x1, 2, 1996 },
+    {   0, 0x3, 2,  546 },
+    {   0, 0x1, 2, 1998 },
+    {   0, 0x1, 2, 2000 },
+    {   0, 0x3, 2,  533 },
+    {   0, 0x3, 1, 2002 },
+    {   0, 0x1, 3, 2003 },
+    {   0, 0x1, 2, 2006 },
+    {   0, 0x1, 3, 2008 },
+    {   0, 0x1, 2, 2011 },
+    {   0, 0x1, 3, 2013 },
+    {   0, 0x1, 2, 2016 },
+    {   0, 0x3, 2,  544 },
+    {   0, 0x1, 2, 2018 },
+    {   0, 0x3, 2,  548 },
+    {   0, 0x1, 2, 2020 },
+    {   0, 0x3, 1, 2022 },
+    {   0, 0x3, 1, 2023 },
+    {   0, 0x3, 1, 2024 },
+    {   0, 0x3, 1, 2025 },
+    {   0, 0x3, 1, 2026 },
+    {   0, 0x3, 2,   10 },
+    {   0, 0x1, 2, 2027 },
+    {   0, 0x1, 2, 2029 },
+    {   0, 0x1, 2, 2031 },
+    {   0, 0x1, 2, 2033 },
+    {   0, 0x1, 2, 2035 },
+    {   0, 0x1, 2, 2037 },
+    {   0, 0x1, 2, 2039 },
+    {   0, 0x1, 2, 2041 },
+    {   0, 0x1, 2, 2043 },
+    {   0, 0x1, 2, 2045 },
+    {   0, 0x1, 2, 2047 },
+    {   0, 0x1, 2, 2049 },
+    {   0, 0x1, 2, 2051 },
+    {   0, 0x1, 2, 2053 },
+    {   0, 0x1, 2, 2055 },
+    {   0, 0x1, 2, 2057 },
+    {   0, 0x1, 2, 2059 },
+    {   0, 0x1, 2, 2061 },
+    {   0, 0x1, 2, 2063 },
+    {   0, 0x1, 2, 2065 },
+    {   0, 0x1, 2, 2067 },
+    {   0, 0x1, 2, 2069 },
+    {   0, 0x1, 2, 2071 },
+    {   0, 0x1, 2, 2073 },
+    {   0, 0x1, 2, 2075 },
+    {   0, 0x1, 2, 2077 },
+    {   0, 0x1, 2, 2079 },
+    {   0, 0x1, 2, 2081 },
+    {   0, 0x1, 2, 2083 },
+    {   0, 0x1, 2, 2085 },
+    {   0, 0x1, 2, 2087 },
+    {   0, 0x1, 2, 2089 },
+    {   0, 0x1, 2, 2091 },
+    {   0, 0x1, 2, 2093 },
+    {   0, 0x1, 2, 2095 },
+    {   0, 0x1, 2, 2097 },
+    {   0, 0x1, 2, 2099 },
+    {   0, 0x1, 2, 2101 },
+    {   0, 0x1, 2, 2103 },
+    {   0, 0x1, 2, 2105 },
+    {   0, 0x1, 2, 2107 },
+    {   0, 0x1, 2, 2109 },
+    {   0, 0x1, 2, 2111 },
+    {   0, 0x1, 2, 2113 },
+    {   0, 0x3, 1, 2115 },
+    {   0, 0x3, 1, 2116 },
+    {   0, 0x3, 2, 2117 },
+    { 224, 0x0, 0,    0 },
+    {   0, 0x1, 2, 2119 },
+    {   0, 0x1, 2, 2121 },
+    {   0, 0x1, 2, 2123 },
+    {   0, 0x1, 2, 2125 },
+    {   0, 0x1, 2, 2127 },
+    {   0, 0x1, 2, 2129 },
+    {   0, 0x1, 2, 2131 },
+    {   0, 0x1, 2, 2133 },
+    {   0, 0x1, 2, 2135 },
+    {   0, 0x1, 2, 2137 },
+    {   0, 0x1, 2, 2139 },
+    {   0, 0x1, 2, 2141 },
+    {   0, 0x1, 2, 2143 },
+    {   0, 0x1, 2, 2145 },
+    {   0, 0x1, 2, 2147 },
+    {   0, 0x1, 2, 2149 },
+    {   0, 0x1, 2, 2151 },
+    {   0, 0x1, 2, 2153 },
+    {   0, 0x1, 2, 2155 },
+    {   0, 0x1, 2, 2157 },
+    {   0, 0x1, 2, 2159 },
+    {   0, 0x1, 2, 2161 },
+    {   0, 0x1, 2, 2163 },
+    {   0, 0x1, 2, 2165 },
+    {   0, 0x1, 2, 2167 },
+    {   0, 0x1, 2, 2169 },
+    {   8, 0x4, 0,    0 },
+    {   0, 0x1, 2, 2171 },
+    {   0, 0x1, 2, 2173 },
+    {   0, 0x1, 2, 2175 },
+    {   0, 0x1, 2, 2177 },
+    {   0, 0x1, 2, 2179 },
+    {   0, 0x1, 2, 2181 },
+    {   0, 0x1, 2, 2183 },
+    {   0, 0x1, 2, 2185 },
+    {   0, 0x1, 2, 2187 },
+    {   0, 0x1, 2, 2189 },
+    {   0, 0x1, 2, 2191 },
+    {   0, 0x1, 2, 2193 },
+    {   0, 0x1, 2, 2195 },
+    {   0, 0x1, 2, 2197 },
+    {   0, 0x1, 2, 2199 },
+    {   0, 0x1, 2, 2201 },
+    {   0, 0x1, 2, 2203 },
+    {   0, 0x1, 2, 2205 },
+    {   0, 0x1, 2, 2207 },
+    {   0, 0x1, 2, 2209 },
+    {   0, 0x1, 2, 2211 },
+    {   0, 0x1, 2, 2213 },
+    {   0, 0x1, 2, 2215 },
+    {   0, 0x1, 2, 2217 },
+    {   0, 0x1, 2, 2219 },
+    {   0, 0x1, 2, 2221 },
+    {   0, 0x1, 2, 2223 },
+    {   0, 0x1, 2, 2225 },
+    {   0, 0x1, 2, 2227 },
+    {   0, 0x1, 2, 2229 },
+    {   0, 0x1, 2, 2231 },
+    {   0, 0x1, 2, 2233 },
+    {   0, 0x1, 0,    0 },
+    {   0, 0x3, 1, 2235 },
+    {   0, 0x3, 1, 2236 },
+    {   0, 0x3, 1, 2237 },
+    {   0, 0x3, 1, 2238 },
+    {   0, 0x3, 1, 2239 },
+    {   0, 0x3, 1, 2240 },
+    {   0, 0x3, 1, 2241 },
+    {   0, 0x3, 1, 2242 },
+    {   0, 0x3, 1, 2243 },
+    {   0, 0x3, 1, 2244 },
+    {   0, 0x3, 1, 2245 },
+    {   0, 0x3, 1, 2246 },
+    {   0, 0x3, 1, 2247 },
+    {   0, 0x3, 1, 2248 },
+    {   0, 0x3, 1, 2249 },
+    {   0, 0x3, 1, 2250 },
+    {   0, 0x3, 1, 2251 },
+    {   0, 0x3, 1, 2252 },
+    {   0, 0x3, 1, 2253 },
+    {   0, 0x3, 1, 2254 },
+    {   0, 0x3, 1, 2255 },
+    {   0, 0x3, 1, 2256 },
+    {   0, 0x3, 1, 2257 },
+    {   0, 0x3, 1, 2258 },
+    {   0, 0x3, 1, 2259 },
+    {   0, 0x3, 1, 2260 },
+    {   0, 0x3, 1, 2261 },
+    {   0, 0x3, 1, 2262 },
+    {   0, 0x3, 1, 2263 },
+    {   0, 0x3, 1, 2264 },
+    {   0, 0x3, 1, 2265 },
+    {   0, 0x3, 1, 2266 },
+    {   0, 0x3, 1, 2267 },
+    {   0, 0x3, 1, 2268 },
+    {   0, 0x3, 1, 2269 },
+    {   0, 0x3, 1, 2270 },
+    {   0, 0x3, 1, 2271 },
+    {   0, 0x3, 1, 2272 },
+    {   0, 0x3, 1, 2273 },
+    {   0, 0x3, 1, 2274 },
+    {   0, 0x3, 1, 2275 },
+    {   0, 0x3, 1, 2276 },
+    {   0, 0x3, 1, 2277 },
+    {   0, 0x3, 1, 2278 },
+    {   0, 0x3, 1, 2279 },
+    {   0, 0x3, 1, 2280 },
+    {   0, 0x3, 1, 2281 },
+    {   0, 0x3, 1, 2282 },
+    {   0, 0x3, 1, 2283 },
+    {   0, 0x3, 1, 2284 },
+    {   0, 0x3, 1, 2285 },
+    {   0, 0x3, 1, 2286 },
+    {   0, 0x3, 1, 2287 },
+    {   0, 0x3, 1, 2288 },
+    {   0, 0x3, 1, 2289 },
+    {   0, 0x3, 1, 2290 },
+    {   0, 0x3, 1, 2291 },
+    {   0, 0x3, 1, 2292 },
+    {   0, 0x3, 1, 2293 },
+    {   0, 0x3, 1, 2294 },
+    {   0, 0x3, 1, 2295 },
+    {   0, 0x3, 1, 2296 },
+    {   0, 0x3, 1, 2297 },
+    {   0, 0x3, 1, 2298 },
+    {   0, 0x3, 1, 2299 },
+    {   0, 0x3, 1, 2300 },
+    {   0, 0x3, 1, 2301 },
+    {   0, 0x3, 1, 2302 },
+    {   0, 0x3, 1, 2303 },
+    {   0, 0x3, 1, 2304 },
+    {   0, 0x3, 1, 2305 },
+    {   0, 0x3, 1, 2306 },
+    {   0, 0x3, 1, 2307 },
+    {   0, 0x3, 1, 2308 },
+    {   0, 0x3, 1, 2309 },
+    {   0, 0x3, 1, 2310 },
+    {   0, 0x3, 1, 2311 },
+    {   0, 0x3, 1, 2312 },
+    {   0, 0x3, 1, 2313 },
+    {   0, 0x3, 1, 2314 },
+    {   0, 0x3, 1, 2315 },
+    {   0, 0x3, 1, 2316 },
+    {   0, 0x3, 1, 2317 },
+    {   0, 0x3, 1, 2318 },
+    {   0, 0x3, 1, 2319 },
+    {   0, 0x3, 1, 2320 },
+    {   0, 0x3, 1, 2321 },
+    {   0, 0x3, 1, 2322 },
+    {   0, 0x3, 1, 2323 },
+    {   0, 0x3, 1, 2324 },
+    {   0, 0x3, 1, 2325 },
+    {   0, 0x3, 1, 2326 },
+    {   0, 0x3, 1, 2327 },
+    {   0, 0x3, 1, 2328 },
+    {   0, 0x3, 1, 2329 },
+    {   0, 0x3, 1, 2330 },
+    {   0, 0x3, 1, 2331 },
+    {   0, 0x3, 1, 2332 },
+    {   0, 0x3, 1, 2333 },
+    {   0, 0x3, 1, 2334 },
+    {   0, 0x3, 1, 2335 },
+    {   0, 0x3, 1, 2336 },
+    {   0, 0x3, 1, 2337 },
+    {   0, 0x3, 1, 2338 },
+    {   0, 0x3, 1, 2339 },
+    {   0, 0x3, 1, 2340 },
+    {   0, 0x3, 1, 2341 },
+    {   0, 0x3, 1, 2342 },
+    {   0, 0x3, 1, 2343 },
+    {   0, 0x3, 1, 2344 },
+    {   0, 0x3, 1, 2345 },
+    {   0, 0x3, 1, 2346 },
+    {   0, 0x3, 1, 2347 },
+    {   0, 0x3, 1, 2348 },
+    {   0, 0x3, 1, 2349 },
+    {   0, 0x3, 1, 2350 },
+    {   0, 0x3, 1, 2351 },
+    {   0, 0x3, 1, 2352 },
+    {   0, 0x3, 1, 2353 },
+    {   0, 0x3, 1, 2354 },
+    {   0, 0x3, 1, 2355 },
+    {   0, 0x3, 1, 2356 },
+    {   0, 0x3, 1, 2357 },
+    {   0, 0x3, 1, 2358 },
+    {   0, 0x3, 1, 2359 },
+    {   0, 0x3, 1, 2360 },
+    {   0, 0x3, 1, 2361 },
+    {   0, 0x3, 1, 2362 },
+    {   0, 0x3, 1, 2363 },
+    {   0, 0x3, 1, 2364 },
+    {   0, 0x3, 1, 2365 },
+    {   0, 0x3, 1, 2366 },
+    {   0, 0x3, 1, 2367 },
+    {   0, 0x3, 1, 2368 },
+    {   0, 0x3, 1, 2369 },
+    {   0, 0x3, 1, 2370 },
+    {   0, 0x3, 1, 2371 },
+    {   0, 0x3, 1, 2372 },
+    {   0, 0x3, 1, 2373 },
+    {   0, 0x3, 1, 2374 },
+    {   0, 0x3, 1, 2375 },
+    {   0, 0x3, 1, 2376 },
+    {   0, 0x3, 1, 2377 },
+    {   0, 0x3, 1, 2378 },
+    {   0, 0x3, 1, 2379 },
+    {   0, 0x3, 1, 2380 },
+    {   0, 0x3, 1, 2381 },
+    {   0, 0x3, 1, 2382 },
+    {   0, 0x3, 1, 2383 },
+    {   0, 0x3, 1, 2384 },
+    {   0, 0x3, 1, 2385 },
+    {   0, 0x3, 1, 2386 },
+    {   0, 0x3, 1, 2387 },
+    {   0, 0x3, 1, 2388 },
+    {   0, 0x3, 1, 2389 },
+    {   0, 0x3, 1, 2390 },
+    {   0, 0x3, 1, 2391 },
+    {   0, 0x3, 1, 2392 },
+    {   0, 0x3, 1, 2393 },
+    {   0, 0x3, 1, 2394 },
+    {   0, 0x3, 1, 2395 },
+    {   0, 0x3, 1, 2396 },
+    {   0, 0x3, 1, 2397 },
+    {   0, 0x3, 1, 2398 },
+    {   0, 0x3, 1, 2399 },
+    {   0, 0x3, 1, 2400 },
+    {   0, 0x3, 1, 2401 },
+    {   0, 0x3, 1, 2402 },
+    {   0, 0x3, 1, 2403 },
+    {   0, 0x3, 1, 2404 },
+    {   0, 0x3, 1, 2405 },
+    {   0, 0x3, 1, 2406 },
+    {   0, 0x3, 1, 2407 },
+    {   0, 0x3, 1, 2408 },
+    {   0, 0x3, 1, 2409 },
+    {   0, 0x3, 1, 2410 },
+    {   0, 0x3, 1, 2411 },
+    {   0, 0x3, 1, 2412 },
+    {   0, 0x3, 1, 2413 },
+    {   0, 0x3, 1, 2414 },
+    {   0, 0x3, 1, 2415 },
+    {   0, 0x3, 1, 2416 },
+    {   0, 0x3, 1, 2417 },
+    {   0, 0x3, 1, 2418 },
+    {   0, 0x3, 1, 2419 },
+    {   0, 0x3, 1, 2420 },
+    {   0, 0x3, 1, 2421 },
+    {   0, 0x3, 1, 2422 },
+    {   0, 0x3, 1, 2423 },
+    {   0, 0x3, 1, 2424 },
+    {   0, 0x3, 1, 2425 },
+    {   0, 0x3, 1, 2426 },
+    {   0, 0x3, 1, 2427 },
+    {   0, 0x3, 1, 2428 },
+    {   0, 0x3, 1, 2429 },
+    {   0, 0x3, 1, 2430 },
+    {   0, 0x3, 1, 2431 },
+    {   0, 0x3, 1, 2432 },
+    {   0, 0x3, 1, 2433 },
+    {   0, 0x3, 1, 2434 },
+    {   0, 0x3, 1, 2435 },
+    {   0, 0x3, 1, 2436 },
+    {   0, 0x3, 1, 2437 },
+    {   0, 0x3, 1, 2438 },
+    {   0, 0x3, 1, 2439 },
+    {   0, 0x3, 1, 2440 },
+    {   0, 0x3, 1, 2441 },
+    {   0, 0x3, 1, 2442 },
+    {   0, 0x3, 1, 2443 },
+    {   0, 0x3, 1, 2444 },
+    {   0, 0x3, 1, 2445 },
+    {   0, 0x3, 1, 2446 },
+    {   0, 0x3, 1, 2447 },
+    {   0, 0x3, 1, 2448 },
+    {   0, 0x3, 1, 2449 },
+    {   0, 0x3, 1, 2450 },
+    {   0, 0x3, 1, 2451 },
+    {   0, 0x3, 1, 2452 },
+    {   0, 0x3, 1, 2453 },
+    {   0, 0x3, 1, 2454 },
+    {   0, 0x3, 1, 2455 },
+    {   0, 0x3, 1, 2456 },
+    {   0, 0x3, 1, 2457 },
+    {   0, 0x3, 1, 2458 },
+    {   0, 0x3, 1, 2459 },
+    {   0, 0x3, 1, 2460 },
+    {   0, 0x3, 1, 2461 },
+    {   0, 0x3, 1, 2462 },
+    {   0, 0x3, 1, 2463 },
+    {   0, 0x3, 1, 2464 },
+    {   0, 0x3, 1, 2465 },
+    {   0, 0x3, 1, 2466 },
+    {   0, 0x3, 1, 2467 },
+    {   0, 0x3, 1, 2468 },
+    {   0, 0x3, 1, 2469 },
+    {   0, 0x3, 1, 2470 },
+    {   0, 0x3, 1, 2471 },
+    {   0, 0x3, 1, 2472 },
+    {   0, 0x3, 1, 2473 },
+    {   0, 0x3, 1, 2474 },
+    {   0, 0x3, 1, 2475 },
+    {   0, 0x3, 1, 2476 },
+    {   0, 0x3, 1, 2477 },
+    {   0, 0x3, 1, 2478 },
+    {   0, 0x3, 1, 2479 },
+    {   0, 0x3, 1, 2480 },
+    {   0, 0x3, 1, 2481 },
+    {   0, 0x3, 1, 2482 },
+    {   0, 0x3, 1, 2483 },
+    {   0, 0x3, 1, 2484 },
+    {   0, 0x3, 1, 2485 },
+    {   0, 0x3, 1, 2486 },
+    {   0, 0x3, 1, 2487 },
+    {   0, 0x3, 1, 2488 },
+    {   0, 0x3, 1, 2489 },
+    {   0, 0x3, 1, 2490 },
+    {   0, 0x3, 1, 2491 },
+    {   0, 0x3, 1, 2492 },
+    {   0, 0x3, 1, 2493 },
+    {   0, 0x3, 1, 2494 },
+    {   0, 0x3, 1, 2495 },
+    {   0, 0x3, 1, 2496 },
+    {   0, 0x3, 1, 2497 },
+    {   0, 0x3, 1, 2498 },
+    {   0, 0x3, 1, 2499 },
+    {   0, 0x3, 1, 2500 },
+    {   0, 0x3, 1, 2501 },
+    {   0, 0x3, 1, 2502 },
+    {   0, 0x3, 1, 2503 },
+    {   0, 0x3, 1, 2504 },
+    {   0, 0x3, 1, 2505 },
+    {   0, 0x3, 1, 2506 },
+    {   0, 0x3, 1, 2507 },
+    {   0, 0x3, 1, 2508 },
+    {   0, 0x3, 1, 2509 },
+    {   0, 0x3, 1, 2510 },
+    {   0, 0x3, 1, 2511 },
+    {   0, 0x3, 1, 2512 },
+    {   0, 0x3, 1, 2513 },
+    {   0, 0x3, 1, 2514 },
+    {   0, 0x3, 1, 2515 },
+    {   0, 0x3, 1, 2516 },
+    {   0, 0x3, 1, 2517 },
+    {   0, 0x3, 1, 2518 },
+    {   0, 0x3, 1, 2519 },
+    {   0, 0x3, 1, 2520 },
+    {   0, 0x3, 1, 2521 },
+    {   0, 0x3, 1, 2522 },
+    {   0, 0x3, 1, 2523 },
+    {   0, 0x3, 1, 2524 },
+    {   0, 0x3, 1, 2525 },
+    {   0, 0x3, 1, 2526 },
+    {   0, 0x3, 1, 2527 },
+    {   0, 0x3, 1, 2528 },
+    {   0, 0x3, 1, 2529 },
+    {   0, 0x3, 1, 2530 },
+    {   0, 0x3, 1, 2531 },
+    {   0, 0x3, 1, 2532 },
+    {   0, 0x3, 1, 2533 },
+    {   0, 0x3, 1, 2534 },
+    {   0, 0x3, 1, 2535 },
+    {   0, 0x3, 1, 2536 },
+    {   0, 0x3, 1, 2537 },
+    {   0, 0x3, 1, 2538 },
+    {   0, 0x3, 1, 2539 },
+    {   0, 0x3, 1, 2540 },
+    {   0, 0x3, 1, 2541 },
+    {   0, 0x3, 1, 2542 },
+    {   0, 0x3, 1, 2543 },
+    {   0, 0x3, 1, 2544 },
+    {   0, 0x3, 1, 2545 },
+    {   0, 0x3, 1, 2546 },
+    {   0, 0x3, 1, 2547 },
+    {   0, 0x3, 1, 2548 },
+    {   0, 0x3, 1, 2549 },
+    {   0, 0x3, 1, 2550 },
+    {   0, 0x3, 1, 2551 },
+    {   0, 0x3, 1, 2552 },
+    {   0, 0x3, 1, 2553 },
+    {   0, 0x3, 1, 2554 },
+    {   0, 0x3, 1, 2555 },
+    {   0, 0x3, 1, 2556 },
+    {   0, 0x3, 1, 2557 },
+    {   0, 0x3, 1, 2558 },
+    {   0, 0x3, 1, 2559 },
+    {   0, 0x3, 1, 2560 },
+    {   0, 0x3, 1, 2561 },
+    {   0, 0x3, 1, 2562 },
+    {   0, 0x3, 1, 2563 },
+    {   0, 0x3, 1, 2564 },
+    {   0, 0x3, 1, 2565 },
+    {   0, 0x3, 1, 2566 },
+    {   0, 0x3, 1, 2567 },
+    {   0, 0x3, 1, 2568 },
+    {   0, 0x3, 1, 2569 },
+    {   0, 0x3, 1, 2570 },
+    {   0, 0x3, 1, 2571 },
+    {   0, 0x3, 1, 2572 },
+    {   0, 0x3, 1, 2573 },
+    {   0, 0x3, 1, 2574 },
+    {   0, 0x3, 1, 2575 },
+    {   0, 0x3, 1, 2576 },
+    {   0, 0x3, 1, 2577 },
+    {   0, 0x3, 1, 2578 },
+    {   0, 0x3, 1, 2579 },
+    {   0, 0x3, 1, 2580 },
+    {   0, 0x3, 1, 2581 },
+    {   0, 0x3, 1, 2582 },
+    {   0, 0x3, 1, 2583 },
+    {   0, 0x3, 1, 2584 },
+    {   0, 0x3, 1, 2585 },
+    {   0, 0x3, 1, 2586 },
+    {   0, 0x3, 1, 2587 },
+    {   0, 0x3, 1, 2588 },
+    {   0, 0x3, 1, 2589 },
+    {   0, 0x3, 1, 2590 },
+    {   0, 0x3, 1, 2591 },
+    {   0, 0x3, 1, 2592 },
+    {   0, 0x3, 1, 2593 },
+    {   0, 0x3, 1, 2594 },
+    {   0, 0x3, 1, 2595 },
+    {   0, 0x3, 1, 2596 },
+    {   0, 0x3, 1, 2597 },
+    {   0, 0x3, 1, 2598 },
+    {   0, 0x3, 1, 2599 },
+    {   0, 0x3, 1, 2600 },
+    {   0, 0x3, 1, 2601 },
+    {   0, 0x3, 1, 2602 },
+    {   0, 0x3, 1, 2603 },
+    {   0, 0x3, 1, 2604 },
+    {   0, 0x3, 1, 2605 },
+    {   0, 0x3, 1, 2606 },
+    {   0, 0x3, 1, 2607 },
+    {   0, 0x3, 1, 2608 },
+    {   0, 0x3, 1, 2609 },
+    {   0, 0x3, 1, 2610 },
+    {   0, 0x3, 1, 2611 },
+    {   0, 0x3, 1, 2612 },
+    {   0, 0x3, 1, 2613 },
+    {   0, 0x3, 1, 2614 },
+    {   0, 0x3, 1, 2615 },
+    {   0, 0x3, 1, 2616 },
+    {   0, 0x3, 1, 2617 },
+    {   0, 0x3, 1, 2618 },
+    {   0, 0x3, 1, 2619 },
+    {   0, 0x3, 1, 2620 },
+    {   0, 0x3, 1, 2621 },
+    {   0, 0x3, 1, 2622 },
+    {   0, 0x3, 1, 2623 },
+    {   0, 0x3, 1, 2624 },
+    {   0, 0x3, 1, 2625 },
+    {   0, 0x3, 1, 2626 },
+    {   0, 0x3, 1, 2627 },
+    {   0, 0x3, 1, 2628 },
+    {   0, 0x3, 1, 2629 },
+    {   0, 0x3, 1, 2630 },
+    {   0, 0x3, 1, 2631 },
+    {   0, 0x3, 1, 2632 },
+    {   0, 0x3, 1, 2633 },
+    {   0, 0x3, 1, 2634 },
+    {   0, 0x3, 1, 2635 },
+    {   0, 0x3, 1, 2636 },
+    {   0, 0x3, 1, 2637 },
+    {   0, 0x3, 1, 2638 },
+    {   0, 0x3, 1, 2639 },
+    {   0, 0x3, 1, 2640 },
+    {   0, 0x3, 1, 2641 },
+    {   0, 0x3, 1, 2642 },
+    {   0, 0x3, 1, 2643 },
+    {   0, 0x3, 1, 2644 },
+    {   0, 0x3, 1, 2645 },
+    {   0, 0x3, 1, 2646 },
+    {   0, 0x3, 1, 2647 },
+    {   0, 0x3, 1, 2648 },
+    {   0, 0x3, 1, 2649 },
+    {   0, 0x3, 1, 2650 },
+    {   0, 0x3, 1, 2651 },
+    {   0, 0x3, 1, 2652 },
+    {   0, 0x3, 1, 2653 },
+    {   0, 0x3, 1, 2654 },
+    {   0, 0x3, 1, 2655 },
+    {   0, 0x3, 1, 2656 },
+    {   0, 0x3, 1, 2657 },
+    {   0, 0x3, 1, 2658 },
+    {   0, 0x3, 1, 2659 },
+    {   0, 0x3, 2, 2660 },
+    {  26, 0x0, 0,    0 },
+    {   0, 0x3, 2, 2662 },
+    {   0, 0x3, 2, 2664 },
+    {   0, 0x3, 2, 2666 },
+    {   0, 0x3, 3, 2668 },
+    {   0, 0x3, 3, 2671 },
+    {   0, 0x3, 2, 2674 },
+    {   0, 0x3, 2, 2676 },
+    {   0, 0x3, 2, 2678 },
+    {   0, 0x3, 2, 2680 },
+    {   0, 0x3, 2, 2682 },
+    {   0, 0x3, 2, 2684 },
+    {   0, 0x3, 2, 2686 },
+    {   0, 0x3, 2, 2688 },
+    {   0, 0x3, 2, 2690 },
+    {   0, 0x3, 2, 2692 },
+    {   0, 0x3, 2, 2694 },
+    {   0, 0x3, 2, 2696 },
+    {   0, 0x3, 2, 2698 },
+    {   0, 0x3, 2, 2700 },
+    {   0, 0x3, 2, 2702 },
+    {   0, 0x3, 2, 2704 },
+    {   0, 0x3, 2, 2706 },
+    {   0, 0x3, 2, 2708 },
+    {   0, 0x3, 2, 2710 },
+    {   0, 0x3, 2, 2712 },
+    {   0, 0x3, 2, 2714 },
+    {   0, 0x3, 2, 2716 },
+    {   0, 0x3, 2, 2718 },
+    {   0, 0x3, 2, 2720 },
+    {   0, 0x3, 2, 2722 },
+    {   0, 0x3, 2, 2724 },
+    {   0, 0x3, 2, 2726 },
+    {   0, 0x3, 2, 2728 },
+    {   0, 0x1, 2, 2730 },
+    {   0, 0x1, 2, 2732 },
+    {   0, 0x1, 2, 2734 },
+    {   0, 0x1, 2, 2736 },
+    {   0, 0x1, 2, 2738 },
+    {   0, 0x1, 2, 2740 },
+    {   0, 0x1, 2, 2742 },
+    {   0, 0x1, 2, 2744 },
+    {   0, 0x1, 2, 2746 },
+    {   0, 0x1, 2, 2748 },
+    {   0, 0x1, 2, 2750 },
+    {   0, 0x1, 2, 2752 },
+    {   0, 0x1, 2, 2754 },
+    {   6, 0x0, 0,    0 },
+    {   0, 0x3, 2, 2756 },
+    {   0, 0x3, 2, 2758 },
+    {   0, 0x3, 3, 2760 },
+    {   0, 0x3, 3, 2763 },
+    {   0, 0x3, 3, 2766 },
+    {   0, 0x3, 3, 2769 },
+    {   0, 0x3, 3, 2772 },
+    { 226, 0x0, 0,    0 },
+    {   0, 0x3, 2, 2775 },
+    {   0, 0x3, 2, 2777 },
+    {   0, 0x3, 3, 2779 },
+    {   0, 0x3, 3, 2782 },
+    {   0, 0x3, 3, 2785 },
+    {   0, 0x3, 3, 2788 },
+    {   0, 0x3, 1, 2791 },
+    {   0, 0x3, 1, 2792 },
+    {   0, 0x3, 1, 2793 },
+    {   0, 0x3, 1, 2794 },
+    {   0, 0x3, 1, 2795 },
+    {   0, 0x3, 1, 2796 },
+    {   0, 0x3, 1, 2797 },
+    {   0, 0x3, 1, 2798 },
+    {   0, 0x3, 1, 2799 },
+    {   0, 0x3, 1, 2800 },
+    {   0, 0x3, 1, 2801 },
+    {   0, 0x3, 1, 2802 },
+    {   0, 0x3, 1, 2803 },
+    {   0, 0x3, 1, 2804 },
+    {   0, 0x3, 1, 2805 },
+    {   0, 0x3, 1, 2806 },
+    {   0, 0x3, 1, 2807 },
+    {   0, 0x3, 1, 2808 },
+    {   0, 0x3, 1, 2809 },
+    {   0, 0x3, 1, 2810 },
+    {   0, 0x3, 1, 2811 },
+    {   0, 0x3, 1, 2812 },
+    {   0, 0x3, 1, 2813 },
+    {   0, 0x3, 1, 2814 },
+    {   0, 0x3, 1, 2815 },
+    {   0, 0x3, 1, 2816 },
+    {   0, 0x3, 1, 2817 },
+    {   0, 0x3, 1, 2818 },
+    {   0, 0x3, 1, 2819 },
+    {   0, 0x3, 1, 2820 },
+    {   0, 0x3, 1, 2821 },
+    {   0, 0x3, 1, 2822 },
+    {   0, 0x3, 1, 2823 },
+    {   0, 0x3, 1, 2824 },
+    {   0, 0x3, 1, 2825 },
+    {   0, 0x3, 1, 2826 },
+    {   0, 0x3, 1, 2827 },
+    {   0, 0x3, 1, 2828 },
+    {   0, 0x3, 1, 2829 },
+    {   0, 0x3, 1, 2830 },
+    {   0, 0x3, 1, 2831 },
+    {   0, 0x3, 1, 2832 },
+    {   0, 0x3, 1, 2833 },
+    {   0, 0x3, 1, 2834 },
+    {   0, 0x3, 1, 2835 },
+    {   0, 0x3, 1, 2836 },
+    {   0, 0x3, 1, 2837 },
+    {   0, 0x3, 1, 2838 },
+    {   0, 0x3, 1, 2839 },
+    {   0, 0x3, 1, 2840 },
+    {   0, 0x3, 1, 2841 },
+    {   0, 0x3, 1, 2842 },
+    {   0, 0x3, 1, 2843 },
+    {   0, 0x3, 1, 2844 },
+    {   0, 0x3, 1, 2845 },
+    {   0, 0x3, 1, 2846 },
+    {   0, 0x3, 1, 2847 },
+    {   0, 0x3, 1, 2848 },
+    {   0, 0x3, 1, 2849 },
+    {   0, 0x3, 1, 2850 },
+    {   0, 0x3, 1, 2851 },
+    {   0, 0x3, 1, 2852 },
+    {   0, 0x3, 1, 2853 },
+    {   0, 0x3, 1, 2854 },
+    {   0, 0x3, 1, 2855 },
+    {   0, 0x3, 1, 2856 },
+    {   0, 0x3, 1, 2857 },
+    {   0, 0x3, 1, 2858 },
+    {   0, 0x3, 1, 2859 },
+    {   0, 0x3, 1, 2860 },
+    {   0, 0x3, 1, 2861 },
+    {   0, 0x3, 1, 2862 },
+    {   0, 0x3, 1, 2863 },
+    {   0, 0x3, 1, 2864 },
+    {   0, 0x3, 1, 2865 },
+    {   0, 0x3, 1, 2866 },
+    {   0, 0x3, 1, 2867 },
+    {   0, 0x3, 1, 2868 },
+    {   0, 0x3, 1, 2869 },
+    {   0, 0x3, 1, 2870 },
+    {   0, 0x3, 1, 2871 },
+    {   0, 0x3, 1, 2872 },
+    {   0, 0x3, 1, 2873 },
+    {   0, 0x3, 1, 2874 },
+    {   0, 0x3, 1, 2875 },
+    {   0, 0x3, 1, 2876 },
+    {   0, 0x3, 1, 2877 },
+    {   0, 0x3, 1, 2878 },
+    {   0, 0x3, 1, 2879 },
+    {   0, 0x3, 1, 2880 },
+    {   0, 0x3, 1, 2881 },
+    {   0, 0x3, 1, 2882 },
+    {   0, 0x3, 1, 2883 },
+    {   0, 0x3, 1, 2884 },
+    {   0, 0x3, 1, 2885 },
+    {   0, 0x3, 1, 2886 },
+    {   0, 0x3, 1, 2887 },
+    {   0, 0x3, 1, 2888 },
+    {   0, 0x3, 1, 2889 },
+    {   0, 0x3, 1, 2890 },
+    {   0, 0x3, 1, 2891 },
+    {   0, 0x3, 1, 2892 },
+    {   0, 0x3, 1, 2893 },
+    {   0, 0x3, 1, 2894 },
+    {   0, 0x3, 1, 2895 },
+    {   0, 0x3, 1, 2896 },
+    {   0, 0x3, 1, 2897 },
+    {   0, 0x3, 1, 2898 },
+    {   0, 0x3, 1, 2899 },
+    {   0, 0x3, 1, 2900 },
+    {   0, 0x3, 1, 2901 },
+    {   0, 0x3, 1, 2902 },
+    {   0, 0x3, 1, 2903 },
+    {   0, 0x3, 1, 2904 },
+    {   0, 0x3, 1, 2905 },
+    {   0, 0x3, 1, 2906 },
+    {   0, 0x3, 1, 2907 },
+    {   0, 0x3, 1, 2908 },
+    {   0, 0x3, 1, 2909 },
+    {   0, 0x3, 1, 2910 },
+    {   0, 0x3, 1, 2911 },
+    {   0, 0x3, 1, 2912 },
+    {   0, 0x3, 1, 2913 },
+    {   0, 0x3, 1, 2914 },
+    {   0, 0x3, 1, 2915 },
+    {   0, 0x3, 1, 2916 },
+    {   0, 0x3, 1, 2917 },
+    {   0, 0x3, 1, 2918 },
+    {   0, 0x3, 1, 2919 },
+    {   0, 0x3, 1, 2920 },
+    {   0, 0x3, 1, 2921 },
+    {   0, 0x3, 1, 2922 },
+    {   0, 0x3, 1, 2923 },
+    {   0, 0x3, 1, 2924 },
+    {   0, 0x3, 1, 2925 },
+    {   0, 0x3, 1, 2926 },
+    {   0, 0x3, 1, 2927 },
+    {   0, 0x3, 1, 2928 },
+    {   0, 0x3, 1, 2929 },
+    {   0, 0x3, 1, 2930 },
+    {   0, 0x3, 1, 2931 },
+    {   0, 0x3, 1, 2932 },
+    {   0, 0x3, 1, 2933 },
+    {   0, 0x3, 1, 2934 },
+    {   0, 0x3, 1, 2935 },
+    {   0, 0x3, 1, 2936 },
+    {   0, 0x3, 1, 2937 },
+    {   0, 0x3, 1, 2938 },
+    {   0, 0x3, 1, 2939 },
+    {   0, 0x3, 1, 2940 },
+    {   0, 0x3, 1, 2941 },
+    {   0, 0x3, 1, 2942 },
+    {   0, 0x3, 1, 2943 },
+    {   0, 0x3, 1, 2944 },
+    {   0, 0x3, 1, 2945 },
+    {   0, 0x3, 1, 2946 },
+    {   0, 0x3, 1, 2947 },
+    {   0, 0x3, 1, 2948 },
+    {   0, 0x3, 1, 2949 },
+    {   0, 0x3, 1, 2950 },
+    {   0, 0x3, 1, 2951 },
+    {   0, 0x3, 1, 2952 },
+    {   0, 0x3, 1, 2953 },
+    {   0, 0x3, 1, 2954 },
+    {   0, 0x3, 1, 2955 },
+    {   0, 0x3, 1, 2956 },
+    {   0, 0x3, 1, 2957 },
+    {   0, 0x3, 1, 2958 },
+    {   0, 0x3, 1, 2959 },
+    {   0, 0x3, 1, 2960 },
+    {   0, 0x3, 1, 2961 },
+    {   0, 0x3, 1, 2962 },
+    {   0, 0x3, 1, 2963 },
+    {   0, 0x3, 1, 2964 },
+    {   0, 0x3, 1, 2965 },
+    {   0, 0x3, 1, 2966 },
+    {   0, 0x3, 1, 2967 },
+    {   0, 0x3, 1, 2968 },
+    {   0, 0x3, 1, 2969 },
+    {   0, 0x3, 1, 2970 },
+    {   0, 0x3, 1, 2971 },
+    {   0, 0x3, 1, 2972 },
+    {   0, 0x3, 1, 2973 },
+    {   0, 0x3, 1, 2974 },
+    {   0, 0x3, 1, 2975 },
+    {   0, 0x3, 1, 2976 },
+    {   0, 0x3, 1, 2977 },
+    {   0, 0x3, 1, 2978 },
+    {   0, 0x3, 1, 2979 },
+    {   0, 0x3, 1, 2980 },
+    {   0, 0x3, 1, 2981 },
+    {   0, 0x3, 1, 2982 },
+    {   0, 0x3, 1, 2983 },
+    {   0, 0x3, 1, 2984 },
+    {   0, 0x3, 1, 2985 },
+    {   0, 0x3, 1, 2986 },
+    {   0, 0x3, 1, 2987 },
+    {   0, 0x3, 1, 2988 },
+    {   0, 0x3, 1, 2989 },
+    {   0, 0x3, 1, 2990 },
+    {   0, 0x3, 1, 2991 },
+    {   0, 0x3, 1, 2992 },
+    {   0, 0x3, 1, 2993 },
+    {   0, 0x3, 1, 2994 },
+    {   0, 0x3, 1, 2995 },
+    {   0, 0x3, 1, 2996 },
+    {   0, 0x3, 1, 2997 },
+    {   0, 0x3, 1, 2998 },
+    {   0, 0x3, 1, 2999 },
+    {   0, 0x3, 1, 3000 },
+    {   0, 0x3, 1, 3001 },
+    {   0, 0x3, 1, 3002 },
+    {   0, 0x3, 1, 3003 },
+    {   0, 0x3, 1, 3004 },
+    {   0, 0x3, 1, 3005 },
+    {   0, 0x3, 1, 3006 },
+    {   0, 0x3, 1, 3007 },
+    {   0, 0x3, 1, 3008 },
+    {   0, 0x3, 1, 3009 },
+    {   0, 0x3, 1, 3010 },
+    {   0, 0x3, 1, 3011 },
+    {   0, 0x3, 1, 3012 },
+    {   0, 0x3, 1, 3013 },
+    {   0, 0x3, 1, 3014 },
+    {   0, 0x3, 1, 3015 },
+    {   0, 0x3, 1, 3016 },
+    {   0, 0x3, 1, 3017 },
+    {   0, 0x3, 1, 3018 },
+    {   0, 0x3, 1, 3019 },
+    {   0, 0x3, 1, 3020 },
+    {   0, 0x3, 1, 3021 },
+    {   0, 0x3, 1, 3022 },
+    {   0, 0x3, 1, 3023 },
+    {   0, 0x3, 1, 3024 },
+    {   0, 0x3, 1, 3025 },
+    {   0, 0x3, 1, 3026 },
+    {   0, 0x3, 1, 3027 },
+    {   0, 0x3, 1, 3028 },
+    {   0, 0x3, 1, 3029 },
+    {   0, 0x3, 1, 3030 },
+    {   0, 0x3, 1, 3031 },
+    {   0, 0x3, 1, 3032 },
+    {   0, 0x3, 1, 3033 },
+    {   0, 0x3, 1, 3034 },
+    {   0, 0x3, 1, 3035 },
+    {   0, 0x3, 1, 3036 },
+    {   0, 0x3, 1, 3037 },
+    {   0, 0x3, 1, 3038 },
+    {   0, 0x3, 1, 3039 },
+    {   0, 0x3, 1, 3040 },
+    {   0, 0x3, 1, 3041 },
+    {   0, 0x3, 1, 3042 },
+    {   0, 0x3, 1, 3043 },
+    {   0, 0x3, 1, 3044 },
+    {   0, 0x3, 1, 3045 },
+    {   0, 0x3, 1, 3046 },
+    {   0, 0x3, 1, 3047 },
+    {   0, 0x3, 1, 3048 },
+    {   0, 0x3, 1, 3049 },
+    {   0, 0x3, 1, 3050 },
+    {   0, 0x3, 1, 3051 },
+    {   0, 0x3, 1, 3052 },
+    {   0, 0x3, 1, 3053 },
+    {   0, 0x3, 1, 3054 },
+    {   0, 0x3, 1, 3055 },
+    {   0, 0x3, 1, 3056 },
+    {   0, 0x3, 1, 3057 },
+    {   0, 0x3, 1, 3058 },
+    {   0, 0x3, 1, 3059 },
+    {   0, 0x3, 1, 3060 },
+    {   0, 0x3, 1, 3061 },
+    {   0, 0x3, 1, 3062 },
+    {   0, 0x3, 1, 3063 },
+    {   0, 0x3, 1, 3064 },
+    {   0, 0x3, 1, 3065 },
+    {   0, 0x3, 1, 3066 },
+    {   0, 0x3, 1, 3067 },
+    {   0, 0x3, 1, 3068 },
+    {   0, 0x3, 1, 3069 },
+    {   0, 0x3, 1, 3070 },
+    {   0, 0x3, 1, 3071 },
+    {   0, 0x3, 1, 3072 },
+    {   0, 0x3, 1, 3073 },
+    {   0, 0x3, 1, 3074 },
+    {   0, 0x3, 1, 3075 },
+    {   0, 0x3, 1, 3076 },
+    {   0, 0x3, 1, 3077 },
+    {   0, 0x3, 1, 3078 },
+    {   0, 0x3, 1, 3079 },
+    {   0, 0x3, 1, 3080 },
+    {   0, 0x3, 1, 3081 },
+    {   0, 0x3, 1, 3082 },
+    {   0, 0x3, 1, 3083 },
+    {   0, 0x3, 1, 3084 },
+    {   0, 0x3, 1, 3085 },
+    {   0, 0x3, 1, 3086 },
+    {   0, 0x3, 1, 3087 },
+    {   0, 0x3, 1, 3088 },
+    {   0, 0x3, 1, 3089 },
+    {   0, 0x3, 1, 3090 },
+    {   0, 0x3, 1, 3091 },
+    {   0, 0x3, 1, 3092 },
+    {   0, 0x3, 1, 3093 },
+    {   0, 0x3, 1, 3094 },
+    {   0, 0x3, 1, 3095 },
+    {   0, 0x3, 1, 3096 },
+    {   0, 0x3, 1, 3097 },
+    {   0, 0x3, 1, 3098 },
+    {   0, 0x3, 1, 3099 },
+    {   0, 0x3, 1, 3100 },
+    {   0, 0x3, 1, 3101 },
+    {   0, 0x3, 1, 3102 },
+    {   0, 0x3, 1, 3103 },
+    {   0, 0x3, 1, 3104 },
+    {   0, 0x3, 1, 3105 },
+    {   0, 0x3, 1, 3106 },
+    {   0, 0x3, 1, 3107 },
+    {   0, 0x3, 1, 3108 },
+    {   0, 0x3, 1, 3109 },
+    {   0, 0x3, 1, 3110 },
+    {   0, 0x3, 1, 3111 },
+    {   0, 0x3, 1, 3112 },
+    {   0, 0x3, 1, 3113 },
+    {   0, 0x3, 1, 3114 },
+    {   0, 0x3, 1, 3115 },
+    {   0, 0x3, 1, 3116 },
+    {   0, 0x3, 1, 3117 },
+    {   0, 0x3, 1, 3118 },
+    {   0, 0x3, 1, 3119 },
+    {   0, 0x3, 1, 3120 },
+    {   0, 0x3, 1, 3121 },
+    {   0, 0x3, 1, 3122 },
+    {   0, 0x3, 1, 3123 },
+    {   0, 0x3, 1, 3124 },
+    {   0, 0x3, 1, 3125 },
+    {   0, 0x3, 1, 3126 },
+    {   0, 0x3, 1, 3127 },
+    {   0, 0x3, 1, 3128 },
+    {   0, 0x3, 1, 3129 },
+    {   0, 0x3, 1, 3130 },
+    {   0, 0x3, 1, 3131 },
+    {   0, 0x3, 1, 3132 },
+    {   0, 0x3, 1, 3133 },
+    {   0, 0x3, 1, 3134 },
+    {   0, 0x3, 1, 3135 },
+    {   0, 0x3, 1, 3136 },
+    {   0, 0x3, 1, 3137 },
+    {   0, 0x3, 1, 3138 },
+    {   0, 0x3, 1, 3139 },
+    {   0, 0x3, 1, 3140 },
+    {   0, 0x3, 1, 3141 },
+    {   0, 0x3, 1, 3142 },
+    {   0, 0x3, 1, 3143 },
+    {   0, 0x3, 1, 3144 },
+    {   0, 0x3, 1, 3145 },
+    {   0, 0x3, 1, 3146 },
+    {   0, 0x3, 1, 3147 },
+    {   0, 0x3, 1, 3148 },
+    {   0, 0x3, 1, 3149 },
+    {   0, 0x3, 1, 3150 },
+    {   0, 0x3, 1, 3151 },
+    {   0, 0x3, 1, 3152 },
+    {   0, 0x3, 1, 3153 },
+    {   0, 0x3, 1, 3154 },
+    {   0, 0x3, 1, 3155 },
+    {   0, 0x3, 1, 3156 },
+    {   0, 0x3, 1, 3157 },
+    {   0, 0x3, 1, 3158 },
+    {   0, 0x3, 1, 3159 },
+    {   0, 0x3, 1, 3160 },
+    {   0, 0x3, 1, 3161 },
+    {   0, 0x3, 1, 3162 },
+    {   0, 0x3, 1, 3163 },
+    {   0, 0x3, 1, 3164 },
+    {   0, 0x3, 1, 3165 },
+    {   0, 0x3, 1, 3166 },
+    {   0, 0x3, 1, 3167 },
+    {   0, 0x3, 1, 3168 },
+    {   0, 0x3, 1, 3169 },
+    {   0, 0x3, 1, 3170 },
+    {   0, 0x3, 1, 3171 },
+    {   0, 0x3, 1, 3172 },
+    {   0, 0x3, 1, 3173 },
+    {   0, 0x3, 1, 3174 },
+    {   0, 0x3, 1, 3175 },
+    {   0, 0x3, 1, 3176 },
+    {   0, 0x3, 1, 3177 },
+    {   0, 0x3, 1, 3178 },
+    {   0, 0x3, 1, 3179 },
+    {   0, 0x3, 1, 3180 },
+    {   0, 0x3, 1, 3181 },
+    {   0, 0x3, 1, 3182 },
+    {   0, 0x3, 1, 3183 },
+    {   0, 0x3, 1, 3184 },
+    {   0, 0x3, 1, 3185 },
+    {   0, 0x3, 1, 3186 },
+    {   0, 0x3, 1, 3187 },
+    {   0, 0x3, 1, 3188 },
+    {   0, 0x3, 1, 3189 },
+    {   0, 0x3, 1, 3190 },
+    {   0, 0x3, 1, 3191 },
+    {   0, 0x3, 1, 3192 },
+    {   0, 0x3, 1, 3193 },
+    {   0, 0x3, 1, 3194 },
+    {   0, 0x3, 1, 3195 },
+    {   0, 0x3, 1, 3196 },
+    {   0, 0x3, 1, 3197 },
+    {   0, 0x3, 1, 3198 },
+    {   0, 0x3, 1, 3199 },
+    {   0, 0x3, 1, 3200 },
+    {   0, 0x3, 1, 3201 },
+    {   0, 0x3, 1, 3202 },
+    {   0, 0x3, 1, 3203 },
+    {   0, 0x3, 1, 3204 },
+    {   0, 0x3, 1, 3205 },
+    {   0, 0x3, 1, 3206 },
+    {   0, 0x3, 1, 3207 },
+    {   0, 0x3, 1, 3208 },
+    {   0, 0x3, 1, 3209 },
+    {   0, 0x3, 1, 3210 },
+    {   0, 0x3, 1, 3211 },
+    {   0, 0x3, 1, 3212 },
+    {   0, 0x3, 1, 3213 },
+    {   0, 0x3, 1, 3214 },
+    {   0, 0x3, 1, 3215 },
+    {   0, 0x3, 1, 3216 },
+    {   0, 0x3, 1, 3217 },
+    {   0, 0x3, 1, 3218 },
+    {   0, 0x3, 1, 3219 },
+    {   0, 0x3, 1, 3220 },
+    {   0, 0x3, 1, 3221 },
+    {   0, 0x3, 1, 3222 },
+    {   0, 0x3, 1, 3223 },
+    {   0, 0x3, 1, 3224 },
+    {   0, 0x3, 1, 3225 },
+    {   0, 0x3, 1, 3226 },
+    {   0, 0x3, 1, 3227 },
+    {   0, 0x3, 1, 3228 },
+    {   0, 0x3, 1, 3229 },
+    {   0, 0x3, 1, 3230 },
+    {   0, 0x3, 1, 3231 },
+    {   0, 0x3, 1, 3232 },
+    {   0, 0x3, 1, 3233 },
+    {   0, 0x3, 1, 3234 },
+    {   0, 0x3, 1, 3235 },
+    {   0, 0x3, 1, 3236 },
+    {   0, 0x3, 1, 3237 },
+    {   0, 0x3, 1, 3238 },
+    {   0, 0x3, 1, 3239 },
+    {   0, 0x3, 1, 3240 },
+    {   0, 0x3, 1, 3241 },
+    {   0, 0x3, 1, 3242 },
+    {   0, 0x3, 1, 3243 },
+    {   0, 0x3, 1, 3244 },
+    {   0, 0x3, 1, 3245 },
+    {   0, 0x3, 1, 3246 },
+    {   0, 0x3, 1, 3247 },
+    {   0, 0x3, 1, 3248 },
+    {   0, 0x3, 1, 3249 },
+    {   0, 0x3, 1, 3250 },
+    {   0, 0x3, 1, 3251 },
+    {   0, 0x3, 1, 3252 },
+    {   0, 0x3, 1, 3253 },
+    {   0, 0x3, 1, 3254 },
+    {   0, 0x3, 1, 3255 },
+    {   0, 0x3, 1, 3256 },
+    {   0, 0x3, 1, 3257 },
+    {   0, 0x3, 1, 3258 },
+    {   0, 0x3, 1, 3259 },
+    {   0, 0x3, 1, 3260 },
+    {   0, 0x3, 1, 3261 },
+    {   0, 0x3, 1, 3262 },
+    {   0, 0x3, 1, 3263 },
+    {   0, 0x3, 1, 3264 },
+    {   0, 0x3, 1, 3265 },
+    {   0, 0x3, 1, 3266 },
+    {   0, 0x3, 1, 3267 },
+};
+
+// Full canonical decompositions
+static const uint32_t NORM_DECOMPS[3268] = {
+    0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+    0x00041, 0x00308, 0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300,
+    0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+    0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303,
+    0x0004F, 0x00300, 0x0004F, 0x00301, 0x0004F, 0x00302, 0x0004F, 0x00303,
+    0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+    0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+    0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030A,
+    0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+    0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+    0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300, 0x0006F, 0x00301,
+    0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+    0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+    0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+    0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+    0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+    0x00063, 0x00307, 0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C,
+    0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+    0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+    0x00065, 0x00328, 0x00045, 0x0030C, 0x00065, 0x0030C, 0x00047, 0x00302,
+    0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+    0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+    0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+    0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+    0x00069, 0x00328, 0x00049, 0x00307, 0x0004A, 0x00302, 0x0006A, 0x00302,
+    0x0004B, 0x00327, 0x0006B, 0x00327, 0x0004C, 0x00301, 0x0006C, 0x00301,
+    0x0004C, 0x00327, 0x0006C, 0x00327, 0x0004C, 0x0030C, 0x0006C, 0x0030C,
+    0x0004E, 0x00301, 0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327,
+    0x0004E, 0x0030C, 0x0006E, 0x0030C, 0x0004F, 0x00304, 0x0006F, 0x00304,
+    0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B, 0x0006F, 0x0030B,
+    0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327,
+    0x00052, 0x0030C, 0x00072, 0x0030C, 0x00053, 0x00301, 0x00073, 0x00301,
+    0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327,
+    0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327, 0x00074, 0x00327,
+    0x00054, 0x0030C, 0x00074, 0x0030C, 0x00055, 0x00303, 0x00075, 0x00303,
+    0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306,
+    0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B, 0x00075, 0x0030B,
+    0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302,
+    0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308, 0x0005A, 0x00301,
+    0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307, 0x0005A, 0x0030C,
+    0x0007A, 0x0030C, 0x0004F, 0x0031B, 0x0006F, 0x0031B, 0x00055, 0x0031B,
+    0x00075, 0x0031B, 0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C,
+    0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C,
+    0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+    0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+    0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075,
+    0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+    0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+    0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C,
+    0x0006B, 0x0030C, 0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328,
+    0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C,
+    0x0006A, 0x0030C, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300,
+    0x0006E, 0x00300, 0x00041, 0x0030A, 0x00301, 0x00061, 0x0030A, 0x00301,
+    0x000C6, 0x00301, 0x000E6, 0x00301, 0x000D8, 0x00301, 0x000F8, 0x00301,
+    0x00041, 0x0030F, 0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311,
+    0x00045, 0x0030F, 0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311,
+    0x00049, 0x0030F, 0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311,
+    0x0004F, 0x0030F, 0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311,
+    0x00052, 0x0030F, 0x00072, 0x0030F, 0x00052, 0x00311, 0x00072, 0x00311,
+    0x00055, 0x0030F, 0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311,
+    0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+    0x00048, 0x0030C, 0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307,
+    0x00045, 0x00327, 0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F,
+    0x00308, 0x00304, 0x0004F, 0x00303, 0x00304, 0x0006F, 0x00303, 0x00304,
+    0x0004F, 0x00307, 0x0006F, 0x00307, 0x0004F, 0x00307, 0x00304, 0x0006F,
+    0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301,
+    0x00313, 0x00308, 0x00301, 0x002B9, 0x0003B, 0x000A8, 0x00301, 0x00391,
+    0x00301, 0x000B7, 0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301,
+    0x0039F, 0x00301, 0x003A5, 0x00301, 0x003A9, 0x00301, 0x003B9, 0x00308,
+    0x00301, 0x00399, 0x00308, 0x003A5, 0x00308, 0x003B1, 0x00301, 0x003B5,
+    0x00301, 0x003B7, 0x00301, 0x003B9, 0x00301, 0x003C5, 0x00308, 0x00301,
+    0x003B9, 0x00308, 0x003C5, 0x00308, 0x003BF, 0x00301, 0x003C5, 0x00301,
+    0x003C9, 0x00301, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x00415, 0x00300,
+    0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041A, 0x00301,
+    0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+    0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308,
+    0x0043A, 0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F,
+    0x00475, 0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306,
+    0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306,
+    0x00435, 0x00306, 0x004D8, 0x00308, 0x004D9, 0x00308, 0x00416, 0x00308,
+    0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304,
+    0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308,
+    0x0043E, 0x00308, 0x004E8, 0x00308, 0x004E9, 0x00308, 0x0042D, 0x00308,
+    0x0044D, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308,
+    0x00443, 0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308,
+    0x00447, 0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00627, 0x00653,
+    0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A, 0x00654,
+    0x006D5, 0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928, 0x0093C,
+    0x00930, 0x0093C, 0x00933, 0x0093C, 0x00915, 0x0093C, 0x00916, 0x0093C,
+    0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922, 0x0093C,
+    0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7, 0x009D7,
+    0x009A1, 0x009BC, 0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32, 0x00A3C,
+    0x00A38, 0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C, 0x00A3C,
+    0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E, 0x00B47, 0x00B57,
+    0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92, 0x00BD7, 0x00BC6, 0x00BBE,
+    0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF, 0x00CD5,
+    0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6, 0x00CC2,
+    0x00CD5, 0x00D46, 0x00D3E, 0x00D47, 0x00D3E, 0x00D46, 0x00D57, 0x00DD9,
+    0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9, 0x00DDF,
+    0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7, 0x00F56, 0x00FB7,
+    0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72, 0x00F71, 0x00F74,
+    0x00FB2, 0x00F80, 0x00FB3, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7,
+    0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7,
+    0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x01B05, 0x01B35, 0x01B07, 0x01B35,
+    0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11, 0x01B35,
+    0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F, 0x01B35,
+    0x01B42, 0x01B35, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307,
+    0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331,
+    0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301,
+    0x00044, 0x00307, 0x00064, 0x00307, 0x00044, 0x00323, 0x00064, 0x00323,
+    0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327,
+    0x00044, 0x0032D, 0x00064, 0x0032D, 0x00045, 0x00304, 0x00300, 0x00065,
+    0x00304, 0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301,
+    0x00045, 0x0032D, 0x00065, 0x0032D, 0x00045, 0x00330, 0x00065, 0x00330,
+    0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307,
+    0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048, 0x00307,
+    0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+    0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032E,
+    0x00068, 0x0032E, 0x00049, 0x00330, 0x00069, 0x00330, 0x00049, 0x00308,
+    0x00301, 0x00069, 0x00308, 0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301,
+    0x0004B, 0x00323, 0x0006B, 0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331,
+    0x0004C, 0x00323, 0x0006C, 0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C,
+    0x00323, 0x00304, 0x0004C, 0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D,
+    0x0006C, 0x0032D, 0x0004D, 0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307,
+    0x0006D, 0x00307, 0x0004D, 0x00323, 0x0006D, 0x00323, 0x0004E, 0x00307,
+    0x0006E, 0x00307, 0x0004E, 0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331,
+    0x0006E, 0x00331, 0x0004E, 0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303,
+    0x00301, 0x0006F, 0x00303, 0x00301, 0x0004F, 0x00303, 0x00308, 0x0006F,
+    0x00303, 0x00308, 0x0004F, 0x00304, 0x00300, 0x0006F, 0x00304, 0x00300,
+    0x0004F, 0x00304, 0x00301, 0x0006F, 0x00304, 0x00301, 0x00050, 0x00301,
+    0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052, 0x00307,
+    0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+    0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331,
+    0x00053, 0x00307, 0x00073, 0x00307, 0x00053, 0x00323, 0x00073, 0x00323,
+    0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030C,
+    0x00307, 0x00073, 0x0030C, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073,
+    0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323,
+    0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032D,
+    0x00074, 0x0032D, 0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330,
+    0x00075, 0x00330, 0x00055, 0x0032D, 0x00075, 0x0032D, 0x00055, 0x00303,
+    0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075,
+    0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323,
+    0x00076, 0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301,
+    0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307,
+    0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307,
+    0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059, 0x00307,
+    0x00079, 0x00307, 0x0005A, 0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323,
+    0x0007A, 0x00323, 0x0005A, 0x00331, 0x0007A, 0x00331, 0x00068, 0x00331,
+    0x00074, 0x00308, 0x00077, 0x0030A, 0x00079, 0x0030A, 0x0017F, 0x00307,
+    0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+    0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302,
+    0x00300, 0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061,
+    0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303,
+    0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306,
+    0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061,
+    0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309,
+    0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323,
+    0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323,
+    0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+    0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302,
+    0x00300, 0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065,
+    0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303,
+    0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309,
+    0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004F, 0x00323,
+    0x0006F, 0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302,
+    0x00301, 0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F,
+    0x00302, 0x00300, 0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302, 0x00309,
+    0x0004F, 0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323,
+    0x00302, 0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F,
+    0x0031B, 0x00301, 0x0004F, 0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300,
+    0x0004F, 0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B,
+    0x00303, 0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F,
+    0x0031B, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309,
+    0x00075, 0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301,
+    0x00055, 0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B,
+    0x00309, 0x00075, 0x0031B, 0x00309, 0x00055, 0x0031B, 0x00303, 0x00075,
+    0x0031B, 0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323,
+    0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323,
+    0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303,
+    0x003B1, 0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1,
+    0x00314, 0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301,
+    0x003B1, 0x00313, 0x00342, 0x003B1, 0x00314, 0x00342, 0x00391, 0x00313,
+    0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300,
+    0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313,
+    0x00342, 0x00391, 0x00314, 0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314,
+    0x003B5, 0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313,
+    0x00301, 0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314,
+    0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313,
+    0x00301, 0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314,
+    0x003B7, 0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313,
+    0x00301, 0x003B7, 0x00314, 0x00301, 0x003B7, 0x00313, 0x00342, 0x003B7,
+    0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313,
+    0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397,
+    0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342,
+    0x003B9, 0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9,
+    0x00314, 0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301,
+    0x003B9, 0x00313, 0x00342, 0x003B9, 0x00314, 0x00342, 0x00399, 0x00313,
+    0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300,
+    0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313,
+    0x00342, 0x00399, 0x00314, 0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314,
+    0x003BF, 0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313,
+    0x00301, 0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314,
+    0x0039F, 0x00313, 0x00300, 0x0039F, 0x00314, 0x00300, 0x0039F, 0x00313,
+    0x00301, 0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314,
+    0x003C5, 0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313,
+    0x00301, 0x003C5, 0x00314, 0x00301, 0x003C5, 0x00313, 0x00342, 0x003C5,
+    0x00314, 0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5,
+    0x00314, 0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9,
+    0x00314, 0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314, 0x00300, 0x003C9,
+    0x00313, 0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342,
+    0x003C9, 0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9,
+    0x00313, 0x00300, 0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313, 0x00301,
+    0x003A9, 0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314,
+    0x00342, 0x003B1, 0x00300, 0x003B5, 0x00300, 0x003B7, 0x00300, 0x003B9,
+    0x00300, 0x003BF, 0x00300, 0x003C5, 0x00300, 0x003C9, 0x00300, 0x003B1,
+    0x00313, 0x00345, 0x003B1, 0x00314, 0x00345, 0x003B1, 0x00313, 0x00300,
+    0x00345, 0x003B1, 0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301,
+    0x00345, 0x003B1, 0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342,
+    0x00345, 0x003B1, 0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345,
+    0x00391, 0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391,
+    0x00314, 0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391,
+    0x00314, 0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391,
+    0x00314, 0x00342, 0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314,
+    0x00345, 0x003B7, 0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300,
+    0x00345, 0x003B7, 0x00313, 0x00301, 0x00345, 0x003B7, 0x00314, 0x00301,
+    0x00345, 0x003B7, 0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342,
+    0x00345, 0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397,
+    0x00313, 0x00300, 0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397,
+    0x00313, 0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397,
+    0x00313, 0x00342, 0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9,
+    0x00313, 0x00345, 0x003C9, 0x00314, 0x00345, 0x003C9, 0x00313, 0x00300,
+    0x00345, 0x003C9, 0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301,
+    0x00345, 0x003C9, 0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342,
+    0x00345, 0x003C9, 0x00314, 0x00342, 0x00345, 0x003A9, 0x00313, 0x00345,
+    0x003A9, 0x00314, 0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9,
+    0x00314, 0x00300, 0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9,
+    0x00314, 0x00301, 0x00345, 0x003A9, 0x00313, 0x00342, 0x00345, 0x003A9,
+    0x00314, 0x00342, 0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1,
+    0x00300, 0x00345, 0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1,
+    0x00342, 0x003B1, 0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304,
+    0x00391, 0x00300, 0x00391, 0x00345, 0x003B9, 0x000A8, 0x00342, 0x003B7,
+    0x00300, 0x00345, 0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7,
+    0x00342, 0x003B7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00397, 0x00300,
+    0x00397, 0x00345, 0x01FBF, 0x00300, 0x01FBF, 0x00301, 0x01FBF, 0x00342,
+    0x003B9, 0x00306, 0x003B9, 0x00304, 0x003B9, 0x00308, 0x00300, 0x003B9,
+    0x00342, 0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304,
+    0x00399, 0x00300, 0x01FFE, 0x00300, 0x01FFE, 0x00301, 0x01FFE, 0x00342,
+    0x003C5, 0x00306, 0x003C5, 0x00304, 0x003C5, 0x00308, 0x00300, 0x003C1,
+    0x00313, 0x003C1, 0x00314, 0x003C5, 0x00342, 0x003C5, 0x00308, 0x00342,
+    0x003A5, 0x00306, 0x003A5, 0x00304, 0x003A5, 0x00300, 0x003A1, 0x00314,
+    0x000A8, 0x00300, 0x00060, 0x003C9, 0x00300, 0x00345, 0x003C9, 0x00345,
+    0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342, 0x003C9, 0x00342, 0x00345,
+    0x0039F, 0x00300, 0x003A9, 0x00300, 0x003A9, 0x00345, 0x000B4, 0x02002,
+    0x02003, 0x003A9, 0x0004B, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194,
+    0x00338, 0x021D0, 0x00338, 0x021D4, 0x00338, 0x021D2, 0x00338, 0x02203,
+    0x00338, 0x02208, 0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225,
+    0x00338, 0x0223C, 0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248,
+    0x00338, 0x0003D, 0x00338, 0x02261, 0x00338, 0x0224D, 0x00338, 0x0003C,
+    0x00338, 0x0003E, 0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272,
+    0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227A,
+    0x00338, 0x0227B, 0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286,
+    0x00338, 0x02287, 0x00338, 0x022A2, 0x00338, 0x022A8, 0x00338, 0x022A9,
+    0x00338, 0x022AB, 0x00338, 0x0227C, 0x00338, 0x0227D, 0x00338, 0x02291,
+    0x00338, 0x02292, 0x00338, 0x022B2, 0x00338, 0x022B3, 0x00338, 0x022B4,
+    0x00338, 0x022B5, 0x00338, 0x03008, 0x03009, 0x02ADD, 0x00338, 0x0304B,
+    0x03099, 0x0304D, 0x03099, 0x0304F, 0x03099, 0x03051, 0x03099, 0x03053,
+    0x03099, 0x03055, 0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305B,
+    0x03099, 0x0305D, 0x03099, 0x0305F, 0x03099, 0x03061, 0x03099, 0x03064,
+    0x03099, 0x03066, 0x03099, 0x03068, 0x03099, 0x0306F, 0x03099, 0x0306F,
+    0x0309A, 0x03072, 0x03099, 0x03072, 0x0309A, 0x03075, 0x03099, 0x03075,
+    0x0309A, 0x03078, 0x03099, 0x03078, 0x0309A, 0x0307B, 0x03099, 0x0307B,
+    0x0309A, 0x03046, 0x03099, 0x0309D, 0x03099, 0x030AB, 0x03099, 0x030AD,
+    0x03099, 0x030AF, 0x03099, 0x030B1, 0x03099, 0x030B3, 0x03099, 0x030B5,
+    0x03099, 0x030B7, 0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099, 0x030BD,
+    0x03099, 0x030BF, 0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099, 0x030C6,
+    0x03099, 0x030C8, 0x03099, 0x030CF, 0x03099, 0x030CF, 0x0309A, 0x030D2,
+    0x03099, 0x030D2, 0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A, 0x030D8,
+    0x03099, 0x030D8, 0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A, 0x030A6,
+    0x03099, 0x030EF, 0x03099, 0x030F0, 0x03099, 0x030F1, 0x03099, 0x030F2,
+    0x03099, 0x030FD, 0x03099, 0x08C48, 0x066F4, 0x08ECA, 0x08CC8, 0x06ED1,
+    0x04E32, 0x053E5, 0x09F9C, 0x05951, 0x091D1, 0x05587, 0x05948, 0x061F6,
+    0x07669, 0x07F85, 0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B,
+    0x070D9, 0x073DE, 0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04,
+    0x0721B, 0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9,
+    0x081D8, 0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86,
+    0x051B7, 0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08001, 0x08606,
+    0x0865C, 0x08DEF, 0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0,
+    0x083C9, 0x09304, 0x09E7F, 0x08AD6, 0x058DF, 0x05F04, 0x07C60, 0x0807E,
+    0x07262, 0x078CA, 0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA,
+    0x06F0F, 0x07D2F, 0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC,
+    0x07A1C, 0x07DBE, 0x083F1, 0x09675, 0x08B80, 0x062CF, 0x08AFE, 0x04E39,
+    0x05BE7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9,
+    0x04E0D, 0x06CCC, 0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449,
+    0x08AAA, 0x06BBA, 0x08FB0, 0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565,
+    0x04EAE, 0x05169, 0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF,
+    0x052F5, 0x05442, 0x05973, 0x05EEC, 0x065C5, 0x06FFE, 0x0792A, 0x095AD,
+    0x09A6A, 0x09E97, 0x09ECE, 0x0529B, 0x066C6, 0x06B77, 0x08F62, 0x05E74,
+    0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149, 0x07489, 0x079CA, 0x07DF4,
+    0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A, 0x05217, 0x052A3, 0x054BD,
+    0x070C8, 0x088C2, 0x05EC9, 0x05FF5, 0x0637B, 0x06BAE, 0x07C3E, 0x07375,
+    0x04EE4, 0x056F9, 0x05DBA, 0x0601C, 0x073B2, 0x07469, 0x07F9A, 0x08046,
+    0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B, 0x079AE, 0x091B4, 0x096B8,
+    0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F, 0x06599, 0x071CE, 0x07642,
+    0x084FC, 0x0907C, 0x09F8D, 0x06688, 0x0962E, 0x05289, 0x0677B, 0x067F3,
+    0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B, 0x07D10, 0x0985E, 0x0516D,
+    0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A, 0x05F8B, 0x06144,
+    0x06817, 0x09686, 0x05229, 0x0540F, 0x05C65, 0x06613, 0x0674E, 0x068A8,
+    0x06CE5, 0x07406, 0x075E2, 0x07F79, 0x088CF, 0x088E1, 0x091CC, 0x096E2,
+    0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498, 0x085FA, 0x096A3, 0x09C57,
+    0x09E9F, 0x06797, 0x06DCB, 0x081E8, 0x07ACB, 0x07B20, 0x07C92, 0x072C0,
+    0x07099, 0x08B58, 0x04EC0, 0x08336, 0x0523A, 0x05207, 0x05EA6, 0x062D3,
+    0x07CD6, 0x05B85, 0x06D1E, 0x066B4, 0x08F3B, 0x0884C, 0x0964D, 0x0898B,
+    0x05ED3, 0x05140, 0x055C0, 0x0585A, 0x06674, 0x051DE, 0x0732A, 0x076CA,
+    0x0793C, 0x0795E, 0x07965, 0x0798F, 0x09756, 0x07CBE, 0x07FBD, 0x08612,
+    0x08AF8, 0x09038, 0x090FD, 0x098EF, 0x098FC, 0x09928, 0x09DB4, 0x090DE,
+    0x096B7, 0x04FAE, 0x050E7, 0x0514D, 0x052C9, 0x052E4, 0x05351, 0x0559D,
+    0x05606, 0x05668, 0x05840, 0x058A8, 0x05C64, 0x05C6E, 0x06094, 0x06168,
+    0x0618E, 0x061F2, 0x0654F, 0x065E2, 0x06691, 0x06885, 0x06D77, 0x06E1A,
+    0x06F22, 0x0716E, 0x0722B, 0x07422, 0x07891, 0x0793E, 0x07949, 0x07948,
+    0x07950, 0x07956, 0x0795D, 0x0798D, 0x0798E, 0x07A40, 0x07A81, 0x07BC0,
+    0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279, 0x08457, 0x08910,
+    0x08996, 0x08B01, 0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x096E3, 0x097FF,
+    0x0983B, 0x06075, 0x242EE, 0x08218, 0x04E26, 0x051B5, 0x05168, 0x04F80,
+    0x05145, 0x05180, 0x052C7, 0x052FA, 0x05555, 0x05599, 0x055E2, 0x058B3,
+    0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69, 0x05FAD,
+    0x060D8, 0x0614E, 0x06108, 0x06160, 0x06234, 0x063C4, 0x0641C, 0x06452,
+    0x06556, 0x0671B, 0x06756, 0x06B79, 0x06EDB, 0x06ECB, 0x0701E, 0x077A7,
+    0x07235, 0x072AF, 0x07471, 0x07506, 0x0753B, 0x0761D, 0x0761F, 0x076DB,
+    0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1, 0x07C7B, 0x07D5B, 0x07F3E,
+    0x08352, 0x083EF, 0x08779, 0x08941, 0x08986, 0x08ABF, 0x08ACB, 0x08AED,
+    0x08B8A, 0x08F38, 0x09072, 0x09199, 0x09276, 0x0967C, 0x097DB, 0x0980B,
+    0x09B12, 0x2284A, 0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249,
+    0x25CD0, 0x27ED3, 0x09F43, 0x09F8E, 0x005D9, 0x005B4, 0x005F2, 0x005B7,
+    0x005E9, 0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1, 0x005E9,
+    0x005BC, 0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0, 0x005BC,
+    0x005D1, 0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4, 0x005BC,
+    0x005D5, 0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC,
+    0x005DA, 0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE, 0x005BC,
+    0x005E0, 0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4, 0x005BC,
+    0x005E6, 0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9, 0x005BC,
+    0x005EA, 0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB, 0x005BF,
+    0x005E4, 0x005BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5, 0x110BA,
+    0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347, 0x11357,
+    0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF,
+    0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158, 0x1D165,
+    0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165,
+    0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9,
+    0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165,
+    0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x04E3D,
+    0x04E38, 0x04E41, 0x20122, 0x04F60, 0x04FBB, 0x05002, 0x0507A, 0x05099,
+    0x050CF, 0x0349E, 0x2063A, 0x05154, 0x05164, 0x05177, 0x2051C, 0x034B9,
+    0x05167, 0x0518D, 0x2054B, 0x05197, 0x051A4, 0x04ECC, 0x051AC, 0x291DF,
+    0x051F5, 0x05203, 0x034DF, 0x0523B, 0x05246, 0x05272, 0x05277, 0x03515,
+    0x05305, 0x05306, 0x05349, 0x0535A, 0x05373, 0x0537D, 0x0537F, 0x20A2C,
+    0x07070, 0x053CA, 0x053DF, 0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E,
+    0x05438, 0x05448, 0x05468, 0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563,
+    0x05584, 0x055AB, 0x055B3, 0x055C2, 0x05716, 0x05717, 0x05651, 0x05674,
+    0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B, 0x05832, 0x05831, 0x058AC,
+    0x214E4, 0x058F2, 0x058F7, 0x05906, 0x0591A, 0x05922, 0x05962, 0x216A8,
+    0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66, 0x036EE, 0x036FC,
+    0x05B08, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BF3, 0x21B18, 0x05BFF,
+    0x05C06, 0x05F53, 0x05C22, 0x03781, 0x05C60, 0x05CC0, 0x05C8D, 0x21DE4,
+    0x05D43, 0x21DE6, 0x05D6E, 0x05D6B, 0x05D7C, 0x05DE1, 0x05DE2, 0x0382F,
+    0x05DFD, 0x05E28, 0x05E3D, 0x05E69, 0x03862, 0x22183, 0x0387C, 0x05EB0,
+    0x05EB3, 0x05EB6, 0x2A392, 0x05EFE, 0x22331, 0x08201, 0x05F22, 0x038C7,
+    0x232B8, 0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7,
+    0x05FF9, 0x06081, 0x0393A, 0x0391C, 0x226D4, 0x060C7, 0x06148, 0x0614C,
+    0x0617A, 0x061B2, 0x061A4, 0x061AF, 0x061DE, 0x06210, 0x0621B, 0x0625D,
+    0x062B1, 0x062D4, 0x06350, 0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383,
+    0x063E4, 0x22BF1, 0x06422, 0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E,
+    0x0649D, 0x06477, 0x03A6C, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649,
+    0x03B19, 0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD,
+    0x043D9, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA, 0x06785,
+    0x06852, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x06942, 0x069A3, 0x069EA,
+    0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21, 0x238A7, 0x06B54, 0x03C4E,
+    0x06B72, 0x06B9F, 0x06BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC,
+    0x06CBF, 0x06CCD, 0x06C67, 0x06D16, 0x06D3E, 0x06D69, 0x06D78, 0x06D85,
+    0x23D1E, 0x06D34, 0x06E2F, 0x06E6E, 0x03D33, 0x06EC7, 0x23ED1, 0x06DF9,
+    0x06F6E, 0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701B, 0x03D96, 0x0704A,
+    0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB,
+    0x07228, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814, 0x0737A,
+    0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x07447, 0x0745C, 0x07485, 0x074CA,
+    0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92, 0x2219F, 0x07610, 0x24FA1,
+    0x24FB8, 0x25044, 0x03FFC, 0x04008, 0x250F3, 0x250F2, 0x25119, 0x25133,
+    0x0771E, 0x0771F, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x040E3,
+    0x25626, 0x2569A, 0x256C5, 0x079EB, 0x0412F, 0x07A4A, 0x07A4F, 0x2597C,
+    0x25AA7, 0x07AEE, 0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80,
+    0x07CD2, 0x042A0, 0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63, 0x04301,
+    0x07DC7, 0x07E02, 0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9,
+    0x07F7A, 0x2633E, 0x07F95, 0x07FFA, 0x264DA, 0x26523, 0x08060, 0x265A8,
+    0x08070, 0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E, 0x05AB5,
+    0x267A7, 0x267B5, 0x23393, 0x2339C, 0x08204, 0x08F9E, 0x0446B, 0x08291,
+    0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C,
+    0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08353, 0x083CA,
+    0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B, 0x084F1, 0x084F3,
+    0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561, 0x26FB1, 0x270D2,
+    0x0456B, 0x08650, 0x08667, 0x08669, 0x086A9, 0x08688, 0x0870E, 0x086E2,
+    0x08728, 0x0876B, 0x08786, 0x045D7, 0x087E1, 0x08801, 0x045F9, 0x08860,
+    0x08863, 0x27667, 0x088D7, 0x088DE, 0x04635, 0x088FA, 0x034BB, 0x278AE,
+    0x27966, 0x046BE, 0x046C7, 0x08AA0, 0x08C55, 0x27CA8, 0x08CAB, 0x08CC1,
+    0x08D1B, 0x08D77, 0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE,
+    0x08ED4, 0x285D2, 0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B,
+    0x09238, 0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B,
+    0x04995, 0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145,
+    0x2921A, 0x04A6E, 0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x09829,
+    0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE, 0x04BCE,
+    0x29B30, 0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67, 0x2A0CE, 0x04CF8,
+    0x2A105, 0x2A20E, 0x2A291, 0x09EBB, 0x04D56, 0x09EF9, 0x09EFE, 0x09F05,
+    0x09F0F, 0x09F16, 0x09F3B, 0x2A600,
+};
+
+// Primary composites, sorted by (first << 21 | second)
+static const uint64_t NORM_PAIRS[941] = {
+    0x00007800338, 0x00007A00338, 0x00007C00338, 0x00008200300,
+    0x00008200301, 0x00008200302, 0x00008200303, 0x00008200304,
+    0x00008200306, 0x00008200307, 0x00008200308, 0x00008200309,
+    0x0000820030A, 0x0000820030C, 0x0000820030F, 0x00008200311,
+    0x00008200323, 0x00008200325, 0x00008200328, 0x00008400307,
+    0x00008400323, 0x00008400331, 0x00008600301, 0x00008600302,
+    0x00008600307, 0x0000860030C, 0x00008600327, 0x00008800307,
+    0x0000880030C, 0x00008800323, 0x00008800327, 0x0000880032D,
+    0x00008800331, 0x00008A00300, 0x00008A00301, 0x00008A00302,
+    0x00008A00303, 0x00008A00304, 0x00008A00306, 0x00008A00307,
+    0x00008A00308, 0x00008A00309, 0x00008A0030C, 0x00008A0030F,
+    0x00008A00311, 0x00008A00323, 0x00008A00327, 0x00008A00328,
+    0x00008A0032D, 0x00008A00330, 0x00008C00307, 0x00008E00301,
+    0x00008E00302, 0x00008E00304, 0x00008E00306, 0x00008E00307,
+    0x00008E0030C, 0x00008E00327, 0x00009000302, 0x00009000307,
+    0x00009000308, 0x0000900030C, 0x00009000323, 0x00009000327,
+    0x0000900032E, 0x00009200300, 0x00009200301, 0x00009200302,
+    0x00009200303, 0x00009200304, 0x00009200306, 0x00009200307,
+    0x00009200308, 0x00009200309, 0x0000920030C, 0x0000920030F,
+    0x00009200311, 0x00009200323, 0x00009200328, 0x00009200330,
+    0x00009400302, 0x00009600301, 0x0000960030C, 0x00009600323,
+    0x00009600327, 0x00009600331, 0x00009800301, 0x0000980030C,
+    0x00009800323, 0x00009800327, 0x0000980032D, 0x00009800331,
+    0x00009A00301, 0x00009A00307, 0x00009A00323, 0x00009C00300,
+    0x00009C00301, 0x00009C00303, 0x00009C00307, 0x00009C0030C,
+    0x00009C00323, 0x00009C00327, 0x00009C0032D, 0x00009C00331,
+    0x00009E00300, 0x00009E00301, 0x00009E00302, 0x00009E00303,
+    0x00009E00304, 0x00009E00306, 0x00009E00307, 0x00009E00308,
+    0x00009E00309, 0x00009E0030B, 0x00009E0030C, 0x00009E0030F,
+    0x00009E00311, 0x00009E0031B, 0x00009E00323, 0x00009E00328,
+    0x0000A000301, 0x0000A000307, 0x0000A400301, 0x0000A400307,
+    0x0000A40030C, 0x0000A40030F, 0x0000A400311, 0x0000A400323,
+    0x0000A400327, 0x0000A400331, 0x0000A600301, 0x0000A600302,
+    0x0000A600307, 0x0000A60030C, 0x0000A600323, 0x0000A600326,
+    0x0000A600327, 0x0000A800307, 0x0000A80030C, 0x0000A800323,
+    0x0000A800326, 0x0000A800327, 0x0000A80032D, 0x0000A800331,
+    0x0000AA00300, 0x0000AA00301, 0x0000AA00302, 0x0000AA00303,
+    0x0000AA00304, 0x0000AA00306, 0x0000AA00308, 0x0000AA00309,
+    0x0000AA0030A, 0x0000AA0030B, 0x0000AA0030C, 0x0000AA0030F,
+    0x0000AA00311, 0x0000AA0031B, 0x0000AA00323, 0x0000AA00324,
+    0x0000AA00328, 0x0000AA0032D, 0x0000AA00330, 0x0000AC00303,
+    0x0000AC00323, 0x0000AE00300, 0x0000AE00301, 0x0000AE00302,
+    0x0000AE00307, 0x0000AE00308, 0x0000AE00323, 0x0000B000307,
+    0x0000B000308, 0x0000B200300, 0x0000B200301, 0x0000B200302,
+    0x0000B200303, 0x0000B200304, 0x0000B200307, 0x0000B200308,
+    0x0000B200309, 0x0000B200323, 0x0000B400301, 0x0000B400302,
+    0x0000B400307, 0x0000B40030C, 0x0000B400323, 0x0000B400331,
+    0x0000C200300, 0x0000C200301, 0x0000C200302, 0x0000C200303,
+    0x0000C200304, 0x0000C200306, 0x0000C200307, 0x0000C200308,
+    0x0000C200309, 0x0000C20030A, 0x0000C20030C, 0x0000C20030F,
+    0x0000C200311, 0x0000C200323, 0x0000C200325, 0x0000C200328,
+    0x0000C400307, 0x0000C400323, 0x0000C400331, 0x0000C600301,
+    0x0000C600302, 0x0000C600307, 0x0000C60030C, 0x0000C600327,
+    0x0000C800307, 0x0000C80030C, 0x0000C800323, 0x0000C800327,
+    0x0000C80032D, 0x0000C800331, 0x0000CA00300, 0x0000CA00301,
+    0x0000CA00302, 0x0000CA00303, 0x0000CA00304, 0x0000CA00306,
+    0x0000CA00307, 0x0000CA00308, 0x0000CA00309, 0x0000CA0030C,
+    0x0000CA0030F, 0x0000CA00311, 0x0000CA00323, 0x0000CA00327,
+    0x0000CA00328, 0x0000CA0032D, 0x0000CA00330, 0x0000CC00307,
+    0x0000CE00301, 0x0000CE00302, 0x0000CE00304, 0x0000CE00306,
+    0x0000CE00307, 0x0000CE0030C, 0x0000CE00327, 0x0000D000302,
+    0x0000D000307, 0x0000D000308, 0x0000D00030C, 0x0000D000323,
+    0x0000D000327, 0x0000D00032E, 0x0000D000331, 0x0000D200300,
+    0x0000D200301, 0x0000D200302, 0x0000D200303, 0x0000D200304,
+    0x0000D200306, 0x0000D200308, 0x0000D200309, 0x0000D20030C,
+    0x0000D20030F, 0x0000D200311, 0x0000D200323, 0x0000D200328,
+    0x0000D200330, 0x0000D400302, 0x0000D40030C, 0x0000D600301,
+    0x0000D60030C, 0x0000D600323, 0x0000D600327, 0x0000D600331,
+    0x0000D800301, 0x0000D80030C, 0x0000D800323, 0x0000D800327,
+    0x0000D80032D, 0x0000D800331, 0x0000DA00301, 0x0000DA00307,
+    0x0000DA00323, 0x0000DC00300, 0x0000DC00301, 0x0000DC00303,
+    0x0000DC00307, 0x0000DC0030C, 0x0000DC00323, 0x0000DC00327,
+    0x0000DC0032D, 0x0000DC00331, 0x0000DE00300, 0x0000DE00301,
+    0x0000DE00302, 0x0000DE00303, 0x0000DE00304, 0x0000DE00306,
+    0x0000DE00307, 0x0000DE00308, 0x0000DE00309, 0x0000DE0030B,
+    0x0000DE0030C, 0x0000DE0030F, 0x0000DE00311, 0x0000DE0031B,
+    0x0000DE00323, 0x0000DE00328, 0x0000E000301, 0x0000E000307,
+    0x0000E400301, 0x0000E400307, 0x0000E40030C, 0x0000E40030F,
+    0x0000E400311, 0x0000E400323, 0x0000E400327, 0x0000E400331,
+    0x0000E600301, 0x0000E600302, 0x0000E600307, 0x0000E60030C,
+    0x0000E600323, 0x0000E600326, 0x0000E600327, 0x0000E800307,
+    0x0000E800308, 0x0000E80030C, 0x0000E800323, 0x0000E800326,
+    0x0000E800327, 0x0000E80032D, 0x0000E800331, 0x0000EA00300,
+    0x0000EA00301, 0x0000EA00302, 0x0000EA00303, 0x0000EA00304,
+    0x0000EA00306, 0x0000EA00308, 0x0000EA00309, 0x0000EA0030A,
+    0x0000EA0030B, 0x0000EA0030C, 0x0000EA0030F, 0x0000EA00311,
+    0x0000EA0031B, 0x0000EA00323, 0x0000EA00324, 0x0000EA00328,
+    0x0000EA0032D, 0x0000EA00330, 0x0000EC00303, 0x0000EC00323,
+    0x0000EE00300, 0x0000EE00301, 0x0000EE00302, 0x0000EE00307,
+    0x0000EE00308, 0x0000EE0030A, 0x0000EE00323, 0x0000F000307,
+    0x0000F000308, 0x0000F200300, 0x0000F200301, 0x0000F200302,
+    0x0000F200303, 0x0000F200304, 0x0000F200307, 0x0000F200308,
+    0x0000F200309, 0x0000F20030A, 0x0000F200323, 0x0000F400301,
+    0x0000F400302, 0x0000F400307, 0x0000F40030C, 0x0000F400323,
+    0x0000F400331, 0x00015000300, 0x00015000301, 0x00015000342,
+    0x00018400300, 0x00018400301, 0x00018400303, 0x00018400309,
+    0x00018800304, 0x00018A00301, 0x00018C00301, 0x00018C00304,
+    0x00018E00301, 0x00019400300, 0x00019400301, 0x00019400303,
+    0x00019400309, 0x00019E00301, 0x0001A800300, 0x0001A800301,
+    0x0001A800303, 0x0001A800309, 0x0001AA00301, 0x0001AA00304,
+    0x0001AA00308, 0x0001AC00304, 0x0001B000301, 0x0001B800300,
+    0x0001B800301, 0x0001B800304, 0x0001B80030C, 0x0001C400300,
+    0x0001C400301, 0x0001C400303, 0x0001C400309, 0x0001C800304,
+    0x0001CA00301, 0x0001CC00301, 0x0001CC00304, 0x0001CE00301,
+    0x0001D400300, 0x0001D400301, 0x0001D400303, 0x0001D400309,
+    0x0001DE00301, 0x0001E800300, 0x0001E800301, 0x0001E800303,
+    0x0001E800309, 0x0001EA00301, 0x0001EA00304, 0x0001EA00308,
+    0x0001EC00304, 0x0001F000301, 0x0001F800300, 0x0001F800301,
+    0x0001F800304, 0x0001F80030C, 0x00020400300, 0x00020400301,
+    0x00020400303, 0x00020400309, 0x00020600300, 0x00020600301,
+    0x00020600303, 0x00020600309, 0x00022400300, 0x00022400301,
+    0x00022600300, 0x00022600301, 0x00029800300, 0x00029800301,
+    0x00029A00300, 0x00029A00301, 0x0002B400307, 0x0002B600307,
+    0x0002C000307, 0x0002C200307, 0x0002D000301, 0x0002D200301,
+    0x0002D400308, 0x0002D600308, 0x0002FE00307, 0x00034000300,
+    0x00034000301, 0x00034000303, 0x00034000309, 0x00034000323,
+    0x00034200300, 0x00034200301, 0x00034200303, 0x00034200309,
+    0x00034200323, 0x00035E00300, 0x00035E00301, 0x00035E00303,
+    0x00035E00309, 0x00035E00323, 0x00036000300, 0x00036000301,
+    0x00036000303, 0x00036000309, 0x00036000323, 0x00036E0030C,
+    0x0003D400304, 0x0003D600304, 0x00044C00304, 0x00044E00304,
+    0x00045000306, 0x00045200306, 0x00045C00304, 0x00045E00304,
+    0x0005240030C, 0x00072200300, 0x00072200301, 0x00072200304,
+    0x00072200306, 0x00072200313, 0x00072200314, 0x00072200345,
+    0x00072A00300, 0x00072A00301, 0x00072A00313, 0x00072A00314,
+    0x00072E00300, 0x00072E00301, 0x00072E00313, 0x00072E00314,
+    0x00072E00345, 0x00073200300, 0x00073200301, 0x00073200304,
+    0x00073200306, 0x00073200308, 0x00073200313, 0x00073200314,
+    0x00073E00300, 0x00073E00301, 0x00073E00313, 0x00073E00314,
+    0x00074200314, 0x00074A00300, 0x00074A00301, 0x00074A00304,
+    0x00074A00306, 0x00074A00308, 0x00074A00314, 0x00075200300,
+    0x00075200301, 0x00075200313, 0x00075200314, 0x00075200345,
+    0x00075800345, 0x00075C00345, 0x00076200300, 0x00076200301,
+    0x00076200304, 0x00076200306, 0x00076200313, 0x00076200314,
+    0x00076200342, 0x00076200345, 0x00076A00300, 0x00076A00301,
+    0x00076A00313, 0x00076A00314, 0x00076E00300, 0x00076E00301,
+    0x00076E00313, 0x00076E00314, 0x00076E00342, 0x00076E00345,
+    0x00077200300, 0x00077200301, 0x00077200304, 0x00077200306,
+    0x00077200308, 0x00077200313, 0x00077200314, 0x00077200342,
+    0x00077E00300, 0x00077E00301, 0x00077E00313, 0x00077E00314,
+    0x00078200313, 0x00078200314, 0x00078A00300, 0x00078A00301,
+    0x00078A00304, 0x00078A00306, 0x00078A00308, 0x00078A00313,
+    0x00078A00314, 0x00078A00342, 0x00079200300, 0x00079200301,
+    0x00079200313, 0x00079200314, 0x00079200342, 0x00079200345,
+    0x00079400300, 0x00079400301, 0x00079400342, 0x00079600300,
+    0x00079600301, 0x00079600342, 0x00079C00345, 0x0007A400301,
+    0x0007A400308, 0x00080C00308, 0x00082000306, 0x00082000308,
+    0x00082600301, 0x00082A00300, 0x00082A00306, 0x00082A00308,
+    0x00082C00306, 0x00082C00308, 0x00082E00308, 0x00083000300,
+    0x00083000304, 0x00083000306, 0x00083000308, 0x00083400301,
+    0x00083C00308, 0x00084600304, 0x00084600306, 0x00084600308,
+    0x0008460030B, 0x00084E00308, 0x00085600308, 0x00085A00308,
+    0x00086000306, 0x00086000308, 0x00086600301, 0x00086A00300,
+    0x00086A00306, 0x00086A00308, 0x00086C00306, 0x00086C00308,
+    0x00086E00308, 0x00087000300, 0x00087000304, 0x00087000306,
+    0x00087000308, 0x00087400301, 0x00087C00308, 0x00088600304,
+    0x00088600306, 0x00088600308, 0x0008860030B, 0x00088E00308,
+    0x00089600308, 0x00089A00308, 0x0008AC00308, 0x0008E80030F,
+    0x0008EA0030F, 0x0009B000308, 0x0009B200308, 0x0009D000308,
+    0x0009D200308, 0x000C4E00653, 0x000C4E00654, 0x000C4E00655,
+    0x000C9000654, 0x000C9400654, 0x000D8200654, 0x000DA400654,
+    0x000DAA00654, 0x0012500093C, 0x0012600093C, 0x0012660093C,
+    0x00138E009BE, 0x00138E009D7, 0x00168E00B3E, 0x00168E00B56,
+    0x00168E00B57, 0x00172400BD7, 0x00178C00BBE, 0x00178C00BD7,
+    0x00178E00BBE, 0x00188C00C56, 0x00197E00CD5, 0x00198C00CC2,
+    0x00198C00CD5, 0x00198C00CD6, 0x00199400CD5, 0x001A8C00D3E,
+    0x001A8C00D57, 0x001A8E00D3E, 0x001BB200DCA, 0x001BB200DCF,
+    0x001BB200DDF, 0x001BB800DCA, 0x00204A0102E, 0x00360A01B35,
+    0x00360E01B35, 0x00361201B35, 0x00361601B35, 0x00361A01B35,
+    0x00362201B35, 0x00367401B35, 0x00367801B35, 0x00367C01B35,
+    0x00367E01B35, 0x00368401B35, 0x003C6C00304, 0x003C6E00304,
+    0x003CB400304, 0x003CB600304, 0x003CC400307, 0x003CC600307,
+    0x003D4000302, 0x003D4000306, 0x003D4200302, 0x003D4200306,
+    0x003D7000302, 0x003D7200302, 0x003D9800302, 0x003D9A00302,
+    0x003E0000300, 0x003E0000301, 0x003E0000342, 0x003E0000345,
+    0x003E0200300, 0x003E0200301, 0x003E0200342, 0x003E0200345,
+    0x003E0400345, 0x003E0600345, 0x003E0800345, 0x003E0A00345,
+    0x003E0C00345, 0x003E0E00345, 0x003E1000300, 0x003E1000301,
+    0x003E1000342, 0x003E1000345, 0x003E1200300, 0x003E1200301,
+    0x003E1200342, 0x003E1200345, 0x003E1400345, 0x003E1600345,
+    0x003E1800345, 0x003E1A00345, 0x003E1C00345, 0x003E1E00345,
+    0x003E2000300, 0x003E2000301, 0x003E2200300, 0x003E2200301,
+    0x003E3000300, 0x003E3000301, 0x003E3200300, 0x003E3200301,
+    0x003E4000300, 0x003E4000301, 0x003E4000342, 0x003E4000345,
+    0x003E4200300, 0x003E4200301, 0x003E4200342, 0x003E4200345,
+    0x003E4400345, 0x003E4600345, 0x003E4800345, 0x003E4A00345,
+    0x003E4C00345, 0x003E4E00345, 0x003E5000300, 0x003E5000301,
+    0x003E5000342, 0x003E5000345, 0x003E5200300, 0x003E5200301,
+    0x003E5200342, 0x003E5200345, 0x003E5400345, 0x003E5600345,
+    0x003E5800345, 0x003E5A00345, 0x003E5C00345, 0x003E5E00345,
+    0x003E6000300, 0x003E6000301, 0x003E6000342, 0x003E6200300,
+    0x003E6200301, 0x003E6200342, 0x003E7000300, 0x003E7000301,
+    0x003E7000342, 0x003E7200300, 0x003E7200301, 0x003E7200342,
+    0x003E8000300, 0x003E8000301, 0x003E8200300, 0x003E8200301,
+    0x003E9000300, 0x003E9000301, 0x003E9200300, 0x003E9200301,
+    0x003EA000300, 0x003EA000301, 0x003EA000342, 0x003EA200300,
+    0x003EA200301, 0x003EA200342, 0x003EB200300, 0x003EB200301,
+    0x003EB200342, 0x003EC000300, 0x003EC000301, 0x003EC000342,
+    0x003EC000345, 0x003EC200300, 0x003EC200301, 0x003EC200342,
+    0x003EC200345, 0x003EC400345, 0x003EC600345, 0x003EC800345,
+    0x003ECA00345, 0x003ECC00345, 0x003ECE00345, 0x003ED000300,
+    0x003ED000301, 0x003ED000342, 0x003ED000345, 0x003ED200300,
+    0x003ED200301, 0x003ED200342, 0x003ED200345, 0x003ED400345,
+    0x003ED600345, 0x003ED800345, 0x003EDA00345, 0x003EDC00345,
+    0x003EDE00345, 0x003EE000345, 0x003EE800345, 0x003EF800345,
+    0x003F6C00345, 0x003F7E00300, 0x003F7E00301, 0x003F7E00342,
+    0x003F8C00345, 0x003FEC00345, 0x003FFC00300, 0x003FFC00301,
+    0x003FFC00342, 0x00432000338, 0x00432400338, 0x00432800338,
+    0x0043A000338, 0x0043A400338, 0x0043A800338, 0x00440600338,
+    0x00441000338, 0x00441600338, 0x00444600338, 0x00444A00338,
+    0x00447800338, 0x00448600338, 0x00448A00338, 0x00449000338,
+    0x00449A00338, 0x0044C200338, 0x0044C800338, 0x0044CA00338,
+    0x0044E400338, 0x0044E600338, 0x0044EC00338, 0x0044EE00338,
+    0x0044F400338, 0x0044F600338, 0x0044F800338, 0x0044FA00338,
+    0x00450400338, 0x00450600338, 0x00450C00338, 0x00450E00338,
+    0x00452200338, 0x00452400338, 0x00454400338, 0x00455000338,
+    0x00455200338, 0x00455600338, 0x00456400338, 0x00456600338,
+    0x00456800338, 0x00456A00338, 0x00608C03099, 0x00609603099,
+    0x00609A03099, 0x00609E03099, 0x0060A203099, 0x0060A603099,
+    0x0060AA03099, 0x0060AE03099, 0x0060B203099, 0x0060B603099,
+    0x0060BA03099, 0x0060BE03099, 0x0060C203099, 0x0060C803099,
+    0x0060CC03099, 0x0060D003099, 0x0060DE03099, 0x0060DE0309A,
+    0x0060E403099, 0x0060E40309A, 0x0060EA03099, 0x0060EA0309A,
+    0x0060F003099, 0x0060F00309A, 0x0060F603099, 0x0060F60309A,
+    0x00613A03099, 0x00614C03099, 0x00615603099, 0x00615A03099,
+    0x00615E03099, 0x00616203099, 0x00616603099, 0x00616A03099,
+    0x00616E03099, 0x00617203099, 0x00617603099, 0x00617A03099,
+    0x00617E03099, 0x00618203099, 0x00618803099, 0x00618C03099,
+    0x00619003099, 0x00619E03099, 0x00619E0309A, 0x0061A403099,
+    0x0061A40309A, 0x0061AA03099, 0x0061AA0309A, 0x0061B003099,
+    0x0061B00309A, 0x0061B603099, 0x0061B60309A, 0x0061DE03099,
+    0x0061E003099, 0x0061E203099, 0x0061E403099, 0x0061FA03099,
+    0x022132110BA, 0x022136110BA, 0x02214A110BA, 0x02226211127,
+    0x02226411127, 0x02268E1133E, 0x02268E11357, 0x022972114B0,
+    0x022972114BA, 0x022972114BD, 0x022B70115AF, 0x022B72115AF,
+    0x02326A11930,
+};
+
+static const uint32_t NORM_COMPOSITES[941] = {
+    0x0226E, 0x02260, 0x0226F, 0x000C0, 0x000C1, 0x000C2, 0x000C3, 0x00100,
+    0x00102, 0x00226, 0x000C4, 0x01EA2, 0x000C5, 0x001CD, 0x00200, 0x00202,
+    0x01EA0, 0x01E00, 0x00104, 0x01E02, 0x01E04, 0x01E06, 0x00106, 0x00108,
+    0x0010A, 0x0010C, 0x000C7, 0x01E0A, 0x0010E, 0x01E0C, 0x01E10, 0x01E12,
+    0x01E0E, 0x000C8, 0x000C9, 0x000CA, 0x01EBC, 0x00112, 0x00114, 0x00116,
+    0x000CB, 0x01EBA, 0x0011A, 0x00204, 0x00206, 0x01EB8, 0x00228, 0x00118,
+    0x01E18, 0x01E1A, 0x01E1E, 0x001F4, 0x0011C, 0x01E20, 0x0011E, 0x00120,
+    0x001E6, 0x00122, 0x00124, 0x01E22, 0x01E26, 0x0021E, 0x01E24, 0x01E28,
+    0x01E2A, 0x000CC, 0x000CD, 0x000CE, 0x00128, 0x0012A, 0x0012C, 0x00130,
+    0x000CF, 0x01EC8, 0x001CF, 0x00208, 0x0020A, 0x01ECA, 0x0012E, 0x01E2C,
+    0x00134, 0x01E30, 0x001E8, 0x01E32, 0x00136, 0x01E34, 0x00139, 0x0013D,
+    0x01E36, 0x0013B, 0x01E3C, 0x01E3A, 0x01E3E, 0x01E40, 0x01E42, 0x001F8,
+    0x00143, 0x000D1, 0x01E44, 0x00147, 0x01E46, 0x00145, 0x01E4A, 0x01E48,
+    0x000D2, 0x000D3, 0x000D4, 0x000D5, 0x0014C, 0x0014E, 0x0022E, 0x000D6,
+    0x01ECE, 0x00150, 0x001D1, 0x0020C, 0x0020E, 0x001A0, 0x01ECC, 0x001EA,
+    0x01E54, 0x01E56, 0x00154, 0x01E58, 0x00158, 0x00210, 0x00212, 0x01E5A,
+    0x00156, 0x01E5E, 0x0015A, 0x0015C, 0x01E60, 0x00160, 0x01E62, 0x00218,
+    0x0015E, 0x01E6A, 0x00164, 0x01E6C, 0x0021A, 0x00162, 0x01E70, 0x01E6E,
+    0x000D9, 0x000DA, 0x000DB, 0x00168, 0x0016A, 0x0016C, 0x000DC, 0x01EE6,
+    0x0016E, 0x00170, 0x001D3, 0x00214, 0x00216, 0x001AF, 0x01EE4, 0x01E72,
+    0x00172, 0x01E76, 0x01E74, 0x01E7C, 0x01E7E, 0x01E80, 0x01E82, 0x00174,
+    0x01E86, 0x01E84, 0x01E88, 0x01E8A, 0x01E8C, 0x01EF2, 0x000DD, 0x00176,
+    0x01EF8, 0x00232, 0x01E8E, 0x00178, 0x01EF6, 0x01EF4, 0x00179, 0x01E90,
+    0x0017B, 0x0017D, 0x01E92, 0x01E94, 0x000E0, 0x000E1, 0x000E2, 0x000E3,
+    0x00101, 0x00103, 0x00227, 0x000E4, 0x01EA3, 0x000E5, 0x001CE, 0x00201,
+    0x00203, 0x01EA1, 0x01E01, 0x00105, 0x01E03, 0x01E05, 0x01E07, 0x00107,
+    0x00109, 0x0010B, 0x0010D, 0x000E7, 0x01E0B, 0x0010F, 0x01E0D, 0x01E11,
+    0x01E13, 0x01E0F, 0x000E8, 0x000E9, 0x000EA, 0x01EBD, 0x00113, 0x00115,
+    0x00117, 0x000EB, 0x01EBB, 0x0011B, 0x00205, 0x00207, 0x01EB9, 0x00229,
+    0x00119, 0x01E19, 0x01E1B, 0x01E1F, 0x001F5, 0x0011D, 0x01E21, 0x0011F,
+    0x00121, 0x001E7, 0x00123, 0x00125, 0x01E23, 0x01E27, 0x0021F, 0x01E25,
+    0x01E29, 0x01E2B, 0x01E96, 0x000EC, 0x000ED, 0x000EE, 0x00129, 0x0012B,
+    0x0012D, 0x000EF, 0x01EC9, 0x001D0, 0x00209, 0x0020B, 0x01ECB, 0x0012F,
+    0x01E2D, 0x00135, 0x001F0, 0x01E31, 0x001E9, 0x01E33, 0x00137, 0x01E35,
+    0x0013A, 0x0013E, 0x01E37, 0x0013C, 0x01E3D, 0x01E3B, 0x01E3F, 0x01E41,
+    0x01E43, 0x001F9, 0x00144, 0x000F1, 0x01E45, 0x00148, 0x01E47, 0x00146,
+    0x01E4B, 0x01E49, 0x000F2, 0x000F3, 0x000F4, 0x000F5, 0x0014D, 0x0014F,
+    0x0022F, 0x000F6, 0x01ECF, 0x00151, 0x001D2, 0x0020D, 0x0020F, 0x001A1,
+    0x01ECD, 0x001EB, 0x01E55, 0x01E57, 0x00155, 0x01E59, 0x00159, 0x00211,
+    0x00213, 0x01E5B, 0x00157, 0x01E5F, 0x0015B, 0x0015D, 0x01E61, 0x00161,
+    0x01E63, 0x00219, 0x0015F, 0x01E6B, 0x01E97, 0x00165, 0x01E6D, 0x0021B,
+    0x00163, 0x01E71, 0x01E6F, 0x000F9, 0x000FA, 0x000FB, 0x00169, 0x0016B,
+    0x0016D, 0x000FC, 0x01EE7, 0x0016F, 0x00171, 0x001D4, 0x00215, 0x00217,
+    0x001B0, 0x01EE5, 0x01E73, 0x00173, 0x01E77, 0x01E75, 0x01E7D, 0x01E7F,
+    0x01E81, 0x01E83, 0x00175, 0x01E87, 0x01E85, 0x01E98, 0x01E89, 0x01E8B,
+    0x01E8D, 0x01EF3, 0x000FD, 0x00177, 0x01EF9, 0x00233, 0x01E8F, 0x000FF,
+    0x01EF7, 0x01E99, 0x01EF5, 0x0017A, 0x01E91, 0x0017C, 0x0017E, 0x01E93,
+    0x01E95, 0x01FED, 0x00385, 0x01FC1, 0x01EA6, 0x01EA4, 0x01EAA, 0x01EA8,
+    0x001DE, 0x001FA, 0x001FC, 0x001E2, 0x01E08, 0x01EC0, 0x01EBE, 0x01EC4,
+    0x01EC2, 0x01E2E, 0x01ED2, 0x01ED0, 0x01ED6, 0x01ED4, 0x01E4C, 0x0022C,
+    0x01E4E, 0x0022A, 0x001FE, 0x001DB, 0x001D7, 0x001D5, 0x001D9, 0x01EA7,
+    0x01EA5, 0x01EAB, 0x01EA9, 0x001DF, 0x001FB, 0x001FD, 0x001E3, 0x01E09,
+    0x01EC1, 0x01EBF, 0x01EC5, 0x01EC3, 0x01E2F, 0x01ED3, 0x01ED1, 0x01ED7,
+    0x01ED5, 0x01E4D, 0x0022D, 0x01E4F, 0x0022B, 0x001FF, 0x001DC, 0x001D8,
+    0x001D6, 0x001DA, 0x01EB0, 0x01EAE, 0x01EB4, 0x01EB2, 0x01EB1, 0x01EAF,
+    0x01EB5, 0x01EB3, 0x01E14, 0x01E16, 0x01E15, 0x01E17, 0x01E50, 0x01E52,
+    0x01E51, 0x01E53, 0x01E64, 0x01E65, 0x01E66, 0x01E67, 0x01E78, 0x01E79,
+    0x01E7A, 0x01E7B, 0x01E9B, 0x01EDC, 0x01EDA, 0x01EE0, 0x01EDE, 0x01EE2,
+    0x01EDD, 0x01EDB, 0x01EE1, 0x01EDF, 0x01EE3, 0x01EEA, 0x01EE8, 0x01EEE,
+    0x01EEC, 0x01EF0, 0x01EEB, 0x01EE9, 0x01EEF, 0x01EED, 0x01EF1, 0x001EE,
+    0x001EC, 0x001ED, 0x001E0, 0x001E1, 0x01E1C, 0x01E1D, 0x00230, 0x00231,
+    0x001EF, 0x01FBA, 0x00386, 0x01FB9, 0x01FB8, 0x01F08, 0x01F09, 0x01FBC,
+    0x01FC8, 0x00388, 0x01F18, 0x01F19, 0x01FCA, 0x00389, 0x01F28, 0x01F29,
+    0x01FCC, 0x01FDA, 0x0038A, 0x01FD9, 0x01FD8, 0x003AA, 0x01F38, 0x01F39,
+    0x01FF8, 0x0038C, 0x01F48, 0x01F49, 0x01FEC, 0x01FEA, 0x0038E, 0x01FE9,
+    0x01FE8, 0x003AB, 0x01F59, 0x01FFA, 0x0038F, 0x01F68, 0x01F69, 0x01FFC,
+    0x01FB4, 0x01FC4, 0x01F70, 0x003AC, 0x01FB1, 0x01FB0, 0x01F00, 0x01F01,
+    0x01FB6, 0x01FB3, 0x01F72, 0x003AD, 0x01F10, 0x01F11, 0x01F74, 0x003AE,
+    0x01F20, 0x01F21, 0x01FC6, 0x01FC3, 0x01F76, 0x003AF, 0x01FD1, 0x01FD0,
+    0x003CA, 0x01F30, 0x01F31, 0x01FD6, 0x01F78, 0x003CC, 0x01F40, 0x01F41,
+    0x01FE4, 0x01FE5, 0x01F7A, 0x003CD, 0x01FE1, 0x01FE0, 0x003CB, 0x01F50,
+    0x01F51, 0x01FE6, 0x01F7C, 0x003CE, 0x01F60, 0x01F61, 0x01FF6, 0x01FF3,
+    0x01FD2, 0x00390, 0x01FD7, 0x01FE2, 0x003B0, 0x01FE7, 0x01FF4, 0x003D3,
+    0x003D4, 0x00407, 0x004D0, 0x004D2, 0x00403, 0x00400, 0x004D6, 0x00401,
+    0x004C1, 0x004DC, 0x004DE, 0x0040D, 0x004E2, 0x00419, 0x004E4, 0x0040C,
+    0x004E6, 0x004EE, 0x0040E, 0x004F0, 0x004F2, 0x004F4, 0x004F8, 0x004EC,
+    0x004D1, 0x004D3, 0x00453, 0x00450, 0x004D7, 0x00451, 0x004C2, 0x004DD,
+    0x004DF, 0x0045D, 0x004E3, 0x00439, 0x004E5, 0x0045C, 0x004E7, 0x004EF,
+    0x0045E, 0x004F1, 0x004F3, 0x004F5, 0x004F9, 0x004ED, 0x00457, 0x00476,
+    0x00477, 0x004DA, 0x004DB, 0x004EA, 0x004EB, 0x00622, 0x00623, 0x00625,
+    0x00624, 0x00626, 0x006C2, 0x006D3, 0x006C0, 0x00929, 0x00931, 0x00934,
+    0x009CB, 0x009CC, 0x00B4B, 0x00B48, 0x00B4C, 0x00B94, 0x00BCA, 0x00BCC,
+    0x00BCB, 0x00C48, 0x00CC0, 0x00CCA, 0x00CC7, 0x00CC8, 0x00CCB, 0x00D4A,
+    0x00D4C, 0x00D4B, 0x00DDA, 0x00DDC, 0x00DDE, 0x00DDD, 0x01026, 0x01B06,
+    0x01B08, 0x01B0A, 0x01B0C, 0x01B0E, 0x01B12, 0x01B3B, 0x01B3D, 0x01B40,
+    0x01B41, 0x01B43, 0x01E38, 0x01E39, 0x01E5C, 0x01E5D, 0x01E68, 0x01E69,
+    0x01EAC, 0x01EB6, 0x01EAD, 0x01EB7, 0x01EC6, 0x01EC7, 0x01ED8, 0x01ED9,
+    0x01F02, 0x01F04, 0x01F06, 0x01F80, 0x01F03, 0x01F05, 0x01F07, 0x01F81,
+    0x01F82, 0x01F83, 0x01F84, 0x01F85, 0x01F86, 0x01F87, 0x01F0A, 0x01F0C,
+    0x01F0E, 0x01F88, 0x01F0B, 0x01F0D, 0x01F0F, 0x01F89, 0x01F8A, 0x01F8B,
+    0x01F8C, 0x01F8D, 0x01F8E, 0x01F8F, 0x01F12, 0x01F14, 0x01F13, 0x01F15,
+    0x01F1A, 0x01F1C, 0x01F1B, 0x01F1D, 0x01F22, 0x01F24, 0x01F26, 0x01F90,
+    0x01F23, 0x01F25, 0x01F27, 0x01F91, 0x01F92, 0x01F93, 0x01F94, 0x01F95,
+    0x01F96, 0x01F97, 0x01F2A, 0x01F2C, 0x01F2E, 0x01F98, 0x01F2B, 0x01F2D,
+    0x01F2F, 0x01F99, 0x01F9A, 0x01F9B, 0x01F9C, 0x01F9D, 0x01F9E, 0x01F9F,
+    0x01F32, 0x01F34, 0x01F36, 0x01F33, 0x01F35, 0x01F37, 0x01F3A, 0x01F3C,
+    0x01F3E, 0x01F3B, 0x01F3D, 0x01F3F, 0x01F42, 0x01F44, 0x01F43, 0x01F45,
+    0x01F4A, 0x01F4C, 0x01F4B, 0x01F4D, 0x01F52, 0x01F54, 0x01F56, 0x01F53,
+    0x01F55, 0x01F57, 0x01F5B, 0x01F5D, 0x01F5F, 0x01F62, 0x01F64, 0x01F66,
+    0x01FA0, 0x01F63, 0x01F65, 0x01F67, 0x01FA1, 0x01FA2, 0x01FA3, 0x01FA4,
+    0x01FA5, 0x01FA6, 0x01FA7, 0x01F6A, 0x01F6C, 0x01F6E, 0x01FA8, 0x01F6B,
+    0x01F6D, 0x01F6F, 0x01FA9, 0x01FAA, 0x01FAB, 0x01FAC, 0x01FAD, 0x01FAE,
+    0x01FAF, 0x01FB2, 0x01FC2, 0x01FF2, 0x01FB7, 0x01FCD, 0x01FCE, 0x01FCF,
+    0x01FC7, 0x01FF7, 0x01FDD, 0x01FDE, 0x01FDF, 0x0219A, 0x0219B, 0x021AE,
+    0x021CD, 0x021CF, 0x021CE, 0x02204, 0x02209, 0x0220C, 0x02224, 0x02226,
+    0x02241, 0x02244, 0x02247, 0x02249, 0x0226D, 0x02262, 0x02270, 0x02271,
+    0x02274, 0x02275, 0x02278, 0x02279, 0x02280, 0x02281, 0x022E0, 0x022E1,
+    0x02284, 0x02285, 0x02288, 0x02289, 0x022E2, 0x022E3, 0x022AC, 0x022AD,
+    0x022AE, 0x022AF, 0x022EA, 0x022EB, 0x022EC, 0x022ED, 0x03094, 0x0304C,
+    0x0304E, 0x03050, 0x03052, 0x03054, 0x03056, 0x03058, 0x0305A, 0x0305C,
+    0x0305E, 0x03060, 0x03062, 0x03065, 0x03067, 0x03069, 0x03070, 0x03071,
+    0x03073, 0x03074, 0x03076, 0x03077, 0x03079, 0x0307A, 0x0307C, 0x0307D,
+    0x0309E, 0x030F4, 0x030AC, 0x030AE, 0x030B0, 0x030B2, 0x030B4, 0x030B6,
+    0x030B8, 0x030BA, 0x030BC, 0x030BE, 0x030C0, 0x030C2, 0x030C5, 0x030C7,
+    0x030C9, 0x030D0, 0x030D1, 0x030D3, 0x030D4, 0x030D6, 0x030D7, 0x030D9,
+    0x030DA, 0x030DC, 0x030DD, 0x030F7, 0x030F8, 0x030F9, 0x030FA, 0x030FE,
+    0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F, 0x1134B, 0x1134C, 0x114BC,
+    0x114BB, 0x114BE, 0x115BA, 0x115BB, 0x11938,
+};
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+# Generates strnorm_tables.h from the Unicode database shipped with Python
+#
+#   python3 strnorm_tables.py > strnorm_tables.h
+
+import unicodedata
+
+# Codepoints past this one have no normalization properties
+LIMIT = 0x30000
+BLOCK = 64
+
+S_BASE, S_COUNT = 0xAC00, 11172
+V_BASE, V_COUNT = 0x1161, 21
+T_BASE, T_COUNT = 0x11A7, 28
+
+NFD_NO    = 0x1
+NFC_NO    = 0x2
+NFC_MAYBE = 0x4
+
+def is_hangul(cp):
+    return S_BASE <= cp < S_BASE + S_COUNT
+
+def canonical(cp):
+    d = unicodedata.decomposition(chr(cp))
+    if not d or d.startswith('<'): return None
+    return [int(x, 16) for x in d.split()]
+
+# Primary composites: canonical pairs that are not excluded from composition
+pairs = {}
+for cp in range(0x110000):
+    d = canonical(cp)
+    if d and len(d) == 2 and unicodedata.normalize('NFC', chr(cp)) == chr(cp):
+        pairs[(d[0], d[1])] = cp
+
+seconds = {s for (_, s) in pairs}
+seconds |= set(range(V_BASE, V_BASE + V_COUNT))
+seconds |= set(range(T_BASE + 1, T_BASE + T_COUNT))
+
+# Properties of every codepoint: (ccc, flags, decomposition)
+decomps = []
+decomp_offsets = {}
+props = [(0, 0, 0, 0)]
+props_index = {props[0]: 0}
+cp_props = []
+
+for cp in range(LIMIT):
+    c = chr(cp)
+    ccc = unicodedata.combining(c)
+    flags = 0
+    dlen = doff = 0
+
+    nfd = unicodedata.normalize('NFD', c)
+    if nfd != c:
+        flags |= NFD_NO
+        if not is_hangul(cp):
+            seq = tuple(ord(x) for x in nfd)
+            if seq not in decomp_offsets:
+                decomp_offsets[seq] = len(decomps)
+                decomps.extend(seq)
+            dlen, doff = len(seq), decomp_offsets[seq]
+
+    if unicodedata.normalize('NFC', c) != c: flags |= NFC_NO
+    elif cp in seconds: flags |= NFC_MAYBE
+
+    p = (ccc, flags, dlen, doff)
+    if p not in props_index:
+        props_index[p] = len(props)
+        props.append(p)
+    cp_props.append(props_index[p])
+
+assert max(cp for (_, _), cp in pairs.items()) < LIMIT
+assert len(props) < 1 << 16 and len(decomps) < 1 << 16
+
+# Two-stage table with deduplicated blocks
+blocks = []
+block_index = {}
+stage1 = []
+for b in range(0, LIMIT, BLOCK):
+    block = tuple(cp_props[b:b + BLOCK])
+    if block not in block_index:
+        block_index[block] = len(blocks)
+        blocks.append(block)
+    stage1.append(block_index[block])
+
+def rows(values, per_line, fmt):
+    for i in range(0, len(values), per_line):
+        print('    ' + ' '.join(fmt(v) + ',' for v in values[i:i + per_line]))
+
+print('// Unicode %s normalization tables (generated by strnorm_tables.py, do not edit)' %
+      unicodedata.unidata_version)
+print()
+print('#define NORM_LIMIT 0x%X' % LIMIT)
+print('#define NORM_BLOCK %d' % BLOCK)
+print()
+print('// Codepoint block -> index of the block in NORM_STAGE2')
+print('static const uint%d_t NORM_STAGE1[%d] = {' % (8 if len(blocks) < 256 else 16, len(stage1)))
+rows(stage1, 16, str)
+print('};')
+print()
+print('// Codepoint -> index in NORM_PROPS')
+print('static const uint16_t NORM_STAGE2[%d][NORM_BLOCK] = {' % len(blocks))
+for block in blocks:
+    print('    {')
+    rows(block, 16, str)
+    print('    },')
+print('};')
+print()
+print('static const NormProps NORM_PROPS[%d] = {' % len(props))
+for ccc, flags, dlen, doff in props:
+    print('    { %3d, 0x%x, %d, %4d },' % (ccc, flags, dlen, doff))
+print('};')
+print()
+print('// Full canonical decompositions')
+print('static const uint32_t NORM_DECOMPS[%d] = {' % len(decomps))
+rows(decomps, 8, lambda v: '0x%05X' % v)
+print('};')
+print()
+print('// Primary composites, sorted by (first << 21 | second)')
+print('static const uint64_t NORM_PAIRS[%d] = {' % len(pairs))
+rows(sorted(f << 21 | s for (f, s) in pairs), 4, lambda v: '0x%011X' % v)
+print('};')
+print()
+print('static const uint32_t NORM_COMPOSITES[%d] = {' % len(pairs))
+rows([pairs[k] for k in sorted(pairs, key=lambda k: k[0] << 21 | k[1])], 8,
+     lambda v: '0x%05X' % v)
+print('};')
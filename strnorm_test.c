@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strnorm.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+int main() {
+    // "café" precomposed and decomposed
+    String cafe_nfc = str_ref("caf\xC3\xA9");
+    String cafe_nfd = str_ref("cafe\xCC\x81");
+
+    test("str_normalize (NFC)", {
+        String s = str_normalize(cafe_nfd, STR_NFC);
+        assert_string_eq(cafe_nfc, s);
+        str_free(&s);
+
+        // Canonical reordering: dot below (220) goes before dot above (230)
+        s = str_normalize(str_ref("q\xCC\x87\xCC\xA3"), STR_NFC);
+        assert_string_eq(str_ref("q\xCC\xA3\xCC\x87"), s);
+        str_free(&s);
+
+        // Hangul jamo compose algorithmically (U+1100 U+1161 U+11A8 -> U+AC01)
+        s = str_normalize(str_ref("\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8"), STR_NFC);
+        assert_string_eq(str_ref("\xEA\xB0\x81"), s);
+        str_free(&s);
+
+        // Singletons never appear in NFC (U+212B ANGSTROM SIGN -> U+00C5)
+        s = str_normalize(str_ref("\xE2\x84\xAB"), STR_NFC);
+        assert_string_eq(str_ref("\xC3\x85"), s);
+        str_free(&s);
+    });
+
+    test("str_normalize (NFD)", {
+        String s = str_normalize(cafe_nfc, STR_NFD);
+        assert_string_eq(cafe_nfd, s);
+        str_free(&s);
+
+        // U+1E69 (s with dot below and dot above) decomposes recursively
+        s = str_normalize(str_ref("\xE1\xB9\xA9"), STR_NFD);
+        assert_string_eq(str_ref("s\xCC\xA3\xCC\x87"), s);
+        str_free(&s);
+
+        s = str_normalize(str_ref("\xEA\xB0\x81"), STR_NFD);
+        assert_string_eq(str_ref("\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8"), s);
+        str_free(&s);
+    });
+
+    test("str_normalize (zero copy)", {
+        String ascii = str_ref("plain ascii identifier");
+        String s = str_normalize(ascii, STR_NFC);
+        assert(s.str == ascii.str && !(s.flags & STR_HEAP));
+
+        s = str_normalize(cafe_nfc, STR_NFC);
+        assert(s.str == cafe_nfc.str);
+
+        // Inconclusive quick check (U+0301 may compose) with nothing to compose
+        String mark = str_ref("\xCC\x81");
+        s = str_normalize(mark, STR_NFC);
+        assert(s.str == mark.str);
+    });
+
+    test("str_normalize (invalid UTF-8)", {
+        String s = str_normalize(str_ref("e\xCC\x81\xFF\xC3"), STR_NFC);
+        assert_string_eq(str_ref("\xC3\xA9\xFF\xC3"), s);
+        str_free(&s);
+    });
+
+    test("str_is_normalized", {
+        assert(str_is_normalized(cafe_nfc, STR_NFC));
+        assert(!str_is_normalized(cafe_nfc, STR_NFD));
+        assert(!str_is_normalized(cafe_nfd, STR_NFC));
+        assert(str_is_normalized(cafe_nfd, STR_NFD));
+        assert(str_is_normalized(str_ref(""), STR_NFC));
+    });
+
+    test("str_norm_eq", {
+        assert(str_norm_eq(cafe_nfc, cafe_nfd));
+        assert(str_norm_eq(str_ref("\xE2\x84\xAB"), str_ref("A\xCC\x8A")));
+        assert(!str_norm_eq(cafe_nfc, str_ref("cafe")));
+        assert(!str_eq(cafe_nfc, cafe_nfd));
+    });
+}
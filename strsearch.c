@@ -0,0 +1,340 @@
+#define _GNU_SOURCE
+#include "strsearch.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "strtrace.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Counts the '\n' bytes of s[0..len)
+static size_t count_newlines(const char *s, size_t len) {
+    size_t n = 0, i = 0;
+
+#ifdef __SSE2__
+    // Subtract the comparison masks (-1) from byte counters, summed up before they overflow
+    const __m128i nl = _mm_set1_epi8('\n');
+    const __m128i zero = _mm_setzero_si128();
+
+    while (i + 16 <= len) {
+        __m128i acc = zero;
+        size_t stop = i + 255 * 16 < len ? i + 255 * 16 : len;
+
+        for (; i + 16 <= stop; i += 16)
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(s + i)), nl));
+
+        __m128i sum = _mm_sad_epu8(acc, zero);
+        n += (size_t)_mm_cvtsi128_si32(sum) + (size_t)_mm_extract_epi16(sum, 4);
+    }
+#endif
+
+    for (; i < len; i++) n += s[i] == '\n';
+    return n;
+}
+
+// State of a search over consecutive buffers of a stream
+typedef struct {
+    String          needle;
+    StrSearchFlags  flags;
+    StrSearchFn     fn;
+    void           *ctx;
+    StrSearchResult res;       // `lines` counts the '\n' bytes until the end
+    uint64_t        next;      // absolute offset of the first byte not searched yet
+    uint64_t        resume;    // absolute offset after the last reported line (STR_SEARCH_LINES)
+    bool            skip_line; // the end of the last reported line was not seen yet
+    bool            stopped;   // the callback returned false
+    char            last;      // last byte searched
+} Search;
+
+// Reports the matches starting in buf[from..end) and counts the lines up to `end`.
+// buf[0..len) is available for the matches and their lines, and starts
+// at absolute offset `base`.
+static void search_range(Search *s, const char *buf, size_t len, uint64_t base,
+                         size_t from, size_t end) {
+    String needle = s->needle;
+    size_t counted = from;
+    size_t pos = from;
+
+    // Line of the first position, as far as it is in the buffer
+    const char *nl = from ? memrchr(buf, '\n', from) : NULL;
+    size_t line_start = nl ? (size_t)(nl - buf) + 1 : 0;
+
+    if (s->skip_line) {
+        nl = memchr(buf + from, '\n', end - from);
+        pos = nl ? (size_t)(nl - buf) + 1 : end;
+        s->skip_line = !nl;
+    } else if (s->resume > base + pos) {
+        pos = s->resume - base;
+    }
+
+    while (needle.len && !s->stopped && pos < end && len - pos >= needle.len) {
+        // Matches must start before `end`
+        size_t avail = end - pos + needle.len - 1;
+        if (avail > len - pos) avail = len - pos;
+
+        const char *hit = memmem(buf + pos, avail, needle.str, needle.len);
+        if (!hit) break;
+
+        size_t p = hit - buf;
+        nl = memrchr(buf + counted, '\n', p - counted);
+        if (nl) line_start = nl - buf + 1;
+        s->res.lines += count_newlines(buf + counted, p - counted);
+        counted = p;
+
+        nl = memchr(hit, '\n', len - p);
+        size_t line_end = nl ? (size_t)(nl - buf) : len;
+
+        StrSearchMatch match = {
+            .offset = base + p,
+            .line   = s->res.lines,
+            .text   = str_nref(buf + line_start, line_end - line_start),
+        };
+
+        s->res.matches++;
+        if (s->fn && !s->fn(s->ctx, &match)) s->stopped = true;
+
+        if (s->flags & STR_SEARCH_LINES) {
+            pos = line_end + 1;
+            s->resume = base + pos;
+            // The line goes on in the next buffer
+            if (!nl) s->skip_line = true;
+        } else {
+            pos = p + 1;
+        }
+    }
+
+    if (end > counted) s->res.lines += count_newlines(buf + counted, end - counted);
+    if (end > from) s->last = buf[end - 1];
+    s->next = base + end;
+}
+
+// Searches a buffer of the stream holding the bytes carried over from the previous one
+// followed by up to `chunk` new bytes. Returns the offset of the bytes to carry over:
+// the incomplete last line if it fits in a chunk, or the needle overlap otherwise.
+static size_t search_chunk(Search *s, const char *buf, size_t len, uint64_t base,
+                           size_t chunk, bool final) {
+    size_t from = s->next - base;
+    size_t end = len;
+
+    if (!final) {
+        // Search complete lines only, so reported lines are whole
+        const char *nl = memrchr(buf + from, '\n', len - from);
+        end = nl ? (size_t)(nl - buf) + 1 : 0;
+
+        // Matches must fit in the buffer
+        size_t fit = len >= s->needle.len ? len - s->needle.len + 1 : 0;
+        if (!nl || len - end > chunk || end > fit) end = fit;
+        if (end < from) end = from;
+    }
+
+    search_range(s, buf, len, base, from, end);
+    if (final) return len;
+
+    // Keep the start of the line containing `end` for context
+    const char *nl = end ? memrchr(buf, '\n', end) : NULL;
+    size_t keep = nl ? (size_t)(nl - buf) + 1 : 0;
+    return len - keep <= chunk ? keep : end;
+}
+
+static StrSearchResult search_finish(Search *s) {
+    StrSearchResult res = s->res;
+    res.bytes = s->next;
+
+    // A non-empty remainder after the last line break counts as a line
+    if (s->next && s->last != '\n') res.lines++;
+    return res;
+}
+
+/* * * * * * * Reader * * * * * * */
+
+typedef struct {
+    char  *mem;   // room for the bytes carried over (chunk), then the bytes read (chunk)
+    size_t len;   // number of bytes read
+    int    error;
+    bool   full;
+} Slot;
+
+// Reads the stream into two slots in turn, one being filled while the other is searched
+typedef struct {
+    int    fd;
+    FILE  *file;
+    size_t chunk;
+    Slot   slots[2];
+    unsigned alloc; // allocator slot of the slot buffers
+    bool   stop;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+} Reader;
+
+// Reads a whole chunk unless the stream ends or fails first
+static void read_chunk(Reader *r, Slot *slot) {
+    char *dst = slot->mem + r->chunk;
+    size_t n = 0;
+    slot->error = 0;
+
+    if (r->file) {
+        n = fread(dst, 1, r->chunk, r->file);
+        if (n < r->chunk && ferror(r->file)) slot->error = errno ? errno : EIO;
+    } else {
+        while (n < r->chunk) {
+            ssize_t k = read(r->fd, dst + n, r->chunk - n);
+            if (k < 0 && errno == EINTR) continue;
+            if (k < 0) slot->error = errno;
+            if (k <= 0) break;
+            n += k;
+        }
+    }
+
+    slot->len = n;
+}
+
+static void *reader_main(void *arg) {
+    Reader *r = arg;
+
+    for (size_t i = 0;; i++) {
+        Slot *slot = &r->slots[i % 2];
+
+        pthread_mutex_lock(&r->lock);
+        while (slot->full && !r->stop) pthread_cond_wait(&r->cond, &r->lock);
+        bool stop = r->stop;
+        pthread_mutex_unlock(&r->lock);
+        if (stop) break;
+
+        read_chunk(r, slot);
+
+        pthread_mutex_lock(&r->lock);
+        slot->full = true;
+        pthread_cond_broadcast(&r->cond);
+        pthread_mutex_unlock(&r->lock);
+
+        if (slot->len < r->chunk) break;
+    }
+
+    return NULL;
+}
+
+static void slot_wait(Reader *r, Slot *slot) {
+    pthread_mutex_lock(&r->lock);
+    while (!slot->full) pthread_cond_wait(&r->cond, &r->lock);
+    pthread_mutex_unlock(&r->lock);
+}
+
+static void slot_release(Reader *r, Slot *slot) {
+    pthread_mutex_lock(&r->lock);
+    slot->full = false;
+    pthread_cond_broadcast(&r->cond);
+    pthread_mutex_unlock(&r->lock);
+}
+
+// Tells whether the stream is a regular file that fits in a single chunk,
+// which is not worth a thread reading ahead
+static bool single_chunk(Reader *r) {
+    struct stat st;
+    int fd = r->file ? fileno(r->file) : r->fd;
+
+    return fd >= 0 && !fstat(fd, &st) && S_ISREG(st.st_mode) && (size_t)st.st_size < r->chunk;
+}
+
+static StrSearchResult search_stream(Reader *r, String needle, size_t chunk,
+                                     StrSearchFlags flags, StrSearchFn fn, void *ctx) {
+    Search s = { .needle = needle, .flags = flags, .fn = fn, .ctx = ctx };
+
+    // The overlap must fit in the room for the carried bytes
+    r->chunk = chunk ? chunk : STR_SEARCH_CHUNK;
+    if (r->chunk < needle.len) r->chunk = needle.len;
+
+    r->alloc = str_allocator_slot(NULL);
+    for (size_t i = 0; i < 2; i++) r->slots[i].mem = str_mem_alloc_with(r->alloc, 2 * r->chunk);
+    if (single_chunk(r)) flags |= STR_SEARCH_SYNC;
+
+    pthread_t thread;
+    bool threaded = !(flags & STR_SEARCH_SYNC);
+    if (threaded) {
+        pthread_mutex_init(&r->lock, NULL);
+        pthread_cond_init(&r->cond, NULL);
+        threaded = !pthread_create(&thread, NULL, reader_main, r);
+    }
+
+    const char *carry = NULL;
+    size_t carry_len = 0;
+    uint64_t base = 0;
+
+    for (size_t i = 0;; i++) {
+        Slot *slot = &r->slots[i % 2];
+        if (threaded) slot_wait(r, slot);
+        else read_chunk(r, slot);
+
+        // Put the bytes carried over right before the new ones
+        char *buf = slot->mem + r->chunk - carry_len;
+        if (carry_len) memcpy(buf, carry, carry_len);
+        if (threaded && i) slot_release(r, &r->slots[(i - 1) % 2]);
+
+        if (slot->error) s.res.error = slot->error;
+        bool final = slot->len < r->chunk;
+        size_t len = carry_len + slot->len;
+
+        size_t keep = search_chunk(&s, buf, len, base, r->chunk, final);
+        if (final || s.stopped) break;
+
+        carry = buf + keep;
+        carry_len = len - keep;
+        base += keep;
+    }
+
+    if (threaded) {
+        pthread_mutex_lock(&r->lock);
+        r->stop = true;
+        pthread_cond_broadcast(&r->cond);
+        pthread_mutex_unlock(&r->lock);
+
+        pthread_join(thread, NULL);
+    }
+
+    if (!(flags & STR_SEARCH_SYNC)) {
+        pthread_cond_destroy(&r->cond);
+        pthread_mutex_destroy(&r->lock);
+    }
+
+    for (size_t i = 0; i < 2; i++) str_mem_free_with(r->alloc, r->slots[i].mem, 2 * r->chunk);
+
+    return search_finish(&s);
+}
+
+/* * * * * * * Search * * * * * * */
+
+StrSearchResult str_search_fd(int fd, String needle, size_t chunk, StrSearchFlags flags,
+                              StrSearchFn fn, void *ctx) {
+    STR_TRACE_SPAN(STR_TRACE_SEARCH, 0);
+
+    Reader r = { .fd = fd };
+    StrSearchResult res = search_stream(&r, needle, chunk, flags, fn, ctx);
+    STR_TRACE_BYTES(res.bytes);
+    return res;
+}
+
+StrSearchResult str_search_file(FILE *f, String needle, size_t chunk, StrSearchFlags flags,
+                                StrSearchFn fn, void *ctx) {
+    STR_TRACE_SPAN(STR_TRACE_SEARCH, 0);
+
+    Reader r = { .file = f };
+    StrSearchResult res = search_stream(&r, needle, chunk, flags, fn, ctx);
+    STR_TRACE_BYTES(res.bytes);
+    return res;
+}
+
+StrSearchResult str_search_str(String haystack, String needle, StrSearchFlags flags,
+                               StrSearchFn fn, void *ctx) {
+    STR_TRACE_SPAN(STR_TRACE_SEARCH, haystack.len);
+
+    Search s = { .needle = needle, .flags = flags, .fn = fn, .ctx = ctx };
+    search_range(&s, haystack.str, haystack.len, 0, 0, haystack.len);
+    return search_finish(&s);
+}
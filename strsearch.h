@@ -0,0 +1,61 @@
+#ifndef _STRSEARCH_H
+#define _STRSEARCH_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Default number of bytes read at once
+#define STR_SEARCH_CHUNK (1 << 20)
+
+// Flags for the streaming search functions
+typedef enum {
+    // Report only the first match of every line (like grep)
+    STR_SEARCH_LINES = 0x1,
+    // Read in the calling thread instead of reading ahead in a background thread
+    STR_SEARCH_SYNC  = 0x2,
+} StrSearchFlags;
+
+// Match passed to the callback
+typedef struct {
+    uint64_t offset; // absolute byte offset of the match in the stream
+    uint64_t line;   // 0-based number of the line containing the match
+    String   text;   // that line without terminator (by reference, only valid during the
+                     // callback). Lines longer than the chunk size, or around a needle
+                     // containing line breaks, may be cut.
+} StrSearchMatch;
+
+// Called for every match in stream order. Returning false stops the search.
+typedef bool (*StrSearchFn)(void *ctx, const StrSearchMatch *match);
+
+// Totals of a search
+typedef struct {
+    uint64_t matches; // number of matches reported
+    uint64_t bytes;   // number of bytes scanned
+    uint64_t lines;   // number of lines scanned (counted like strlines_count())
+    int      error;   // 0 on success, errno value of the failed read otherwise
+} StrSearchResult;
+
+// Searches the stream read from the file descriptor for the needle, in chunks of
+// `chunk` bytes (0 for STR_SEARCH_CHUNK), and calls `fn` (if not NULL) for every match.
+// Overlapping matches are all reported. An empty needle matches nothing.
+// The next chunk is read in a background thread while the current one is scanned
+// (unless STR_SEARCH_SYNC or the stream is a regular file smaller than a chunk),
+// with memory bounded to 4 chunks whatever the stream size.
+// Matches spanning two chunks are found through an overlap of the needle length.
+// When the callback stops the search, the read in progress is completed first.
+StrSearchResult str_search_fd(int fd, String needle, size_t chunk, StrSearchFlags flags,
+                              StrSearchFn fn, void *ctx);
+
+// Same as str_search_fd(), but reads with fread() from the current position of the file
+StrSearchResult str_search_file(FILE *f, String needle, size_t chunk, StrSearchFlags flags,
+                                StrSearchFn fn, void *ctx);
+
+// Same as str_search_fd(), but searches a string held in memory (e.g. a mapped file)
+StrSearchResult str_search_str(String haystack, String needle, StrSearchFlags flags,
+                               StrSearchFn fn, void *ctx);
+
+#endif // _STRSEARCH_H
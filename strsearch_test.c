@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strsearch.h"
+
+#define MAX_MATCHES 4096
+
+// Matches collected by the callback
+typedef struct {
+    size_t   count;
+    size_t   limit; // stop after this many matches (0 for no limit)
+    uint64_t offset[MAX_MATCHES];
+    uint64_t line[MAX_MATCHES];
+    size_t   text_len[MAX_MATCHES];
+    char     text_first[MAX_MATCHES];
+} Collected;
+
+static bool collect(void *ctx, const StrSearchMatch *match) {
+    Collected *c = ctx;
+
+    if (c->count < MAX_MATCHES) {
+        c->offset[c->count]     = match->offset;
+        c->line[c->count]       = match->line;
+        c->text_len[c->count]   = match->text.len;
+        c->text_first[c->count] = match->text.len ? match->text.str[0] : 0;
+    }
+
+    return ++c->count != c->limit;
+}
+
+static Collected got, want;
+
+// Collects the matches by brute force, with whole lines
+static void naive_search(String text, String needle, StrSearchFlags flags) {
+    uint64_t line = 0;
+    size_t line_start = 0;
+    uint64_t reported = UINT64_MAX;
+
+    memset(&want, 0, sizeof want);
+
+    for (size_t i = 0; i + needle.len <= text.len; i++) {
+        if (i && text.str[i - 1] == '\n') {
+            line++;
+            line_start = i;
+        }
+        if (memcmp(text.str + i, needle.str, needle.len)) continue;
+        if ((flags & STR_SEARCH_LINES) && reported == line) continue;
+        reported = line;
+
+        const char *nl = memchr(text.str + line_start, '\n', text.len - line_start);
+        size_t line_end = nl ? (size_t)(nl - text.str) : text.len;
+
+        want.offset[want.count]     = i;
+        want.line[want.count]       = line;
+        want.text_len[want.count]   = line_end - line_start;
+        want.text_first[want.count] = line_end > line_start ? text.str[line_start] : 0;
+        want.count++;
+    }
+}
+
+// Compares the collected matches to the expected ones. Only the lines shorter
+// than `chunk` are compared in full, longer ones may be cut.
+// Returns the number of mismatches.
+static size_t compare(size_t chunk) {
+    size_t mismatches = got.count != want.count;
+
+    for (size_t i = 0; i < got.count && i < want.count; i++) {
+        mismatches += got.offset[i] != want.offset[i];
+        mismatches += got.line[i] != want.line[i];
+
+        if (want.text_len[i] < chunk) {
+            mismatches += got.text_len[i] != want.text_len[i];
+            mismatches += got.text_first[i] != want.text_first[i];
+        }
+    }
+
+    return mismatches;
+}
+
+// Writes the text to a temporary file and searches it in every way.
+// Returns the number of mismatches.
+static size_t check_text(String text, String needle, size_t chunk) {
+    size_t mismatches = 0;
+    // Lines around needles with line breaks may be cut whatever their length
+    size_t whole = memchr(needle.str, '\n', needle.len) ? 0 : chunk ? chunk : SIZE_MAX;
+    FILE *f = tmpfile();
+    fwrite(text.str, 1, text.len, f);
+
+    for (int lines = 0; lines < 2; lines++) {
+        StrSearchFlags mode = lines ? STR_SEARCH_LINES : 0;
+        naive_search(text, needle, mode);
+
+        for (int sync = 0; sync < 2; sync++) {
+            StrSearchFlags flags = mode | (sync ? STR_SEARCH_SYNC : 0);
+
+            memset(&got, 0, sizeof got);
+            rewind(f);
+            StrSearchResult res = str_search_file(f, needle, chunk, flags, collect, &got);
+            mismatches += compare(whole) + res.error + (res.bytes != text.len);
+
+            memset(&got, 0, sizeof got);
+            lseek(fileno(f), 0, SEEK_SET);
+            res = str_search_fd(fileno(f), needle, chunk, flags, collect, &got);
+            mismatches += compare(whole) + res.error + (res.bytes != text.len);
+        }
+
+        memset(&got, 0, sizeof got);
+        str_search_str(text, needle, mode, collect, &got);
+        mismatches += compare(SIZE_MAX);
+    }
+
+    fclose(f);
+    return mismatches;
+}
+
+// Searches random texts of a few letters and line breaks with every chunk size.
+// Returns the number of mismatches.
+static size_t check_random(size_t len, const char *alphabet) {
+    static const size_t CHUNKS[] = { 4, 7, 64, 1000, 0 };
+    size_t mismatches = 0;
+    size_t n = strlen(alphabet);
+
+    String text = str_alloc("");
+    str_reserve(len, &text);
+    for (size_t i = 0; i < len; i++) text.str[i] = alphabet[rand() % n];
+    text.len = len;
+
+    for (size_t t = 0; t < 8; t++) {
+        char buf[4];
+        size_t nlen = 1 + rand() % 4;
+        for (size_t k = 0; k < nlen; k++) buf[k] = alphabet[rand() % n];
+
+        for (size_t c = 0; c < sizeof CHUNKS / sizeof *CHUNKS; c++)
+            mismatches += check_text(text, str_nref(buf, nlen), CHUNKS[c]);
+    }
+
+    str_free(&text);
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    test("str_search_str", {
+        String text = str_ref("one needle\ntwo\nneedle needle three\n");
+
+        memset(&got, 0, sizeof got);
+        StrSearchResult res = str_search_str(text, str_ref("needle"), 0, collect, &got);
+        assert_eq((uint64_t)3, res.matches, "%lu");
+        assert_eq((uint64_t)3, res.lines, "%lu");
+        assert_eq((uint64_t)text.len, res.bytes, "%lu");
+        assert_eq((uint64_t)4, got.offset[0], "%lu");
+        assert_eq((uint64_t)2, got.line[2], "%lu");
+        assert_eq((size_t)19, got.text_len[2], "%zu");
+
+        res = str_search_str(text, str_ref("needle"), STR_SEARCH_LINES, NULL, NULL);
+        assert_eq((uint64_t)2, res.matches, "%lu");
+
+        // Overlapping matches
+        res = str_search_str(str_ref("aaaa"), str_ref("aa"), 0, NULL, NULL);
+        assert_eq((uint64_t)3, res.matches, "%lu");
+        assert_eq((uint64_t)1, res.lines, "%lu");
+
+        res = str_search_str(text, str_ref(""), 0, NULL, NULL);
+        assert_eq((uint64_t)0, res.matches, "%lu");
+    });
+
+    test("str_search_fd", {
+        int fds[2];
+        assert(!pipe(fds));
+
+        const char *text = "first line\nsecond needle\nneedle\n";
+        assert_eq((ssize_t)strlen(text), write(fds[1], text, strlen(text)), "%zd");
+        close(fds[1]);
+
+        memset(&got, 0, sizeof got);
+        StrSearchResult res = str_search_fd(fds[0], str_ref("needle"), 8, 0, collect, &got);
+        close(fds[0]);
+
+        assert_eq(0, res.error, "%d");
+        assert_eq((uint64_t)2, res.matches, "%lu");
+        assert_eq((uint64_t)3, res.lines, "%lu");
+        assert_eq((uint64_t)18, got.offset[0], "%lu");
+        assert_eq((uint64_t)1, got.line[0], "%lu");
+        assert_eq((size_t)13, got.text_len[0], "%zu");
+        assert_eq((uint64_t)25, got.offset[1], "%lu");
+
+        res = str_search_fd(-1, str_ref("needle"), 0, 0, NULL, NULL);
+        assert(res.error != 0);
+    });
+
+    test("str_search_file (stop)", {
+        FILE *f = tmpfile();
+        for (size_t i = 0; i < 10000; i++) fputs("match\n", f);
+        rewind(f);
+
+        memset(&got, 0, sizeof got);
+        got.limit = 5;
+        StrSearchResult res = str_search_file(f, str_ref("match"), 4096, 0, collect, &got);
+        assert_eq((uint64_t)5, res.matches, "%lu");
+        assert(res.bytes < 10000 * 6);
+
+        fclose(f);
+    });
+
+    test("str_search (chunks)", {
+        assert_eq((size_t)0, check_random(3000, "ab\n"), "%zu");
+        assert_eq((size_t)0, check_random(3000, "aaab"), "%zu");
+        assert_eq((size_t)0, check_random(20000, "abcdefgh\n"), "%zu");
+    });
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include "strtemplate.h"
+
+#include <string.h>
+
+/* * * * * * * Compilation * * * * * * */
+
+// Template being compiled, with the capacities of its arrays
+typedef struct {
+    StrTemplate t;
+    size_t      seg_cap;
+    size_t      name_cap;
+    size_t     *name_offs; // offsets of the names in the text (the text moves as it grows)
+} Builder;
+
+static void push_segment(Builder *b, size_t slot, size_t offset, size_t len) {
+    if (b->t.count == b->seg_cap) {
+        size_t cap = b->seg_cap ? b->seg_cap * 2 : 8;
+        b->t.segments = str_mem_realloc_with(b->t.alloc, b->t.segments,
+                                             b->seg_cap * sizeof *b->t.segments,
+                                             cap * sizeof *b->t.segments);
+        b->seg_cap = cap;
+    }
+
+    b->t.segments[b->t.count++] = (StrTemplateSegment){ slot, offset, len };
+}
+
+// Appends literal bytes, extending the previous segment if it ends at the same place
+static void push_literal(Builder *b, const char *str, size_t len) {
+    StrTemplateSegment *last = b->t.count ? &b->t.segments[b->t.count - 1] : NULL;
+
+    if (last && last->slot == STR_TEMPLATE_LITERAL && last->offset + last->len == b->t.text.len)
+        last->len += len;
+    else
+        push_segment(b, STR_TEMPLATE_LITERAL, b->t.text.len, len);
+
+    str_pushs(str_nref(str, len), &b->t.text);
+    b->t.literal_len += len;
+}
+
+// Returns the slot of the name, adding it if it is new
+static size_t find_slot(Builder *b, const char *name, size_t len) {
+    for (size_t k = 0; k < b->t.nslots; k++)
+        if (b->t.names[k].len == len && !memcmp(b->t.text.str + b->name_offs[k], name, len))
+            return k;
+
+    if (b->t.nslots == b->name_cap) {
+        size_t cap = b->name_cap ? b->name_cap * 2 : 4;
+        b->t.names   = str_mem_realloc_with(b->t.alloc, b->t.names,
+                                            b->name_cap * sizeof *b->t.names,
+                                            cap * sizeof *b->t.names);
+        b->name_offs = str_mem_realloc_with(b->t.alloc, b->name_offs,
+                                            b->name_cap * sizeof *b->name_offs,
+                                            cap * sizeof *b->name_offs);
+        b->name_cap  = cap;
+    }
+
+    // The pointers are set once the text stops moving
+    b->name_offs[b->t.nslots] = b->t.text.len;
+    b->t.names[b->t.nslots] = (String){ .flags = STR_VALID, .len = len };
+    str_pushs(str_nref(name, len), &b->t.text);
+    return b->t.nslots++;
+}
+
+// Resizes an array to its final size (freeing it if empty)
+static void *shrink(unsigned slot, void *ptr, size_t old_size, size_t size) {
+    if (size) return str_mem_realloc_with(slot, ptr, old_size, size);
+    str_mem_free_with(slot, ptr, old_size);
+    return NULL;
+}
+
+// Offset of the first brace in str[i..len), or `len`
+static size_t next_brace(String str, size_t i) {
+    while (i < str.len && str.str[i] != '{' && str.str[i] != '}') i++;
+    return i;
+}
+
+bool str_template_compile(String src, StrTemplate *out, size_t *invalid) {
+    Builder b = { .t.text = str_alloc(""), .t.alloc = str_allocator_slot(NULL) };
+    size_t i = 0;
+
+    while (i < src.len) {
+        size_t brace = next_brace(src, i);
+        if (brace > i) {
+            push_literal(&b, src.str + i, brace - i);
+            i = brace;
+            continue;
+        }
+
+        // Escaped brace
+        char c = src.str[i];
+        if (i + 1 < src.len && src.str[i + 1] == c) {
+            push_literal(&b, &c, 1);
+            i += 2;
+            continue;
+        }
+
+        // Slot: the name ends at the next brace, which must be a closing one
+        size_t close = next_brace(src, i + 1);
+        if (c == '}' || close == src.len || src.str[close] != '}' || close == i + 1) {
+            if (invalid) *invalid = i;
+            str_mem_free_with(b.t.alloc, b.t.segments, b.seg_cap * sizeof *b.t.segments);
+            str_mem_free_with(b.t.alloc, b.t.names, b.name_cap * sizeof *b.t.names);
+            str_mem_free_with(b.t.alloc, b.name_offs, b.name_cap * sizeof *b.name_offs);
+            str_free(&b.t.text);
+            return false;
+        }
+
+        size_t slot = find_slot(&b, src.str + i + 1, close - i - 1);
+        push_segment(&b, slot, 0, 0);
+        i = close + 1;
+    }
+
+    // Shrink the arrays to their exact sizes, which str_template_free() relies on
+    b.t.segments = shrink(b.t.alloc, b.t.segments, b.seg_cap * sizeof *b.t.segments,
+                          b.t.count * sizeof *b.t.segments);
+    b.t.names = shrink(b.t.alloc, b.t.names, b.name_cap * sizeof *b.t.names,
+                       b.t.nslots * sizeof *b.t.names);
+
+    for (size_t k = 0; k < b.t.nslots; k++)
+        b.t.names[k].str = b.t.text.str + b.name_offs[k];
+    str_mem_free_with(b.t.alloc, b.name_offs, b.name_cap * sizeof *b.name_offs);
+
+    *out = b.t;
+    return true;
+}
+
+void str_template_free(StrTemplate *t) {
+    str_mem_free_with(t->alloc, t->segments, t->count * sizeof *t->segments);
+    str_mem_free_with(t->alloc, t->names, t->nslots * sizeof *t->names);
+    str_free(&t->text);
+    memset(t, 0, sizeof *t);
+}
+
+int str_template_slot(const StrTemplate *t, String name) {
+    for (size_t k = 0; k < t->nslots; k++)
+        if (t->names[k].len == name.len && !memcmp(t->names[k].str, name.str, name.len))
+            return (int)k;
+
+    return -1;
+}
+
+/* * * * * * * Rendering * * * * * * */
+
+size_t str_template_len(const StrTemplate *t, const String *values) {
+    size_t len = t->literal_len;
+
+    for (size_t k = 0; k < t->count; k++)
+        if (t->segments[k].slot != STR_TEMPLATE_LITERAL)
+            len += values[t->segments[k].slot].len;
+
+    return len;
+}
+
+size_t str_template_render_to(char *out, const StrTemplate *t, const String *values) {
+    char *o = out;
+
+    for (size_t k = 0; k < t->count; k++) {
+        const StrTemplateSegment *s = &t->segments[k];
+        const char *src = t->text.str + s->offset;
+        size_t n = s->len;
+
+        if (s->slot != STR_TEMPLATE_LITERAL) {
+            src = values[s->slot].str;
+            n   = values[s->slot].len;
+        }
+
+        // Empty values may have no buffer
+        if (n) memcpy(o, src, n);
+        o += n;
+    }
+
+    return o - out;
+}
+
+String str_template_render(const StrTemplate *t, const String *values) {
+    return str_template_render_with(NULL, t, values);
+}
+
+String str_template_render_with(const StrAllocator *alloc, const StrTemplate *t,
+                                const String *values) {
+    String out = str_nalloc_with(alloc, NULL, str_template_len(t, values));
+    str_template_render_to(out.str, t, values);
+    return out;
+}
+
+void str_template_push(const StrTemplate *t, const String *values, String *str) {
+    size_t len = str_template_len(t, values);
+    str_reserve(str->len + len, str);
+    str->len += str_template_render_to(str->str + str->len, t, values);
+}
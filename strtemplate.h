@@ -0,0 +1,73 @@
+#ifndef _STRTEMPLATE_H
+#define _STRTEMPLATE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Slot of the literal segments
+#define STR_TEMPLATE_LITERAL ((size_t)-1)
+
+// Piece of a compiled template
+typedef struct {
+    size_t slot;   // index of the value to insert, or STR_TEMPLATE_LITERAL
+    size_t offset; // start of the literal bytes in the text of the template
+    size_t len;    // length of the literal bytes
+} StrTemplateSegment;
+
+// Compiled template
+//
+// Supported syntax:
+//   {name}   a slot, replaced by the value of the slot when rendering
+//   {{ }}    a literal brace
+// Names are any bytes but braces. Slots are numbered in the order their names first
+// appear, and a name used several times is the same slot.
+typedef struct {
+    StrTemplateSegment *segments; // literals and slots in order (adjacent literals are merged)
+    size_t              count;    // number of segments
+    String             *names;    // names of the slots (references to `text`)
+    size_t              nslots;   // number of slots
+    size_t              literal_len; // total length of the literals
+    String              text;     // literals and names with the escapes removed (heap-allocated)
+    unsigned            alloc;    // allocator slot of `segments` and `names`
+} StrTemplate;
+
+// Parses the placeholders of the template once into segments.
+// Returns false (leaving `out` untouched) if a brace is unbalanced or a name is empty,
+// writing the offset of the faulty brace to `invalid`, which may be NULL.
+// Requires str_template_free() (if successful)
+bool str_template_compile(String src, StrTemplate *out, size_t *invalid);
+
+// Frees the memory allocated for the compiled template
+void str_template_free(StrTemplate *tpl);
+
+// Returns the slot of the given name, or -1 if the template has no such slot
+int str_template_slot(const StrTemplate *tpl, String name);
+
+// The rendering functions below take one value per slot (`tpl->nslots` values)
+
+// Length of the template rendered with the values
+size_t str_template_len(const StrTemplate *tpl, const String *values);
+
+// Renders the template with the values into the given buffer (str_template_len()
+// bytes) without a nul-terminator and returns the number of bytes written
+size_t str_template_render_to(char *out, const StrTemplate *tpl, const String *values);
+
+// Renders the template with the values into a new string, in a single allocation
+// Requires str_free()
+String str_template_render(const StrTemplate *tpl, const String *values);
+
+// Same as str_template_render(), but allocates with the given allocator (NULL for
+// the global one), e.g. an arena. The allocator stays registered (and has to stay
+// valid) until str_allocator_release(), which has to be called before it is destroyed,
+// e.g. when a per-request arena is reset. At most STR_MAX_ALLOCATORS can be registered
+// at once.
+String str_template_render_with(const StrAllocator *alloc, const StrTemplate *tpl,
+                                const String *values);
+
+// Appends the template rendered with the values to the given heap-allocated string,
+// growing its buffer at most once
+void str_template_push(const StrTemplate *tpl, const String *values, String *str);
+
+#endif // _STRTEMPLATE_H
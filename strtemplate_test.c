@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strtemplate.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+// Bump allocator over a fixed buffer, counting its allocations
+typedef struct {
+    char   buf[1024];
+    size_t used;
+    int    allocs;
+} Arena;
+
+static void *arena_alloc(void *ctx, size_t size) {
+    Arena *a = ctx;
+    if (a->used + size > sizeof a->buf) return NULL;
+    a->allocs++;
+    a->used += size;
+    return a->buf + a->used - size;
+}
+
+static void *arena_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    void *p = arena_alloc(ctx, new_size);
+    if (p && ptr) memcpy(p, ptr, old_size < new_size ? old_size : new_size);
+    return p;
+}
+
+static void arena_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx; (void)ptr; (void)size;
+}
+
+// Registered allocators must outlive everything allocated with them
+static Arena ARENA;
+
+static const StrAllocator ARENA_ALLOCATOR = {
+    .alloc   = arena_alloc,
+    .realloc = arena_realloc,
+    .free    = arena_free,
+    .ctx     = &ARENA,
+};
+
+// Values of the slots, looked up by name
+static const char *VALUES[][2] = {
+    { "user", "alice" }, { "id", "42" }, { "empty", "" }, { "x", "{}" },
+};
+
+// Renders the template by rescanning it, the way chained replacements would
+static String reference(String src) {
+    String out = str_alloc("");
+
+    for (size_t i = 0; i < src.len; i++) {
+        char c = src.str[i];
+
+        if ((c == '{' || c == '}') && i + 1 < src.len && src.str[i + 1] == c) {
+            str_push(c, &out);
+            i++;
+        } else if (c == '{') {
+            size_t close = i + 1;
+            while (src.str[close] != '}') close++;
+            String name = str_nref(src.str + i + 1, close - i - 1);
+
+            for (size_t k = 0; k < sizeof VALUES / sizeof *VALUES; k++)
+                if (str_eq(name, str_ref(VALUES[k][0]))) str_pushs(str_ref(VALUES[k][1]), &out);
+            i = close;
+        } else {
+            str_push(c, &out);
+        }
+    }
+
+    return out;
+}
+
+// Pieces of the random templates
+static const char *PIECES[] = {
+    "a", "bc", " = ", "{{", "}}", "{user}", "{id}", "{empty}", "{x}",
+};
+
+// Compiles and renders random templates and compares them to the reference.
+// Returns the number of mismatches.
+static size_t check_random(size_t count) {
+    size_t mismatches = 0;
+
+    for (size_t t = 0; t < count; t++) {
+        String src = str_alloc("");
+        for (size_t n = rand() % 20; n--;)
+            str_pushs(str_ref(PIECES[rand() % (sizeof PIECES / sizeof *PIECES)]), &src);
+
+        StrTemplate tpl;
+        if (!str_template_compile(src, &tpl, NULL)) {
+            mismatches++;
+            str_free(&src);
+            continue;
+        }
+
+        String values[sizeof VALUES / sizeof *VALUES];
+        for (size_t k = 0; k < tpl.nslots; k++)
+            for (size_t v = 0; v < sizeof VALUES / sizeof *VALUES; v++)
+                if (str_eq(tpl.names[k], str_ref(VALUES[v][0]))) values[k] = str_ref(VALUES[v][1]);
+
+        String want = reference(src);
+        String got = str_template_render(&tpl, values);
+        mismatches += !str_eq(want, got) || got.len != str_template_len(&tpl, values);
+
+        str_free(&got);
+        str_free(&want);
+        str_template_free(&tpl);
+        str_free(&src);
+    }
+
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    test("str_template_compile", {
+        StrTemplate tpl;
+        assert(str_template_compile(str_ref("user={user} id={id} again={user}"), &tpl, NULL));
+
+        assert_eq((size_t)2, tpl.nslots, "%zu");
+        assert_string_eq(str_ref("user"), tpl.names[0]);
+        assert_string_eq(str_ref("id"), tpl.names[1]);
+        assert_eq(1, str_template_slot(&tpl, str_ref("id")), "%d");
+        assert_eq(-1, str_template_slot(&tpl, str_ref("name")), "%d");
+
+        assert_eq((size_t)6, tpl.count, "%zu");
+        assert_eq(STR_TEMPLATE_LITERAL, tpl.segments[0].slot, "%zu");
+        assert_eq((size_t)0, tpl.segments[5].slot, "%zu");
+        assert_eq((size_t)16, tpl.literal_len, "%zu");
+        str_template_free(&tpl);
+
+        // Escaped braces are merged into the surrounding literal
+        assert(str_template_compile(str_ref("{{a}} {b}}}"), &tpl, NULL));
+        assert_eq((size_t)3, tpl.count, "%zu");
+        assert_eq((size_t)4, tpl.segments[0].len, "%zu");
+        str_template_free(&tpl);
+
+        assert(str_template_compile(str_ref(""), &tpl, NULL));
+        assert_eq((size_t)0, tpl.count, "%zu");
+        str_template_free(&tpl);
+    });
+
+    test("str_template_compile (errors)", {
+        StrTemplate tpl;
+        size_t invalid = 0;
+
+        assert(!str_template_compile(str_ref("a={a"), &tpl, &invalid));
+        assert_eq((size_t)2, invalid, "%zu");
+        assert(!str_template_compile(str_ref("{a} }"), &tpl, &invalid));
+        assert_eq((size_t)4, invalid, "%zu");
+        assert(!str_template_compile(str_ref("x{}"), &tpl, &invalid));
+        assert_eq((size_t)1, invalid, "%zu");
+        assert(!str_template_compile(str_ref("{a{b}}"), &tpl, &invalid));
+        assert_eq((size_t)0, invalid, "%zu");
+    });
+
+    test("str_template_render", {
+        StrTemplate tpl;
+        assert(str_template_compile(str_ref("user={user} id={id} {{{user}}}"), &tpl, NULL));
+
+        String values[2];
+        values[0] = str_ref("bob");
+        values[1] = str_ref("");
+        assert_eq((size_t)18, str_template_len(&tpl, values), "%zu");
+
+        String out = str_template_render(&tpl, values);
+        assert_string_eq(str_ref("user=bob id= {bob}"), out);
+        str_free(&out);
+
+        // Caller buffer
+        char buf[64];
+        size_t n = str_template_render_to(buf, &tpl, values);
+        assert_string_eq(str_ref("user=bob id= {bob}"), str_nref(buf, n));
+
+        // Appended to a string
+        out = str_alloc("> ");
+        str_template_push(&tpl, values, &out);
+        str_template_push(&tpl, values, &out);
+        assert_string_eq(str_ref("> user=bob id= {bob}user=bob id= {bob}"), out);
+        str_free(&out);
+
+        str_template_free(&tpl);
+    });
+
+    test("str_template_render_with", {
+        StrTemplate tpl;
+        assert(str_template_compile(str_ref("{greeting}, {name}!"), &tpl, NULL));
+
+        String values[2];
+        values[0] = str_ref("hello");
+        values[1] = str_ref("world");
+
+        // A single allocation from the arena
+        String out = str_template_render_with(&ARENA_ALLOCATOR, &tpl, values);
+
+        assert_string_eq(str_ref("hello, world!"), out);
+        assert_eq(1, ARENA.allocs, "%d");
+        assert(out.str >= ARENA.buf && out.str < ARENA.buf + sizeof ARENA.buf);
+
+        // The arena is reset as a whole, its slot is released for the next one
+        str_allocator_release(&ARENA_ALLOCATOR);
+        ARENA = (Arena){0};
+
+        str_template_free(&tpl);
+    });
+
+    test("str_template_render (random)", {
+        assert_eq((size_t)0, check_random(500), "%zu");
+    });
+
+    return 0;
+}
@@ -0,0 +1,245 @@
+#include "strtrace.h"
+
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TRACE_TSC
+#include <x86intrin.h>
+#endif
+
+/* * * * * * * Private Utilities * * * * * * */
+
+static const char *const POINT_NAMES[STR_TRACE_COUNT] = {
+    [STR_TRACE_SEARCH]      = "str_search",
+    [STR_TRACE_SPLIT]       = "str_split",
+    [STR_TRACE_REPLACE]     = "str_replace",
+    [STR_TRACE_ESCAPE]      = "str_escape",
+    [STR_TRACE_FMT]         = "str_fmt",
+    [STR_TRACE_FREAD]       = "fread_str",
+    [STR_TRACE_UTF8_DECODE] = "utf8_decode_chunk",
+};
+
+// The `min` field holds the complement of the lowest latency, so that it can be kept
+// with the same atomic maximum as `max` and starts unset at zero
+static StrTraceStats STATS[STR_TRACE_COUNT];
+static bool enabled = true;
+
+// The counters are updated atomically, so they stay exact with concurrent calls
+#define STAT_ADD(field, n) __atomic_add_fetch(&(field), (n), __ATOMIC_RELAXED)
+#define STAT_GET(field)    __atomic_load_n(&(field), __ATOMIC_RELAXED)
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline uint64_t ticks(void) {
+#ifdef TRACE_TSC
+    return __rdtsc();
+#else
+    return now_ns();
+#endif
+}
+
+// Measures the duration of a tick against the monotonic clock (once, over 1 ms)
+static double tick_ns(void) {
+#ifdef TRACE_TSC
+    static double ns_per_tick = 0;
+
+    double cached;
+    __atomic_load(&ns_per_tick, &cached, __ATOMIC_RELAXED);
+    if (cached) return cached;
+
+    uint64_t t0 = ticks(), n0 = now_ns(), n1;
+    while ((n1 = now_ns()) - n0 < 1000000);
+    uint64_t t1 = ticks();
+
+    double ratio = t1 > t0 ? (double)(n1 - n0) / (t1 - t0) : 1;
+    __atomic_store(&ns_per_tick, &ratio, __ATOMIC_RELAXED);
+    return ratio;
+#else
+    return 1;
+#endif
+}
+
+/* * * * * * * Histograms * * * * * * */
+
+// Lowest latency of a bucket
+static uint64_t bucket_low(unsigned b) {
+    if (b < 32) return b;
+
+    unsigned e = 5 + (b - 32) / 16;
+    return (uint64_t)(16 + (b - 32) % 16) << (e - STR_TRACE_SUB_BITS);
+}
+
+// Number of latencies in a bucket
+static uint64_t bucket_width(unsigned b) {
+    return b < 32 ? 1 : (uint64_t)1 << (5 + (b - 32) / 16 - STR_TRACE_SUB_BITS);
+}
+
+/* * * * * * * Recording * * * * * * */
+
+#ifdef STR_TRACE
+
+// Entry points with a call in progress on this thread (one bit each)
+static _Thread_local unsigned active;
+
+static void stat_max(uint64_t *max, uint64_t value) {
+    uint64_t cur = __atomic_load_n(max, __ATOMIC_RELAXED);
+    while (value > cur && !__atomic_compare_exchange_n(max, &cur, value, true,
+                                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// Bucket of a latency: the value itself below 32, otherwise the power of two
+// and the next STR_TRACE_SUB_BITS bits below the leading one
+static unsigned bucket_of(uint64_t t) {
+    if (t < 32) return t;
+
+    unsigned e = 63 - __builtin_clzll(t);
+    unsigned shift = e - STR_TRACE_SUB_BITS;
+    return 32 + (e - 5) * 16 + ((t >> shift) - 16);
+}
+
+StrTraceSpan str_trace_begin(StrTracePoint point, size_t bytes) {
+    if (!__atomic_load_n(&enabled, __ATOMIC_RELAXED) || (active & 1u << point))
+        return (StrTraceSpan){ .point = STR_TRACE_COUNT };
+
+    active |= 1u << point;
+    return (StrTraceSpan){ .point = point, .bytes = bytes, .start = ticks() };
+}
+
+void str_trace_end(StrTraceSpan *span) {
+    if (span->point == STR_TRACE_COUNT) return;
+
+    uint64_t t = ticks() - span->start;
+    StrTraceStats *s = &STATS[span->point];
+    active &= ~(1u << span->point);
+
+    STAT_ADD(s->calls, 1);
+    STAT_ADD(s->bytes, span->bytes);
+    STAT_ADD(s->ticks, t);
+    STAT_ADD(s->buckets[bucket_of(t)], 1);
+    stat_max(&s->min, ~t);
+    stat_max(&s->max, t);
+}
+
+#endif
+
+bool str_trace_compiled(void) {
+#ifdef STR_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+void str_trace_enable(bool enable) {
+    __atomic_store_n(&enabled, enable, __ATOMIC_RELAXED);
+}
+
+void str_trace_reset(void) {
+    memset(STATS, 0, sizeof STATS);
+}
+
+/* * * * * * * Snapshots * * * * * * */
+
+void str_trace_snapshot(StrTraceSnapshot *snap) {
+    for (StrTracePoint p = 0; p < STR_TRACE_COUNT; p++) {
+        StrTraceStats *s = &STATS[p];
+        StrTraceStats *out = &snap->points[p];
+
+        out->calls = STAT_GET(s->calls);
+        out->bytes = STAT_GET(s->bytes);
+        out->ticks = STAT_GET(s->ticks);
+        out->min   = out->calls ? ~STAT_GET(s->min) : 0;
+        out->max   = STAT_GET(s->max);
+
+        for (unsigned b = 0; b < STR_TRACE_BUCKETS; b++)
+            out->buckets[b] = STAT_GET(s->buckets[b]);
+    }
+
+    snap->ns_per_tick = tick_ns();
+}
+
+const char *str_trace_point_name(StrTracePoint point) {
+    return point < STR_TRACE_COUNT ? POINT_NAMES[point] : "unknown";
+}
+
+double str_trace_percentile(const StrTraceSnapshot *snap, StrTracePoint point, double q) {
+    const StrTraceStats *s = &snap->points[point];
+    if (!s->calls) return 0;
+
+    // Rank of the call, from 1 to the number of calls
+    uint64_t rank = (uint64_t)(q * s->calls + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > s->calls) rank = s->calls;
+
+    uint64_t seen = 0;
+    unsigned b = 0;
+    for (; b < STR_TRACE_BUCKETS - 1; b++)
+        if ((seen += s->buckets[b]) >= rank) break;
+
+    // Middle of the bucket, within the latencies actually seen
+    uint64_t t = bucket_low(b) + bucket_width(b) / 2;
+    if (t < s->min) t = s->min;
+    if (t > s->max) t = s->max;
+    return t * snap->ns_per_tick;
+}
+
+// Throughput of the calls in MB/s
+static double throughput(const StrTraceSnapshot *snap, const StrTraceStats *s) {
+    double ns = s->ticks * snap->ns_per_tick;
+    return ns > 0 ? s->bytes * 1e3 / ns : 0;
+}
+
+void str_trace_fdump(FILE *f, const StrTraceSnapshot *snap) {
+    fprintf(f, "%-18s %10s %12s %10s %10s %10s %10s %10s %10s\n",
+            "function", "calls", "bytes", "MB/s", "mean ns", "p50 ns", "p90 ns", "p99 ns", "max ns");
+
+    for (StrTracePoint p = 0; p < STR_TRACE_COUNT; p++) {
+        const StrTraceStats *s = &snap->points[p];
+        if (!s->calls) continue;
+
+        fprintf(f, "%-18s %10"PRIu64" %12"PRIu64" %10.1f %10.0f %10.0f %10.0f %10.0f %10.0f\n",
+                POINT_NAMES[p], s->calls, s->bytes, throughput(snap, s),
+                s->ticks * snap->ns_per_tick / s->calls,
+                str_trace_percentile(snap, p, 0.5),
+                str_trace_percentile(snap, p, 0.9),
+                str_trace_percentile(snap, p, 0.99),
+                s->max * snap->ns_per_tick);
+    }
+}
+
+void str_trace_fdump_json(FILE *f, const StrTraceSnapshot *snap) {
+    fprintf(f, "{");
+
+    for (StrTracePoint p = 0; p < STR_TRACE_COUNT; p++) {
+        const StrTraceStats *s = &snap->points[p];
+
+        fprintf(f, "%s\n  \"%s\": {\"calls\": %"PRIu64", \"bytes\": %"PRIu64", \"mb_per_s\": %.1f, "
+                   "\"mean_ns\": %.1f, \"min_ns\": %.1f, \"p50_ns\": %.1f, \"p90_ns\": %.1f, "
+                   "\"p99_ns\": %.1f, \"max_ns\": %.1f, \"buckets\": [",
+                p ? "," : "", POINT_NAMES[p], s->calls, s->bytes, throughput(snap, s),
+                s->calls ? s->ticks * snap->ns_per_tick / s->calls : 0,
+                s->min * snap->ns_per_tick,
+                str_trace_percentile(snap, p, 0.5),
+                str_trace_percentile(snap, p, 0.9),
+                str_trace_percentile(snap, p, 0.99),
+                s->max * snap->ns_per_tick);
+
+        bool first = true;
+        for (unsigned b = 0; b < STR_TRACE_BUCKETS; b++) {
+            if (!s->buckets[b]) continue;
+            fprintf(f, "%s[%.1f, %"PRIu64"]", first ? "" : ", ",
+                    bucket_low(b) * snap->ns_per_tick, s->buckets[b]);
+            first = false;
+        }
+
+        fprintf(f, "]}");
+    }
+
+    fprintf(f, "\n}\n");
+}
@@ -0,0 +1,115 @@
+#ifndef _STRTRACE_H
+#define _STRTRACE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Optional instrumentation of the hot entry points of the library.
+//
+// Compiling the library with -DSTR_TRACE makes every traced call count itself, the
+// bytes it processed and its latency, read from the time stamp counter (rdtsc) where
+// available. Without the flag, the hooks expand to nothing: the library is the same
+// as if this file did not exist, and the functions below report no calls.
+//
+// Nested calls of the same entry point are only counted once, by the outermost call
+// (e.g. str_fmt() formatting through str_vpushf()). The view functions (strview_lpos()
+// etc.) are not traced: the searches of str_split() and str_replace() count towards
+// those entry points only.
+
+// Traced entry points
+typedef enum {
+    STR_TRACE_SEARCH,      // str_search_str(), str_search_fd(), str_search_file(),
+                           // str_lpos(), str_rpos(), str_count(), str_counts()
+    STR_TRACE_SPLIT,       // str_split() (every call, the bytes are the pieces)
+    STR_TRACE_REPLACE,     // str_replace()
+    STR_TRACE_ESCAPE,      // str_escape()
+    STR_TRACE_FMT,         // str_fmt(), str_pushf(), str_vpushf()
+    STR_TRACE_FREAD,       // fread_str(), fread_str_with()
+    STR_TRACE_UTF8_DECODE, // utf8_decode_chunk()
+    STR_TRACE_COUNT,
+} StrTracePoint;
+
+// Latency histograms are HDR-style: exact below 32 ticks, then 16 buckets per power
+// of two, so any latency is known to within 1/16 of its value
+#define STR_TRACE_SUB_BITS 4
+#define STR_TRACE_BUCKETS  (32 + (64 - 5) * 16)
+
+// Counters of an entry point
+typedef struct {
+    uint64_t calls;   // number of calls
+    uint64_t bytes;   // bytes processed (input bytes, or bytes produced for fread_str())
+    uint64_t ticks;   // total latency
+    uint64_t min;     // lowest latency (in ticks, 0 without calls)
+    uint64_t max;     // highest latency (in ticks)
+    uint64_t buckets[STR_TRACE_BUCKETS]; // number of calls per latency bucket
+} StrTraceStats;
+
+// Copy of all the counters (about 55 KiB, better kept off the stack)
+typedef struct {
+    StrTraceStats points[STR_TRACE_COUNT];
+    double        ns_per_tick; // duration of a tick in nanoseconds
+} StrTraceSnapshot;
+
+// Tells whether the library was compiled with STR_TRACE
+bool str_trace_compiled(void);
+
+// Enables or disables the recording of calls (enabled by default when compiled in)
+void str_trace_enable(bool enable);
+
+// Resets all counters to zero
+// (not atomic as a whole, call it while no other thread calls traced functions)
+void str_trace_reset(void);
+
+// Copies the counters. Each counter is read atomically, but calls recorded during the
+// copy may only be partly visible.
+void str_trace_snapshot(StrTraceSnapshot *snap);
+
+// Returns the name of the given entry point
+const char *str_trace_point_name(StrTracePoint point);
+
+// Returns the latency (in nanoseconds) below which the fraction `q` (0 to 1) of the
+// calls of the entry point fall, within the precision of the buckets
+double str_trace_percentile(const StrTraceSnapshot *snap, StrTracePoint point, double q);
+
+// Prints a table of the entry points with at least one call: calls, bytes, throughput,
+// and the mean, median, 90th, 99th percentile and maximum latencies
+void str_trace_fdump(FILE *f, const StrTraceSnapshot *snap);
+
+// Prints the same figures as a JSON object keyed by entry point name, with the
+// non-empty buckets as [lower bound in ns, count] pairs
+void str_trace_fdump_json(FILE *f, const StrTraceSnapshot *snap);
+
+/* * * * * * * Hooks * * * * * * */
+
+// Used by the traced functions of the library
+
+#ifdef STR_TRACE
+
+// Call being traced
+typedef struct {
+    StrTracePoint point; // STR_TRACE_COUNT if the call is not recorded
+    size_t        bytes;
+    uint64_t      start;
+} StrTraceSpan;
+
+StrTraceSpan str_trace_begin(StrTracePoint point, size_t bytes);
+void str_trace_end(StrTraceSpan *span);
+
+// Traces the enclosing block as a call of the entry point processing `bytes` bytes
+#define STR_TRACE_SPAN(point, bytes) \
+    __attribute__((cleanup(str_trace_end))) \
+    StrTraceSpan _str_trace_span = str_trace_begin(point, bytes)
+
+// Sets the bytes processed by the traced call, when only known at its end
+#define STR_TRACE_BYTES(n) (_str_trace_span.bytes = (n))
+
+#else
+
+#define STR_TRACE_SPAN(point, bytes)
+#define STR_TRACE_BYTES(n) ((void)0)
+
+#endif
+
+#endif // _STRTRACE_H
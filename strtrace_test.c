@@ -0,0 +1,143 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strsearch.h"
+#include "strtrace.h"
+#include "utf8.h"
+
+// Built with -DSTR_TRACE (see the test script)
+
+static StrTraceSnapshot snap;
+
+// Sum of the histogram of an entry point
+static uint64_t bucket_total(StrTracePoint point) {
+    uint64_t total = 0;
+    for (unsigned b = 0; b < STR_TRACE_BUCKETS; b++) total += snap.points[point].buckets[b];
+    return total;
+}
+
+// Tells whether the dump contains the text
+static bool dump_has(const char *dump, const char *text) {
+    return strstr(dump, text) != NULL;
+}
+
+int main() {
+    test("str_trace_snapshot", {
+        assert(str_trace_compiled());
+        str_trace_reset();
+
+        String s = str_alloc("a,b,c");
+        String piece = {0};
+        while (str_split(s, str_ref(","), &piece));
+        str_replace(str_ref(","), str_ref(";"), &s, STR_REPLACE_ALL);
+
+        String esc = str_escape(str_ref("tab\t"));
+        str_free(&esc);
+
+        // Formatting through str_vpushf() is counted once
+        String f = str_fmt("%d-%d", 12, 34);
+        str_pushf(&f, "%s", "abc");
+        str_free(&f);
+
+        str_search_str(s, str_ref(";"), 0, NULL, NULL);
+
+        // The core search functions, but not the searches inside str_replace()
+        assert_eq(1, str_lpos(str_ref(";"), s, 0), "%d");
+        assert_eq(3, str_rpos(str_ref(";"), s, 0), "%d");
+        assert_eq(2, str_count(';', s), "%d");
+        assert_eq(2, str_counts(str_ref(";"), s, 0), "%d");
+
+        utf8_Decoder d;
+        uint32_t cps[16];
+        utf8_decoder_init(&d);
+        utf8_decode_chunk(&d, "h\xC3\xA9llo", 6, cps, 16);
+        str_free(&s);
+
+        str_trace_snapshot(&snap);
+
+        // The last call finds no piece
+        assert_eq((uint64_t)4, snap.points[STR_TRACE_SPLIT].calls, "%lu");
+        assert_eq((uint64_t)3, snap.points[STR_TRACE_SPLIT].bytes, "%lu");
+        assert_eq((uint64_t)1, snap.points[STR_TRACE_REPLACE].calls, "%lu");
+        assert_eq((uint64_t)5, snap.points[STR_TRACE_REPLACE].bytes, "%lu");
+        assert_eq((uint64_t)1, snap.points[STR_TRACE_ESCAPE].calls, "%lu");
+        assert_eq((uint64_t)2, snap.points[STR_TRACE_FMT].calls, "%lu");
+        assert_eq((uint64_t)8, snap.points[STR_TRACE_FMT].bytes, "%lu");
+        assert_eq((uint64_t)5, snap.points[STR_TRACE_SEARCH].calls, "%lu");
+        assert_eq((uint64_t)25, snap.points[STR_TRACE_SEARCH].bytes, "%lu");
+        assert_eq((uint64_t)6, snap.points[STR_TRACE_UTF8_DECODE].bytes, "%lu");
+        assert_eq((uint64_t)0, snap.points[STR_TRACE_FREAD].calls, "%lu");
+
+        for (StrTracePoint p = 0; p < STR_TRACE_COUNT; p++) {
+            assert_eq(snap.points[p].calls, bucket_total(p), "%lu");
+            assert(snap.points[p].min <= snap.points[p].max);
+        }
+        assert(snap.ns_per_tick > 0);
+    });
+
+    test("str_trace_percentile", {
+        str_trace_reset();
+
+        String s = str_alloc("");
+        for (int i = 0; i < 1000; i++) str_pushf(&s, "%d,", i);
+        String piece = {0};
+        while (str_split(s, str_ref(","), &piece));
+        str_free(&s);
+
+        str_trace_snapshot(&snap);
+        const StrTraceStats *st = &snap.points[STR_TRACE_SPLIT];
+        // 1000 pieces, the empty one after the last comma, and the call finding none
+        assert_eq((uint64_t)1002, st->calls, "%lu");
+
+        double p50 = str_trace_percentile(&snap, STR_TRACE_SPLIT, 0.5);
+        double p99 = str_trace_percentile(&snap, STR_TRACE_SPLIT, 0.99);
+        assert(p50 >= st->min * snap.ns_per_tick);
+        assert(p50 <= p99);
+        assert(p99 <= st->max * snap.ns_per_tick);
+        assert_eq(0.0, str_trace_percentile(&snap, STR_TRACE_FREAD, 0.5), "%f");
+    });
+
+    test("str_trace_enable", {
+        str_trace_reset();
+        str_trace_enable(false);
+        String e = str_escape(str_ref("x"));
+        str_free(&e);
+        str_trace_enable(true);
+
+        str_trace_snapshot(&snap);
+        assert_eq((uint64_t)0, snap.points[STR_TRACE_ESCAPE].calls, "%lu");
+    });
+
+    test("str_trace_fdump", {
+        str_trace_reset();
+        FILE *tmp = tmpfile();
+        fputs("contents", tmp);
+        rewind(tmp);
+        String s = fread_str(tmp);
+        fclose(tmp);
+        str_free(&s);
+        str_trace_snapshot(&snap);
+
+        char *text = NULL;
+        size_t len = 0;
+        FILE *out = open_memstream(&text, &len);
+        str_trace_fdump(out, &snap);
+        fclose(out);
+        assert(dump_has(text, "fread_str"));
+        assert(!dump_has(text, "str_split"));
+        free(text);
+
+        out = open_memstream(&text, &len);
+        str_trace_fdump_json(out, &snap);
+        fclose(out);
+        assert(dump_has(text, "\"fread_str\": {\"calls\": 1, \"bytes\": 8,"));
+        assert(dump_has(text, "\"str_split\": {\"calls\": 0,"));
+        assert_eq('}', text[len - 2], "%c");
+        free(text);
+    });
+
+    return 0;
+}
@@ -4,8 +4,11 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdarg.h>
-#include <ctype.h>
 #include <inttypes.h>
+#include <pthread.h>
+
+#include "strcodec.h"
+#include "strtrace.h"
 
 /* * * * * * * Private Utilities * * * * * * */
 
@@ -17,6 +20,411 @@
 // Minimum char buffer size
 #define STR_MIN_BUFSZ 0x80
 
+/* * * * * * * Allocators * * * * * * */
+
+static void *libc_alloc(void *ctx, size_t size) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void *libc_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)ctx; (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void libc_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx; (void)size;
+    free(ptr);
+}
+
+static const StrAllocator LIBC_ALLOCATOR = {
+    .alloc   = libc_alloc,
+    .realloc = libc_realloc,
+    .free    = libc_free,
+};
+
+// Registered allocators, indexed by String.alloc. Slot 0 is always the default
+// allocator, so zero-initialized strings use malloc/realloc/free.
+// Slots are filled atomically and cleared again by str_allocator_release().
+static const StrAllocator *ALLOCATORS[STR_MAX_ALLOCATORS] = { &LIBC_ALLOCATOR };
+
+// Slot of the global allocator
+static unsigned global_slot = 0;
+
+static inline const StrAllocator *slot_allocator(unsigned slot) {
+    return __atomic_load_n(&ALLOCATORS[slot], __ATOMIC_ACQUIRE);
+}
+
+static inline unsigned current_slot(void) {
+    return __atomic_load_n(&global_slot, __ATOMIC_ACQUIRE);
+}
+
+// Returns the slot of the given allocator (registering it if necessary)
+// or the slot of the global allocator if NULL
+static unsigned allocator_slot(const StrAllocator *alloc) {
+    if (!alloc) return current_slot();
+
+    for (unsigned i = 0; i < STR_MAX_ALLOCATORS; i++)
+        if (slot_allocator(i) == alloc) return i;
+
+    for (unsigned i = 1; i < STR_MAX_ALLOCATORS; i++) {
+        const StrAllocator *cur = NULL;
+
+        // Claim the free slot, unless another thread was faster
+        if (__atomic_compare_exchange_n(&ALLOCATORS[i], &cur, alloc, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+            || cur == alloc)
+            return i;
+    }
+
+    // Falling back to another allocator would hand its buffers to the wrong free()
+    fprintf(stderr, "Too many allocators registered (STR_MAX_ALLOCATORS is %d), "
+                    "release unused ones with str_allocator_release()\n",
+            STR_MAX_ALLOCATORS);
+    abort();
+}
+
+/* * * * * * * Allocation stats * * * * * * */
+
+static const char *SITE_NAMES[STR_SITE_COUNT + 1] = {
+    [STR_SITE_NALLOC]        = "str_nalloc",
+    [STR_SITE_CLONE]         = "str_clone",
+    [STR_SITE_FREAD]         = "fread_str",
+    [STR_SITE_FDEBUG]        = "str_fdebug",
+    [STR_SITE_FMT]           = "str_fmt",
+    [STR_SITE_PUSHF]         = "str_pushf",
+    [STR_SITE_FREE]          = "str_free",
+    [STR_SITE_CSTR]          = "cstr",
+    [STR_SITE_SLICE]         = "str_slice",
+    [STR_SITE_ESCAPE]        = "str_escape",
+    [STR_SITE_PUSH]          = "str_push",
+    [STR_SITE_PUSHS]         = "str_pushs",
+    [STR_SITE_POPN]          = "str_popn",
+    [STR_SITE_INSERT]        = "str_insert",
+    [STR_SITE_INSERTS]       = "str_inserts",
+    [STR_SITE_REPLACE_SLICE] = "str_replace_slice",
+    [STR_SITE_REPLACE]       = "str_replace",
+    [STR_SITE_RESERVE]       = "str_reserve",
+    [STR_SITE_SHARE]         = "str_make_shared",
+    [STR_SITE_OTHER]         = "other",
+    [STR_SITE_ALL]           = "all",
+};
+
+static bool stats_enabled = false;
+static StrAllocStats STATS[STR_SITE_COUNT + 1];
+
+// Site the current allocations are attributed to (STR_SITE_COUNT if none)
+static _Thread_local StrAllocSite alloc_site = STR_SITE_COUNT;
+
+static StrAllocSite alloc_site_enter(StrAllocSite site) {
+    StrAllocSite prev = alloc_site;
+    if (prev == STR_SITE_COUNT) alloc_site = site;
+    return prev;
+}
+
+static void alloc_site_leave(StrAllocSite *prev) {
+    alloc_site = *prev;
+}
+
+// Attributes allocations made until the end of the enclosing block to the given
+// site, unless they are already attributed to an outer library function
+#define ALLOC_SITE(site) \
+    __attribute__((cleanup(alloc_site_leave))) \
+    StrAllocSite _alloc_site_prev = alloc_site_enter(site)
+
+// The counters are updated atomically, so they stay exact with concurrent allocations
+#define STAT_ADD(field, n) __atomic_add_fetch(&(field), (n), __ATOMIC_RELAXED)
+
+static inline bool stats_on(void) {
+    return __atomic_load_n(&stats_enabled, __ATOMIC_RELAXED);
+}
+
+static StrAllocStats *stats_site(void) {
+    return &STATS[alloc_site == STR_SITE_COUNT ? STR_SITE_OTHER : alloc_site];
+}
+
+static void stats_max(size_t *peak, size_t value) {
+    size_t cur = __atomic_load_n(peak, __ATOMIC_RELAXED);
+    while (value > cur && !__atomic_compare_exchange_n(peak, &cur, value, true,
+                                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+// Adds `new_size - old_size` to the bytes in use and returns the new total.
+// Buffers allocated while counting was disabled (or before a reset) are freed
+// uncounted, the total is clamped at zero instead of wrapping around.
+static size_t stats_in_use(size_t old_size, size_t new_size) {
+    size_t *in_use = &STATS[STR_SITE_ALL].in_use;
+    if (new_size >= old_size) return STAT_ADD(*in_use, new_size - old_size);
+
+    size_t cur = __atomic_load_n(in_use, __ATOMIC_RELAXED), next;
+    do next = cur > old_size - new_size ? cur - (old_size - new_size) : 0;
+    while (!__atomic_compare_exchange_n(in_use, &cur, next, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return next;
+}
+
+// Records an allocation growing (or shrinking) from `old_size` to `new_size` bytes
+static void stats_grow(StrAllocStats *site, size_t old_size, size_t new_size) {
+    StrAllocStats *all = &STATS[STR_SITE_ALL];
+
+    if (new_size > old_size) {
+        STAT_ADD(site->bytes, new_size - old_size);
+        STAT_ADD(all->bytes, new_size - old_size);
+    }
+
+    size_t in_use = stats_in_use(old_size, new_size);
+
+    stats_max(&all->peak, in_use);
+    stats_max(&site->peak, in_use);
+}
+
+/* * * * * * * Thread caches * * * * * * */
+
+// Freed buffers of the default allocator whose size is a power of two between
+// STR_MIN_BUFSZ and CACHE_MAX_SIZE (the sizes str_bufsz() returns) are kept
+// in per-thread free lists, and reused by the next allocation of that size
+// on the same thread without going through malloc.
+#define CACHE_MAX_SIZE 0x1000
+#define CACHE_CLASSES  6
+
+typedef struct CacheBlock {
+    struct CacheBlock *next;
+} CacheBlock;
+
+typedef struct {
+    CacheBlock *head[CACHE_CLASSES];
+    unsigned    count[CACHE_CLASSES];
+    bool        registered; // for the flush at thread exit
+    bool        exiting;    // flushed at thread exit, buffers freed later are not cached
+} ThreadCache;
+
+static bool cache_enabled = true;
+static _Thread_local ThreadCache cache;
+
+static pthread_key_t  cache_key;
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+
+// Returns the size class of an allocation of the default allocator, or -1
+static inline int cache_class(unsigned slot, size_t size) {
+    if (slot || size < STR_MIN_BUFSZ || size > CACHE_MAX_SIZE || (size & (size - 1))) return -1;
+    if (!__atomic_load_n(&cache_enabled, __ATOMIC_RELAXED)) return -1;
+    return __builtin_ctzll(size) - __builtin_ctzll(STR_MIN_BUFSZ);
+}
+
+static void cache_flush(ThreadCache *c) {
+    for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+        while (c->head[cls]) {
+            CacheBlock *b = c->head[cls];
+            c->head[cls] = b->next;
+            free(b);
+        }
+        c->count[cls] = 0;
+    }
+}
+
+// Other key destructors may still free strings after this one ran, and the key is
+// not set again: stop caching so that their buffers are not leaked
+static void cache_destroy(void *c) {
+    cache_flush(c);
+    ((ThreadCache *)c)->exiting = true;
+}
+
+// The main thread does not run key destructors, flush its cache at exit
+// so leak checkers do not report the cached buffers
+__attribute__((destructor))
+static void cache_exit(void) {
+    cache_flush(&cache);
+}
+
+static void cache_key_create(void) {
+    pthread_key_create(&cache_key, cache_destroy);
+}
+
+static void *cache_pop(int cls) {
+    CacheBlock *b = cache.head[cls];
+    if (b) {
+        cache.head[cls] = b->next;
+        cache.count[cls]--;
+    }
+    return b;
+}
+
+// Returns false if the free list of the class is full
+static bool cache_push(int cls, void *ptr) {
+    if (cache.count[cls] >= STR_CACHE_DEPTH || cache.exiting) return false;
+
+    if (!cache.registered) {
+        pthread_once(&cache_once, cache_key_create);
+        pthread_setspecific(cache_key, &cache);
+        cache.registered = true;
+    }
+
+    CacheBlock *b = ptr;
+    b->next = cache.head[cls];
+    cache.head[cls] = b;
+    cache.count[cls]++;
+    return true;
+}
+
+/* * * * * * * Slots * * * * * * */
+
+static void *slot_alloc(unsigned slot, size_t size) {
+    const StrAllocator *a = slot_allocator(slot);
+
+    if (stats_on()) {
+        StrAllocStats *site = stats_site();
+        STAT_ADD(site->allocs, 1);
+        STAT_ADD(STATS[STR_SITE_ALL].allocs, 1);
+        stats_grow(site, 0, size);
+    }
+
+    int cls = cache_class(slot, size);
+    if (cls >= 0) {
+        void *ptr = cache_pop(cls);
+        if (ptr) return ptr;
+    }
+
+    return a->alloc(a->ctx, size);
+}
+
+static void *slot_realloc(unsigned slot, void *ptr, size_t old_size, size_t new_size) {
+    const StrAllocator *a = slot_allocator(slot);
+
+    if (stats_on()) {
+        StrAllocStats *site = stats_site();
+        STAT_ADD(site->reallocs, 1);
+        STAT_ADD(STATS[STR_SITE_ALL].reallocs, 1);
+        stats_grow(site, old_size, new_size);
+    }
+
+    // Move to a cached buffer of the new size
+    int cls = ptr ? cache_class(slot, new_size) : -1;
+    if (cls >= 0 && cache.head[cls]) {
+        void *moved = memcpy(cache_pop(cls), ptr, old_size < new_size ? old_size : new_size);
+
+        int old_cls = cache_class(slot, old_size);
+        if (old_cls < 0 || !cache_push(old_cls, ptr)) a->free(a->ctx, ptr, old_size);
+        return moved;
+    }
+
+    return a->realloc(a->ctx, ptr, old_size, new_size);
+}
+
+static void slot_free(unsigned slot, void *ptr, size_t size) {
+    const StrAllocator *a = slot_allocator(slot);
+
+    if (stats_on()) {
+        StrAllocStats *site = stats_site();
+        STAT_ADD(site->frees, 1);
+        STAT_ADD(STATS[STR_SITE_ALL].frees, 1);
+        stats_in_use(size, 0);
+    }
+
+    int cls = cache_class(slot, size);
+    if (cls >= 0 && cache_push(cls, ptr)) return;
+
+    a->free(a->ctx, ptr, size);
+}
+
+/* * * * * * * MEMORY * * * * * * */
+
+void str_set_allocator(const StrAllocator *alloc) {
+    __atomic_store_n(&global_slot, alloc ? allocator_slot(alloc) : 0, __ATOMIC_RELEASE);
+}
+
+const StrAllocator *str_get_allocator(void) {
+    return slot_allocator(current_slot());
+}
+
+void str_allocator_release(const StrAllocator *alloc) {
+    if (!alloc || alloc == &LIBC_ALLOCATOR) return;
+
+    for (unsigned i = 1; i < STR_MAX_ALLOCATORS; i++) {
+        if (slot_allocator(i) != alloc) continue;
+
+        unsigned cur = i;
+        __atomic_compare_exchange_n(&global_slot, &cur, 0, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+        __atomic_store_n(&ALLOCATORS[i], NULL, __ATOMIC_RELEASE);
+    }
+}
+
+unsigned str_allocator_slot(const StrAllocator *alloc) {
+    return allocator_slot(alloc);
+}
+
+void *str_mem_alloc(size_t size) {
+    return slot_alloc(current_slot(), size);
+}
+
+void *str_mem_realloc(void *ptr, size_t old_size, size_t new_size) {
+    return slot_realloc(current_slot(), ptr, old_size, new_size);
+}
+
+void str_mem_free(void *ptr, size_t size) {
+    if (ptr) slot_free(current_slot(), ptr, size);
+}
+
+void *str_mem_alloc_with(unsigned slot, size_t size) {
+    return slot_alloc(slot, size);
+}
+
+void *str_mem_realloc_with(unsigned slot, void *ptr, size_t old_size, size_t new_size) {
+    return slot_realloc(slot, ptr, old_size, new_size);
+}
+
+void str_mem_free_with(unsigned slot, void *ptr, size_t size) {
+    if (ptr) slot_free(slot, ptr, size);
+}
+
+void str_cache_enable(bool enable) {
+    __atomic_store_n(&cache_enabled, enable, __ATOMIC_RELAXED);
+}
+
+void str_cache_flush(void) {
+    cache_flush(&cache);
+}
+
+void str_alloc_stats_enable(bool enable) {
+    __atomic_store_n(&stats_enabled, enable, __ATOMIC_RELAXED);
+}
+
+void str_alloc_stats_reset(void) {
+    memset(STATS, 0, sizeof STATS);
+}
+
+StrAllocStats str_alloc_stats(StrAllocSite site) {
+    if (site > STR_SITE_ALL) site = STR_SITE_ALL;
+
+    const StrAllocStats *s = &STATS[site];
+    return (StrAllocStats){
+        .allocs   = __atomic_load_n(&s->allocs, __ATOMIC_RELAXED),
+        .reallocs = __atomic_load_n(&s->reallocs, __ATOMIC_RELAXED),
+        .frees    = __atomic_load_n(&s->frees, __ATOMIC_RELAXED),
+        .bytes    = __atomic_load_n(&s->bytes, __ATOMIC_RELAXED),
+        .in_use   = __atomic_load_n(&s->in_use, __ATOMIC_RELAXED),
+        .peak     = __atomic_load_n(&s->peak, __ATOMIC_RELAXED),
+    };
+}
+
+const char *str_alloc_site_name(StrAllocSite site) {
+    if (site > STR_SITE_ALL) site = STR_SITE_ALL;
+    return SITE_NAMES[site];
+}
+
+void str_alloc_stats_fdump(FILE *f) {
+    fprintf(f, "%-18s %10s %10s %10s %12s %12s\n",
+            "site", "allocs", "reallocs", "frees", "bytes", "peak");
+
+    for (StrAllocSite i = 0; i <= STR_SITE_ALL; i++) {
+        StrAllocStats s = STATS[i];
+        if (!s.allocs && !s.reallocs && !s.frees && i != STR_SITE_ALL) continue;
+
+        fprintf(f, "%-18s %10zu %10zu %10zu %12zu %12zu\n",
+                SITE_NAMES[i], s.allocs, s.reallocs, s.frees, s.bytes, s.peak);
+    }
+}
+
 // Computes the optimal buffer size for a string with the given length
 size_t str_bufsz(size_t len) {
     if (len + 1 <= STR_MIN_BUFSZ)
@@ -28,12 +436,77 @@ size_t str_bufsz(size_t len) {
     return bufsz;
 }
 
+/* * * * * * * Shared buffers * * * * * * */
+
+// Header in front of the buffer of a shared string
+typedef struct {
+    size_t refs;
+} SharedHeader;
+
+// Keeps the string data as aligned as the allocation itself
+#define SHARED_HDR_SIZE ((sizeof(SharedHeader) + 15) & ~(size_t)15)
+
+static inline SharedHeader *shared_header(const String *str) {
+    return (SharedHeader *)(str->str - SHARED_HDR_SIZE);
+}
+
+// Allocates the buffer of a shared string with a single reference
+static char *shared_alloc(unsigned slot, size_t bufsz) {
+    SharedHeader *h = slot_alloc(slot, SHARED_HDR_SIZE + bufsz);
+    h->refs = 1;
+    return (char *)h + SHARED_HDR_SIZE;
+}
+
+static void shared_retain(const String *str) {
+    __atomic_add_fetch(&shared_header(str)->refs, 1, __ATOMIC_RELAXED);
+}
+
+// Drops a reference, freeing the buffer with the last one
+static void shared_release(String *str) {
+    SharedHeader *h = shared_header(str);
+    if (__atomic_sub_fetch(&h->refs, 1, __ATOMIC_ACQ_REL)) return;
+
+    memset(str->str, 0, str->len);
+    slot_free(str->alloc, h, SHARED_HDR_SIZE + str->bufsz);
+}
+
+// Makes sure the shared buffer is referenced only by the given string
+// and can hold `len` bytes
+static void shared_ensure_buf(String *str, size_t len) {
+    size_t bufsz = str->bufsz;
+    while (len > bufsz) bufsz *= 2;
+
+    SharedHeader *h = shared_header(str);
+
+    if (__atomic_load_n(&h->refs, __ATOMIC_ACQUIRE) == 1) {
+        if (bufsz != str->bufsz) {
+            h = slot_realloc(str->alloc, h, SHARED_HDR_SIZE + str->bufsz, SHARED_HDR_SIZE + bufsz);
+            str->str   = (char *)h + SHARED_HDR_SIZE;
+            str->bufsz = bufsz;
+        }
+        return;
+    }
+
+    // Copy on write
+    char *buf = memcpy(shared_alloc(str->alloc, bufsz), str->str, str->len);
+    shared_release(str);
+    str->str   = buf;
+    str->bufsz = bufsz;
+}
+
 // Allocates more memory if needed to store a string of the given desired length
+// and copies the buffer if it is shared with another string
 // Doesn't check whether the string is valid or allocated on the heap!
 void str_ensure_buf(String *str, size_t len) {
+    if (str->flags & STR_SHARED) {
+        shared_ensure_buf(str, len);
+        return;
+    }
+
     if (len > str->bufsz) {
-        str->bufsz *= 2;
-        str->str = realloc(str->str, str->bufsz);
+        size_t old_bufsz = str->bufsz;
+        while (len > str->bufsz) str->bufsz *= 2;
+        str->str = slot_realloc(str->alloc, str->str, old_bufsz, str->bufsz);
     }
 }
 
@@ -42,6 +515,7 @@ void str_ensure_buf(String *str, size_t len) {
 String str_nref(const char *str, size_t len) {
     return (String){
         .flags = STR_VALID,
+        .alloc = 0,
         .bufsz = 0,
         .len   = len,
         .str   = (char *)str,
@@ -52,38 +526,108 @@ inline String str_ref(const char *str) {
     return str_nref(str, strlen(str));
 }
 
-String str_nalloc(const char *str, size_t len) {
+inline String str_nalloc(const char *str, size_t len) {
+    return str_nalloc_with(NULL, str, len);
+}
+
+inline String str_alloc(const char *str) {
+    return str_nalloc_with(NULL, str, strlen(str));
+}
+
+String str_clone(String str) {
+    ALLOC_SITE(STR_SITE_CLONE);
+
+    if (str.flags & STR_SHARED) {
+        shared_retain(&str);
+        return str;
+    }
+
+    return str_nalloc_with(NULL, str.str, str.len);
+}
+
+String str_nalloc_with(const StrAllocator *alloc, const char *str, size_t len) {
+    ALLOC_SITE(STR_SITE_NALLOC);
+
+    unsigned slot = allocator_slot(alloc);
     size_t bufsz = str_bufsz(len);
+    char *buf = slot_alloc(slot, bufsz);
+
     return (String){
         .flags = STR_VALID | STR_HEAP,
+        .alloc = slot,
         .bufsz = bufsz,
         .len   = len,
-        .str   = memcpy(malloc(bufsz), str, len),
+        .str   = str ? memcpy(buf, str, len) : buf,
     };
 }
 
-inline String str_alloc(const char *str) {
-    return str_nalloc(str, strlen(str));
+inline String str_alloc_with(const StrAllocator *alloc, const char *str) {
+    return str_nalloc_with(alloc, str, strlen(str));
 }
 
-inline String str_clone(String str) {
-    return str_nalloc(str.str, str.len);
+String str_clone_with(const StrAllocator *alloc, String str) {
+    ALLOC_SITE(STR_SITE_CLONE);
+
+    if ((str.flags & STR_SHARED) && allocator_slot(alloc) == str.alloc) {
+        shared_retain(&str);
+        return str;
+    }
+
+    return str_nalloc_with(alloc, str.str, str.len);
+}
+
+void str_make_shared(String *str) {
+    ALLOC_SITE(STR_SITE_SHARE);
+
+    if (!(str->flags & STR_VALID))
+        fprintf(stderr, "Invalid string passed to str_make_shared\n");
+
+    if (str->flags & STR_SHARED) return;
+
+    unsigned slot = str->flags & STR_HEAP ? str->alloc : current_slot();
+    size_t bufsz  = str->flags & STR_HEAP ? str->bufsz : str_bufsz(str->len);
+
+    String shared = {
+        .flags = STR_VALID | STR_HEAP | STR_SHARED,
+        .alloc = slot,
+        .bufsz = bufsz,
+        .len   = str->len,
+        .str   = memcpy(shared_alloc(slot, bufsz), str->str, str->len),
+    };
+
+    str_free(str);
+    *str = shared;
+}
+
+size_t str_refcount(String str) {
+    if (str.flags & STR_SHARED)
+        return __atomic_load_n(&shared_header(&str)->refs, __ATOMIC_ACQUIRE);
+    return (str.flags & STR_HEAP) ? 1 : 0;
 }
 
 /* * * * * * * Input/Output * * * * * * */
 
-String fread_str(FILE *f) {
+inline String fread_str(FILE *f) {
+    return fread_str_with(NULL, f);
+}
+
+String fread_str_with(const StrAllocator *alloc, FILE *f) {
+    ALLOC_SITE(STR_SITE_FREAD);
+    STR_TRACE_SPAN(STR_TRACE_FREAD, 0);
+
     fseek(f, 0, SEEK_END);
 
     String str;
     str.flags = STR_VALID | STR_HEAP;
+    str.alloc = allocator_slot(alloc);
     str.len   = ftell(f);
     str.bufsz = str_bufsz(str.len);
-    str.str   = malloc(str.bufsz);
+    str.str   = slot_alloc(str.alloc, str.bufsz);
 
     rewind(f);
     fread(str.str, 1, str.len, f);
 
+    STR_TRACE_BYTES(str.len);
     return str;
 }
 
@@ -95,6 +639,8 @@ inline void str_debug(String str) {
 
 // Prints debug info for the given string to a file
 void str_fdebug(FILE *f, String str) {
+    ALLOC_SITE(STR_SITE_FDEBUG);
+
     String esc = str_escape(str);
 
     fprintf(f,
@@ -112,49 +658,88 @@ void str_fdebug(FILE *f, String str) {
 }
 
 String str_fmt(const char *fmt, ...) {
-    if (!strchr(fmt, '%')) return str_alloc(fmt);
+    ALLOC_SITE(STR_SITE_FMT);
+    STR_TRACE_SPAN(STR_TRACE_FMT, 0);
+
+    String str;
+    if (!strchr(fmt, '%')) {
+        str = str_alloc(fmt);
+    } else {
+        va_list args;
+        va_start(args, fmt);
+
+        str = str_nalloc("", 0);
+        str_vpushf(&str, fmt, args);
+
+        va_end(args);
+    }
 
-    va_list args, temp_args;
+    STR_TRACE_BYTES(str.len);
+    return str;
+}
+
+void str_pushf(String *str, const char *fmt, ...) {
+    va_list args;
     va_start(args, fmt);
+    str_vpushf(str, fmt, args);
+    va_end(args);
+}
 
-    String str = {0};
+void str_vpushf(String *str, const char *fmt, va_list args) {
+    ALLOC_SITE(STR_SITE_PUSHF);
+    STR_TRACE_SPAN(STR_TRACE_FMT, 0);
 
-    for (size_t bufsz = str_bufsz(0);; bufsz <<= 1) {
-        va_copy(temp_args, args);
+    if ((str->flags & (STR_VALID | STR_HEAP)) != (STR_VALID | STR_HEAP)) {
+        fprintf(stderr, "Invalid string passed to str_vpushf\n");
+        return;
+    }
 
-        str.flags = STR_HEAP;
-        str.bufsz = bufsz + 1; // space for null byte
-        str.str   = str.str ? realloc(str.str, str.bufsz) : malloc(str.bufsz);
-        str.len   = vsnprintf(str.str, str.bufsz, fmt, temp_args);
+    // Formatting writes to the spare capacity, which must not be shared
+    str_ensure_buf(str, str->len);
 
-        va_end(temp_args);
+    va_list temp_args;
+    va_copy(temp_args, args);
 
-        // The loop will continue until the string fits inside the buffer
-        if (str.len >= 0 && str.len < str.bufsz) break;
+    // First pass formats straight into the spare capacity (+1 for the nul
+    // byte written by vsnprintf) and doubles as the sizing pass
+    size_t spare = str->bufsz - str->len;
+    int n = vsnprintf(str->str + str->len, spare, fmt, temp_args);
+    va_end(temp_args);
+
+    if (n < 0) return;
+
+    if ((size_t)n >= spare) {
+        str_ensure_buf(str, str->len + n + 1);
+        vsnprintf(str->str + str->len, n + 1, fmt, args);
     }
 
-    va_end(args);
-    str.flags |= STR_VALID;
-    return str;
+    str->len += n;
+    STR_TRACE_BYTES(n);
 }
 
 /* * * * * * * CONSUMPTION * * * * * * */
 
 void str_free(String *str) {
+    ALLOC_SITE(STR_SITE_FREE);
+
     if (!(str->flags & STR_VALID)) return;
 
-    if (str->flags & STR_HEAP) {
+    if (str->flags & STR_SHARED) {
+        shared_release(str);
+    } else if (str->flags & STR_HEAP) {
         memset(str->str, 0, str->len);
-        free(str->str);
+        slot_free(str->alloc, str->str, str->bufsz);
     }
 
     str->flags = 0;
+    str->alloc = 0;
     str->bufsz = 0;
     str->len   = 0;
     str->str   = NULL;
 }
 
 char *cstr(String str) {
+    ALLOC_SITE(STR_SITE_CSTR);
     STR_CHECK_VALID(str, cstr);
 
     // This would improve performance by preventing heap allocation, if the string
@@ -164,7 +749,44 @@ char *cstr(String str) {
     // if (str.str[str.len - 1] == '\0')
     //     return str.str;
 
-    return strncpy(malloc(str.len + 1), str.str, str.len);
+    char *c = memcpy(str_mem_alloc(str.len + 1), str.str, str.len);
+    c[str.len] = '\0';
+    return c;
+}
+
+void cstr_free(char *str) {
+    ALLOC_SITE(STR_SITE_FREE);
+    if (str) str_mem_free(str, strlen(str) + 1);
+}
+
+// Kept in front of the strings returned by cstr_with()
+typedef struct {
+    size_t   size;  // size of the allocation, header included
+    unsigned alloc; // slot of the allocator
+} CstrHeader;
+
+#define CSTR_HDR_SIZE ((sizeof(CstrHeader) + 15) & ~(size_t)15)
+
+char *cstr_with(const StrAllocator *alloc, String str) {
+    ALLOC_SITE(STR_SITE_CSTR);
+    STR_CHECK_VALID(str, cstr_with);
+
+    unsigned slot = allocator_slot(alloc);
+    CstrHeader *h = slot_alloc(slot, CSTR_HDR_SIZE + str.len + 1);
+    h->alloc = slot;
+    h->size  = CSTR_HDR_SIZE + str.len + 1;
+
+    char *c = memcpy((char *)h + CSTR_HDR_SIZE, str.str, str.len);
+    c[str.len] = '\0';
+    return c;
+}
+
+void cstr_with_free(char *str) {
+    ALLOC_SITE(STR_SITE_FREE);
+    if (!str) return;
+
+    CstrHeader *h = (CstrHeader *)(str - CSTR_HDR_SIZE);
+    slot_free(h->alloc, h, h->size);
 }
 
 /* * * * * * * TRANSFORMATION * * * * * * */
@@ -179,6 +801,7 @@ String str_slice_ref(String str, size_t offset, size_t len) {
 }
 
 String str_slice(String str, size_t offset, size_t len) {
+    ALLOC_SITE(STR_SITE_SLICE);
     STR_CHECK_VALID(str, str_slice);
 
     if (offset + len > str.len)
@@ -188,75 +811,48 @@ String str_slice(String str, size_t offset, size_t len) {
 }
 
 String str_strip(const char *chs, String str, StrStripFlags flags, int *out) {
-    size_t i = 0;
+    STR_CHECK_VALID(str, str_strip);
 
-    if (flags & STR_STRIP_LEFT)
-        while (strchr(chs, str.str[i])) i++;
-
-    int end = 0;
-    size_t len = str.len - i;
-
-    if (flags & STR_STRIP_RIGHT)
-        while (strchr(chs, str.str[i + len - 1])) { len--; end++; }
-
-    if (out) *out = (int)i + end;
-    return str_slice_ref(str, i, len);
+    return str_from_view(strview_strip(chs, strview(str), flags, out));
 }
 
 bool str_split(String str, String delim, String *out) {
-    // ...xxx|delim xxxxxxxx|delim xxx...
-    //       ^-- start      ^-- end
+    STR_TRACE_SPAN(STR_TRACE_SPLIT, 0);
 
-    size_t start;
-    if (out->str)
-        start = str_lpos(delim, str, out->str - str.str + out->len);
-    else
-        start = str_lpos(delim, str, 0);
+    StrView view = strview(*out);
+    if (!strview_split(strview(str), strview(delim), &view)) return false;
 
-    if (start == -1) {
-        if (out->str) return false;
-        else {
-            *out = str;
-            return true;
-        }
-    }
-
-    if (!out->str) {
-        *out = str_slice_ref(str, 0, start);
-        return true;
-    }
-
-    size_t end = str_lpos(delim, str, start + delim.len);
-    if (end == -1) end = str.len;
-
-    *out = str_slice_ref(str, start + delim.len, end - start - delim.len);
+    *out = str_from_view(view);
+    STR_TRACE_BYTES(view.len);
     return true;
 }
 
 String str_escape(String str) {
     // Escape table (char -> sequence)
-    static char *ESC[0x100];
-    if (!ESC[0]) {
-        ESC['\0'] = "\\0";
-        ESC['\"'] = "\\\""; ESC['\''] = "\\'"; ESC['\\'] = "\\\\";
-        ESC['\a'] = "\\a";  ESC['\b'] = "\\b"; ESC['\n'] = "\\n";
-        ESC['\f'] = "\\f";  ESC['\r'] = "\\r"; ESC['\t'] = "\\t";
-        ESC['\v'] = "\\v";
-    }
+    static const char *const ESC[0x100] = {
+        ['\0'] = "\\0",
+        ['\"'] = "\\\"", ['\''] = "\\'", ['\\'] = "\\\\",
+        ['\a'] = "\\a",  ['\b'] = "\\b", ['\n'] = "\\n",
+        ['\f'] = "\\f",  ['\r'] = "\\r", ['\t'] = "\\t",
+        ['\v'] = "\\v",
+    };
+
+    ALLOC_SITE(STR_SITE_ESCAPE);
+    STR_TRACE_SPAN(STR_TRACE_ESCAPE, str.len);
 
     String e = str_alloc("");
 
     for (size_t i = 0; i < str.len; i++) {
-        char c = str.str[i];
+        unsigned char c = str.str[i];
 
         if (ESC[c]) {
             str_pushs(str_ref(ESC[c]), &e);
         } else {
             // TODO: Detect unicode and build \u escapes
-            if (!isprint(str.str[i])) {
-                String hex = str_fmt("\\x%02X", str.str[i]);
-                str_pushs(hex, &e);
-                str_free(&hex);
+            if (!str_isclass(c, STR_CLASS_PRINT)) {
+                char hex[4] = "\\x";
+                str_hex_encode_to(hex + 2, str_nref(str.str + i, 1), STR_CODEC_UPPER);
+                str_pushs(str_nref(hex, sizeof hex), &e);
             } else str_push(str.str[i], &e);
         }
     }
@@ -269,6 +865,8 @@ String str_unescape(String str) { /* TODO */ return str; }
 /* * * * * * * MUTATION * * * * * * */
 
 void str_push(char c, String *str) {
+    ALLOC_SITE(STR_SITE_PUSH);
+
     if (!FLAGS_ALL(str->flags, STR_VALID | STR_HEAP))
         fprintf(stderr, "Invalid string passed to str_append\n");
 
@@ -277,6 +875,8 @@ void str_push(char c, String *str) {
 }
 
 void str_pushs(String suffix, String *str) {
+    ALLOC_SITE(STR_SITE_PUSHS);
+
     if (!FLAGS_ALL(str->flags, STR_VALID | STR_HEAP))
         fprintf(stderr, "Invalid string passed to str_appends\n");
 
@@ -295,6 +895,8 @@ bool str_pop(String *str, char *out) {
 }
 
 bool str_popn(String *str, size_t n, String *out) {
+    ALLOC_SITE(STR_SITE_POPN);
+
     if (!FLAGS_ALL(str->flags, STR_VALID | STR_HEAP))
         fprintf(stderr, "Invalid string passed to str_popn\n");
 
@@ -305,6 +907,8 @@ bool str_popn(String *str, size_t n, String *out) {
 }
 
 void str_insert(char c, size_t pos, String *str) {
+    ALLOC_SITE(STR_SITE_INSERT);
+
     if (!FLAGS_ALL(str->flags, STR_VALID | STR_HEAP))
         fprintf(stderr, "Invalid string passed to str_insert\n");
 
@@ -317,6 +921,8 @@ void str_insert(char c, size_t pos, String *str) {
 }
 
 void str_inserts(String infix, size_t pos, String *str) {
+    ALLOC_SITE(STR_SITE_INSERTS);
+
     if (!FLAGS_ALL(str->flags, STR_VALID | STR_HEAP))
         fprintf(stderr, "Invalid string passed to str_inserts\n");
 
@@ -329,17 +935,23 @@ void str_inserts(String infix, size_t pos, String *str) {
 }
 
 void str_replace_slice(size_t offset, size_t len, String repl, String *str) {
+    ALLOC_SITE(STR_SITE_REPLACE_SLICE);
+
     if (!FLAGS_ALL(str->flags, STR_VALID | STR_HEAP))
         fprintf(stderr, "Invalid string passed to str_replace_slice\n");
 
     if (len == 0)           { str_inserts(repl, offset, str); return; }
     if (offset >= str->len) { str_pushs(repl, str); return; }
 
+    // The result gets a new buffer (which stays in shared mode)
     String r;
-    r.flags = STR_VALID | STR_HEAP;
+    r.flags = str->flags & (STR_VALID | STR_HEAP | STR_SHARED);
+    r.alloc = str->alloc;
     r.len   = str->len - len + repl.len;
     r.bufsz = str_bufsz(r.len);
-    char *w = r.str = malloc(r.bufsz);
+    char *w = r.str = r.flags & STR_SHARED
+        ? shared_alloc(r.alloc, r.bufsz)
+        : slot_alloc(r.alloc, r.bufsz);
 
     memcpy(w, str->str, offset); // str[..offset]
     w += offset;
@@ -355,16 +967,20 @@ void str_replace_slice(size_t offset, size_t len, String repl, String *str) {
 }
 
 int str_replace(String pat, String repl, String *str, StrReplaceFlags flags) {
+    ALLOC_SITE(STR_SITE_REPLACE);
+    STR_TRACE_SPAN(STR_TRACE_REPLACE, str->len);
+
     if (!FLAGS_ALL(str->flags, STR_VALID | STR_HEAP))
         fprintf(stderr, "Invalid string passed to str_replace\n");
 
-    int (*pos_fn)(String, String, size_t) =
-        (flags & STR_REPLACE_REVERSE) ? str_rpos : str_lpos;
+    // The view functions are not traced, the searches are part of the replacement
+    int (*pos_fn)(StrView, StrView, size_t) =
+        (flags & STR_REPLACE_REVERSE) ? strview_rpos : strview_lpos;
 
     int pos;
     int n = 0;
 
-    while ((pos = pos_fn(pat, *str, 0)) >= 0) {
+    while ((pos = pos_fn(strview(pat), strview(*str), 0)) >= 0) {
         str_replace_slice(pos, pat.len, repl, str);
         n++;
 
@@ -374,79 +990,219 @@ int str_replace(String pat, String repl, String *str, StrReplaceFlags flags) {
     return n;
 }
 
+void str_reserve(size_t cap, String *str) {
+    ALLOC_SITE(STR_SITE_RESERVE);
+
+    if ((str->flags & (STR_VALID | STR_HEAP)) != (STR_VALID | STR_HEAP)) {
+        fprintf(stderr, "Invalid string passed to str_reserve\n");
+        return;
+    }
+
+    str_ensure_buf(str, cap);
+}
+
 /* * * * * * * INSPECTION * * * * * * */
 
 bool str_eq(String a, String b) {
-    if (a.len != b.len) return false;
-    return !strncmp(a.str, b.str, a.len);
+    return strview_eq(strview(a), strview(b));
 }
 
 int str_lpos(String needle, String haystack, size_t offset) {
-    if (offset + needle.len > haystack.len) return -1;
+    STR_TRACE_SPAN(STR_TRACE_SEARCH, haystack.len);
+    return strview_lpos(strview(needle), strview(haystack), offset);
+}
 
-    for (size_t i = offset; i < haystack.len; i++) {
-        bool eq = true;
+int str_rpos(String needle, String haystack, size_t offset) {
+    STR_TRACE_SPAN(STR_TRACE_SEARCH, haystack.len);
+    return strview_rpos(strview(needle), strview(haystack), offset);
+}
 
-        for (size_t j = 0; j < needle.len; j++) {
-            if (haystack.str[i + j] != needle.str[j]) {
-                eq = false;
-                break;
-            }
+int str_count(char c, String str) {
+    STR_CHECK_VALID(str, str_count);
+    STR_TRACE_SPAN(STR_TRACE_SEARCH, str.len);
+
+    return strview_count(c, strview(str));
+}
+
+int str_counts(String needle, String haystack, StrCountFlags flags) {
+    STR_CHECK_VALID(needle,   str_counts);
+    STR_CHECK_VALID(haystack, str_counts);
+    STR_TRACE_SPAN(STR_TRACE_SEARCH, haystack.len);
+
+    return strview_counts(strview(needle), strview(haystack), flags);
+}
+
+bool str_startswith(String prefix, String str) {
+    STR_CHECK_VALID(prefix, str_startswith);
+    STR_CHECK_VALID(str,    str_startswith);
+
+    return strview_startswith(strview(prefix), strview(str));
+}
+
+bool str_endswith(String suffix, String str) {
+    STR_CHECK_VALID(suffix, str_endswith);
+    STR_CHECK_VALID(str,    str_endswith);
+
+    return strview_endswith(strview(suffix), strview(str));
+}
+
+/* * * * * * * CHARACTER CLASSES * * * * * * */
+
+#define C_PRINT_PUNCT (STR_CLASS_PRINT | STR_CLASS_PUNCT)
+
+const uint8_t STR_CHAR_CLASSES[0x100] = {
+    [0x00 ... 0x08] = STR_CLASS_CNTRL,
+    ['\t' ... '\r'] = STR_CLASS_CNTRL | STR_CLASS_SPACE,
+    [0x0E ... 0x1F] = STR_CLASS_CNTRL,
+    [' ']           = STR_CLASS_PRINT | STR_CLASS_SPACE,
+    ['!' ... '/']   = C_PRINT_PUNCT,
+    ['0' ... '9']   = STR_CLASS_PRINT | STR_CLASS_DIGIT | STR_CLASS_XDIGIT,
+    [':' ... '@']   = C_PRINT_PUNCT,
+    ['A' ... 'F']   = STR_CLASS_PRINT | STR_CLASS_UPPER | STR_CLASS_XDIGIT,
+    ['G' ... 'Z']   = STR_CLASS_PRINT | STR_CLASS_UPPER,
+    ['[' ... '`']   = C_PRINT_PUNCT,
+    ['a' ... 'f']   = STR_CLASS_PRINT | STR_CLASS_LOWER | STR_CLASS_XDIGIT,
+    ['g' ... 'z']   = STR_CLASS_PRINT | STR_CLASS_LOWER,
+    ['{' ... '~']   = C_PRINT_PUNCT,
+    [0x7F]          = STR_CLASS_CNTRL,
+};
+
+/* * * * * * * VIEWS * * * * * * */
+
+_Static_assert(sizeof(StrView) == 2 * sizeof(void *), "StrView must be two words");
+
+StrView strview(String str) {
+    return (StrView){ .str = str.str, .len = str.len };
+}
+
+StrView strview_nref(const char *str, size_t len) {
+    return (StrView){ .str = str, .len = len };
+}
+
+StrView strview_ref(const char *str) {
+    return strview_nref(str, strlen(str));
+}
+
+String str_from_view(StrView view) {
+    return str_nref(view.str, view.len);
+}
+
+String str_alloc_view(StrView view) {
+    return str_nalloc(view.str, view.len);
+}
+
+StrView strview_slice(StrView str, size_t offset, size_t len) {
+    if (offset > str.len) offset = str.len;
+    if (len > str.len - offset) len = str.len - offset;
+
+    return strview_nref(str.str + offset, len);
+}
+
+StrView strview_strip(const char *chs, StrView str, StrStripFlags flags, int *out) {
+    size_t start = 0, end = str.len;
+
+    if (flags & STR_STRIP_LEFT)
+        while (start < end && strchr(chs, str.str[start])) start++;
+
+    if (flags & STR_STRIP_RIGHT)
+        while (end > start && strchr(chs, str.str[end - 1])) end--;
+
+    if (out) *out = (int)(start + str.len - end);
+    return strview_nref(str.str + start, end - start);
+}
+
+bool strview_split(StrView str, StrView delim, StrView *out) {
+    // ...xxx|delim xxxxxxxx|delim xxx...
+    //       ^-- start      ^-- end
+
+    size_t start;
+    if (out->str)
+        start = strview_lpos(delim, str, out->str - str.str + out->len);
+    else
+        start = strview_lpos(delim, str, 0);
+
+    if (start == -1) {
+        if (out->str) return false;
+        else {
+            *out = str;
+            return true;
         }
+    }
 
-        if (eq) return i;
+    if (!out->str) {
+        *out = strview_slice(str, 0, start);
+        return true;
     }
 
-    return -1;
+    size_t end = strview_lpos(delim, str, start + delim.len);
+    if (end == -1) end = str.len;
+
+    *out = strview_slice(str, start + delim.len, end - start - delim.len);
+    return true;
 }
 
-int str_rpos(String needle, String haystack, size_t offset) {
-    if (needle.len > haystack.len - offset) return -1;
+size_t strview_split_all(StrView str, StrView delim, StrView *out, size_t cap) {
+    size_t n = 0;
+    size_t start = 0;
 
-    for (int i = haystack.len - offset - needle.len; i >= 0; i--) {
-        bool eq = true;
+    // Same portions as strview_split(): the whole string if the delimiter
+    // does not occur (or is empty), otherwise the text around every occurence
+    if (!delim.len || strview_lpos(delim, str, 0) == -1) {
+        if (cap) out[0] = str;
+        return 1;
+    }
 
-        for (size_t j = 0; j < needle.len; j++) {
-            if (haystack.str[i + j] != needle.str[j]) {
-                eq = false;
-                break;
-            }
-        }
+    for (;;) {
+        int pos = strview_lpos(delim, str, start);
+        size_t end = pos == -1 ? str.len : (size_t)pos;
 
-        if (eq) return i;
+        if (n < cap) out[n] = strview_nref(str.str + start, end - start);
+        n++;
+
+        if (pos == -1) return n;
+        start = end + delim.len;
+    }
+}
+
+bool strview_eq(StrView a, StrView b) {
+    if (a.len != b.len) return false;
+    return !a.len || !memcmp(a.str, b.str, a.len);
+}
+
+int strview_lpos(StrView needle, StrView haystack, size_t offset) {
+    if (offset + needle.len > haystack.len) return -1;
+
+    for (size_t i = offset; i + needle.len <= haystack.len; i++) {
+        if (!memcmp(haystack.str + i, needle.str, needle.len)) return i;
     }
 
     return -1;
 }
 
-int str_count(char c, String str) {
-    STR_CHECK_VALID(str, str_count);
+int strview_rpos(StrView needle, StrView haystack, size_t offset) {
+    if (offset > haystack.len || needle.len > haystack.len - offset) return -1;
+
+    for (int i = haystack.len - offset - needle.len; i >= 0; i--) {
+        if (!memcmp(haystack.str + i, needle.str, needle.len)) return i;
+    }
 
+    return -1;
+}
+
+int strview_count(char c, StrView str) {
     int n = 0;
     for (size_t i = 0; i < str.len; str.str[i++] == c ? n++ : 0);
     return n;
 }
 
-int str_counts(String needle, String haystack, StrCountFlags flags) {
-    STR_CHECK_VALID(needle,   str_counts);
-    STR_CHECK_VALID(haystack, str_counts);
-
-    if (needle.len == 0 || haystack.len == 0)
+int strview_counts(StrView needle, StrView haystack, StrCountFlags flags) {
+    if (needle.len == 0 || needle.len > haystack.len)
         return 0;
 
     int n = 0;
 
     for (size_t i = 0; i <= haystack.len - needle.len; i++) {
-        bool eq = true;
-
-        for (size_t j = 0; j < needle.len; j++) {
-            if (haystack.str[i + j] != needle.str[j]) {
-                eq = false;
-                break;
-            }
-        }
-
-        if (eq) {
+        if (!memcmp(haystack.str + i, needle.str, needle.len)) {
             if (!(flags & STR_COUNT_OVERLAP))
                 i += needle.len - 1;
 
@@ -457,21 +1213,14 @@ int str_counts(String needle, String haystack, StrCountFlags flags) {
     return n;
 }
 
-bool str_startswith(String prefix, String str) {
-    STR_CHECK_VALID(prefix, str_startswith);
-    STR_CHECK_VALID(str,    str_startswith);
-
+bool strview_startswith(StrView prefix, StrView str) {
     if (prefix.len > str.len) return false;
 
-    return !strncmp(str.str, prefix.str, prefix.len);
+    return !prefix.len || !memcmp(str.str, prefix.str, prefix.len);
 }
 
-bool str_endswith(String suffix, String str) {
-    STR_CHECK_VALID(suffix, str_startswith);
-    STR_CHECK_VALID(str,    str_startswith);
-
+bool strview_endswith(StrView suffix, StrView str) {
     if (suffix.len > str.len) return false;
 
-    return !strncmp(str.str + str.len - suffix.len,
-                    suffix.str, suffix.len);
+    return !suffix.len || !memcmp(str.str + str.len - suffix.len, suffix.str, suffix.len);
 }
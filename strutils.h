@@ -3,6 +3,8 @@
 
 #include <stdio.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdarg.h>
 #include <stdbool.h>
 
 // Attributes of a string slice
@@ -12,16 +14,153 @@ typedef enum {
     STR_VALID = 0x1,
     // Whether a string is allocated on the heap and can be free()-d
     STR_HEAP  = 0x2,
+    // Whether the heap buffer is reference-counted and shared between clones
+    // (always together with STR_HEAP, see str_make_shared())
+    STR_SHARED = 0x4,
 } StringFlags;
 
 // String slice (pointer to data + length + metadata)
 typedef struct {
     StringFlags flags;
-    size_t bufsz; // buffer byte length (only for STR_HEAP)
-    size_t len;   // string byte length
+    unsigned alloc; // allocator slot the buffer belongs to (only for STR_HEAP)
+    size_t bufsz;   // buffer byte length (only for STR_HEAP)
+    size_t len;     // string byte length
     char  *str;
 } String;
 
+// Read-only string slice (pointer + length), half the size of a String.
+// Views never own their bytes, so they carry no flags, capacity or allocator.
+// See the VIEWS section below.
+typedef struct {
+    const char *str;
+    size_t      len;
+} StrView;
+
+/* * * * * * * MEMORY * * * * * * */
+
+// Memory allocator used for string buffers
+typedef struct {
+    // Allocates `size` bytes
+    void *(*alloc)(void *ctx, size_t size);
+    // Resizes an allocation of `old_size` bytes to `new_size` bytes
+    void *(*realloc)(void *ctx, void *ptr, size_t old_size, size_t new_size);
+    // Frees an allocation of `size` bytes
+    void  (*free)(void *ctx, void *ptr, size_t size);
+    // User data passed to every call
+    void  *ctx;
+} StrAllocator;
+
+// Maximum number of allocators registered at the same time (including the default
+// malloc-based one). An allocator is registered the first time it is passed to any
+// function and stays registered until str_allocator_release(). Registering more
+// aborts the program.
+#define STR_MAX_ALLOCATORS 16
+
+// Sets the global allocator used by all allocating functions.
+// Passing NULL restores the default (malloc/realloc/free).
+// Heap strings and the objects of the other modules remember the allocator they were
+// created with, so the allocator can be changed while they are alive, but it must
+// outlive all of them.
+void str_set_allocator(const StrAllocator *alloc);
+
+// Returns the global allocator
+const StrAllocator *str_get_allocator(void);
+
+// Unregisters the given allocator, freeing its slot for another one (e.g. before
+// a per-request arena is destroyed or a stack-allocated allocator goes out of scope).
+// Nothing allocated with it may be used or freed afterwards. If it is the global
+// allocator, the default one becomes global.
+void str_allocator_release(const StrAllocator *alloc);
+
+// Returns the slot of the given allocator (the global one if NULL), registering it
+// if necessary. Objects owning auxiliary buffers record it at creation.
+unsigned str_allocator_slot(const StrAllocator *alloc);
+
+// Allocates, resizes and frees auxiliary memory with the global allocator
+void *str_mem_alloc(size_t size);
+void *str_mem_realloc(void *ptr, size_t old_size, size_t new_size);
+void  str_mem_free(void *ptr, size_t size);
+
+// Same as above, with the allocator of the given slot (see str_allocator_slot())
+void *str_mem_alloc_with(unsigned slot, size_t size);
+void *str_mem_realloc_with(unsigned slot, void *ptr, size_t old_size, size_t new_size);
+void  str_mem_free_with(unsigned slot, void *ptr, size_t size);
+
+// All functions may be called concurrently from different threads on different
+// strings. Allocator registration, the instrumentation counters and the caches
+// below need no external locking.
+
+// Maximum number of freed buffers kept per size class and thread
+#define STR_CACHE_DEPTH 32
+
+// Enables or disables the per-thread buffer caches (enabled by default).
+// Freed buffers of the default allocator sized 128 B to 4 KiB (see str_bufsz())
+// are kept in a free list of the freeing thread and reused by its next allocation
+// of the same size. Disabling the caches does not release the buffers already cached.
+void str_cache_enable(bool enable);
+
+// Releases the buffers cached by the calling thread.
+// Done automatically when a thread or the program exits.
+void str_cache_flush(void);
+
+// Library functions allocations are attributed to by the instrumentation
+typedef enum {
+    STR_SITE_NALLOC,        // str_nalloc(), str_alloc()
+    STR_SITE_CLONE,         // str_clone()
+    STR_SITE_FREAD,         // fread_str()
+    STR_SITE_FDEBUG,        // str_debug(), str_fdebug()
+    STR_SITE_FMT,           // str_fmt()
+    STR_SITE_PUSHF,         // str_pushf(), str_vpushf()
+    STR_SITE_FREE,          // str_free(), cstr_free()
+    STR_SITE_CSTR,          // cstr()
+    STR_SITE_SLICE,         // str_slice()
+    STR_SITE_ESCAPE,        // str_escape()
+    STR_SITE_PUSH,          // str_push()
+    STR_SITE_PUSHS,         // str_pushs()
+    STR_SITE_POPN,          // str_popn()
+    STR_SITE_INSERT,        // str_insert()
+    STR_SITE_INSERTS,       // str_inserts()
+    STR_SITE_REPLACE_SLICE, // str_replace_slice()
+    STR_SITE_REPLACE,       // str_replace()
+    STR_SITE_RESERVE,       // str_reserve()
+    STR_SITE_SHARE,         // str_make_shared()
+    STR_SITE_OTHER,         // everything else (auxiliary buffers, other modules)
+    STR_SITE_COUNT,
+    // Totals over all sites (only for str_alloc_stats())
+    STR_SITE_ALL = STR_SITE_COUNT,
+} StrAllocSite;
+
+// Allocation counters
+typedef struct {
+    size_t allocs;   // number of allocations
+    size_t reallocs; // number of reallocations
+    size_t frees;    // number of frees
+    size_t bytes;    // bytes allocated (including growth by reallocation)
+    size_t in_use;   // bytes allocated and not freed yet (only for STR_SITE_ALL)
+    size_t peak;     // highest number of bytes in use reached by an allocation from this site
+} StrAllocStats;
+
+// Enables or disables counting of allocations (disabled by default).
+// Allocations are attributed to the outermost library function that caused them,
+// e.g. buffer growth inside str_escape() counts towards STR_SITE_ESCAPE.
+void str_alloc_stats_enable(bool enable);
+
+// Resets all allocation counters to zero
+// (not atomic as a whole, call it while no other thread allocates).
+// Only allocations made while counting is enabled are in use: buffers allocated
+// before a reset or while counting was disabled are not, and freeing them does
+// not bring `in_use` below zero.
+void str_alloc_stats_reset(void);
+
+// Returns the allocation counters of the given site or STR_SITE_ALL
+StrAllocStats str_alloc_stats(StrAllocSite site);
+
+// Returns the name of the given site
+const char *str_alloc_site_name(StrAllocSite site);
+
+// Prints the allocation counters of all sites with at least one allocation
+void str_alloc_stats_fdump(FILE *f);
+
 /* * * * * * * CREATION * * * * * * */
 
 // Creates a string by directly referencing the given string with the
@@ -33,6 +172,7 @@ String str_nref(const char *str, size_t len);
 String str_ref(const char *str);
 
 // Allocates a string with the bytes of the given string and the given byte length.
+// If `str` is NULL, the bytes are left uninitialized for the caller to write.
 // Requires str_free()
 String str_nalloc(const char *str, size_t len);
 
@@ -41,14 +181,36 @@ String str_nalloc(const char *str, size_t len);
 String str_alloc(const char *str);
 
 // Allocates a copy of the given string on the heap
+// If the string is shared (see str_make_shared()), the buffer is shared instead.
 // Requires str_free()
 String str_clone(String str);
 
+// Moves the string into a reference-counted buffer (copying it once), so that
+// str_clone() only increments the count instead of copying the whole string.
+// The mutation functions copy the buffer first if it is shared with another clone,
+// and str_free() releases the buffer when the last clone is freed.
+// The count is updated atomically, so clones can be freed from different threads.
+void str_make_shared(String *str);
+
+// Returns the number of clones sharing the buffer of the given string
+// (1 for a heap string that is not shared, 0 for a reference)
+size_t str_refcount(String str);
+
+// Same as str_nalloc(), str_alloc() and str_clone(), but allocate the buffer
+// with the given allocator instead of the global one (NULL for the global one).
+// The string keeps using the allocator when mutated and freed.
+String str_nalloc_with(const StrAllocator *alloc, const char *str, size_t len);
+String str_alloc_with(const StrAllocator *alloc, const char *str);
+String str_clone_with(const StrAllocator *alloc, String str);
+
 /* * * * * * * Input/Output * * * * * * */
 
 // Reads the entire contents of the file into a new heap-allocated string
 String fread_str(FILE *);
 
+// Same as fread_str(), but allocates with the given allocator (NULL for the global one)
+String fread_str_with(const StrAllocator *alloc, FILE *);
+
 /* * * * * * * PRINTING * * * * * * */
 
 #define BYTE_BIN_FMT "%c%c%c%c%c%c%c%c"
@@ -74,6 +236,15 @@ void str_fdebug(FILE *f, String str);
 // Creates a dynamically allocated string using sprintf
 String str_fmt(const char *fmt, ...);
 
+// Appends sprintf-formatted output to the given heap-allocated string.
+// Formats directly into the spare buffer capacity and only grows the buffer
+// (and formats a second time) if the output does not fit.
+// Views and invalid strings are reported on stderr and left unchanged.
+void str_pushf(String *str, const char *fmt, ...);
+
+// Same as str_pushf(), but takes a va_list
+void str_vpushf(String *str, const char *fmt, va_list args);
+
 /* * * * * * * CONSUMPTION * * * * * * */
 
 // Frees the buffer allocated for the given string
@@ -81,10 +252,25 @@ String str_fmt(const char *fmt, ...);
 void str_free(String *str);
 
 // Converts the string into a nul-terminated string.
-// The string buffer gets allocated on the heap
+// The string buffer gets allocated on the heap with the global allocator
 // (unless string is luckily already nul-terminated)
+// Requires cstr_free() (or free() if using the default allocator)
 char *cstr(String str);
 
+// Frees a string returned by cstr(), through the current global allocator.
+// The global allocator must not have changed since cstr(), and the string must not
+// contain nul bytes (its size is taken from strlen()): use cstr_with() otherwise.
+void cstr_free(char *str);
+
+// Same as cstr(), with the given allocator (the global one if NULL).
+// The buffer records its allocator and size, so the string may contain nul bytes and
+// outlive a change of the global allocator.
+// Requires cstr_with_free(), not free(): the buffer starts with a header
+char *cstr_with(const StrAllocator *alloc, String str);
+
+// Frees a string returned by cstr_with(), through the allocator it was allocated with
+void cstr_with_free(char *str);
+
 /* * * * * * * TRANSFORMATION * * * * * * */
 
 // Creates a string by taking a slice of the given string (by reference).
@@ -164,6 +350,12 @@ typedef enum {
 // Returns the number of replaced occurences
 int str_replace(String pat, String repl, String *str, StrReplaceFlags flags);
 
+// Grows the buffer of the given heap-allocated string so that it can hold at least
+// `cap` bytes without reallocating. The spare capacity is `str->bufsz - str->len`
+// and can be written to (a shared buffer gets copied first).
+// Views and invalid strings are reported on stderr and left unchanged.
+void str_reserve(size_t cap, String *str);
+
 /* * * * * * * INSPECTION * * * * * * */
 
 // Returns true if the two strings are equal and false otherwise
@@ -197,4 +389,72 @@ bool str_startswith(String prefix, String str);
 // Tells whether the given string ends with the given suffix
 bool str_endswith(String suffix, String str);
 
+/* * * * * * * CHARACTER CLASSES * * * * * * */
+
+// Classes of ASCII bytes, as in the "C" locale. Bytes 0x80-0xFF belong to none.
+typedef enum {
+    STR_CLASS_UPPER  = 0x1,
+    STR_CLASS_LOWER  = 0x2,
+    STR_CLASS_DIGIT  = 0x4,
+    STR_CLASS_XDIGIT = 0x8,
+    STR_CLASS_SPACE  = 0x10, // ' ', '\t', '\n', '\v', '\f', '\r'
+    STR_CLASS_PUNCT  = 0x20,
+    STR_CLASS_CNTRL  = 0x40,
+    STR_CLASS_PRINT  = 0x80, // graphic characters and ' '
+    STR_CLASS_ALPHA  = STR_CLASS_UPPER | STR_CLASS_LOWER,
+    STR_CLASS_ALNUM  = STR_CLASS_ALPHA | STR_CLASS_DIGIT,
+    STR_CLASS_GRAPH  = STR_CLASS_ALNUM | STR_CLASS_PUNCT,
+} StrCharClass;
+
+// Classes of every byte
+extern const uint8_t STR_CHAR_CLASSES[0x100];
+
+// Tells whether the byte belongs to any of the given classes.
+// A locale-independent replacement for the <ctype.h> functions, e.g.
+// str_isclass(c, STR_CLASS_ALNUM) instead of isalnum(c).
+static inline bool str_isclass(char c, StrCharClass classes) {
+    return STR_CHAR_CLASSES[(unsigned char)c] & classes;
+}
+
+/* * * * * * * VIEWS * * * * * * */
+
+// Views are meant for arrays of slices (e.g. tokenizer outputs) and for inspection
+// in hot loops, where the 16 bytes of a StrView instead of the 32 of a String halve
+// the memory and cache footprint. The String inspection functions above are thin
+// wrappers over the view ones.
+
+// Creates a view of the given string (the string must outlive the view)
+StrView strview(String str);
+
+// Creates a view of the given bytes with the specified byte length
+StrView strview_nref(const char *str, size_t len);
+
+// Creates a view of the given nul-terminated string
+StrView strview_ref(const char *str);
+
+// Creates a string referencing the bytes of the view (see str_nref())
+String str_from_view(StrView view);
+
+// Allocates a string with a copy of the bytes of the view.
+// Requires str_free()
+String str_alloc_view(StrView view);
+
+// Same as str_slice_ref(), str_strip() and str_split(), for views
+StrView strview_slice(StrView str, size_t offset, size_t len);
+StrView strview_strip(const char *chs, StrView str, StrStripFlags flags, int *out);
+bool    strview_split(StrView str, StrView delim, StrView *out);
+
+// Splits the string by the given delimiter like strview_split() and writes up to `cap`
+// portions to `out`. Returns the total number of portions, which may exceed `cap`.
+size_t strview_split_all(StrView str, StrView delim, StrView *out, size_t cap);
+
+// Same as the inspection functions above, for views
+bool strview_eq(StrView a, StrView b);
+int  strview_lpos(StrView needle, StrView haystack, size_t offset);
+int  strview_rpos(StrView needle, StrView haystack, size_t offset);
+int  strview_count(char c, StrView str);
+int  strview_counts(StrView needle, StrView haystack, StrCountFlags flags);
+bool strview_startswith(StrView prefix, StrView str);
+bool strview_endswith(StrView suffix, StrView str);
+
 #endif // _STRUTILS_H
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <ctype.h>
 
 #include "unit.h"
 #include "strutils.h"
@@ -18,6 +20,88 @@
 
 #define STR_MIN_BUFSZ 0x80
 
+// Allocator counting live allocations in its context
+static void *counting_alloc(void *ctx, size_t size) {
+    (*(int *)ctx)++;
+    return malloc(size);
+}
+
+static void *counting_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)ctx; (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+    (void)size;
+    (*(int *)ctx)--;
+    free(ptr);
+}
+
+static StrAllocator counting_allocator(int *live) {
+    return (StrAllocator){
+        .alloc   = counting_alloc,
+        .realloc = counting_realloc,
+        .free    = counting_free,
+        .ctx     = live,
+    };
+}
+
+#define STRESS_THREADS 8
+#define STRESS_ROUNDS  2000
+
+static String stress_shared;
+
+// Created after the cache key, so its destructor runs after the cache was flushed
+static pthread_key_t stress_exit_key;
+
+// Frees strings at thread exit, after the cache of the thread was destroyed
+static void stress_exit(void *arg) {
+    String *s = arg;
+    str_free(s);
+    free(s);
+
+    String late = str_alloc("late");
+    str_free(&late);
+}
+
+// Allocates, grows, escapes, clones and frees strings of every size class,
+// also through a private allocator registered concurrently with the other threads.
+// Returns the number of wrong results.
+static void *stress_worker(void *arg) {
+    size_t errors = 0;
+    int live = 0;
+    StrAllocator counting = counting_allocator(&live);
+    unsigned seed = (unsigned)(size_t)arg;
+
+    for (size_t round = 0; round < STRESS_ROUNDS; round++) {
+        size_t len = rand_r(&seed) % 5000;
+
+        String s = round % 2 ? str_alloc("") : str_alloc_with(&counting, "");
+        for (size_t i = 0; i < len; i++) str_push('a' + i % 26, &s);
+        errors += s.len != len || (len && s.str[len - 1] != (char)('a' + (len - 1) % 26));
+
+        String esc = str_escape(str_ref("\t\x01\""));
+        errors += !str_eq(esc, str_ref("\\t\\x01\\\""));
+
+        String clone = str_clone(stress_shared);
+        errors += clone.str != stress_shared.str || !str_eq(clone, str_ref("shared"));
+
+        str_free(&clone);
+        str_free(&esc);
+        str_free(&s);
+    }
+
+    str_cache_flush();
+    str_allocator_release(&counting);
+    errors += live != 0;
+
+    String *at_exit = malloc(sizeof *at_exit);
+    *at_exit = str_alloc("freed at exit");
+    pthread_setspecific(stress_exit_key, at_exit);
+
+    return (void *)errors;
+}
+
 int main() {
     const char *s1 = "Hello, world!";
     const char *s2 = "Hello";
@@ -41,6 +125,11 @@ int main() {
 
         assert_eq(-1, (int)str_lpos(str_ref("love"), str1, 0), "%d");
         assert_eq(3,  (int)str_lpos(str_ref("lo"), str1, 0), "%d");
+
+        // Slices are not nul-terminated: nothing past their length may match
+        assert_eq(-1, (int)str_lpos(str_ref("lo"), str_nref("hello", 4), 0), "%d");
+        assert_eq(0,  (int)str_lpos(str_nref("hello", 2), str_ref("help"), 0), "%d");
+        assert_eq(-1, (int)str_lpos(str_nref("lol", 3), str_nref("lolly", 2), 0), "%d");
     });
 
     test("str_rpos", {
@@ -67,6 +156,29 @@ int main() {
         str_free(&str5);
     });
 
+    test("cstr_with", {
+        int live = 0;
+        StrAllocator counting = counting_allocator(&live);
+
+        // Embedded nul bytes, freed after changing the global allocator
+        char *c = cstr_with(&counting, str_nref("a\0b\0c", 5));
+        assert_eq(1, live, "%d");
+        assert(!memcmp(c, "a\0b\0c", 6));
+
+        str_set_allocator(&counting);
+        char *g = cstr_with(NULL, str_ref("global"));
+        str_set_allocator(NULL);
+        assert_eq(2, live, "%d");
+        assert_streq("global", g);
+
+        cstr_with_free(c);
+        cstr_with_free(g);
+        assert_eq(0, live, "%d");
+
+        cstr_with_free(NULL);
+        str_allocator_release(&counting);
+    });
+
     test("str_slice", {
         String slice = str_slice(str1, 0, 5);
         assert_string_eq(str_ref("Hello"), str_slice_ref(str1, 0, 5));
@@ -134,6 +246,25 @@ int main() {
                          str_ref("Hello, world!"));
     });
 
+    test("str_pushf", {
+        String str = str_alloc("x");
+
+        str_pushf(&str, "%d-%s", 42, "foo");
+        assert_string_eq(str_ref("x42-foo"), str);
+
+        // Output larger than the spare capacity
+        str_pushf(&str, "%300s", "");
+        assert_eq((size_t)307, str.len, "%zu");
+        assert_eq((size_t)STR_MIN_BUFSZ * 4, str.bufsz, "%zu");
+
+        str_free(&str);
+
+        // Views are not written to
+        String view = str_ref("bar");
+        str_pushf(&view, "%d", 1);
+        assert_string_eq(str_ref("bar"), view);
+    });
+
     test("str_push", {
         String str = str_alloc("Hello, wor");
         String clone = str_clone(str);
@@ -290,6 +421,26 @@ int main() {
         str_free(&str);
     });
 
+    test("str_reserve", {
+        String str = str_alloc("foo");
+
+        str_reserve(1000, &str);
+        assert(str.bufsz >= 1000);
+        assert_string_eq(str_ref("foo"), str);
+
+        size_t bufsz = str.bufsz;
+        str_reserve(10, &str);
+        assert_eq(bufsz, str.bufsz, "%zu");
+
+        str_free(&str);
+
+        // Views are not grown
+        String view = str_ref("bar");
+        str_reserve(1000, &view);
+        assert_eq((size_t)0, view.bufsz, "%zu");
+        assert_string_eq(str_ref("bar"), view);
+    });
+
     String to_strip = str_ref(" . foo bar . ");
 
     test("str_strip (none)", {
@@ -333,6 +484,69 @@ int main() {
         assert(!str_split(to_split, delim, &out));
     });
 
+    test("str_isclass", {
+        // Same classes as <ctype.h> in the "C" locale
+        size_t mismatches = 0;
+        for (int c = 0; c < 0x100; c++) {
+            mismatches += str_isclass(c, STR_CLASS_UPPER)  != !!isupper(c);
+            mismatches += str_isclass(c, STR_CLASS_LOWER)  != !!islower(c);
+            mismatches += str_isclass(c, STR_CLASS_ALPHA)  != !!isalpha(c);
+            mismatches += str_isclass(c, STR_CLASS_DIGIT)  != !!isdigit(c);
+            mismatches += str_isclass(c, STR_CLASS_XDIGIT) != !!isxdigit(c);
+            mismatches += str_isclass(c, STR_CLASS_ALNUM)  != !!isalnum(c);
+            mismatches += str_isclass(c, STR_CLASS_SPACE)  != !!isspace(c);
+            mismatches += str_isclass(c, STR_CLASS_PUNCT)  != !!ispunct(c);
+            mismatches += str_isclass(c, STR_CLASS_CNTRL)  != !!iscntrl(c);
+            mismatches += str_isclass(c, STR_CLASS_PRINT)  != !!isprint(c);
+            mismatches += str_isclass(c, STR_CLASS_GRAPH)  != !!isgraph(c);
+        }
+        assert_eq((size_t)0, mismatches, "%zu");
+    });
+
+    test("StrView", {
+        assert_eq((size_t)16, sizeof(StrView), "%zu");
+
+        StrView view = strview(str1);
+        assert(view.str == str1.str);
+        assert_eq(str1.len, view.len, "%zu");
+        assert_string_eq(str1, str_from_view(view));
+
+        String copy = str_alloc_view(strview_slice(view, 7, 100));
+        assert_string_eq(str_ref("world!"), copy);
+        str_free(&copy);
+
+        assert(strview_eq(strview_slice(view, 0, 5), strview(str2)));
+        assert(!strview_eq(strview_nref("a\0b", 3), strview_nref("a\0c", 3)));
+        assert_eq(10, strview_lpos(strview_ref("l"), view, 4), "%d");
+        assert_eq(3,  strview_rpos(strview_ref("l"), view, 4), "%d");
+        assert_eq(-1, strview_rpos(strview_ref("l"), view, 100), "%d");
+        assert_eq(3,  strview_count('l', view), "%d");
+        assert_eq(0,  strview_counts(view, strview(str2), 0), "%d");
+        assert(strview_startswith(strview(str2), view));
+        assert(strview_endswith(strview_ref("!"), view));
+
+        int stripped;
+        view = strview_strip(" .", strview_ref(" . . "), STR_STRIP_LEFT | STR_STRIP_RIGHT, &stripped);
+        assert_eq((size_t)0, view.len, "%zu");
+        assert_eq(5, stripped, "%d");
+    });
+
+    test("strview_split_all", {
+        StrView parts[4];
+        StrView out = {0};
+        StrView text = strview_ref("foo, , bar, baz");
+        StrView delim = strview_ref(", ");
+
+        assert_eq((size_t)4, strview_split_all(text, delim, parts, 4), "%zu");
+        for (size_t i = 0; strview_split(text, delim, &out); i++)
+            assert(strview_eq(out, parts[i]));
+
+        assert_string_eq(str_ref("bar"), str_from_view(parts[2]));
+        assert_eq((size_t)4, strview_split_all(text, delim, parts, 1), "%zu");
+        assert_eq((size_t)1, strview_split_all(text, strview_ref("|"), parts, 4), "%zu");
+        assert_string_eq(str_from_view(text), str_from_view(parts[0]));
+    });
+
     test("str_escape", {
         String esc = str_escape(str_ref("Hello,\t\"world!\"\r\n"));
         assert_string_eq(str_ref("Hello,\\t\\\"world!\\\"\\r\\n"), esc);
@@ -343,6 +557,239 @@ int main() {
         str_free(&esc);
     });
 
+    test("str_set_allocator", {
+        int live = 0;
+        StrAllocator counting = counting_allocator(&live);
+
+        str_set_allocator(&counting);
+        assert(str_get_allocator() == &counting);
+
+        String a = str_alloc("foo");
+        char *c = cstr(a);
+        assert_eq(2, live, "%d");
+
+        str_set_allocator(NULL);
+
+        // Strings keep using the allocator they were created with
+        str_pushs(str_ref("bar"), &a);
+        str_free(&a);
+        assert_eq(1, live, "%d");
+
+        str_set_allocator(&counting);
+        cstr_free(c);
+        str_set_allocator(NULL);
+        assert_eq(0, live, "%d");
+        str_allocator_release(&counting);
+    });
+
+    test("str_allocator_release", {
+        int live = 0;
+        StrAllocator counting[STR_MAX_ALLOCATORS + 4];
+
+        // Released slots are reused, more allocators than slots can be used in turn
+        for (size_t i = 0; i < STR_MAX_ALLOCATORS + 4; i++) {
+            counting[i] = counting_allocator(&live);
+
+            String a = str_alloc_with(&counting[i], "arena");
+            assert_eq(str_allocator_slot(&counting[i]), a.alloc, "%u");
+            assert(a.alloc != 0);
+            assert_eq(1, live, "%d");
+
+            str_free(&a);
+            assert_eq(0, live, "%d");
+            str_allocator_release(&counting[i]);
+        }
+
+        // Releasing the global allocator restores the default one
+        str_set_allocator(&counting[0]);
+        str_allocator_release(&counting[0]);
+        assert(str_get_allocator() != &counting[0]);
+        assert_eq(0u, str_allocator_slot(NULL), "%u");
+
+        // Auxiliary buffers are freed with the allocator of their slot
+        unsigned slot = str_allocator_slot(&counting[1]);
+        void *mem = str_mem_alloc_with(slot, 64);
+        mem = str_mem_realloc_with(slot, mem, 64, 256);
+        assert_eq(1, live, "%d");
+        str_mem_free_with(slot, mem, 256);
+        assert_eq(0, live, "%d");
+        str_allocator_release(&counting[1]);
+    });
+
+    test("str_nalloc_with", {
+        int live = 0;
+        StrAllocator counting = counting_allocator(&live);
+
+        String a = str_nalloc_with(&counting, "foobar", 3);
+        String b = str_clone_with(&counting, a);
+        assert_eq(2, live, "%d");
+        assert_string_eq(str_ref("foo"), b);
+
+        str_replace_slice(0, 1, str_ref("b"), &a);
+        assert_eq(2, live, "%d");
+        assert_string_eq(str_ref("boo"), a);
+
+        str_free(&a);
+        str_free(&b);
+        assert_eq(0, live, "%d");
+        str_allocator_release(&counting);
+    });
+
+    test("str_make_shared", {
+        int live = 0;
+        StrAllocator counting = counting_allocator(&live);
+
+        String a = str_alloc_with(&counting, "payload");
+        str_make_shared(&a);
+        assert(a.flags & STR_SHARED);
+        assert_eq(1, live, "%d");
+
+        // Clones share the buffer
+        String b = str_clone(a);
+        String c = str_clone(a);
+        assert(b.str == a.str && c.str == a.str);
+        assert_eq((size_t)3, str_refcount(a), "%zu");
+        assert_eq(1, live, "%d");
+
+        // Mutating a clone copies the buffer
+        str_push('!', &b);
+        assert(b.str != a.str);
+        assert_string_eq(str_ref("payload!"), b);
+        assert_string_eq(str_ref("payload"), a);
+        assert_eq((size_t)2, str_refcount(a), "%zu");
+        assert_eq((size_t)1, str_refcount(b), "%zu");
+        assert_eq(2, live, "%d");
+
+        // A popped clone must not write over the others when pushed to
+        char ch;
+        str_pop(&c, &ch);
+        str_pushf(&c, "%s", "D");
+        assert_string_eq(str_ref("payloaD"), c);
+        assert_string_eq(str_ref("payload"), a);
+
+        // A buffer referenced once is mutated in place
+        char *buf = b.str;
+        str_inserts(str_ref(">"), 0, &b);
+        assert(b.str == buf);
+        str_replace_slice(0, 1, str_ref("<<"), &b);
+        assert(b.flags & STR_SHARED);
+        assert_string_eq(str_ref("<<payload!"), b);
+
+        str_free(&a);
+        str_free(&b);
+        str_free(&c);
+        assert_eq(0, live, "%d");
+        assert_eq((size_t)0, str_refcount(a), "%zu");
+        str_allocator_release(&counting);
+    });
+
+    test("str_alloc_stats", {
+        str_alloc_stats_reset();
+        str_alloc_stats_enable(true);
+
+        String str = str_alloc("");
+        for (size_t i = 0; i < STR_MIN_BUFSZ + 1; i++) str_push('#', &str);
+        String esc = str_escape(str_ref("\x01\x02"));
+
+        str_alloc_stats_enable(false);
+
+        StrAllocStats nalloc = str_alloc_stats(STR_SITE_NALLOC);
+        assert_eq((size_t)1, nalloc.allocs, "%zu");
+
+        StrAllocStats push = str_alloc_stats(STR_SITE_PUSH);
+        assert_eq((size_t)0, push.allocs, "%zu");
+        assert_eq((size_t)1, push.reallocs, "%zu");
+        assert_eq((size_t)STR_MIN_BUFSZ, push.bytes, "%zu");
+
+        // Buffer growth inside str_escape() is attributed to it
+        StrAllocStats escape = str_alloc_stats(STR_SITE_ESCAPE);
+        assert_eq((size_t)1, escape.allocs, "%zu");
+        assert_eq((size_t)0, escape.frees, "%zu");
+        assert_eq((size_t)0, str_alloc_stats(STR_SITE_FMT).allocs, "%zu");
+
+        StrAllocStats all = str_alloc_stats(STR_SITE_ALL);
+        assert_eq((size_t)STR_MIN_BUFSZ * 3, all.in_use, "%zu");
+        assert(all.peak >= all.in_use);
+
+        str_free(&str);
+        str_free(&esc);
+    });
+
+    test("str_alloc_stats (live allocations)", {
+        // Allocated before counting, freed while counting
+        String before = str_alloc("before");
+        str_alloc_stats_reset();
+        str_alloc_stats_enable(true);
+        str_free(&before);
+        assert_eq((size_t)0, str_alloc_stats(STR_SITE_ALL).in_use, "%zu");
+
+        str_alloc_stats_reset();
+        String after = str_alloc("after");
+        StrAllocStats all = str_alloc_stats(STR_SITE_ALL);
+        assert_eq(after.bufsz, all.in_use, "%zu");
+        assert_eq(after.bufsz, all.peak, "%zu");
+
+        // Allocated while counting, freed while not
+        str_alloc_stats_enable(false);
+        str_free(&after);
+        assert_eq((size_t)STR_MIN_BUFSZ, str_alloc_stats(STR_SITE_ALL).in_use, "%zu");
+
+        str_alloc_stats_reset();
+        all = str_alloc_stats(STR_SITE_ALL);
+        assert_eq((size_t)0, all.in_use, "%zu");
+        assert_eq((size_t)0, all.peak, "%zu");
+    });
+
+    test("thread safety", {
+        str_alloc_stats_reset();
+        str_alloc_stats_enable(true);
+        size_t in_use = str_alloc_stats(STR_SITE_ALL).in_use;
+
+        stress_shared = str_alloc("shared");
+        str_make_shared(&stress_shared);
+        pthread_key_create(&stress_exit_key, stress_exit);
+
+        pthread_t threads[STRESS_THREADS];
+        for (size_t i = 0; i < STRESS_THREADS; i++)
+            pthread_create(&threads[i], NULL, stress_worker, (void *)(i + 1));
+
+        size_t errors = 0;
+        for (size_t i = 0; i < STRESS_THREADS; i++) {
+            void *res;
+            pthread_join(threads[i], &res);
+            errors += (size_t)res;
+        }
+        assert_eq((size_t)0, errors, "%zu");
+        assert_eq((size_t)1, str_refcount(stress_shared), "%zu");
+
+        str_free(&stress_shared);
+        pthread_key_delete(stress_exit_key);
+        str_alloc_stats_enable(false);
+
+        // Every allocation of every thread was counted and freed
+        StrAllocStats all = str_alloc_stats(STR_SITE_ALL);
+        assert_eq(all.allocs, all.frees, "%zu");
+        assert_eq(in_use, all.in_use, "%zu");
+        assert(all.allocs >= (size_t)STRESS_THREADS * STRESS_ROUNDS * 2);
+    });
+
+    test("str_cache_flush", {
+        // A freed buffer is reused by the next allocation of its size
+        String a = str_alloc("cached");
+        char *buf = a.str;
+        str_free(&a);
+        String b = str_alloc("reused");
+        assert(b.str == buf);
+        str_free(&b);
+
+        str_cache_enable(false);
+        String c = str_alloc("uncached");
+        str_free(&c);
+        str_cache_enable(true);
+
+        str_cache_flush();
+    });
+
     test("fread_str", {
         FILE *f = fopen("test.txt", "r");
         String contents = fread_str(f);
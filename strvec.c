@@ -0,0 +1,215 @@
+#define _GNU_SOURCE
+#include "strvec.h"
+
+#include <string.h>
+
+/* * * * * * * Private Utilities * * * * * * */
+
+static inline size_t str_len_at(const StrVec *vec, size_t i) {
+    return vec->offsets[i + 1] - vec->offsets[i];
+}
+
+// Picks the allocator of a zero-initialized table before its first allocation
+static inline void pick_alloc(StrVec *vec) {
+    if (!vec->data && !vec->offsets) vec->alloc = str_allocator_slot(NULL);
+}
+
+static void grow_data(StrVec *vec, size_t need) {
+    if (vec->len + need <= vec->cap) return;
+    pick_alloc(vec);
+
+    size_t cap = vec->cap ? vec->cap * 2 : 256;
+    if (cap < vec->len + need) cap = vec->len + need;
+
+    vec->data = str_mem_realloc_with(vec->alloc, vec->data, vec->cap, cap);
+    vec->cap = cap;
+}
+
+static void grow_offsets(StrVec *vec) {
+    if (vec->offsets && vec->count < vec->ocap) return;
+
+    size_t cap = vec->ocap ? vec->ocap * 2 : 32;
+    pick_alloc(vec);
+
+    if (!vec->offsets) {
+        // Zero-initialized table
+        vec->offsets = str_mem_alloc_with(vec->alloc, (cap + 1) * sizeof *vec->offsets);
+        vec->offsets[0] = 0;
+    } else {
+        vec->offsets = str_mem_realloc_with(vec->alloc, vec->offsets,
+                                            (vec->ocap + 1) * sizeof *vec->offsets,
+                                            (cap + 1) * sizeof *vec->offsets);
+    }
+    vec->ocap = cap;
+}
+
+// Matches the needle against the strings from index `from` on, stopping after
+// `limit` matches. Sets the bits of the matches in `bits` (if not NULL) and writes
+// the index of the last match to `last`. Returns the number of matches.
+static size_t scan(const StrVec *vec, String needle, StrVecMatch match, size_t from,
+                   size_t limit, uint64_t *bits, size_t *last) {
+    const size_t *off = vec->offsets;
+    size_t found = 0;
+
+#define HIT(k) do { \
+        if (bits) bits[(k) / 64] |= 1ull << ((k) % 64); \
+        *last = (k); \
+        if (++found == limit) return found; \
+    } while (0)
+
+    if (match == STR_VEC_CONTAINS && needle.len) {
+        // Search the whole buffer, skipping matches spanning two strings
+        size_t k = from, pos = off[from];
+
+        while (k < vec->count && vec->len - pos >= needle.len) {
+            const char *hit = memmem(vec->data + pos, vec->len - pos, needle.str, needle.len);
+            if (!hit) break;
+
+            size_t p = hit - vec->data;
+            while (off[k + 1] <= p) k++;
+
+            if (p + needle.len <= off[k + 1]) {
+                HIT(k);
+                pos = off[++k];
+            } else {
+                pos = p + 1;
+            }
+        }
+
+        return found;
+    }
+
+    for (size_t k = from; k < vec->count; k++) {
+        size_t len = str_len_at(vec, k);
+
+        if (match == STR_VEC_EQUAL ? len != needle.len : len < needle.len) continue;
+        // The buffer is still NULL if all the strings pushed so far are empty
+        if (!needle.len || !memcmp(vec->data + off[k], needle.str, needle.len)) HIT(k);
+    }
+
+#undef HIT
+
+    return found;
+}
+
+/* * * * * * * Table * * * * * * */
+
+StrVec strvec_new(size_t count, size_t bytes) {
+    StrVec vec = {0};
+
+    vec.alloc = str_allocator_slot(NULL);
+    vec.ocap = count;
+    vec.offsets = str_mem_alloc_with(vec.alloc, (count + 1) * sizeof *vec.offsets);
+    vec.offsets[0] = 0;
+
+    if (bytes) {
+        vec.data = str_mem_alloc_with(vec.alloc, bytes);
+        vec.cap = bytes;
+    }
+
+    return vec;
+}
+
+void strvec_free(StrVec *vec) {
+    str_mem_free_with(vec->alloc, vec->data, vec->cap);
+    str_mem_free_with(vec->alloc, vec->offsets, (vec->ocap + 1) * sizeof *vec->offsets);
+    memset(vec, 0, sizeof *vec);
+}
+
+void strvec_clear(StrVec *vec) {
+    vec->len = 0;
+    vec->count = 0;
+}
+
+size_t strvec_push(String str, StrVec *vec) {
+    // The string may point into the buffer about to be reallocated
+    uintptr_t p = (uintptr_t)str.str, base = (uintptr_t)vec->data;
+    bool inner = vec->data && p >= base && p < base + vec->len;
+
+    grow_data(vec, str.len);
+    grow_offsets(vec);
+
+    if (inner) str.str = vec->data + (p - base);
+
+    if (str.len) memcpy(vec->data + vec->len, str.str, str.len);
+    vec->len += str.len;
+    vec->offsets[++vec->count] = vec->len;
+
+    return vec->count - 1;
+}
+
+size_t strvec_len(const StrVec *vec) {
+    return vec->count;
+}
+
+String strvec_get(const StrVec *vec, size_t i) {
+    if (i >= vec->count) return str_nref(vec->data, 0);
+    return str_nref(vec->data + vec->offsets[i], str_len_at(vec, i));
+}
+
+bool strvec_next(const StrVec *vec, size_t *i, String *out) {
+    if (*i >= vec->count) return false;
+
+    *out = strvec_get(vec, *i);
+    (*i)++;
+    return true;
+}
+
+/* * * * * * * Bulk operations * * * * * * */
+
+size_t strvec_find(const StrVec *vec, String needle, StrVecMatch match, size_t from) {
+    size_t last = STR_VEC_NONE;
+    if (from >= vec->count) return last;
+
+    scan(vec, needle, match, from, 1, NULL, &last);
+    return last;
+}
+
+size_t strvec_count(const StrVec *vec, String needle, StrVecMatch match) {
+    size_t last;
+    if (!vec->count) return 0;
+
+    return scan(vec, needle, match, 0, SIZE_MAX, NULL, &last);
+}
+
+size_t strvec_match(const StrVec *vec, String needle, StrVecMatch match, uint64_t *bits) {
+    size_t last;
+    memset(bits, 0, (vec->count + 63) / 64 * sizeof *bits);
+    if (!vec->count) return 0;
+
+    return scan(vec, needle, match, 0, SIZE_MAX, bits, &last);
+}
+
+// Multiply-xorshift over 8-byte words
+static inline uint64_t hash_bytes(const char *s, size_t len) {
+    const uint64_t K = 0xFF51AFD7ED558CCDull;
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ (len * K);
+    size_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, s + i, 8);
+        h = (h ^ w) * K;
+        h ^= h >> 32;
+    }
+
+    if (i < len) {
+        uint64_t w = 0;
+        memcpy(&w, s + i, len - i);
+        h = (h ^ w) * K;
+    }
+
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+void strvec_hash(const StrVec *vec, uint64_t *out) {
+    for (size_t k = 0; k < vec->count; k++)
+        out[k] = hash_bytes(vec->data + vec->offsets[k], str_len_at(vec, k));
+}
+
+uint64_t strvec_hash_str(String str) {
+    return hash_bytes(str.str, str.len);
+}
@@ -0,0 +1,84 @@
+#ifndef _STRVEC_H
+#define _STRVEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "strutils.h"
+
+// Index returned when no string matches
+#define STR_VEC_NONE SIZE_MAX
+
+// Table of strings stored column-wise: the bytes of all strings back to back
+// in a single buffer, and their start offsets in a separate array.
+// Costs 8 bytes per string on top of the bytes themselves.
+typedef struct {
+    char   *data;    // bytes of all strings (without terminators)
+    size_t  len;     // number of bytes used
+    size_t  cap;
+    size_t *offsets; // start offset of every string followed by `len` (count + 1 entries)
+    size_t  count;   // number of strings
+    size_t  ocap;    // capacity of `offsets` in strings
+    unsigned alloc;  // allocator slot of both buffers
+} StrVec;
+
+// How strings are compared to the needle by the bulk operations
+typedef enum {
+    // Strings equal to the needle
+    STR_VEC_EQUAL,
+    // Strings starting with the needle
+    STR_VEC_PREFIX,
+    // Strings containing the needle (searched over the whole buffer at once)
+    STR_VEC_CONTAINS,
+} StrVecMatch;
+
+// Creates an empty table with room for `count` strings and `bytes` bytes
+// (a zero-initialized table is empty as well).
+// The buffers are allocated with the global allocator at the time of the first allocation.
+// Requires strvec_free()
+StrVec strvec_new(size_t count, size_t bytes);
+
+// Frees the memory allocated for the table
+void strvec_free(StrVec *vec);
+
+// Removes all strings, keeping the allocated memory
+void strvec_clear(StrVec *vec);
+
+// Appends a copy of the string (which may be a string of the table itself)
+// and returns its index
+size_t strvec_push(String str, StrVec *vec);
+
+// Returns the number of strings in the table
+size_t strvec_len(const StrVec *vec);
+
+// Returns the string at the given index (by reference, valid until the next push).
+// Returns an empty string if out of bounds.
+String strvec_get(const StrVec *vec, size_t i);
+
+// Iterates over the strings: writes the string at `*i` to `out` and advances `i`.
+// Returns false past the last string. `*i` should start at 0.
+bool strvec_next(const StrVec *vec, size_t *i, String *out);
+
+/* * * * * * * Bulk operations * * * * * * */
+
+// Returns the index of the first string matching the needle at or after `from`,
+// or STR_VEC_NONE
+size_t strvec_find(const StrVec *vec, String needle, StrVecMatch match, size_t from);
+
+// Counts the strings matching the needle
+size_t strvec_count(const StrVec *vec, String needle, StrVecMatch match);
+
+// Compares every string to the needle, setting the bits of the matching strings
+// and clearing the others in `bits` ((count + 63) / 64 words).
+// Returns the number of matching strings.
+size_t strvec_match(const StrVec *vec, String needle, StrVecMatch match, uint64_t *bits);
+
+// Writes the hash of every string to `out` (count entries)
+void strvec_hash(const StrVec *vec, uint64_t *out);
+
+// Hash of a single string, as computed by strvec_hash()
+// (not stable across versions, do not persist)
+uint64_t strvec_hash_str(String str);
+
+#endif // _STRVEC_H
@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strvec.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+static const char *WORDS[] = { "apple", "", "banana", "app", "pineapple", "apple", "nab" };
+
+#define NWORDS (sizeof WORDS / sizeof *WORDS)
+
+static void *counting_alloc(void *ctx, size_t size) {
+    (*(int *)ctx)++;
+    return malloc(size);
+}
+
+static void *counting_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)old_size;
+    if (!ptr) (*(int *)ctx)++;
+    return realloc(ptr, new_size);
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+    (void)size;
+    (*(int *)ctx)--;
+    free(ptr);
+}
+
+static StrAllocator counting_allocator(int *live) {
+    return (StrAllocator){
+        .alloc   = counting_alloc,
+        .realloc = counting_realloc,
+        .free    = counting_free,
+        .ctx     = live,
+    };
+}
+
+// Checks the bulk operations against per-string comparisons on random words.
+// Returns the number of mismatches.
+static size_t check_random(size_t count) {
+    StrVec vec = {0};
+    char buf[8];
+
+    for (size_t i = 0; i < count; i++) {
+        size_t n = rand() % 6;
+        for (size_t k = 0; k < n; k++) buf[k] = 'a' + rand() % 3;
+        strvec_push(str_nref(buf, n), &vec);
+    }
+
+    size_t mismatches = 0;
+    uint64_t *bits = malloc((count + 63) / 64 * sizeof *bits);
+
+    for (size_t t = 0; t < 50; t++) {
+        size_t n = rand() % 4;
+        for (size_t k = 0; k < n; k++) buf[k] = 'a' + rand() % 3;
+        String needle = str_nref(buf, n);
+
+        for (StrVecMatch m = STR_VEC_EQUAL; m <= STR_VEC_CONTAINS; m++) {
+            size_t expected = 0, first = STR_VEC_NONE;
+
+            for (size_t i = 0; i < count; i++) {
+                String s = strvec_get(&vec, i);
+                bool hit = m == STR_VEC_EQUAL  ? s.len == n && !memcmp(s.str, buf, n)
+                         : m == STR_VEC_PREFIX ? s.len >= n && !memcmp(s.str, buf, n)
+                         : (!n || str_lpos(needle, s, 0) != -1);
+                if (hit && first == STR_VEC_NONE) first = i;
+                expected += hit;
+            }
+
+            mismatches += strvec_count(&vec, needle, m) != expected;
+            mismatches += strvec_match(&vec, needle, m, bits) != expected;
+            mismatches += strvec_find(&vec, needle, m, 0) != first;
+
+            if (first != STR_VEC_NONE)
+                mismatches += !(bits[first / 64] >> (first % 64) & 1);
+        }
+    }
+
+    free(bits);
+    strvec_free(&vec);
+    return mismatches;
+}
+
+int main() {
+    srand(42);
+
+    test("strvec_push", {
+        StrVec vec = strvec_new(2, 4);
+
+        for (size_t i = 0; i < NWORDS; i++)
+            assert_eq(i, strvec_push(str_ref(WORDS[i]), &vec), "%zu");
+
+        assert_eq(NWORDS, strvec_len(&vec), "%zu");
+        assert_string_eq(str_ref("banana"), strvec_get(&vec, 2));
+        assert_string_eq(str_ref(""), strvec_get(&vec, 1));
+        assert_string_eq(str_ref(""), strvec_get(&vec, NWORDS));
+
+        // Pushing a string of the table itself
+        strvec_push(strvec_get(&vec, 4), &vec);
+        assert_string_eq(str_ref("pineapple"), strvec_get(&vec, NWORDS));
+
+        strvec_clear(&vec);
+        assert_eq((size_t)0, strvec_len(&vec), "%zu");
+
+        strvec_free(&vec);
+    });
+
+    test("strvec_next", {
+        StrVec vec = {0};
+        for (size_t i = 0; i < NWORDS; i++) strvec_push(str_ref(WORDS[i]), &vec);
+
+        size_t i = 0;
+        size_t n = 0;
+        String s;
+        while (strvec_next(&vec, &i, &s)) {
+            assert_string_eq(str_ref(WORDS[n]), s);
+            n++;
+        }
+        assert_eq(NWORDS, n, "%zu");
+
+        strvec_free(&vec);
+    });
+
+    test("strvec_find", {
+        StrVec vec = {0};
+        for (size_t i = 0; i < NWORDS; i++) strvec_push(str_ref(WORDS[i]), &vec);
+
+        assert_eq((size_t)0, strvec_find(&vec, str_ref("apple"), STR_VEC_EQUAL, 0), "%zu");
+        assert_eq((size_t)5, strvec_find(&vec, str_ref("apple"), STR_VEC_EQUAL, 1), "%zu");
+        assert_eq((size_t)3, strvec_find(&vec, str_ref("app"), STR_VEC_PREFIX, 1), "%zu");
+        assert_eq((size_t)4, strvec_find(&vec, str_ref("eap"), STR_VEC_CONTAINS, 0), "%zu");
+        assert_eq(STR_VEC_NONE, strvec_find(&vec, str_ref("cherry"), STR_VEC_EQUAL, 0), "%zu");
+
+        // "app" + "pineapple" has "ppp" only across the boundary
+        assert_eq(STR_VEC_NONE, strvec_find(&vec, str_ref("ppp"), STR_VEC_CONTAINS, 0), "%zu");
+
+        strvec_free(&vec);
+    });
+
+    test("strvec_find (empty strings)", {
+        // No data buffer gets allocated for empty strings
+        StrVec vec = {0};
+        strvec_push(str_ref(""), &vec);
+        strvec_push(str_ref(""), &vec);
+
+        assert_eq((size_t)1, strvec_find(&vec, str_ref(""), STR_VEC_EQUAL, 1), "%zu");
+        assert_eq((size_t)0, strvec_find(&vec, str_ref(""), STR_VEC_PREFIX, 0), "%zu");
+        assert_eq((size_t)0, strvec_find(&vec, str_ref(""), STR_VEC_CONTAINS, 0), "%zu");
+        assert_eq(STR_VEC_NONE, strvec_find(&vec, str_ref("a"), STR_VEC_PREFIX, 0), "%zu");
+
+        strvec_free(&vec);
+    });
+
+    test("strvec_count", {
+        StrVec vec = {0};
+        for (size_t i = 0; i < NWORDS; i++) strvec_push(str_ref(WORDS[i]), &vec);
+
+        assert_eq((size_t)2, strvec_count(&vec, str_ref("apple"), STR_VEC_EQUAL), "%zu");
+        assert_eq((size_t)3, strvec_count(&vec, str_ref("app"), STR_VEC_PREFIX), "%zu");
+        assert_eq((size_t)3, strvec_count(&vec, str_ref("apple"), STR_VEC_CONTAINS), "%zu");
+        assert_eq((size_t)2, strvec_count(&vec, str_ref("na"), STR_VEC_CONTAINS), "%zu");
+        assert_eq((size_t)1, strvec_count(&vec, str_ref(""), STR_VEC_EQUAL), "%zu");
+        assert_eq(NWORDS, strvec_count(&vec, str_ref(""), STR_VEC_CONTAINS), "%zu");
+
+        uint64_t bits[1];
+        assert_eq((size_t)2, strvec_match(&vec, str_ref("apple"), STR_VEC_EQUAL, bits), "%zu");
+        assert_eq((uint64_t)0x21, bits[0], "%lu");
+
+        strvec_free(&vec);
+
+        assert_eq((size_t)0, check_random(1000), "%zu");
+    });
+
+    test("strvec_hash", {
+        StrVec vec = {0};
+        for (size_t i = 0; i < NWORDS; i++) strvec_push(str_ref(WORDS[i]), &vec);
+
+        uint64_t hashes[NWORDS];
+        strvec_hash(&vec, hashes);
+
+        assert_eq(hashes[0], hashes[5], "%lu");
+        assert(hashes[0] != hashes[3]);
+        assert_eq(strvec_hash_str(str_ref("banana")), hashes[2], "%lu");
+
+        strvec_free(&vec);
+    });
+
+    test("strvec_free (allocator)", {
+        int live = 0;
+        StrAllocator counting = counting_allocator(&live);
+
+        // The table keeps the allocator it was created with
+        str_set_allocator(&counting);
+        StrVec vec = {0};
+        strvec_push(str_ref("first"), &vec);
+        str_set_allocator(NULL);
+
+        for (size_t i = 0; i < 100; i++) strvec_push(str_ref(WORDS[i % NWORDS]), &vec);
+        assert_eq(2, live, "%d");
+
+        strvec_free(&vec);
+        assert_eq(0, live, "%d");
+        str_allocator_release(&counting);
+    });
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include "strwrite.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+/* * * * * * * Private Utilities * * * * * * */
+
+// Tells whether the last slice of the batch ends at the end of the used buffer
+static bool last_is_buf(const StrWriter *w) {
+    if (!w->niov) return false;
+    const struct iovec *last = &w->iov[w->niov - 1];
+    return (char *)last->iov_base + last->iov_len == w->buf + w->buflen;
+}
+
+// Reserves `len` bytes (at most STR_WRITER_BUFSZ) at the end of the buffer
+// and adds them to the batch. Returns a pointer to the reserved bytes.
+static char *reserve(size_t len, StrWriter *w) {
+    if (w->buflen + len > STR_WRITER_BUFSZ) str_writer_flush(w);
+
+    bool extend = last_is_buf(w);
+    if (!extend && w->niov == STR_WRITER_IOVS) {
+        str_writer_flush(w);
+        extend = false;
+    }
+
+    char *p = w->buf + w->buflen;
+    if (extend) {
+        w->iov[w->niov - 1].iov_len += len;
+    } else {
+        w->iov[w->niov++] = (struct iovec){ .iov_base = p, .iov_len = len };
+    }
+
+    w->buflen += len;
+    return p;
+}
+
+// Gives back the unused tail of the last reservation
+static void unreserve(size_t len, StrWriter *w) {
+    w->iov[w->niov - 1].iov_len -= len;
+    w->buflen -= len;
+    if (!w->iov[w->niov - 1].iov_len) w->niov--;
+}
+
+/* * * * * * * Writer * * * * * * */
+
+StrWriter str_writer_fd(int fd) {
+    StrWriter w;
+    w.fd       = fd;
+    w.file     = NULL;
+    w.buflen   = 0;
+    w.niov     = 0;
+    w.error    = 0;
+    w.syscalls = 0;
+    w.bytes    = 0;
+    return w;
+}
+
+StrWriter str_writer_file(FILE *f) {
+    StrWriter w = str_writer_fd(fileno(f));
+    w.file = f;
+    return w;
+}
+
+bool str_writer_flush(StrWriter *w) {
+    if (w->niov && !w->error) {
+        if (w->file) fflush(w->file);
+
+        struct iovec *iov = w->iov;
+        int cnt = w->niov;
+
+        while (cnt) {
+            ssize_t n = writev(w->fd, iov, cnt);
+            w->syscalls++;
+
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                w->error = errno;
+                break;
+            }
+
+            w->bytes += n;
+
+            // Skip the slices written completely and advance into a partial one
+            while (cnt && (size_t)n >= iov->iov_len) {
+                n -= iov->iov_len;
+                iov++;
+                cnt--;
+            }
+            if (cnt) {
+                iov->iov_base = (char *)iov->iov_base + n;
+                iov->iov_len -= n;
+            }
+        }
+    }
+
+    w->niov   = 0;
+    w->buflen = 0;
+    return !w->error;
+}
+
+void str_write(String str, StrWriter *w) {
+    if (str.len <= STR_WRITER_COPY_MAX) {
+        str_write_copy(str, w);
+        return;
+    }
+
+    if (w->niov == STR_WRITER_IOVS) str_writer_flush(w);
+    w->iov[w->niov++] = (struct iovec){ .iov_base = str.str, .iov_len = str.len };
+}
+
+void str_write_copy(String str, StrWriter *w) {
+    while (str.len) {
+        size_t n = str.len < STR_WRITER_BUFSZ ? str.len : STR_WRITER_BUFSZ;
+        memcpy(reserve(n, w), str.str, n);
+        str.str += n;
+        str.len -= n;
+    }
+}
+
+void str_write_char(char c, StrWriter *w) {
+    *reserve(1, w) = c;
+}
+
+/* * * * * * * Numbers * * * * * * */
+
+void str_write_int(int64_t value, StrWriter *w) {
+    char *p = reserve(STR_NUM_MAXLEN, w);
+    unreserve(STR_NUM_MAXLEN - fmt_int(p, value), w);
+}
+
+void str_write_uint(uint64_t value, StrWriter *w) {
+    char *p = reserve(STR_NUM_MAXLEN, w);
+    unreserve(STR_NUM_MAXLEN - fmt_uint(p, value), w);
+}
+
+void str_write_hex(uint64_t value, size_t width, StrHexFlags flags, StrWriter *w) {
+    char *p = reserve(STR_NUM_MAXLEN, w);
+    unreserve(STR_NUM_MAXLEN - fmt_hex(p, value, width, flags), w);
+}
+
+void str_write_double(double value, StrWriter *w) {
+    char *p = reserve(STR_NUM_MAXLEN, w);
+    unreserve(STR_NUM_MAXLEN - fmt_double(p, value), w);
+}
+
+/* * * * * * * Debugging * * * * * * */
+
+void str_write_debug(String str, StrWriter *w) {
+    String esc = str_escape(str);
+
+    str_write_copy(str_ref("String {\n  flags = "), w);
+    for (int bit = 7; bit >= 0; bit--) str_write_char(str.flags >> bit & 1 ? '1' : '0', w);
+
+    str_write_copy(str_ref(",\n  bufsz = "), w);
+    str_write_uint(str.bufsz, w);
+    str_write_copy(str_ref(",\n  len   = "), w);
+    str_write_uint(str.len, w);
+    str_write_copy(str_ref(",\n  str   = \""), w);
+    // The escaped string is freed before the next flush
+    str_write_copy(esc, w);
+    str_write_copy(str_ref("\"\n}\n"), w);
+
+    str_free(&esc);
+}
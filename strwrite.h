@@ -0,0 +1,66 @@
+#ifndef _STRWRITE_H
+#define _STRWRITE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/uio.h>
+
+#include "strutils.h"
+#include "strconv.h"
+
+// Size of the internal buffer small strings are copied into
+#define STR_WRITER_BUFSZ 4096
+// Maximum number of slices written by a single writev() call
+#define STR_WRITER_IOVS 64
+// Strings longer than this are not copied but referenced until the next flush
+#define STR_WRITER_COPY_MAX 256
+
+// Buffered writer over a file descriptor.
+// Collects strings into a batch of slices flushed with a single writev() call.
+// Small strings are copied into an internal buffer (adjacent ones share a slice),
+// large strings are referenced and must stay valid until the next flush.
+// The batch points into the writer itself, so it must not be copied while not empty.
+typedef struct {
+    int    fd;
+    FILE  *file;     // flushed before every write if the writer was made from a FILE*
+    size_t buflen;   // number of bytes used in `buf`
+    int    niov;     // number of slices in the batch
+    int    error;    // errno of the first failed write (further output is dropped)
+    size_t syscalls; // number of write system calls made
+    size_t bytes;    // number of bytes written
+    struct iovec iov[STR_WRITER_IOVS];
+    char   buf[STR_WRITER_BUFSZ];
+} StrWriter;
+
+// Creates a writer over the given file descriptor
+StrWriter str_writer_fd(int fd);
+
+// Creates a writer over the file descriptor of the given file.
+// Output buffered by the FILE itself is flushed first, so the two can be mixed.
+StrWriter str_writer_file(FILE *f);
+
+// Writes out the batch. Must be called before the writer goes out of scope.
+// Returns false if any write has failed (see `error`).
+bool str_writer_flush(StrWriter *w);
+
+// Appends a string to the batch
+void str_write(String str, StrWriter *w);
+
+// Appends a string to the batch, always copying it
+void str_write_copy(String str, StrWriter *w);
+
+// Appends a character to the batch
+void str_write_char(char c, StrWriter *w);
+
+// Append the representation of a number to the batch (see str_push_int() and co.)
+void str_write_int(int64_t value, StrWriter *w);
+void str_write_uint(uint64_t value, StrWriter *w);
+void str_write_hex(uint64_t value, size_t width, StrHexFlags flags, StrWriter *w);
+void str_write_double(double value, StrWriter *w);
+
+// Appends the same debug info as str_fdebug() to the batch
+void str_write_debug(String str, StrWriter *w);
+
+#endif // _STRWRITE_H
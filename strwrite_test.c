@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "unit.h"
+#include "strutils.h"
+#include "strwrite.h"
+
+#define assert_string_eq(a, b) \
+    assert_custom_eq(a, b, str_eq, STR_FMT, STR_FMT_ARGS);
+
+// Reads back everything written to the file
+static String read_back(FILE *f) {
+    fflush(f);
+    return fread_str(f);
+}
+
+int main() {
+    test("str_write", {
+        FILE *f = tmpfile();
+        StrWriter w = str_writer_file(f);
+
+        str_write(str_ref("Hello"), &w);
+        str_write_char(',', &w);
+        str_write(str_ref(" world"), &w);
+        str_write_char('\n', &w);
+        assert(str_writer_flush(&w));
+
+        String out = read_back(f);
+        assert_string_eq(str_ref("Hello, world\n"), out);
+        assert_eq((size_t)1, w.syscalls, "%zu");
+        assert_eq((size_t)13, w.bytes, "%zu");
+
+        str_free(&out);
+        fclose(f);
+    });
+
+    test("str_write (numbers)", {
+        FILE *f = tmpfile();
+        StrWriter w = str_writer_file(f);
+
+        str_write_int(-42, &w);
+        str_write_char(' ', &w);
+        str_write_uint(18446744073709551615ull, &w);
+        str_write_char(' ', &w);
+        str_write_hex(0xBEEF, 8, STR_HEX_UPPER, &w);
+        str_write_char(' ', &w);
+        str_write_double(0.1, &w);
+        str_write_char(' ', &w);
+        str_write_double(-INFINITY, &w);
+        str_writer_flush(&w);
+
+        String out = read_back(f);
+        assert_string_eq(str_ref("-42 18446744073709551615 0000BEEF 0.1 -inf"), out);
+
+        str_free(&out);
+        fclose(f);
+    });
+
+    test("str_write (batching)", {
+        FILE *f = tmpfile();
+        StrWriter w = str_writer_file(f);
+
+        // Small strings are copied: one syscall per full buffer
+        String expected = str_alloc("");
+        for (int i = 0; i < 1000; i++) {
+            str_write(str_ref("line\n"), &w);
+            str_pushs(str_ref("line\n"), &expected);
+        }
+        str_writer_flush(&w);
+        assert_eq((size_t)(5000 + STR_WRITER_BUFSZ - 1) / STR_WRITER_BUFSZ, w.syscalls, "%zu");
+
+        // Large strings are referenced: one syscall per full batch of slices
+        String big = str_alloc("");
+        for (int i = 0; i < STR_WRITER_COPY_MAX * 2; i++) str_push('a' + i % 26, &big);
+
+        w.syscalls = 0;
+        for (int i = 0; i < STR_WRITER_IOVS * 2; i++) {
+            str_write(big, &w);
+            str_pushs(big, &expected);
+        }
+        str_writer_flush(&w);
+        assert_eq((size_t)2, w.syscalls, "%zu");
+
+        String out = read_back(f);
+        assert_string_eq(expected, out);
+
+        str_free(&out);
+        str_free(&big);
+        str_free(&expected);
+        fclose(f);
+    });
+
+    test("str_write_debug", {
+        String str = str_alloc("foo\n\"bar\"");
+
+        FILE *a = tmpfile();
+        str_fdebug(a, str);
+        String expected = read_back(a);
+
+        FILE *b = tmpfile();
+        StrWriter w = str_writer_file(b);
+        str_write_debug(str, &w);
+        str_writer_flush(&w);
+        String out = read_back(b);
+
+        assert_string_eq(expected, out);
+
+        str_free(&expected);
+        str_free(&out);
+        str_free(&str);
+        fclose(a);
+        fclose(b);
+    });
+
+    test("str_writer_file (ordering)", {
+        FILE *f = tmpfile();
+        StrWriter w = str_writer_file(f);
+
+        fputs("stdio ", f);
+        str_write(str_ref("writer"), &w);
+        str_writer_flush(&w);
+
+        String out = read_back(f);
+        assert_string_eq(str_ref("stdio writer"), out);
+
+        str_free(&out);
+        fclose(f);
+    });
+}
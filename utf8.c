@@ -1,4 +1,9 @@
 #include "utf8.h"
+#include "strtrace.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 void utf8_decoder_init(utf8_Decoder *d) {
     d->state = 0;
@@ -26,6 +31,82 @@ bool utf8_decode(utf8_Decoder *d, char byte) {
     return !--d->state;
 }
 
+utf8_ChunkResult utf8_decode_chunk(utf8_Decoder *d, const char *in, size_t len,
+                                   uint32_t *out, size_t cap) {
+    STR_TRACE_SPAN(STR_TRACE_UTF8_DECODE, 0);
+
+    const unsigned char *s = (const unsigned char *)in;
+    size_t i = 0, n = 0;
+
+    // A sequence produces a single codepoint, so it can be started
+    // as long as there is room for one
+    while (i < len && n < cap) {
+        // Finish the sequence carried over from the previous chunk
+        // (or started by an unusual header below) byte by byte
+        if (d->state) {
+            while (i < len)
+                if (utf8_decode(d, s[i++])) {
+                    out[n++] = d->codepoint;
+                    break;
+                }
+            continue;
+        }
+
+#ifdef __SSE2__
+        // Widen runs of 16 ASCII bytes to codepoints
+        const __m128i zero = _mm_setzero_si128();
+
+        while (i + 16 <= len && n + 16 <= cap) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+            int mask = _mm_movemask_epi8(v);
+
+            if (mask) {
+                // Copy the ASCII bytes before the first non-ASCII one
+                for (int k = __builtin_ctz(mask); k--;) out[n++] = s[i++];
+                break;
+            }
+
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128((__m128i *)(out + n +  0), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(out + n +  4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(out + n +  8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i *)(out + n + 12), _mm_unpackhi_epi16(hi, zero));
+            i += 16;
+            n += 16;
+        }
+
+        if (i == len || n == cap) break;
+#endif
+
+        unsigned char c = s[i];
+
+        if (c < 0x80) {
+            out[n++] = c;
+            i++;
+            continue;
+        }
+
+        // Whole 2, 3 and 4 byte sequences are decoded at once
+        size_t size = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+
+        if (c >= 0xC0 && c < 0xF8 && i + size <= len) {
+            uint32_t cp = c & (0x7F >> size);
+            for (size_t k = 1; k < size; k++) cp = cp << 6 | (s[i + k] & 0x3F);
+
+            out[n++] = cp;
+            i += size;
+            continue;
+        }
+
+        // Incomplete sequence, stray continuation byte or unusual header
+        if (utf8_decode(d, s[i++])) out[n++] = d->codepoint;
+    }
+
+    STR_TRACE_BYTES(i);
+    return (utf8_ChunkResult){ .consumed = i, .produced = n };
+}
+
 char *utf8_encode(char *buffer, uint32_t codepoint) {
     // 7-bit ASCII bytes just get appended to the buffer
     if (codepoint < 0x80) {
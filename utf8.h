@@ -18,6 +18,20 @@ void utf8_decoder_init(utf8_Decoder *);
 // NOTE: Decoder has to be initialized to zero before decoding a new string!
 bool utf8_decode(utf8_Decoder *, char);
 
+// Number of bytes consumed and codepoints produced by utf8_decode_chunk
+typedef struct {
+    size_t consumed;
+    size_t produced;
+} utf8_ChunkResult;
+
+// Decodes a chunk of a utf8 stream into at most `cap` codepoints written to `out`.
+// An incomplete sequence at the end of the chunk is kept in the decoder and
+// completed by the next chunk. Stops early when `out` is full, in which case
+// fewer than `len` bytes are consumed. Decodes the same codepoints as calling
+// utf8_decode with every byte, with a vectorized path for runs of ASCII.
+utf8_ChunkResult utf8_decode_chunk(utf8_Decoder *, const char *in, size_t len,
+                                   uint32_t *out, size_t cap);
+
 // Encodes subsequent codepoints into utf8 and appends the resulting
 // bytes to the given buffer, returning pointers to memory in the buffer
 // after the appended bytes
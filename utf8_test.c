@@ -1,7 +1,82 @@
+#include <stdlib.h>
+#include <string.h>
+
 #include "unit.h"
 #include "utf8.h"
 
+static const char *WORDS[] = {
+    "plain ascii words that are long enough for the vector path ", "a", "ф", "😀",
+    "日本語", "naïve ", "\xC3", "\x80\x80", "\xF8\x88\x80\x80\x80", "\xFF",
+};
+
+// Decodes the bytes one at a time with utf8_decode
+static size_t decode_bytes(const char *s, size_t len, uint32_t *out) {
+    utf8_Decoder d;
+    utf8_decoder_init(&d);
+
+    size_t n = 0;
+    for (size_t i = 0; i < len; i++)
+        if (utf8_decode(&d, s[i])) out[n++] = d.codepoint;
+    return n;
+}
+
+// Decodes the bytes in chunks of random sizes into outputs of random capacities
+// and compares the codepoints to decode_bytes(). Returns the number of mismatches.
+static size_t check_chunks(const char *s, size_t len) {
+    uint32_t *want = malloc((len + 1) * sizeof *want);
+    uint32_t *got  = malloc((len + 1) * sizeof *got);
+    size_t nwant = decode_bytes(s, len, want);
+
+    utf8_Decoder d;
+    utf8_decoder_init(&d);
+    size_t i = 0, n = 0;
+
+    while (i < len) {
+        size_t chunk = 1 + rand() % 64;
+        if (chunk > len - i) chunk = len - i;
+        size_t cap = rand() % 40;
+        if (cap > len - n) cap = len - n;
+
+        utf8_ChunkResult res = utf8_decode_chunk(&d, s + i, chunk, got + n, cap);
+        i += res.consumed;
+        n += res.produced;
+    }
+
+    size_t mismatches = n != nwant || memcmp(got, want, n * sizeof *got);
+    free(want);
+    free(got);
+    return mismatches;
+}
+
+// Checks texts made of random words and random bytes.
+// Returns the number of mismatches.
+static size_t check_random(void) {
+    size_t mismatches = 0;
+    char buf[4096];
+
+    for (size_t t = 0; t < 200; t++) {
+        size_t len = 0;
+        bool bytes = t % 2;
+
+        while (len < sizeof buf - 64) {
+            if (bytes) {
+                buf[len++] = rand() % 3 ? rand() : 'x';
+            } else {
+                const char *w = WORDS[rand() % (sizeof WORDS / sizeof *WORDS)];
+                memcpy(buf + len, w, strlen(w));
+                len += strlen(w);
+            }
+        }
+
+        mismatches += check_chunks(buf, len);
+    }
+
+    return mismatches;
+}
+
 int main() {
+    srand(42);
+
     test("utf8_decode", {
         utf8_Decoder d;
 
@@ -16,6 +91,30 @@ int main() {
         assert_eq(d.codepoint, (int)'z', "%u");
     });
 
+    test("utf8_decode_chunk", {
+        utf8_Decoder d;
+        utf8_decoder_init(&d);
+        uint32_t out[32];
+
+        // "ф" split between two chunks
+        utf8_ChunkResult res = utf8_decode_chunk(&d, "ab\xD1", 3, out, 32);
+        assert_eq((size_t)3, res.consumed, "%zu");
+        assert_eq((size_t)2, res.produced, "%zu");
+        res = utf8_decode_chunk(&d, "\x84z", 2, out + 2, 30);
+        assert_eq((size_t)2, res.produced, "%zu");
+        assert_eq(0x444, out[2], "%u");
+        assert_eq((uint32_t)'z', out[3], "%u");
+
+        // Full output
+        const char *text = "0123456789abcdef😀😀";
+        res = utf8_decode_chunk(&d, text, strlen(text), out, 17);
+        assert_eq((size_t)20, res.consumed, "%zu");
+        assert_eq((size_t)17, res.produced, "%zu");
+        assert_eq(0x1F600, out[16], "%u");
+
+        assert_eq((size_t)0, check_random(), "%zu");
+    });
+
     test("utf8_encode", {
         char buf[9] = {0};
 